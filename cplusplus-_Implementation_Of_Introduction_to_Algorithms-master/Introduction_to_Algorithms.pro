@@ -41,6 +41,8 @@ HEADERS += \
     src/select_algorithms/good_select/goodselect_test.h \
     src/graph_algorithms/basic_graph/graph_representation/matrix_graph/matrixgraph.h \
     src/graph_algorithms/basic_graph/graph_representation/matrix_graph/matrixgraph_test.h \
+    src/graph_algorithms/basic_graph/graph_representation/bitset_graph/bitsetgraph.h \
+    src/graph_algorithms/basic_graph/graph_representation/bitset_graph/bitsetgraph_test.h \
     src/graph_algorithms/basic_graph/graph_representation/graph_vertex/vertex.h \
     src/graph_algorithms/basic_graph/graph_representation/graph_vertex/vertex_test.h \
     src/graph_algorithms/basic_graph/graph_representation/graph_edge/edge.h \
@@ -49,8 +51,27 @@ HEADERS += \
     src/graph_algorithms/basic_graph/graph_dfs/dfs_test.h \
     src/graph_algorithms/basic_graph/graph_bfs/bfs.h \
     src/graph_algorithms/basic_graph/graph_bfs/bfs_test.h \
+    src/graph_algorithms/basic_graph/graph_visitor/graphvisitor.h \
+    src/graph_algorithms/basic_graph/graph_visitor/graphvisitor_test.h \
+    src/graph_algorithms/basic_graph/parallel_bfs/parallelbfs.h \
+    src/graph_algorithms/basic_graph/parallel_bfs/parallelbfs_test.h \
+    src/graph_algorithms/basic_graph/multi_source_bfs/multisourcebfs.h \
+    src/graph_algorithms/basic_graph/multi_source_bfs/multisourcebfs_test.h \
+    src/graph_algorithms/basic_graph/graph_reordering/graphreordering.h \
+    src/graph_algorithms/basic_graph/graph_reordering/graphreordering_test.h \
     src/graph_algorithms/basic_graph/graph_representation/graph/graph.h \
     src/graph_algorithms/basic_graph/graph_representation/graph/graph_test.h \
+    src/graph_algorithms/basic_graph/graph_representation/csr_graph/csrgraph.h \
+    src/graph_algorithms/basic_graph/graph_representation/csr_graph/csrgraph_test.h \
+    src/graph_algorithms/basic_graph/graph_representation/graph_snapshot/graphsnapshot.h \
+    src/graph_algorithms/basic_graph/graph_representation/graph_snapshot/graphsnapshot_test.h \
+    src/graph_algorithms/basic_graph/graph_representation/vertex_property_map/vertexpropertymap.h \
+    src/graph_algorithms/basic_graph/graph_representation/vertex_property_map/vertexpropertymap_test.h \
+    src/graph_algorithms/basic_graph/graph_representation/neighbor_range/neighborrange.h \
+    src/graph_algorithms/basic_graph/graph_representation/edge_range/edgerange.h \
+    src/graph_algorithms/basic_graph/graph_representation/edge_range/edgerange_test.h \
+    src/graph_algorithms/basic_graph/graph_representation/lazy_vertex_array/lazyvertexarray.h \
+    src/graph_algorithms/basic_graph/graph_representation/lazy_vertex_array/lazyvertexarray_test.h \
     src/graph_algorithms/basic_graph/graph_representation/adjlist_graph/adjlistgraph.h \
     src/graph_algorithms/basic_graph/graph_representation/adjlist_graph/adjlistgraph_test.h \
     src/graph_algorithms/basic_graph/topology_sort/topologysort.h \
@@ -59,18 +80,38 @@ HEADERS += \
     src/graph_algorithms/basic_graph/strong_connected_component/strongconnectedcomponent_test.h \
     src/queue_algorithms/min_queue/minqueue.h \
     src/queue_algorithms/min_queue/minqueue_test.h \
+    src/queue_algorithms/indexed_min_queue/indexedminqueue.h \
+    src/queue_algorithms/indexed_min_queue/indexedminqueue_test.h \
+    src/queue_algorithms/id_min_queue/idminqueue.h \
+    src/queue_algorithms/id_min_queue/idminqueue_test.h \
+    src/parallel_algorithms/parallel_for/parallelfor.h \
+    src/parallel_algorithms/parallel_for/parallelfor_test.h \
+    src/parallel_algorithms/atomic_min/atomicmin.h \
+    src/parallel_algorithms/atomic_min/atomicmin_test.h \
+    src/parallel_algorithms/thread_pool/threadpool.h \
+    src/parallel_algorithms/thread_pool/threadpool_test.h \
+    src/parallel_algorithms/parallel_sort/parallelsort.h \
+    src/parallel_algorithms/parallel_sort/parallelsort_test.h \
     src/graph_algorithms/minimum_spanning_tree/prim/prim.h \
     src/graph_algorithms/minimum_spanning_tree/prim/prim_test.h \
     src/graph_algorithms/minimum_spanning_tree/kruskal/kruskal.h \
     src/graph_algorithms/minimum_spanning_tree/kruskal/kruskal_test.h \
+    src/graph_algorithms/minimum_spanning_tree/boruvka/boruvka.h \
+    src/graph_algorithms/minimum_spanning_tree/boruvka/boruvka_test.h \
     src/set_algorithms/disjoint_set/disjointset.h \
     src/set_algorithms/disjoint_set/disjointset_test.h \
+    src/set_algorithms/flat_disjoint_set/flatdisjointset.h \
+    src/set_algorithms/flat_disjoint_set/flatdisjointset_test.h \
+    src/set_algorithms/concurrent_disjoint_set/concurrentdisjointset.h \
+    src/set_algorithms/concurrent_disjoint_set/concurrentdisjointset_test.h \
     src/graph_algorithms/basic_graph/connected_component/connectedcomponent.h \
     src/graph_algorithms/basic_graph/connected_component/connectedcomponent_test.h \
     src/graph_algorithms/single_source_shortest_path/bellman_ford/bellmanford.h \
     src/graph_algorithms/single_source_shortest_path/bellman_ford/bellmanford_test.h \
     src/graph_algorithms/single_source_shortest_path/dag_shortest_path/dagshortpath.h \
     src/graph_algorithms/single_source_shortest_path/dag_shortest_path/dagshortpath_test.h \
+    src/graph_algorithms/single_source_shortest_path/dag_shortest_path/dagschedule.h \
+    src/graph_algorithms/single_source_shortest_path/dag_shortest_path/dagschedule_test.h \
     src/graph_algorithms/basic_graph/graph_representation/graph_vertex/bfs_vertex.h \
     src/graph_algorithms/basic_graph/graph_representation/graph_vertex/bfs_vertex_test.h \
     src/graph_algorithms/basic_graph/graph_representation/graph_vertex/dfs_vertex.h \
@@ -79,6 +120,16 @@ HEADERS += \
     src/graph_algorithms/basic_graph/graph_representation/graph_vertex/vertexp_test.h \
     src/graph_algorithms/single_source_shortest_path/dijkstra/dijkstra.h \
     src/graph_algorithms/single_source_shortest_path/dijkstra/dijkstra_test.h \
+    src/graph_algorithms/single_source_shortest_path/shortest_path_query/shortestpathquery.h \
+    src/graph_algorithms/single_source_shortest_path/shortest_path_query/shortestpathquery_test.h \
+    src/graph_algorithms/single_source_shortest_path/contraction_hierarchy/contractionhierarchy.h \
+    src/graph_algorithms/single_source_shortest_path/contraction_hierarchy/contractionhierarchy_test.h \
+    src/graph_algorithms/single_source_shortest_path/delta_stepping/deltastepping.h \
+    src/graph_algorithms/single_source_shortest_path/delta_stepping/deltastepping_test.h \
+    src/graph_algorithms/all_node_pair_shortest_path/dense_matrix/densematrix.h \
+    src/graph_algorithms/all_node_pair_shortest_path/dense_matrix/densematrix_test.h \
+    src/graph_algorithms/all_node_pair_shortest_path/min_plus/minplus.h \
+    src/graph_algorithms/all_node_pair_shortest_path/min_plus/minplus_test.h \
     src/graph_algorithms/all_node_pair_shortest_path/matrix_shortest_path/matrix_shortest_path.h \
     src/graph_algorithms/all_node_pair_shortest_path/matrix_shortest_path/matrix_shortest_path_test.h \
     src/graph_algorithms/all_node_pair_shortest_path/floyd_warshall/floyd_warshall.h \
@@ -95,6 +146,16 @@ HEADERS += \
     src/graph_algorithms/basic_graph/graph_representation/graph_vertex/flow_vertex_test.h \
     src/graph_algorithms/max_flow/relabel_to_front/relabeltofront.h \
     src/graph_algorithms/max_flow/relabel_to_front/relabeltofront_test.h \
+    src/graph_algorithms/max_flow/residual_graph/residualgraph.h \
+    src/graph_algorithms/max_flow/residual_graph/residualgraph_test.h \
+    src/graph_algorithms/max_flow/dinic/dinic.h \
+    src/graph_algorithms/max_flow/dinic/dinic_test.h \
+    src/graph_algorithms/max_flow/highest_label_push_relabel/highestlabelpushrelabel.h \
+    src/graph_algorithms/max_flow/highest_label_push_relabel/highestlabelpushrelabel_test.h \
+    src/graph_algorithms/graph_generator/graphgenerator.h \
+    src/graph_algorithms/graph_generator/graphgenerator_test.h \
+    src/graph_algorithms/graph_benchmark/graphbenchmark.h \
+    src/graph_algorithms/graph_benchmark/graphbenchmark_test.h \
     src/string_matching_algorithms/regular_match/match.h \
     src/string_matching_algorithms/regular_match/match_test.h \
     src/graph_algorithms/basic_graph/graph_representation/graph_vertex/front_flow_vertex.h \
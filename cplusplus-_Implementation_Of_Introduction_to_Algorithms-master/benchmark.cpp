@@ -0,0 +1,183 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+
+//图算法的基准测试程序：用带种子的生成器生成图，然后在每个图上对各个图算法计时，以CSV或JSON格式输出。
+//
+//用法： ./benchmark [--scale S] [--seed N] [--threads T] [--format csv|json] [--output FILE]
+//                   [--graphs rmat,grid,erdos_renyi,geometric] [--algorithms bfs,dijkstra,...] [--dense-limit V]
+//                   [--contraction-degree-limit D]
+//
+//每个图的顶点数量约为 2^S：
+//  rmat        : R-MAT 有向图，2^S 个顶点，16*2^S 条边
+//  grid        : 2^(S/2) * 2^(S-S/2) 的二维网格无向图
+//  erdos_renyi : G(n,m) 随机有向图，2^S 个顶点，8*2^S 条边
+//  geometric   : 平均度数为6的随机几何无向图（近似道路网）
+#include<iostream>
+#include<fstream>
+#include<sstream>
+#include<string>
+#include<vector>
+#include<cstdlib>
+#include<cstdint>
+#include<stdexcept>
+#include"src/graph_algorithms/graph_benchmark/graphbenchmark.h"
+
+using IntroductionToAlgorithm::GraphAlgorithm::GraphEdgeList;
+using IntroductionToAlgorithm::GraphAlgorithm::BenchmarkOptions;
+using IntroductionToAlgorithm::GraphAlgorithm::BenchmarkRecord;
+using IntroductionToAlgorithm::GraphAlgorithm::rmat_graph;
+using IntroductionToAlgorithm::GraphAlgorithm::grid_graph;
+using IntroductionToAlgorithm::GraphAlgorithm::erdos_renyi_graph;
+using IntroductionToAlgorithm::GraphAlgorithm::geometric_graph;
+using IntroductionToAlgorithm::GraphAlgorithm::run_graph_benchmark;
+using IntroductionToAlgorithm::GraphAlgorithm::benchmark_csv;
+using IntroductionToAlgorithm::GraphAlgorithm::benchmark_json;
+using IntroductionToAlgorithm::GraphAlgorithm::min_plus_kernel_name;
+
+namespace {
+    //!BenchmarkArguments：命令行参数
+    struct BenchmarkArguments
+    {
+        std::size_t scale=12;           /*!< 图的规模：顶点数量约为2^scale*/
+        std::uint64_t seed=1;           /*!< 随机数种子*/
+        std::string format="csv";       /*!< 输出格式：csv 或 json*/
+        std::string output;             /*!< 输出文件，为空表示标准输出*/
+        std::vector<std::string> graphs={"rmat","grid","erdos_renyi","geometric"}; /*!< 要生成的图*/
+        BenchmarkOptions options;       /*!< 基准测试的选项*/
+    };
+    const std::size_t MAX_SCALE=30;     /*!< `--scale`的上限，保证 2^scale 以及边的数量不溢出*/
+
+    //!usage:输出用法
+    void usage()
+    {
+        std::cerr<<"usage: ./benchmark [--scale S] [--seed N] [--threads T] [--format csv|json] [--output FILE]\n"
+                 <<"                   [--graphs rmat,grid,erdos_renyi,geometric] [--algorithms bfs,dijkstra,...] [--dense-limit V]\n"
+                 <<"                   [--contraction-degree-limit D]"<<std::endl;
+    }
+
+    //!split:将逗号分隔的字符串拆分为多个字符串
+    std::vector<std::string> split(const std::string& str)
+    {
+        std::vector<std::string> result;
+        std::istringstream in(str);
+        std::string item;
+        while(std::getline(in,item,','))
+            if(!item.empty()) result.push_back(item);
+        return result;
+    }
+    //!parse_number:将`--key`的值解析为非负整数。值必须完整地是一个十进制数，否则抛出异常
+    std::uint64_t parse_number(const std::string& key,const std::string& value)
+    {
+        std::size_t length=0;
+        unsigned long long number=0;
+        try
+        {
+            if(!value.empty()&&value[0]!='-') number=std::stoull(value,&length);
+        }catch(const std::exception&)
+        {
+            length=0;
+        }
+        if(length==0||length!=value.size())
+            throw std::invalid_argument("invalid value of "+key+": "+value);
+        return number;
+    }
+    //!parse:解析命令行参数，参数无效时抛出异常
+    BenchmarkArguments parse(int argc,char** argv)
+    {
+        BenchmarkArguments args;
+        for(int i=1;i<argc;i++)
+        {
+            std::string key=argv[i];
+            if(i+1>=argc) throw std::invalid_argument("missing value of "+key);
+            std::string value=argv[++i];
+            if(key=="--scale") args.scale=parse_number(key,value);
+            else if(key=="--seed") args.seed=parse_number(key,value);
+            else if(key=="--threads") args.options.thread_num=parse_number(key,value);
+            else if(key=="--format") args.format=value;
+            else if(key=="--output") args.output=value;
+            else if(key=="--graphs") args.graphs=split(value);
+            else if(key=="--algorithms") args.options.algorithms=split(value);
+            else if(key=="--dense-limit") args.options.dense_limit=parse_number(key,value);
+            else if(key=="--contraction-degree-limit") args.options.contraction_degree_limit=parse_number(key,value);
+            else throw std::invalid_argument("unknown option "+key);
+        }
+        if(args.scale>MAX_SCALE)
+            throw std::invalid_argument("scale must not exceed "+std::to_string(MAX_SCALE));
+        if(args.format!="csv"&&args.format!="json")
+            throw std::invalid_argument("format must be csv or json");
+        return args;
+    }
+    //!generate:按名字生成图
+    GraphEdgeList generate(const std::string& name,std::size_t scale,std::uint64_t seed)
+    {
+        std::size_t num=std::size_t(1)<<scale;
+        if(name=="rmat") return rmat_graph(scale,16,seed);
+        if(name=="grid") return grid_graph(std::size_t(1)<<(scale/2),std::size_t(1)<<(scale-scale/2),seed);
+        if(name=="erdos_renyi") return erdos_renyi_graph(num,8*num,seed);
+        if(name=="geometric") return geometric_graph(num,6,seed);
+        throw std::invalid_argument("unknown graph: "+name);
+    }
+    //!run:生成所有的图并运行基准测试，返回进程的返回值。所有的图算法都不递归，因此在主线程中以默认大小的栈执行
+    int run(const BenchmarkArguments& args)
+    {
+        try
+        {
+            std::ofstream file;
+            if(!args.output.empty())        //在运行之前打开，避免运行完所有的基准测试之后才发现无法输出
+            {
+                file.open(args.output);
+                if(!file.is_open()) throw std::runtime_error("can not open output file "+args.output);
+            }
+            std::ostream& out=args.output.empty()?std::cout:file;
+            std::cerr<<"min_plus kernel: "<<min_plus_kernel_name()<<std::endl;     //运行期按CPU选择，不依赖编译选项
+            std::vector<BenchmarkRecord> records;
+            for(const auto& name:args.graphs)
+            {
+                GraphEdgeList graph=generate(name,args.scale,args.seed);
+                std::cerr<<name<<"-"<<args.scale<<": "<<graph.vertex_num<<" vertices, "<<graph.edges.size()<<" edges"<<std::endl;
+                auto result=run_graph_benchmark(name+"-"+std::to_string(args.scale),graph,args.options);
+                records.insert(records.end(),result.begin(),result.end());
+            }
+            if(args.format=="json") benchmark_json(records,out);
+            else benchmark_csv(records,out);
+            out.flush();
+            if(!out) throw std::runtime_error("failed to write the results");
+        }catch(const std::exception& e)
+        {
+            std::cerr<<"benchmark error: "<<e.what()<<std::endl;
+            return 1;
+        }
+        return 0;
+    }
+}
+
+int main(int argc,char** argv)
+{
+    BenchmarkArguments args;
+    try
+    {
+        args=parse(argc,argv);
+    }catch(const std::exception& e)
+    {
+        std::cerr<<e.what()<<std::endl;
+        usage();
+        return 1;
+    }
+    return run(args);
+}
@@ -32,6 +32,12 @@
 #include "src/tree_algorithms/binarytree/binarytree_test.h"
 #include "src/tree_algorithms/searchtree/searchtree_test.h"
 #include "src/queue_algorithms/min_queue/minqueue_test.h"
+#include "src/queue_algorithms/indexed_min_queue/indexedminqueue_test.h"
+#include "src/queue_algorithms/id_min_queue/idminqueue_test.h"
+#include "src/parallel_algorithms/parallel_for/parallelfor_test.h"
+#include "src/parallel_algorithms/atomic_min/atomicmin_test.h"
+#include "src/parallel_algorithms/thread_pool/threadpool_test.h"
+#include "src/parallel_algorithms/parallel_sort/parallelsort_test.h"
 #include "src/graph_algorithms/basic_graph/graph_representation/graph_vertex/vertex_test.h"
 #include "src/graph_algorithms/basic_graph/graph_representation/graph_vertex/bfs_vertex_test.h"
 #include "src/graph_algorithms/basic_graph/graph_representation/graph_vertex/dfs_vertex_test.h"
@@ -41,26 +47,50 @@
 #include "src/graph_algorithms/basic_graph/graph_representation/graph_vertex/front_flow_vertex_test.h"
 #include "src/graph_algorithms/basic_graph/graph_representation/graph_edge/edge_test.h"
 #include "src/graph_algorithms/basic_graph/graph_representation/matrix_graph/matrixgraph_test.h"
+#include "src/graph_algorithms/basic_graph/graph_representation/bitset_graph/bitsetgraph_test.h"
 #include "src/graph_algorithms/basic_graph/graph_representation/adjlist_graph/adjlistgraph_test.h"
 #include "src/graph_algorithms/basic_graph/graph_representation/graph/graph_test.h"
+#include "src/graph_algorithms/basic_graph/graph_representation/csr_graph/csrgraph_test.h"
+#include "src/graph_algorithms/basic_graph/graph_representation/edge_range/edgerange_test.h"
+#include "src/graph_algorithms/basic_graph/graph_representation/lazy_vertex_array/lazyvertexarray_test.h"
+#include "src/graph_algorithms/basic_graph/graph_representation/graph_snapshot/graphsnapshot_test.h"
+#include "src/graph_algorithms/basic_graph/graph_representation/vertex_property_map/vertexpropertymap_test.h"
 #include "src/graph_algorithms/basic_graph/graph_bfs/bfs_test.h"
+#include "src/graph_algorithms/basic_graph/parallel_bfs/parallelbfs_test.h"
+#include "src/graph_algorithms/basic_graph/multi_source_bfs/multisourcebfs_test.h"
+#include "src/graph_algorithms/basic_graph/graph_reordering/graphreordering_test.h"
 #include "src/graph_algorithms/basic_graph/graph_dfs/dfs_test.h"
+#include "src/graph_algorithms/basic_graph/graph_visitor/graphvisitor_test.h"
 #include "src/graph_algorithms/basic_graph/topology_sort/topologysort_test.h"
 #include "src/graph_algorithms/basic_graph/strong_connected_component/strongconnectedcomponent_test.h"
 #include "src/graph_algorithms/basic_graph/connected_component/connectedcomponent_test.h"
 #include "src/queue_algorithms/min_queue/minqueue_test.h"
 #include "src/set_algorithms/disjoint_set/disjointset_test.h"
+#include "src/set_algorithms/flat_disjoint_set/flatdisjointset_test.h"
+#include "src/set_algorithms/concurrent_disjoint_set/concurrentdisjointset_test.h"
 #include "src/graph_algorithms/minimum_spanning_tree/prim/prim_test.h"
 #include "src/graph_algorithms/minimum_spanning_tree/kruskal/kruskal_test.h"
+#include "src/graph_algorithms/minimum_spanning_tree/boruvka/boruvka_test.h"
 #include "src/graph_algorithms/single_source_shortest_path/bellman_ford/bellmanford_test.h"
 #include "src/graph_algorithms/single_source_shortest_path/dag_shortest_path/dagshortpath_test.h"
+#include "src/graph_algorithms/single_source_shortest_path/dag_shortest_path/dagschedule_test.h"
 #include "src/graph_algorithms/single_source_shortest_path/dijkstra/dijkstra_test.h"
+#include "src/graph_algorithms/single_source_shortest_path/shortest_path_query/shortestpathquery_test.h"
+#include "src/graph_algorithms/single_source_shortest_path/contraction_hierarchy/contractionhierarchy_test.h"
+#include "src/graph_algorithms/single_source_shortest_path/delta_stepping/deltastepping_test.h"
+#include "src/graph_algorithms/all_node_pair_shortest_path/dense_matrix/densematrix_test.h"
+#include "src/graph_algorithms/all_node_pair_shortest_path/min_plus/minplus_test.h"
 #include "src/graph_algorithms/all_node_pair_shortest_path/matrix_shortest_path/matrix_shortest_path_test.h"
 #include "src/graph_algorithms/all_node_pair_shortest_path/floyd_warshall/floyd_warshall_test.h"
 #include "src/graph_algorithms/all_node_pair_shortest_path/johnson/johnson_test.h"
 #include "src/graph_algorithms/max_flow/ford_fulkerson/fordfulkerson_test.h"
 #include "src/graph_algorithms/max_flow/generic_push_relabel/genericpushrelabel_test.h"
 #include "src/graph_algorithms/max_flow/relabel_to_front/relabeltofront_test.h"
+#include "src/graph_algorithms/max_flow/residual_graph/residualgraph_test.h"
+#include "src/graph_algorithms/max_flow/dinic/dinic_test.h"
+#include "src/graph_algorithms/max_flow/highest_label_push_relabel/highestlabelpushrelabel_test.h"
+#include "src/graph_algorithms/graph_generator/graphgenerator_test.h"
+#include "src/graph_algorithms/graph_benchmark/graphbenchmark_test.h"
 #include "src/string_matching_algorithms/regular_match/match_test.h"
 #include "src/string_matching_algorithms/rabin_karp_match/rabinkarpmatch_test.h"
 #include "src/string_matching_algorithms/finite_automaton_match/finiteautomatonmatch_test.h"
@@ -0,0 +1,140 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef DENSEMATRIX
+#define DENSEMATRIX
+#include<vector>
+#include<memory>
+#include<stdexcept>
+#include<cstddef>
+#include"../../../header.h"
+namespace IntroductionToAlgorithm
+{
+    namespace GraphAlgorithm
+    {
+        //!DenseMatrix：运行时指定大小的稠密矩阵，用于所有结点对最短路径算法
+        /*!
+        *
+        * 本章原有的算法采用`std::array<std::array<T,N>,N>`作为矩阵。它的大小在编译期确定，且分配在栈上，因此当N较大（如数千个顶点）时会导致栈溢出。
+        *
+        * `DenseMatrix`将矩阵按行优先的次序存放在堆上的一个连续的`std::vector`中：
+        *
+        * - 第i行的元素为`_data[i*_col_num ... (i+1)*_col_num)`，可以通过`row(i)`获取它的首地址，便于编译器对行内循环进行向量化
+        * - 行数、列数在运行时指定
+        *
+        */
+        template<typename T>
+        class DenseMatrix
+        {
+        public:
+            typedef T ValueType; /*!< 矩阵元素的类型*/
+            //!默认构造函数：空矩阵
+            DenseMatrix():_row_num(0),_col_num(0){}
+            //!显式构造函数
+            /*!
+            * \param row_num:行数
+            * \param col_num:列数
+            * \param value:所有元素的初始值，默认为`T()`
+            */
+            DenseMatrix(std::size_t row_num,std::size_t col_num,const T& value=T()):
+                _row_num(row_num),_col_num(col_num),_data(row_num*col_num,value){}
+
+            //!rows:返回行数
+            std::size_t rows() const {return _row_num;}
+            //!cols:返回列数
+            std::size_t cols() const {return _col_num;}
+            //!operator():返回第i行第j列的元素，不检查下标
+            T& operator()(std::size_t i,std::size_t j) {return _data[i*_col_num+j];}
+            //!operator():返回第i行第j列的元素，不检查下标
+            const T& operator()(std::size_t i,std::size_t j) const {return _data[i*_col_num+j];}
+            //!at:返回第i行第j列的元素
+            /*!
+            * \param i:行号，必须小于`rows()`，否则抛出异常
+            * \param j:列号，必须小于`cols()`，否则抛出异常
+            * \return 元素的引用
+            */
+            T& at(std::size_t i,std::size_t j)
+            {
+                if(i>=_row_num||j>=_col_num)
+                    throw std::invalid_argument("at error: index out of range!");
+                return _data[i*_col_num+j];
+            }
+            //!at:返回第i行第j列的元素
+            /*!
+            * \param i:行号，必须小于`rows()`，否则抛出异常
+            * \param j:列号，必须小于`cols()`，否则抛出异常
+            * \return 元素的常引用
+            */
+            const T& at(std::size_t i,std::size_t j) const
+            {
+                if(i>=_row_num||j>=_col_num)
+                    throw std::invalid_argument("at error: index out of range!");
+                return _data[i*_col_num+j];
+            }
+            //!row:返回第i行的首地址，不检查下标
+            T* row(std::size_t i) {return _data.data()+i*_col_num;}
+            //!row:返回第i行的首地址，不检查下标
+            const T* row(std::size_t i) const {return _data.data()+i*_col_num;}
+            //!operator==:两个矩阵大小相同且所有元素相等
+            bool operator==(const DenseMatrix& other) const
+            {
+                return _row_num==other._row_num&&_col_num==other._col_num&&_data==other._data;
+            }
+            //!operator!=
+            bool operator!=(const DenseMatrix& other) const {return !(*this==other);}
+
+        private:
+            std::size_t _row_num; /*!< 行数*/
+            std::size_t _col_num; /*!< 列数*/
+            std::vector<T> _data; /*!< 按行优先次序存放的元素*/
+        };
+
+        //!weight_matrix：从图中创建所有结点对最短路径算法所用的权重矩阵，算法导论25章
+        /*!
+        * \param graph:指定的有向图。它必须非空，否则抛出异常
+        * \return: 一个n*n的`DenseMatrix`，n为`graph->vertexes.size()`。其中 w_i_j =:
+        *
+        *   - 0:若i=j
+        *   - 有向边(i,j)的权重，若i!=j且(i,j)属于E
+        *   - 正无穷，若 i!=j且(i,j)不属于E
+        *
+        * 这里不能直接从图的矩阵描述中提取，因为这里要求 w(i,i)=0，而图中结点可能有指向自己的边。
+        *
+        * 它通过`neighbors(id)`遍历所有的边，因此适用于`Graph`、`CSRGraph`等图类型，时间复杂度 O(V^2+E)
+        */
+        template<typename GraphType>
+        DenseMatrix<typename GraphType::EWeightType> weight_matrix(std::shared_ptr<GraphType> graph)
+        {
+            typedef typename GraphType::EWeightType EWeightType;
+            if(!graph)
+                throw std::invalid_argument("weight_matrix error: graph must not be nullptr!");
+            std::size_t num=graph->vertexes.size();
+            DenseMatrix<EWeightType> W(num,num,unlimit<EWeightType>());
+            for(std::size_t i=0;i<num;i++)
+            {
+                W(i,i)=0;
+                if(!vertex_exists(graph->vertexes,i)) continue;
+                for(const auto& neighbor:graph->neighbors(i))
+                    if(static_cast<std::size_t>(neighbor.first)!=i)
+                        W(i,neighbor.first)=neighbor.second;
+            }
+            return W;
+        }
+    }
+}
+#endif // DENSEMATRIX
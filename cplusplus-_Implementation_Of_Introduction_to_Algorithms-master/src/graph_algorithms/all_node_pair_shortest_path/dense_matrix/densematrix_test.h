@@ -0,0 +1,122 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef DENSEMATRIX_TEST
+#define DENSEMATRIX_TEST
+#include "../../../google_test/gtest.h"
+#include "densematrix.h"
+#include "../../basic_graph/graph_representation/graph_vertex/vertex.h"
+#include "../../basic_graph/graph_representation/graph/graph.h"
+#include "../../basic_graph/graph_representation/csr_graph/csrgraph.h"
+
+using IntroductionToAlgorithm::GraphAlgorithm::DenseMatrix;
+using IntroductionToAlgorithm::GraphAlgorithm::weight_matrix;
+using IntroductionToAlgorithm::GraphAlgorithm::Graph;
+using IntroductionToAlgorithm::GraphAlgorithm::CSRGraph;
+using IntroductionToAlgorithm::GraphAlgorithm::Vertex;
+using IntroductionToAlgorithm::GraphAlgorithm::unlimit;
+
+namespace {
+    const int DM_N= 5;  /*!< 测试的图顶点数量*/
+}
+
+//!DenseMatrixTest:测试类，用于为测试提供基础数据
+/*!
+*
+* `DenseMatrixTest`是 `::testing::Test` 的子类。它主要用于为每一个`TEST_F`准备测试环境
+*/
+class DenseMatrixTest:public ::testing::Test
+{
+public:
+typedef Graph<DM_N,Vertex<int>> GType; /*!< 模板实例化的图类型，该图的顶点类型为`Vertex<int>`*/
+
+protected:
+    void SetUp()
+    {
+        //****  算法导论图25-1，以及一条自环(2,2)   ****
+        _edges={std::make_tuple(0,1,3),std::make_tuple(0,2,8),std::make_tuple(0,4,-4),std::make_tuple(1,3,1),
+                std::make_tuple(1,4,7),std::make_tuple(2,1,4),std::make_tuple(2,2,9),std::make_tuple(3,2,-5),
+                std::make_tuple(3,0,2),std::make_tuple(4,3,6)};
+        _graph=std::make_shared<GType>(unlimit<int>()); //边的无效权重为正无穷
+        for(int i=0;i<DM_N;i++)
+            _graph->add_vertex(0);
+        _graph->add_edges(_edges.begin(),_edges.end());
+    }
+    void TearDown(){}
+    std::vector<GType::EdgeTupleType> _edges; /*!< 图的边*/
+    std::shared_ptr<GType> _graph;    /*!< 指向一个图，算法导论图25-1*/
+};
+
+//!DenseMatrixTest:测试 DenseMatrix
+/*!
+*
+* `test_dense_matrix`：测试`DenseMatrix`的元素访问、行访问与比较
+*/
+TEST_F(DenseMatrixTest,test_dense_matrix)
+{
+    DenseMatrix<int> empty;
+    EXPECT_EQ(empty.rows(),0);
+    EXPECT_EQ(empty.cols(),0);
+
+    DenseMatrix<int> matrix(3,4,7);
+    EXPECT_EQ(matrix.rows(),3);
+    EXPECT_EQ(matrix.cols(),4);
+    for(int i=0;i<3;i++)
+        for(int j=0;j<4;j++)
+        {
+            EXPECT_EQ(matrix(i,j),7);
+            matrix(i,j)=i*10+j;
+        }
+    EXPECT_EQ(matrix.at(2,3),23);
+    EXPECT_THROW(matrix.at(3,0),std::invalid_argument);
+    EXPECT_THROW(matrix.at(0,4),std::invalid_argument);
+    EXPECT_EQ(matrix.row(1)[2],12);
+    EXPECT_EQ(matrix.row(2),&matrix(2,0));
+
+    DenseMatrix<int> other=matrix;
+    EXPECT_TRUE(other==matrix);
+    other.at(0,0)=-1;
+    EXPECT_TRUE(other!=matrix);
+    EXPECT_TRUE(DenseMatrix<int>(4,3,0)!=DenseMatrix<int>(3,4,0));
+}
+
+//!DenseMatrixTest:测试 weight_matrix
+/*!
+*
+* `test_weight_matrix`：测试`weight_matrix`：对角线为0，自环被忽略，不存在的边为正无穷；`Graph`与`CSRGraph`的结果相同
+*/
+TEST_F(DenseMatrixTest,test_weight_matrix)
+{
+    std::shared_ptr<GType> empty_graph;
+    EXPECT_THROW(weight_matrix(empty_graph),std::invalid_argument);
+
+    auto W=weight_matrix(_graph);
+    EXPECT_EQ(W.rows(),DM_N);
+    EXPECT_EQ(W.cols(),DM_N);
+    for(int i=0;i<DM_N;i++)
+        for(int j=0;j<DM_N;j++)
+        {
+            if(i==j) EXPECT_EQ(W(i,j),0);
+            else if(_graph->has_edge(i,j)) EXPECT_EQ(W(i,j),_graph->weight(i,j));
+            else EXPECT_EQ(W(i,j),unlimit<int>());
+        }
+
+    auto csr=std::make_shared<CSRGraph<Vertex<int>>>(DM_N,_edges.begin(),_edges.end(),unlimit<int>());
+    EXPECT_EQ(weight_matrix(csr),W);
+}
+#endif // DENSEMATRIX_TEST
@@ -19,7 +19,11 @@
 #ifndef FLOYD_WARSHALL
 #define FLOYD_WARSHALL
 #include <memory>
+#include <array>
+#include <algorithm>
 #include "../../../header.h"
+#include "../dense_matrix/densematrix.h"
+#include "../../../parallel_algorithms/parallel_for/parallelfor.h"
 namespace IntroductionToAlgorithm
 {
     namespace GraphAlgorithm
@@ -91,12 +95,14 @@ namespace IntroductionToAlgorithm
         *
         * - 初始化：从图中获取结果矩阵D，以及父矩阵P
         * - 外层循环 k 从 0..N-1(N次)
-        *   - 新建 D<k>,P<k>，同时执行内层循环 i 从 0..N-1(N次)
+        *   - 执行内层循环 i 从 0..N-1(N次)。若d_i_k为正无穷则跳过该行
         *   - 执行最内层循环 j 从 0..N-1(N次)
-        *       - 根据递推公式对d_i_j<k>和p_i_j<k>赋值(此时D等于D<k-1>，P等于P<k-1>
-        *   - 将D<k>赋值给D,P<k>赋值给P
+        *       - 根据递推公式原地更新d_i_j和p_i_j
         * - 返回 std::make_pair(D,P)
         *
+        * 这里原地更新D和P，而不是每一轮新建D<k>,P<k>。因为d_k_k=0（图中不存在权重为负的环路），第k轮中d_i_k与d_k_j都不会改变，
+        * p_k_j也不会改变，所以原地更新与逐轮新建矩阵的结果相同。
+        *
         * ### 算法性能
         *
         * 时间复杂度 O(V^3)
@@ -116,8 +122,8 @@ namespace IntroductionToAlgorithm
             //**************  初始化 D 和 P ************
             //****  这里不能直接从图的矩阵描述中提取，因为这里要求 w(i,i)=0，而图的矩阵描述中，结点可能有指向自己的边
             MatrixType D,P;
-            for(int i=0;i<GraphType::NUM;i++)
-                for(int j=0;j<GraphType::NUM;j++)
+            for(std::size_t i=0;i<GraphType::NUM;i++)
+                for(std::size_t j=0;j<GraphType::NUM;j++)
                 {
                     if(i==j)
                     {
@@ -139,38 +145,158 @@ namespace IntroductionToAlgorithm
                     }
                  }
             //**************  计算矩阵D和前驱矩阵P ******************
-            for(int k=0;k<GraphType::NUM;k++)
+            const EWeightType INFINITE=unlimit<EWeightType>();
+            for(std::size_t k=0;k<GraphType::NUM;k++)
             {
-                MatrixType newD; //  D<k>
-                MatrixType newP; //  P<k>
-                for(int i=0;i<GraphType::NUM;i++)
+                for(std::size_t i=0;i<GraphType::NUM;i++)
                 {
-                    for(int j=0;j<GraphType::NUM;j++)
+                    const EWeightType d_ik=D[i][k];
+                    if(d_ik>=INFINITE) continue;                    // d_i_k为正无穷，则第i行不会改变
+                    for(std::size_t j=0;j<GraphType::NUM;j++)
                     {
-                        // D中存放的是D<k-1>,P中存放的是P<k-1>
-                        EWeightType sum=0;
-                        if(D[i][k]==unlimit<EWeightType>()||D[k][j]==unlimit<EWeightType>()||D[i][k]+D[k][j]>=unlimit<EWeightType>())
-                            sum=unlimit<EWeightType>();
-                        else
-                            sum=D[i][k]+D[k][j];
-
-                        if(D[i][j]<=sum) // d_i_j<k-1> <= d_i_k<k-1>+d_k_j<k-1>
+                        if(D[k][j]>=INFINITE) continue;             // d_k_j为正无穷
+                        EWeightType sum=d_ik+D[k][j];
+                        if(sum<D[i][j]) // d_i_j<k-1> > d_i_k<k-1>+d_k_j<k-1>
                         {
-                           newD[i][j]= D[i][j]; //则 d_i_j<k> = d_i_j<k-1>
-                           newP[i][j]= P[i][j]; //则 p_i_j<k> = p_i_j<k-1>
-                        }
-                        else  // d_i_j<k-1> > d_i_k<k-1>+d_k_j<k-1>
-                        {
-                            newD[i][j]= sum; //则 d_i_j<k> = d_i_k<k-1>+d_k_j<k-1>
-                            newP[i][j]= P[k][j];         //则 p_i_j<k> = p_k_j<k-1>
+                            D[i][j]=sum;     //则 d_i_j<k> = d_i_k<k-1>+d_k_j<k-1>
+                            P[i][j]=P[k][j]; //则 p_i_j<k> = p_k_j<k-1>
                         }
                      }
                 }
-                D=newD;
-                P=newP;
             }
             return std::make_pair(D,P);
         }
+
+        //!_floyd_warshall_tile：分块floyd_warshall算法的基本操作：用中间结点[k_begin,k_end)更新D与P的一个子块
+        /*!
+        * \param D:距离矩阵
+        * \param P:前驱矩阵
+        * \param k_begin:中间结点的起始编号
+        * \param k_end:中间结点的终止编号（不包含）
+        * \param i_begin:子块的起始行
+        * \param i_end:子块的终止行（不包含）
+        * \param j_begin:子块的起始列
+        * \param j_end:子块的终止列（不包含）
+        * \return: void
+        *
+        * 对子块的每一行i，依次用每个k更新该行的d_i_j与p_i_j（循环次序为i,k,j，使第i行在整个k循环中都留在缓存中）。
+        * 最内层循环没有分支：先计算比较结果，再用条件表达式选择新值，以便编译器将其向量化。
+        * d_i_k为正无穷时跳过；d_k_j为正无穷的列不会被更新（否则负的d_i_k会使正无穷变小），并且此时加数取0，使d_i_k+d_k_j不会溢出。
+        *
+        * 注意：i,k,j的循环次序只有在行k（或列k）已经对[k_begin,k_end)闭包时才等价于floyd_warshall的k,i,j次序。
+        * 更新对角块本身时，必须每次只传入一个k。
+        */
+        template<typename EWeightType,typename VIDType>
+        void _floyd_warshall_tile(DenseMatrix<EWeightType>&D,DenseMatrix<VIDType>&P,std::size_t k_begin,std::size_t k_end,
+                                  std::size_t i_begin,std::size_t i_end,std::size_t j_begin,std::size_t j_end)
+        {
+            const EWeightType INFINITE=unlimit<EWeightType>();
+            for(std::size_t i=i_begin;i<i_end;i++)
+            {
+                EWeightType* D_i=D.row(i);
+                VIDType* P_i=P.row(i);
+                for(std::size_t k=k_begin;k<k_end;k++)
+                {
+                    const EWeightType d_ik=D_i[k];
+                    if(d_ik>=INFINITE||i==k) continue;             // i==k时d_k_k=0，不会更新
+                    const EWeightType* D_k=D.row(k);
+                    const VIDType* P_k=P.row(k);
+                    for(std::size_t j=j_begin;j<j_end;j++)
+                    {
+                        const EWeightType d_kj=D_k[j];
+                        const bool reachable=d_kj<INFINITE;
+                        const EWeightType sum=d_ik+(reachable?d_kj:0);                  //先选择加数，正无穷不参与加法，避免有符号溢出
+                        const bool better=reachable&(sum<D_i[j]);
+                        D_i[j]=better?sum:D_i[j];
+                        P_i[j]=better?P_k[j]:P_i[j];
+                    }
+                }
+            }
+        }
+
+        //!parallel_floyd_warshall：返回所有节点对的最短路径的分块并行floyd_warshall算法。
+        /*!
+        *
+        * \param graph:指定的有向图。它必须非空，否则抛出异常
+        * \param thread_num:线程数量。若为0则使用硬件支持的并发线程数量
+        * \param block_size:分块的边长，必须大于0，否则抛出异常。默认为128
+        * \return: 一个n*n的距离矩阵D与n*n的前驱矩阵P的std::pair，n为`graph->vertexes.size()`。D、P的含义与`floyd_warshall`相同，
+        *   前驱不存在时为-1。
+        *
+        * 与`floyd_warshall`相比：
+        *
+        * - D与P为堆上的`DenseMatrix`，大小在运行时确定，因此适用于数千到上万个顶点的稠密图，也适用于`CSRGraph`等非`Graph`的图类型
+        * - D与P原地更新
+        * - 采用分块（tiled）的三阶段算法以提高缓存命中率，并在线程之间并行
+        *
+        * ### 算法步骤
+        *
+        * 将n*n矩阵划分为 B*B 的子块，共 nb*nb 块（nb=ceil(n/B)）。对每个 kb=0..nb-1，用中间结点 k 属于第kb块的所有结点更新矩阵：
+        *
+        * - 阶段1：更新对角块(kb,kb)。它只依赖于自身
+        * - 阶段2：并行更新第kb行的块(kb,j)与第kb列的块(i,kb)。它们只依赖于自身以及对角块
+        * - 阶段3：并行更新其余的块(i,j)。它只依赖于自身以及块(i,kb)、(kb,j)，这两者在本轮中已经不再改变
+        *
+        * 阶段1结束后对角块已经对第kb块的中间结点闭包，因此阶段2、3中经过第kb块中间结点的最短路径可以分解为 i-->k(经过闭包的块)-->j，
+        * 子块内部的更新次序不影响结果。
+        * 各个阶段内部不同子块之间互不依赖，因此可以并行执行。当最短路径唯一时，D、P与`floyd_warshall`完全相同；否则D相同，
+        * P可能给出另一条同样权重的最短路径。
+        *
+        * ### 算法性能
+        *
+        * 时间复杂度 O(V^3)，空间复杂度 O(V^2)
+        */
+        template<typename GraphType>
+        std::pair<DenseMatrix<typename GraphType::EWeightType>,DenseMatrix<typename GraphType::VIDType>>
+        parallel_floyd_warshall(std::shared_ptr<GraphType> graph,std::size_t thread_num=0,std::size_t block_size=128)
+        {
+            typedef typename GraphType::EWeightType EWeightType;
+            typedef typename GraphType::VIDType VIDType;
+            using IntroductionToAlgorithm::ParallelAlgorithm::thread_num_or_default;
+            using IntroductionToAlgorithm::ParallelAlgorithm::parallel_for;
+
+            if(!graph)
+                throw std::invalid_argument("parallel_floyd_warshall error: graph must not be nullptr!");
+            if(block_size==0)
+                throw std::invalid_argument("parallel_floyd_warshall error: block_size must > 0!");
+            std::size_t threads=thread_num_or_default(thread_num);
+            //**************  初始化 D 和 P ************
+            DenseMatrix<EWeightType> D=weight_matrix(graph);
+            std::size_t num=D.rows();
+            DenseMatrix<VIDType> P(num,num,-1);
+            for(std::size_t i=0;i<num;i++)
+                for(std::size_t j=0;j<num;j++)
+                    if(i!=j&&D(i,j)<unlimit<EWeightType>())
+                        P(i,j)=i;
+            //**************  分块计算矩阵D和前驱矩阵P ******************
+            std::size_t block_num=(num+block_size-1)/block_size;
+            auto block_begin=[&](std::size_t b){return b*block_size;};
+            auto block_end=[&](std::size_t b){return std::min(num,(b+1)*block_size);};
+            for(std::size_t kb=0;kb<block_num;kb++)
+            {
+                std::size_t k_begin=block_begin(kb),k_end=block_end(kb);
+                //*******  阶段1：对角块，每次一个k，即块内的floyd_warshall  *******
+                for(std::size_t k=k_begin;k<k_end;k++)
+                    _floyd_warshall_tile(D,P,k,k+1,k_begin,k_end,k_begin,k_end);
+                //*******  阶段2：第kb行、第kb列的块（前block_num个为行块，后block_num个为列块）  *******
+                parallel_for(0,2*block_num,threads,[&](std::size_t index){
+                    std::size_t b=index%block_num;
+                    if(b==kb) return;
+                    if(index<block_num)
+                        _floyd_warshall_tile(D,P,k_begin,k_end,k_begin,k_end,block_begin(b),block_end(b));
+                    else
+                        _floyd_warshall_tile(D,P,k_begin,k_end,block_begin(b),block_end(b),k_begin,k_end);
+                },1);
+                //*******  阶段3：其余的块，按行块划分给各个线程  *******
+                parallel_for(0,block_num,threads,[&](std::size_t ib){
+                    if(ib==kb) return;
+                    for(std::size_t jb=0;jb<block_num;jb++)
+                        if(jb!=kb)
+                            _floyd_warshall_tile(D,P,k_begin,k_end,block_begin(ib),block_end(ib),block_begin(jb),block_end(jb));
+                },1);
+            }
+            return std::make_pair(std::move(D),std::move(P));
+        }
     }
 }
 #endif // FLOYD_WARSHALL
@@ -18,18 +18,23 @@
  */
 #ifndef FLOYD_WARSHALL_TEST
 #define FLOYD_WARSHALL_TEST
+#include <random>
 #include "../../../google_test/gtest.h"
 #include "floyd_warshall.h"
 #include "../../basic_graph/graph_representation/graph_vertex/vertex.h"
 #include "../../basic_graph/graph_representation/graph/graph.h"
+#include "../../basic_graph/graph_representation/csr_graph/csrgraph.h"
 
 using IntroductionToAlgorithm::GraphAlgorithm::Graph;
 using IntroductionToAlgorithm::GraphAlgorithm::Vertex;
 using IntroductionToAlgorithm::GraphAlgorithm::floyd_warshall;
+using IntroductionToAlgorithm::GraphAlgorithm::parallel_floyd_warshall;
+using IntroductionToAlgorithm::GraphAlgorithm::CSRGraph;
 using IntroductionToAlgorithm::GraphAlgorithm::unlimit;
 
 namespace {
     const int FW_N= 5;  /*!< 测试的图顶点数量*/
+    const int FW_RANDOM_N= 150;  /*!< 随机图的顶点数量*/
 }
 
 //!FloydWarshallTest:测试类，用于为测试提供基础数据
@@ -85,5 +90,76 @@ TEST_F(FloydWarshallTest,test_floyd_warshall)
                        std::array<typename GType::EWeightType,FW_N>({3,2,3,4,-1})};
     EXPECT_EQ(floyd_warshall(_graph),std::make_pair(real_D,real_P));
 }
+
+//!FloydWarshallTest:测试 parallel_floyd_warshall 算法
+/*!
+*
+* `test_parallel_floyd_warshall`：测试 parallel_floyd_warshall 算法：对各种分块大小和线程数量，结果与`floyd_warshall`相同
+*/
+TEST_F(FloydWarshallTest,test_parallel_floyd_warshall)
+{
+    std::shared_ptr<GType> empty_graph;
+    EXPECT_THROW(parallel_floyd_warshall(empty_graph),std::invalid_argument);
+    EXPECT_THROW(parallel_floyd_warshall(_graph,1,0),std::invalid_argument);
+
+    auto result=floyd_warshall(_graph);
+    for(std::size_t block_size:{1,2,3,64})
+        for(std::size_t thread_num:{1,2,4})
+        {
+            auto parallel_result=parallel_floyd_warshall(_graph,thread_num,block_size);
+            ASSERT_EQ(parallel_result.first.rows(),FW_N);
+            for(int i=0;i<FW_N;i++)
+                for(int j=0;j<FW_N;j++)
+                {
+                    EXPECT_EQ(parallel_result.first(i,j),result.first[i][j])<<"block_size:"<<block_size<<" i:"<<i<<" j:"<<j;
+                    EXPECT_EQ(parallel_result.second(i,j),result.second[i][j])<<"block_size:"<<block_size<<" i:"<<i<<" j:"<<j;
+                }
+        }
+}
+
+//!FloydWarshallTest:测试 parallel_floyd_warshall 算法
+/*!
+*
+* `test_parallel_floyd_warshall_random`：在含负权重边（但无负权重环路）且部分结点不可达的随机`CSRGraph`上，
+* parallel_floyd_warshall 的距离矩阵与`floyd_warshall`相同，且前驱矩阵给出的是一条最短路径
+*/
+TEST_F(FloydWarshallTest,test_parallel_floyd_warshall_random)
+{
+    typedef Graph<FW_RANDOM_N,Vertex<int>> RandomGType;
+    //****  随机有向图：权重为 w+p(u)-p(v)，其中w>=0，因此存在负权重的边，但任何环路的权重都非负。最后10个顶点没有入边  ****
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<int> weight_dist(0,30);
+    std::uniform_int_distribution<int> edge_dist(0,19);
+    std::vector<int> potential(FW_RANDOM_N);
+    for(auto& p:potential) p=weight_dist(gen);
+    std::vector<RandomGType::EdgeTupleType> edges;
+    for(int i=0;i<FW_RANDOM_N;i++)
+        for(int j=0;j<FW_RANDOM_N-10;j++)
+            if(i!=j&&edge_dist(gen)==0)
+                edges.push_back(std::make_tuple(i,j,weight_dist(gen)+potential[i]-potential[j]));
+
+    auto graph=std::make_shared<RandomGType>(unlimit<int>());
+    for(int i=0;i<FW_RANDOM_N;i++)
+        graph->add_vertex(0);
+    graph->add_edges(edges.begin(),edges.end());
+    auto csr=std::make_shared<CSRGraph<Vertex<int>>>(FW_RANDOM_N,edges.begin(),edges.end(),unlimit<int>());
+
+    auto result=floyd_warshall(graph);
+    for(std::size_t block_size:{7,32})
+    {
+        auto parallel_result=parallel_floyd_warshall(csr,4,block_size);
+        const auto& D=parallel_result.first;
+        const auto& P=parallel_result.second;
+        for(int i=0;i<FW_RANDOM_N;i++)
+            for(int j=0;j<FW_RANDOM_N;j++)
+            {
+                EXPECT_EQ(D(i,j),result.first[i][j])<<"block_size:"<<block_size<<" i:"<<i<<" j:"<<j;
+                if(i==j||D(i,j)>=unlimit<int>())
+                    EXPECT_EQ(P(i,j),-1)<<"block_size:"<<block_size<<" i:"<<i<<" j:"<<j;
+                else  //d_i_j = d_i_p + w(p,j)，p为j的前驱
+                    EXPECT_EQ(D(i,j),D(i,P(i,j))+csr->weight(P(i,j),j))<<"block_size:"<<block_size<<" i:"<<i<<" j:"<<j;
+            }
+    }
+}
 #endif // FLOYD_WARSHALL_TEST
 
@@ -23,6 +23,13 @@
 #include "../../basic_graph/graph_representation/graph/graph.h"
 #include "../../single_source_shortest_path/bellman_ford/bellmanford.h"
 #include "../../single_source_shortest_path/dijkstra/dijkstra.h"
+#include "../dense_matrix/densematrix.h"
+#include "../../../queue_algorithms/id_min_queue/idminqueue.h"
+#include "../../../parallel_algorithms/thread_pool/threadpool.h"
+#include "../../../parallel_algorithms/parallel_for/parallelfor.h"
+#include <vector>
+#include <deque>
+#include <atomic>
 
 namespace IntroductionToAlgorithm
 {
@@ -174,6 +181,151 @@ namespace IntroductionToAlgorithm
             return D;
         }
 
+
+        //!parallel_johnson：返回所有节点对的最短路径的并行johnson算法。算法导论25章25.3节
+        /*!
+        *
+        * \param graph:指定的有向图。它必须非空，否则抛出异常。它不能包含权重为负值的环路，否则抛出异常
+        * \param thread_num:线程数量。若为0则使用硬件支持的并发线程数量
+        * \return: 一个n*n的距离矩阵D与n*n的前驱矩阵P的std::pair，n为`graph->vertexes.size()`。D、P的含义与`parallel_floyd_warshall`相同：
+        *   不可达时d_i_j为正无穷，p_i_j为-1
+        *
+        * `johnson`中每次dijkstra都会修改图中顶点对象的`key`与`parent`，因此各个源点只能依次执行。本算法的区别在于：
+        *
+        * - 不修改图，也不创建新图G'。将图的边复制到压缩稀疏行数组中，重赋权重之后的数组被所有线程只读共享
+        * - h(v)=delt(s,v)由队列优化的bellman_ford（同`bellman_ford_spfa`）计算：新结点s到每个结点的边权重为0，因此初始时所有结点的h(v)=0，且都在队列中
+        * - 各个源点作为任务交给一个`ThreadPool`：每个工作线程拥有自己的距离数组、前驱数组与`IDMinQueue`，依次取出下一个尚未处理的源点执行dijkstra，
+        *   并将结果直接写入预先分配的D、P的对应行。不同的行由不同的线程写入，因此不需要加锁
+        *
+        * ### 算法性能
+        *
+        *  时间复杂度 O（V^2 + VElgV)，由多个线程分担；额外空间为每个线程 O(V)
+        */
+        template<typename GraphType>
+        std::pair<DenseMatrix<typename GraphType::EWeightType>,DenseMatrix<typename GraphType::VIDType>>
+        parallel_johnson(std::shared_ptr<GraphType> graph,std::size_t thread_num=0)
+        {
+            typedef typename GraphType::EWeightType EWeightType;
+            typedef typename GraphType::VIDType VIDType;
+            using IntroductionToAlgorithm::ParallelAlgorithm::thread_num_or_default;
+            using IntroductionToAlgorithm::ParallelAlgorithm::parallel_for;
+            using IntroductionToAlgorithm::ParallelAlgorithm::ThreadPool;
+            using IntroductionToAlgorithm::QueueAlgorithm::IDMinQueue;
+
+            if(!graph)
+                throw std::invalid_argument("parallel_johnson error: graph must not be nullptr!");
+            const std::size_t num=graph->vertexes.size();
+            const std::size_t threads=thread_num_or_default(thread_num);
+            const EWeightType INFINITE=unlimit<EWeightType>();
+
+            //************* 构建压缩稀疏行邻接表，忽略权重非负的自环 ****************
+            std::vector<std::size_t> offsets(num+1,0);
+            parallel_for(0,num,threads,[&](std::size_t i){
+                std::size_t degree=0;
+                if(vertex_exists(graph->vertexes,i))
+                    for(const auto& neighbor:graph->neighbors(i))
+                    {
+                        if(static_cast<std::size_t>(neighbor.first)!=i) degree++;
+                        else if(neighbor.second<0) throw std::invalid_argument("parallel_johnson error: graph must not contain minus circle!");
+                    }
+                offsets[i+1]=degree;
+            });
+            for(std::size_t i=0;i<num;i++) offsets[i+1]+=offsets[i];
+            std::vector<VIDType> targets(offsets[num]);
+            std::vector<EWeightType> weights(offsets[num]);
+            parallel_for(0,num,threads,[&](std::size_t i){
+                std::size_t k=offsets[i];
+                if(vertex_exists(graph->vertexes,i))
+                    for(const auto& neighbor:graph->neighbors(i))
+                        if(static_cast<std::size_t>(neighbor.first)!=i)
+                        {
+                            targets[k]=neighbor.first;
+                            weights[k]=neighbor.second;
+                            k++;
+                        }
+            });
+
+            //*******************  重赋权值：h(v)=delt(s,v)  **************
+            std::vector<EWeightType> H(num,0);
+            std::vector<std::size_t> length(num,0);     //当前最短路径（不含边(s,v)）的边数
+            std::vector<char> in_queue(num,1);
+            std::deque<std::size_t> queue;
+            for(std::size_t i=0;i<num;i++) queue.push_back(i);
+            while(!queue.empty())
+            {
+                std::size_t from=queue.front();
+                queue.pop_front();
+                in_queue[from]=0;
+                for(std::size_t k=offsets[from];k<offsets[from+1];k++)
+                {
+                    std::size_t to=targets[k];
+                    if(H[from]+weights[k]<H[to])
+                    {
+                        H[to]=H[from]+weights[k];
+                        length[to]=length[from]+1;
+                        if(length[to]>=num)
+                            throw std::invalid_argument("parallel_johnson error: graph must not contain minus circle!");
+                        if(!in_queue[to])
+                        {
+                            queue.push_back(to);
+                            in_queue[to]=1;
+                        }
+                    }
+                }
+            }
+            parallel_for(0,num,threads,[&](std::size_t from){
+                for(std::size_t k=offsets[from];k<offsets[from+1];k++)
+                    weights[k]+=H[from]-H[targets[k]];  // w'(u,v)=w(u,v)+h(u)-h(v)>=0
+            });
+
+            //******************  以每个顶点为源点，在线程池中并行执行dijkstra  *********
+            DenseMatrix<EWeightType> D(num,num,INFINITE);
+            DenseMatrix<VIDType> P(num,num,-1);
+            std::atomic<std::size_t> next_source(0);
+            std::size_t worker_num=std::min(threads,std::max<std::size_t>(num,1));
+            ThreadPool pool(worker_num);
+            for(std::size_t worker=0;worker<worker_num;worker++)
+                pool.submit([&](){
+                    std::vector<EWeightType> distance(num);       //本线程的距离数组
+                    std::vector<VIDType> parent(num);             //本线程的前驱数组
+                    IDMinQueue<EWeightType> queue(num);           //本线程的最小优先级队列
+                    std::size_t source;
+                    while((source=next_source.fetch_add(1))<num)
+                    {
+                        EWeightType* D_row=D.row(source);
+                        VIDType* P_row=P.row(source);
+                        D_row[source]=0;
+                        if(!vertex_exists(graph->vertexes,source)) continue;
+                        std::fill(distance.begin(),distance.end(),INFINITE);
+                        std::fill(parent.begin(),parent.end(),-1);
+                        distance[source]=0;
+                        queue.insert(source,0);
+                        while(!queue.is_empty())
+                        {
+                            std::size_t from=queue.extract_min();
+                            for(std::size_t k=offsets[from];k<offsets[from+1];k++)
+                            {
+                                std::size_t to=targets[k];
+                                EWeightType new_distance=distance[from]+weights[k];
+                                if(new_distance<distance[to])
+                                {
+                                    distance[to]=new_distance;
+                                    parent[to]=from;
+                                    queue.insert_or_decreate_key(to,new_distance);
+                                }
+                            }
+                        }
+                        for(std::size_t j=0;j<num;j++)
+                            if(distance[j]<INFINITE)
+                            {
+                                D_row[j]=distance[j]+H[j]-H[source];   // 恢复权值
+                                P_row[j]=parent[j];
+                            }
+                    }
+                });
+            pool.wait();
+            return std::make_pair(std::move(D),std::move(P));
+        }
     }
 }
 #endif // JOHNSON
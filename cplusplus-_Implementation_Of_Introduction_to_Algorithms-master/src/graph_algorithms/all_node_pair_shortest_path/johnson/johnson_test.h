@@ -18,14 +18,21 @@
  */
 #ifndef JOHNSON_TEST
 #define JOHNSON_TEST
+#include <random>
+#include <set>
 #include "../../../google_test/gtest.h"
 #include "johnson.h"
+#include "../floyd_warshall/floyd_warshall.h"
+#include "../../basic_graph/graph_representation/csr_graph/csrgraph.h"
 #include "../../basic_graph/graph_representation/graph_vertex/vertexp.h"
 #include "../../basic_graph/graph_representation/graph/graph.h"
 
 using IntroductionToAlgorithm::GraphAlgorithm::Graph;
 using IntroductionToAlgorithm::GraphAlgorithm::VertexP;
 using IntroductionToAlgorithm::GraphAlgorithm::johnson;
+using IntroductionToAlgorithm::GraphAlgorithm::parallel_johnson;
+using IntroductionToAlgorithm::GraphAlgorithm::parallel_floyd_warshall;
+using IntroductionToAlgorithm::GraphAlgorithm::CSRGraph;
 using IntroductionToAlgorithm::GraphAlgorithm::unlimit;
 
 namespace {
@@ -81,5 +88,93 @@ TEST_F(JohnsonTest,test_johnson)
     EXPECT_EQ(johnson(_graph),real_D);
 }
 
+//!JohnsonTest:测试 parallel_johnson 算法
+/*!
+*
+* `test_parallel_johnson`：测试 parallel_johnson 算法：结果与`johnson`、`floyd_warshall`相同，且不修改图中的顶点；图中有负权重环路时抛出异常
+*/
+TEST_F(JohnsonTest,test_parallel_johnson)
+{
+    std::shared_ptr<GType> empty_graph;
+    EXPECT_THROW(parallel_johnson(empty_graph),std::invalid_argument);
+
+    auto D=johnson(_graph);
+    auto FW=floyd_warshall(_graph);
+    for(int i=0;i<JS_N;i++)
+    {
+        _graph->vertexes[i]->key=100+i;
+        _graph->vertexes[i]->parent.reset();
+    }
+    for(std::size_t thread_num:{1,2,8})
+    {
+        auto result=parallel_johnson(_graph,thread_num);
+        for(int i=0;i<JS_N;i++)
+            for(int j=0;j<JS_N;j++)
+            {
+                EXPECT_EQ(result.first(i,j),D[i][j])<<"thread_num:"<<thread_num<<" i:"<<i<<" j:"<<j;
+                EXPECT_EQ(result.second(i,j),FW.second[i][j])<<"thread_num:"<<thread_num<<" i:"<<i<<" j:"<<j;
+            }
+    }
+    for(int i=0;i<JS_N;i++)
+    {
+        EXPECT_EQ(_graph->vertexes[i]->key,100+i);
+        EXPECT_FALSE(_graph->vertexes[i]->parent);
+    }
+    //*********  负权重环路 3->2->1->3  ***********
+    _graph->add_edge(std::make_tuple(2,3,-1));
+    _graph->adjust_edge(3,2,-5);
+    EXPECT_THROW(parallel_johnson(_graph),std::invalid_argument);
+    //*********  负权重的自环  ***********
+    std::vector<GType::EdgeTupleType> edges({std::make_tuple(0,1,1),std::make_tuple(1,1,-1)});
+    auto loop_graph=std::make_shared<CSRGraph<VertexP<int>>>(2,edges.begin(),edges.end(),unlimit<int>());
+    EXPECT_THROW(parallel_johnson(loop_graph),std::invalid_argument);
+}
+
+//!JohnsonTest:测试 parallel_johnson 算法
+/*!
+*
+* `test_parallel_johnson_random`：在含负权重边（但无负权重环路）且部分结点不可达的随机稀疏`CSRGraph`上，
+* parallel_johnson 的距离矩阵与`parallel_floyd_warshall`相同，且前驱矩阵给出的是一条最短路径
+*/
+TEST_F(JohnsonTest,test_parallel_johnson_random)
+{
+    //****  随机有向图：300个顶点，1500条边，权重为 w+p(u)-p(v)，其中w>=0，因此任何环路的权重都非负。最后10个顶点没有入边  ****
+    const int num=300;
+    std::mt19937 gen(10);
+    std::uniform_int_distribution<int> vertex_dist(0,num-11);
+    std::uniform_int_distribution<int> from_dist(0,num-1);
+    std::uniform_int_distribution<int> weight_dist(0,30);
+    std::vector<int> potential(num);
+    for(auto& p:potential) p=weight_dist(gen);
+    std::set<std::pair<int,int>> edge_set;
+    while(edge_set.size()<1500)
+    {
+        int from=from_dist(gen);
+        int to=vertex_dist(gen);
+        if(from!=to) edge_set.insert(std::make_pair(from,to));
+    }
+    std::vector<GType::EdgeTupleType> edges;
+    for(const auto& edge:edge_set)
+        edges.push_back(std::make_tuple(edge.first,edge.second,weight_dist(gen)+potential[edge.first]-potential[edge.second]));
+    auto graph=std::make_shared<CSRGraph<VertexP<int>>>(num,edges.begin(),edges.end(),unlimit<int>());
+
+    auto expected=parallel_floyd_warshall(graph).first;
+    for(std::size_t thread_num:{1,3})
+    {
+        auto result=parallel_johnson(graph,thread_num);
+        const auto& D=result.first;
+        const auto& P=result.second;
+        EXPECT_EQ(D,expected)<<"thread_num:"<<thread_num;
+        for(int i=0;i<num;i++)
+            for(int j=0;j<num;j++)
+            {
+                if(i==j||D(i,j)>=unlimit<int>())
+                    EXPECT_EQ(P(i,j),-1)<<"i:"<<i<<" j:"<<j;
+                else  //d_i_j = d_i_p + w(p,j)，p为j的前驱
+                    EXPECT_EQ(D(i,j),D(i,P(i,j))+graph->weight(P(i,j),j))<<"i:"<<i<<" j:"<<j;
+            }
+    }
+}
+
 #endif // JOHNSON_TEST
 
@@ -20,7 +20,10 @@
 #define MATRIX_SHORTEST_PATH
 #include <memory>
 #include <array>
+#include <utility>
 #include "../../../header.h"
+#include "../dense_matrix/densematrix.h"
+#include "../min_plus/minplus.h"
 namespace IntroductionToAlgorithm
 {
     namespace GraphAlgorithm
@@ -42,6 +45,8 @@ namespace IntroductionToAlgorithm
         *       - 将newL[i][j]设为正无穷，对所有的k,k 从 0...N-1(N次)，选取 L[i][k]+W[k][j]的最小值赋值给newL[i][j]
         * - 最终返回 newL
         *
+        * 这里将L与W复制到`DenseMatrix`中，由`min_plus_product`计算乘积。其中正无穷的处理是饱和的：正无穷加上一个负数仍然为正无穷。
+        *
         * 性能：时间复杂度 O(n^3)
         *
         */
@@ -50,22 +55,78 @@ namespace IntroductionToAlgorithm
             typedef typename MatrixType::value_type::value_type ValueType;
 
             static_assert(std::tuple_size<MatrixType>::value==std::tuple_size<typename MatrixType::value_type>::value,"extend_path error:matrix must be N*N size!"); //必须是方阵
-            std::size_t row_num=std::tuple_size<MatrixType>::value;
-            std::size_t col_num=std::tuple_size<typename MatrixType::value_type>::value;
+            const std::size_t N=std::tuple_size<MatrixType>::value;
 
-            MatrixType newL;
-            for(int i=0;i<row_num;i++)
-                for(int j=0;j<col_num;j++)
+            DenseMatrix<ValueType> dense_L(N,N),dense_W(N,N),dense_newL;
+            for(std::size_t i=0;i<N;i++)
+                for(std::size_t j=0;j<N;j++)
                 {
-                    newL[i][j]=unlimit<ValueType>();
-                    for(int k=0;k<row_num;k++)
-                    {
-                        newL[i][j]=std::min(newL[i][j],L[i][k]+W[k][j]);
-                    }
+                    dense_L(i,j)=L[i][j];
+                    dense_W(i,j)=W[i][j];
                 }
+            min_plus_product(dense_L,dense_W,dense_newL);
+            MatrixType newL;
+            for(std::size_t i=0;i<N;i++)
+                for(std::size_t j=0;j<N;j++)
+                    newL[i][j]=dense_newL(i,j);
             return newL;
         }
 
+        //!matrix_shortest_path：返回所有节点对的最短路径的矩阵乘法算法。算法导论25章25.1节
+        /*!
+        * \param W:n*n的权重矩阵，可以由`weight_matrix(graph)`得到。若它不是方阵则抛出异常
+        * \param thread_num:线程数量。若为0则使用硬件支持的并发线程数量
+        * \return: 一个n*n的矩阵(d_i_j)，其中 d_i_j 代表的是结点i到j的一条最短路径的权重；不可达时为正无穷
+        *
+        * 它是`matrix_shortest_path(graph)`的运行时大小的版本：执行n-2次 L=L.W，每次乘积都由`min_plus_product`计算。
+        * 整个过程只使用两个缓冲区：乘积写入另一个缓冲区，然后交换两者。W的打包缓冲区也在各次乘积之间复用。
+        *
+        * 性能：时间复杂度O(V^4)
+        */
+        template<typename T> DenseMatrix<T> matrix_shortest_path(const DenseMatrix<T>& W,std::size_t thread_num=0)
+        {
+            if(W.rows()!=W.cols())
+                throw std::invalid_argument("matrix_shortest_path error: W must be N*N size!");
+            DenseMatrix<T> L=W; //L<1>
+            DenseMatrix<T> buffer(W.rows(),W.cols());
+            std::vector<T> packed;
+            for(std::size_t m=1;m+1<W.rows();m++) //扩展 N-2次
+            {
+                min_plus_product(L,W,buffer,packed,thread_num);
+                std::swap(L,buffer);
+            }
+            return L;
+        }
+
+        //!matrix_shortest_path_fast：返回所有节点对的最短路径的矩阵乘法复平方算法。算法导论25章25.1节
+        /*!
+        * \param W:n*n的权重矩阵，可以由`weight_matrix(graph)`得到。若它不是方阵则抛出异常
+        * \param thread_num:线程数量。若为0则使用硬件支持的并发线程数量
+        * \return: 一个n*n的矩阵(d_i_j)，其中 d_i_j 代表的是结点i到j的一条最短路径的权重；不可达时为正无穷
+        *
+        * 它是`matrix_shortest_path_fast(graph)`的运行时大小的版本：执行 L=L.L 直到L包含的路径边数不小于n-1，
+        * 每次平方都由`min_plus_product`计算。整个过程只使用两个缓冲区：乘积写入另一个缓冲区，然后交换两者。打包缓冲区也在各次平方之间复用。
+        *
+        * 若某次平方之后L不再改变，则L已经是最终结果，提前返回。
+        *
+        * 性能：时间复杂度O(V^3lgV)
+        */
+        template<typename T> DenseMatrix<T> matrix_shortest_path_fast(const DenseMatrix<T>& W,std::size_t thread_num=0)
+        {
+            if(W.rows()!=W.cols())
+                throw std::invalid_argument("matrix_shortest_path_fast error: W must be N*N size!");
+            DenseMatrix<T> L=W; //L<1>
+            DenseMatrix<T> buffer(W.rows(),W.cols());
+            std::vector<T> packed;
+            for(std::size_t m=1;m+1<W.rows();m<<=1)
+            {
+                min_plus_product(L,L,buffer,packed,thread_num);
+                std::swap(L,buffer);
+                if(L==buffer) break;  //已经收敛
+            }
+            return L;
+        }
+
 
 
         //!matrix_shortest_path：返回所有节点对的最短路径的矩阵乘法算法。算法导论25章25.1节
@@ -117,10 +178,12 @@ namespace IntroductionToAlgorithm
         *
         * ### 算法步骤
         *
-        * - 初始化：从图中获取权重矩阵 W
+        * - 初始化：从图中获取权重矩阵 W（`weight_matrix`）
         * - 执行循环扩展L，其中 L<0>=W, L<k>=extend_path(L<k-1>,W)
         * - 最终返回 L<N-1>
         *
+        * 这里的循环由运行时大小的`matrix_shortest_path(W)`完成，然后将结果复制到返回的`std::array`中。
+        *
         * ### 算法性能
         *
         * 时间复杂度O(V^4)
@@ -133,28 +196,12 @@ namespace IntroductionToAlgorithm
 
             if(!graph)
                 throw std::invalid_argument("matrix_shortest_path error: graph must not be nullptr!");
-            MatrixType W;
-            //**************  从图中创建权重矩阵  ***************
-            //****  这里不能直接从图的矩阵描述中提取，因为这里要求 w(i,i)=0，而图的矩阵描述中，结点可能有指向自己的边
+            auto L=matrix_shortest_path(weight_matrix(graph));
+            MatrixType result;
             for(int i=0;i<GraphType::NUM;i++)
                 for(int j=0;j<GraphType::NUM;j++)
-                {
-                    if(i==j) W[i][j]=0;
-                    else
-                    {
-                        if(!graph->has_edge(i,j))
-                            W[i][j]=unlimit<EWeightType>();
-                        else
-                            W[i][j]=graph->weight(i,j);
-                    }
-                 }
-            //*********  计算 L <n-1> ***********
-            MatrixType L=W; //L<0>
-            for(int i=0;i<GraphType::NUM-2;i++) //扩展 N-2次
-            {
-                L=extend_path(L,W);
-            }
-            return L;
+                    result[i][j]=L(i,j);
+            return result;
         }
 
         //!matrix_shortest_path：返回所有节点对的最短路径的矩阵乘法复平方算法。算法导论25章25.1节
@@ -200,10 +247,12 @@ namespace IntroductionToAlgorithm
         *
         * ### 算法步骤
         *
-        * - 初始化：从图中获取权重矩阵 W
+        * - 初始化：从图中获取权重矩阵 W（`weight_matrix`）
         * - 执行循环扩展L，其中 L<0>=W, L<2*k>=extend_path(L<k>,L<k>)
         * - 最终返回 L<log(N-1)的上界整数>
         *
+        * 这里的循环由运行时大小的`matrix_shortest_path_fast(W)`完成，然后将结果复制到返回的`std::array`中。
+        *
         * ### 算法性能
         * 时间复杂度O(V^3lgV)
         */
@@ -215,31 +264,12 @@ namespace IntroductionToAlgorithm
 
             if(!graph)
                 throw std::invalid_argument("matrix_shortest_path_fast error: graph must not be nullptr!");
-
-            MatrixType W;
-            //**************  从图中创建权重矩阵  ***************
-            //****  这里不能直接从图的矩阵描述中提取，因为这里要求 w(i,i)=0，而图的矩阵描述中，结点可能有指向自己的边
+            auto L=matrix_shortest_path_fast(weight_matrix(graph));
+            MatrixType result;
             for(int i=0;i<GraphType::NUM;i++)
                 for(int j=0;j<GraphType::NUM;j++)
-                {
-                    if(i==j) W[i][j]=0;
-                    else
-                    {
-                        if(!graph->has_edge(i,j))
-                            W[i][j]=unlimit<EWeightType>();
-                        else
-                            W[i][j]=graph->weight(i,j);
-                    }
-                 }
-            //*********  计算 L <n-1> ***********
-            MatrixType L=W;
-            int m=1;
-            while(m<GraphType::NUM-1)
-            {
-                L=extend_path(L,L);
-                m=m<<1;
-            }
-            return L;
+                    result[i][j]=L(i,j);
+            return result;
         }
 
     }
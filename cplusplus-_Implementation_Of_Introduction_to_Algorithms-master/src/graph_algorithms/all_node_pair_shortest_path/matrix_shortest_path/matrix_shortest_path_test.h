@@ -18,8 +18,11 @@
  */
 #ifndef MATRIX_SHORTEST_PATH_TEST
 #define MATRIX_SHORTEST_PATH_TEST
+#include <random>
 #include "../../../google_test/gtest.h"
 #include "matrix_shortest_path.h"
+#include "../floyd_warshall/floyd_warshall.h"
+#include "../../basic_graph/graph_representation/csr_graph/csrgraph.h"
 #include "../../basic_graph/graph_representation/graph_vertex/vertex.h"
 #include "../../basic_graph/graph_representation/graph/graph.h"
 
@@ -29,6 +32,10 @@ using IntroductionToAlgorithm::GraphAlgorithm::extend_path;
 using IntroductionToAlgorithm::GraphAlgorithm::matrix_shortest_path;
 using IntroductionToAlgorithm::GraphAlgorithm::matrix_shortest_path_fast;
 using IntroductionToAlgorithm::GraphAlgorithm::unlimit;
+using IntroductionToAlgorithm::GraphAlgorithm::weight_matrix;
+using IntroductionToAlgorithm::GraphAlgorithm::DenseMatrix;
+using IntroductionToAlgorithm::GraphAlgorithm::parallel_floyd_warshall;
+using IntroductionToAlgorithm::GraphAlgorithm::CSRGraph;
 
 namespace {
     const int MT_N= 5;  /*!< 测试的图顶点数量*/
@@ -98,5 +105,36 @@ TEST_F(MatrixShortestPathTest,test_matrix_shortest_path_fast)
                             std::array<typename GType::EWeightType,MT_N>({8,5,1,6,0})};
     EXPECT_EQ(matrix_shortest_path_fast(_graph),real_result);
 }
+//!MatrixShortestPathTest:测试运行时大小的 matrix_shortest_path、matrix_shortest_path_fast算法
+/*!
+*
+* `test_matrix_shortest_path_dense`：在含负权重边（但无负权重环路）且部分结点不可达的随机`CSRGraph`上，
+* 两个算法的结果都与`parallel_floyd_warshall`相同，不可达的结点对为正无穷
+*/
+TEST_F(MatrixShortestPathTest,test_matrix_shortest_path_dense)
+{
+    EXPECT_THROW(matrix_shortest_path(DenseMatrix<int>(2,3)),std::invalid_argument);
+    EXPECT_THROW(matrix_shortest_path_fast(DenseMatrix<int>(2,3)),std::invalid_argument);
+
+    //****  随机有向图：60个顶点，权重为 w+p(u)-p(v)，其中w>=0，因此任何环路的权重都非负。最后5个顶点没有入边  ****
+    const int num=60;
+    std::mt19937 gen(8);
+    std::uniform_int_distribution<int> weight_dist(0,30);
+    std::uniform_int_distribution<int> edge_dist(0,14);
+    std::vector<int> potential(num);
+    for(auto& p:potential) p=weight_dist(gen);
+    std::vector<GType::EdgeTupleType> edges;
+    for(int i=0;i<num;i++)
+        for(int j=0;j<num-5;j++)
+            if(i!=j&&edge_dist(gen)==0)
+                edges.push_back(std::make_tuple(i,j,weight_dist(gen)+potential[i]-potential[j]));
+    auto graph=std::make_shared<CSRGraph<Vertex<int>>>(num,edges.begin(),edges.end(),unlimit<int>());
+
+    auto D=parallel_floyd_warshall(graph).first;
+    EXPECT_EQ(D(0,num-1),unlimit<int>());
+    auto W=weight_matrix(graph);
+    EXPECT_EQ(matrix_shortest_path(W,2),D);
+    EXPECT_EQ(matrix_shortest_path_fast(W,2),D);
+}
 #endif // MATRIX_SHORTEST_PATH_TEST
 
@@ -0,0 +1,315 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef MINPLUS
+#define MINPLUS
+#include<vector>
+#include<algorithm>
+#include<stdexcept>
+#include<cstddef>
+#include<limits>
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define MIN_PLUS_X86_DISPATCH   /*!< 在运行期根据CPU选择AVX-512、AVX2或者标量的int微内核*/
+#include<immintrin.h>
+#endif
+#include"../../../header.h"
+#include"../dense_matrix/densematrix.h"
+#include"../../../parallel_algorithms/parallel_for/parallelfor.h"
+namespace IntroductionToAlgorithm
+{
+    namespace GraphAlgorithm
+    {
+        const std::size_t MIN_PLUS_MR=4;  /*!< min-plus微内核一次处理的A的行数*/
+        const std::size_t MIN_PLUS_NR=16; /*!< min-plus微内核一次处理的B的列数，即B的一个打包面板的宽度*/
+
+        //!_MinPlusKernel：min-plus乘积的微内核
+        /*!
+        *
+        * 计算C的`row_num`(<=MR)行、NR列的一个子块：c_r_j = min(正无穷, min{a_r_k + b_k_j : k=0...k_num-1})，其中：
+        *
+        * - `a_rows[r]`为A的第r行的首地址
+        * - `panel`为B中对应的NR列打包后的面板：第k行的NR个元素连续存放在`panel[k*NR...(k+1)*NR)`中。打包时不足NR列的部分用正无穷填充
+        * - `c_rows[r]`为C的第r行中该子块的首地址，只写入前`col_num`(<=NR)个元素
+        *
+        * 正无穷的处理是饱和的：a_r_k或者b_k_j大于等于正无穷时，a_r_k+b_k_j视为正无穷（而不是一个略小于正无穷的值）；
+        * 和大于等于正无穷时也视为正无穷。
+        *
+        * 要求有限的元素都不小于负无穷（即`-unlimit<T>()`），由`min_plus_product`检查。由于正无穷为最大值的一半，
+        * 两个在[负无穷,正无穷)之间的数相加不会溢出；和大于等于正无穷时不会小于累加器的初值（正无穷），因此结果不超过正无穷。
+        * 大于等于正无穷的元素不参与加法（SIMD版本中参与加法，但其结果被掩码排除或者被max修正为正无穷）。
+        *
+        * 通用版本用标量代码写成，累加器为一个MR*NR的局部数组，便于编译器将其保存在寄存器中并向量化。
+        * 对于`int`类型，`select()`在运行期根据CPU支持的指令集选择下面的AVX-512或者AVX2版本，因此不需要以`-mavx2`等选项编译。
+        */
+        template<typename T>
+        struct _MinPlusKernel
+        {
+            typedef void (*KernelType)(const T* const*,std::size_t,const T*,std::size_t,T* const*,std::size_t); /*!< 微内核的函数指针类型*/
+            //!select:返回本机可用的最快的微内核
+            static KernelType select() {return &run;}
+            //!name:返回`select()`选择的微内核的名字
+            static const char* name() {return "scalar";}
+            static void run(const T* const* a_rows,std::size_t row_num,const T* panel,std::size_t k_num,T* const* c_rows,std::size_t col_num)
+            {
+                const T INFINITE=unlimit<T>();
+                T acc[MIN_PLUS_MR][MIN_PLUS_NR];
+                for(std::size_t r=0;r<MIN_PLUS_MR;r++)
+                    for(std::size_t c=0;c<MIN_PLUS_NR;c++)
+                        acc[r][c]=INFINITE;
+                for(std::size_t k=0;k<k_num;k++)
+                {
+                    const T* b=panel+k*MIN_PLUS_NR;
+                    for(std::size_t r=0;r<row_num;r++)
+                    {
+                        const T a=a_rows[r][k];
+                        if(a>=INFINITE) continue;
+                        for(std::size_t c=0;c<MIN_PLUS_NR;c++)
+                        {
+                            const T sum=b[c]>=INFINITE?INFINITE:a+b[c];
+                            acc[r][c]=std::min(acc[r][c],sum);
+                        }
+                    }
+                }
+                for(std::size_t r=0;r<row_num;r++)
+                    for(std::size_t c=0;c<col_num;c++)
+                        c_rows[r][c]=acc[r][c];
+            }
+        };
+
+#ifdef MIN_PLUS_X86_DISPATCH
+        //!_min_plus_cpu_has_avx512：返回CPU是否支持AVX-512F
+        inline bool _min_plus_cpu_has_avx512()
+        {
+            static const bool result=__builtin_cpu_supports("avx512f");
+            return result;
+        }
+        //!_min_plus_cpu_has_avx2：返回CPU是否支持AVX2
+        inline bool _min_plus_cpu_has_avx2()
+        {
+            static const bool result=__builtin_cpu_supports("avx2");
+            return result;
+        }
+        //!_min_plus_kernel_avx512：AVX-512版本的int min-plus微内核
+        /*!
+        *
+        * 每一行的NR=16个累加器恰好放在一个512位寄存器中，共MR个累加器寄存器。对每个k，面板的一行只加载一次，
+        * 其中为正无穷的位置用掩码排除，MR行共享这个掩码。只有`_min_plus_cpu_has_avx512()`为真时才能调用
+        */
+        __attribute__((target("avx512f")))
+        inline void _min_plus_kernel_avx512(const int* const* a_rows,std::size_t row_num,const int* panel,std::size_t k_num,int* const* c_rows,std::size_t col_num)
+        {
+            const int INFINITE=unlimit<int>();
+            const __m512i inf=_mm512_set1_epi32(INFINITE);
+            __m512i acc[MIN_PLUS_MR];
+            for(std::size_t r=0;r<MIN_PLUS_MR;r++) acc[r]=inf;
+            for(std::size_t k=0;k<k_num;k++)
+            {
+                const __m512i b=_mm512_loadu_si512(panel+k*MIN_PLUS_NR);
+                const __mmask16 finite=_mm512_cmplt_epi32_mask(b,inf);     //b_k_j不为正无穷的位置
+                for(std::size_t r=0;r<row_num;r++)
+                {
+                    const int a=a_rows[r][k];
+                    if(a>=INFINITE) continue;
+                    const __m512i sum=_mm512_add_epi32(_mm512_set1_epi32(a),b);
+                    acc[r]=_mm512_mask_min_epi32(acc[r],finite,acc[r],sum);
+                }
+            }
+            const __mmask16 store_mask=static_cast<__mmask16>((1u<<col_num)-1);
+            for(std::size_t r=0;r<row_num;r++)
+                _mm512_mask_storeu_epi32(c_rows[r],store_mask,acc[r]);
+        }
+        //!_min_plus_kernel_avx2：AVX2版本的int min-plus微内核
+        /*!
+        *
+        * 每一行的NR=16个累加器放在两个256位寄存器中，共2*MR个累加器寄存器。对每个k，面板的一行只加载一次，
+        * 并预先计算 bound=(b_k_j为正无穷 ? 正无穷 : INT_MIN)，MR行共享它：max(a+b,bound)使得b_k_j为正无穷时和为正无穷。
+        * AVX2没有32位的饱和加法，这样处理只需要一次 max 指令。只有`_min_plus_cpu_has_avx2()`为真时才能调用
+        */
+        __attribute__((target("avx2")))
+        inline void _min_plus_kernel_avx2(const int* const* a_rows,std::size_t row_num,const int* panel,std::size_t k_num,int* const* c_rows,std::size_t col_num)
+        {
+            const int INFINITE=unlimit<int>();
+            const __m256i inf=_mm256_set1_epi32(INFINITE);
+            const __m256i inf_minus_1=_mm256_set1_epi32(INFINITE-1);
+            const __m256i lowest=_mm256_set1_epi32(std::numeric_limits<int>::min());
+            __m256i acc[MIN_PLUS_MR][2];
+            for(std::size_t r=0;r<MIN_PLUS_MR;r++) acc[r][0]=acc[r][1]=inf;
+            for(std::size_t k=0;k<k_num;k++)
+            {
+                const int* b=panel+k*MIN_PLUS_NR;
+                const __m256i b0=_mm256_loadu_si256(reinterpret_cast<const __m256i*>(b));
+                const __m256i b1=_mm256_loadu_si256(reinterpret_cast<const __m256i*>(b+8));
+                const __m256i bound0=_mm256_blendv_epi8(lowest,inf,_mm256_cmpgt_epi32(b0,inf_minus_1));
+                const __m256i bound1=_mm256_blendv_epi8(lowest,inf,_mm256_cmpgt_epi32(b1,inf_minus_1));
+                for(std::size_t r=0;r<row_num;r++)
+                {
+                    const int a=a_rows[r][k];
+                    if(a>=INFINITE) continue;
+                    const __m256i va=_mm256_set1_epi32(a);
+                    acc[r][0]=_mm256_min_epi32(acc[r][0],_mm256_max_epi32(_mm256_add_epi32(va,b0),bound0));
+                    acc[r][1]=_mm256_min_epi32(acc[r][1],_mm256_max_epi32(_mm256_add_epi32(va,b1),bound1));
+                }
+            }
+            for(std::size_t r=0;r<row_num;r++)
+            {
+                int result[MIN_PLUS_NR];
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(result),acc[r][0]);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(result+8),acc[r][1]);
+                std::copy(result,result+col_num,c_rows[r]);
+            }
+        }
+        //!select:`int`类型按CPU支持的指令集依次选择AVX-512、AVX2、标量版本的微内核
+        template<>
+        inline _MinPlusKernel<int>::KernelType _MinPlusKernel<int>::select()
+        {
+            if(_min_plus_cpu_has_avx512()) return &_min_plus_kernel_avx512;
+            if(_min_plus_cpu_has_avx2()) return &_min_plus_kernel_avx2;
+            return &run;
+        }
+        //!name:返回`int`类型在本机选择的微内核的名字
+        template<>
+        inline const char* _MinPlusKernel<int>::name()
+        {
+            if(_min_plus_cpu_has_avx512()) return "avx512";
+            if(_min_plus_cpu_has_avx2()) return "avx2";
+            return "scalar";
+        }
+#endif
+
+        //!min_plus_kernel_name：返回`int`类型的`min_plus_product`在本机使用的微内核的名字："avx512"、"avx2"或者"scalar"
+        inline const char* min_plus_kernel_name()
+        {
+            return _MinPlusKernel<int>::name();
+        }
+
+        //!_min_plus_check_range：检查矩阵中的元素都不小于负无穷
+        /*!
+        * \param M:待检查的矩阵
+        * \return: void
+        *
+        * 若存在小于`-unlimit<T>()`的元素则抛出异常。无符号类型无需检查
+        */
+        template<typename T>
+        void _min_plus_check_range(const DenseMatrix<T>& M)
+        {
+            if(!std::numeric_limits<T>::is_signed) return;
+            const T LOWEST=-unlimit<T>();
+            for(std::size_t i=0;i<M.rows();i++)
+            {
+                const T* row=M.row(i);
+                for(std::size_t j=0;j<M.cols();j++)
+                    if(row[j]<LOWEST)
+                        throw std::invalid_argument("min_plus_product error: element must not be less than -unlimit<T>()!");
+            }
+        }
+
+        //!min_plus_product：矩阵的min-plus（热带半环）乘积，算法导论25章25.1节
+        /*!
+        * \param A:左矩阵，大小为 m*n
+        * \param B:右矩阵，大小为 n*p。若A的列数不等于B的行数则抛出异常
+        * \param C:结果矩阵，将被重新设置为 m*p。它不能与A或者B是同一个对象，否则抛出异常
+        * \param packed:B的打包缓冲区，将被重新设置大小。多次计算乘积时由调用者传入同一个缓冲区，避免每次都分配内存
+        * \param thread_num:线程数量。若为0则使用硬件支持的并发线程数量
+        * \return: void
+        *
+        * 计算 c_i_j = min{a_i_k + b_k_j : k=0...n-1}。它就是`extend_path`中的运算，其中大于等于正无穷的值都视为正无穷，且结果不超过正无穷。
+        *
+        * 要求A与B的元素都不小于负无穷（即`-unlimit<T>()`），否则抛出异常。这保证了微内核中的加法不会溢出。
+        *
+        * ### 算法步骤
+        *
+        * - 打包：将B按照每NR列划分为若干面板，每个面板中第k行的NR个元素连续存放，不足NR列的部分用正无穷填充。
+        *   这样微内核沿着k方向顺序读取面板，而不是跨行读取B
+        * - 将A的行按照每MR行划分为若干行块，各行块并行处理。对每个行块和每个面板，调用微内核计算C中的一个MR*NR子块。
+        *   微内核的累加器保存在寄存器中，整个k循环中都不写回内存
+        *
+        * 微内核对`int`类型有AVX2与AVX-512的版本，在运行期根据CPU选择；对其他类型使用可以被编译器向量化的通用版本。
+        *
+        * ### 算法性能
+        *
+        * 时间复杂度 O(m*n*p)，额外空间 O(n*p)（即`packed`）
+        */
+        template<typename T>
+        void min_plus_product(const DenseMatrix<T>& A,const DenseMatrix<T>& B,DenseMatrix<T>& C,std::vector<T>& packed,std::size_t thread_num=0)
+        {
+            using IntroductionToAlgorithm::ParallelAlgorithm::thread_num_or_default;
+            using IntroductionToAlgorithm::ParallelAlgorithm::parallel_for;
+            if(A.cols()!=B.rows())
+                throw std::invalid_argument("min_plus_product error: A.cols() must equal B.rows()!");
+            if(&C==&A||&C==&B)
+                throw std::invalid_argument("min_plus_product error: C must not be A or B!");
+            _min_plus_check_range(A);
+            _min_plus_check_range(B);
+
+            const T INFINITE=unlimit<T>();
+            std::size_t m=A.rows(),n=A.cols(),p=B.cols();
+            if(C.rows()!=m||C.cols()!=p)
+                C=DenseMatrix<T>(m,p);
+            if(m==0||p==0) return;
+            std::size_t threads=thread_num_or_default(thread_num);
+            //************  打包B  ***************
+            std::size_t panel_num=(p+MIN_PLUS_NR-1)/MIN_PLUS_NR;
+            packed.resize(panel_num*n*MIN_PLUS_NR);
+            parallel_for(0,panel_num,threads,[&](std::size_t panel){
+                T* dest=packed.data()+panel*n*MIN_PLUS_NR;
+                std::size_t col_begin=panel*MIN_PLUS_NR;
+                std::size_t col_num=std::min(MIN_PLUS_NR,p-col_begin);
+                for(std::size_t k=0;k<n;k++)
+                {
+                    std::copy(B.row(k)+col_begin,B.row(k)+col_begin+col_num,dest+k*MIN_PLUS_NR);
+                    std::fill(dest+k*MIN_PLUS_NR+col_num,dest+(k+1)*MIN_PLUS_NR,INFINITE);  //缓冲区可能被复用，每次都填充
+                }
+            },1);
+            //************  按行块并行计算  ***************
+            std::size_t row_block_num=(m+MIN_PLUS_MR-1)/MIN_PLUS_MR;
+            const auto kernel=_MinPlusKernel<T>::select();
+            parallel_for(0,row_block_num,threads,[&](std::size_t row_block){
+                std::size_t row_begin=row_block*MIN_PLUS_MR;
+                std::size_t row_num=std::min(MIN_PLUS_MR,m-row_begin);
+                const T* a_rows[MIN_PLUS_MR];
+                T* c_rows[MIN_PLUS_MR];
+                for(std::size_t r=0;r<row_num;r++)
+                    a_rows[r]=A.row(row_begin+r);
+                for(std::size_t panel=0;panel<panel_num;panel++)
+                {
+                    std::size_t col_begin=panel*MIN_PLUS_NR;
+                    for(std::size_t r=0;r<row_num;r++)
+                        c_rows[r]=C.row(row_begin+r)+col_begin;
+                    kernel(a_rows,row_num,packed.data()+panel*n*MIN_PLUS_NR,n,c_rows,std::min(MIN_PLUS_NR,p-col_begin));
+                }
+            },1);
+        }
+        //!min_plus_product：矩阵的min-plus（热带半环）乘积，算法导论25章25.1节
+        /*!
+        * \param A:左矩阵，大小为 m*n
+        * \param B:右矩阵，大小为 n*p。若A的列数不等于B的行数则抛出异常
+        * \param C:结果矩阵，将被重新设置为 m*p。它不能与A或者B是同一个对象，否则抛出异常
+        * \param thread_num:线程数量。若为0则使用硬件支持的并发线程数量
+        * \return: void
+        *
+        * 它使用一个局部的打包缓冲区调用上面的版本，适用于只计算一次乘积的情形
+        */
+        template<typename T>
+        void min_plus_product(const DenseMatrix<T>& A,const DenseMatrix<T>& B,DenseMatrix<T>& C,std::size_t thread_num=0)
+        {
+            std::vector<T> packed;
+            min_plus_product(A,B,C,packed,thread_num);
+        }
+    }
+}
+#endif // MINPLUS
@@ -0,0 +1,186 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef MINPLUS_TEST
+#define MINPLUS_TEST
+#include <random>
+#include "../../../google_test/gtest.h"
+#include "minplus.h"
+
+using IntroductionToAlgorithm::GraphAlgorithm::DenseMatrix;
+using IntroductionToAlgorithm::GraphAlgorithm::min_plus_product;
+using IntroductionToAlgorithm::GraphAlgorithm::unlimit;
+using IntroductionToAlgorithm::GraphAlgorithm::_MinPlusKernel;
+using IntroductionToAlgorithm::GraphAlgorithm::MIN_PLUS_MR;
+using IntroductionToAlgorithm::GraphAlgorithm::MIN_PLUS_NR;
+
+//!MinPlusTest:测试类，用于为测试提供基础数据
+/*!
+*
+* `MinPlusTest`是 `::testing::Test` 的子类。它主要用于为每一个`TEST_F`准备测试环境
+*/
+class MinPlusTest:public ::testing::Test
+{
+protected:
+    void SetUp(){}
+    void TearDown(){}
+
+    //!random_matrix:生成一个随机矩阵，其中约1/4的元素为正无穷，其余元素在[-50,100]之间
+    template<typename T> DenseMatrix<T> random_matrix(std::size_t row_num,std::size_t col_num)
+    {
+        std::uniform_int_distribution<int> value_dist(-50,100);
+        std::uniform_int_distribution<int> inf_dist(0,3);
+        DenseMatrix<T> matrix(row_num,col_num);
+        for(std::size_t i=0;i<row_num;i++)
+            for(std::size_t j=0;j<col_num;j++)
+                matrix(i,j)=inf_dist(_gen)==0?unlimit<T>():static_cast<T>(value_dist(_gen));
+        return matrix;
+    }
+    //!naive_product:朴素的三重循环min-plus乘积，正无穷的处理是饱和的
+    template<typename T> DenseMatrix<T> naive_product(const DenseMatrix<T>& A,const DenseMatrix<T>& B)
+    {
+        DenseMatrix<T> C(A.rows(),B.cols(),unlimit<T>());
+        for(std::size_t i=0;i<A.rows();i++)
+            for(std::size_t j=0;j<B.cols();j++)
+                for(std::size_t k=0;k<A.cols();k++)
+                    if(A(i,k)<unlimit<T>()&&B(k,j)<unlimit<T>())
+                        C(i,j)=std::min(C(i,j),A(i,k)+B(k,j));
+        return C;
+    }
+
+    std::mt19937 _gen; /*!< 随机数发生器*/
+};
+
+//!MinPlusTest:测试 min_plus_product
+/*!
+*
+* `test_min_plus_product`：测试 min_plus_product：对各种不是MR、NR整数倍的大小以及各种线程数量，结果与朴素算法相同
+*/
+TEST_F(MinPlusTest,test_min_plus_product)
+{
+    const std::size_t sizes[][3]={{1,1,1},{1,5,1},{5,5,5},{4,16,16},{7,9,33},{35,17,20},{64,64,64}};
+    for(const auto& size:sizes)
+        for(std::size_t thread_num:{1,3})
+        {
+            auto A=random_matrix<int>(size[0],size[1]);
+            auto B=random_matrix<int>(size[1],size[2]);
+            DenseMatrix<int> C;
+            min_plus_product(A,B,C,thread_num);
+            EXPECT_EQ(C,naive_product(A,B))<<"size:"<<size[0]<<","<<size[1]<<","<<size[2]<<" thread_num:"<<thread_num;
+        }
+    //*********  其他类型使用通用的微内核  ***********
+    auto A=random_matrix<long long>(19,23);
+    auto B=random_matrix<long long>(23,18);
+    DenseMatrix<long long> C;
+    min_plus_product(A,B,C,2);
+    EXPECT_EQ(C,naive_product(A,B));
+}
+
+//!MinPlusTest:测试 min_plus_product
+/*!
+*
+* `test_min_plus_infinite`：测试 min_plus_product 的饱和性：正无穷加上负数仍然为正无穷，和超过正无穷时为正无穷，
+* 大于正无穷的元素（直到最大值）与负无穷相加不会溢出；复用打包缓冲区时结果不变；以及参数错误、元素小于负无穷时抛出异常
+*/
+TEST_F(MinPlusTest,test_min_plus_infinite)
+{
+    const int INF=unlimit<int>();
+    DenseMatrix<int> A(2,2),B(2,2),C;
+    A(0,0)=-10; A(0,1)=INF;
+    A(1,0)=INF-5; A(1,1)=INF;
+    B(0,0)=INF; B(0,1)=10;
+    B(1,0)=-20; B(1,1)=-30;
+    min_plus_product(A,B,C);
+    EXPECT_EQ(C(0,0),INF); // -10+正无穷，正无穷+(-20)
+    EXPECT_EQ(C(0,1),0);
+    EXPECT_EQ(C(1,0),INF); // (INF-5)+正无穷，正无穷+(-20)
+    EXPECT_EQ(C(1,1),INF); // (INF-5)+10 超过正无穷
+
+    //********* 取值范围的边界：[-INF,INF)为有限值，[INF,最大值]都视为正无穷 *********
+    const int MAX=std::numeric_limits<int>::max();
+    DenseMatrix<int> A2(3,2),B2(2,19),C2;   //19列：不是NR的整数倍，最后一个面板有填充
+    A2(0,0)=-INF; A2(0,1)=-INF;
+    A2(1,0)=INF-1; A2(1,1)=MAX;
+    A2(2,0)=-INF; A2(2,1)=INF-1;
+    for(std::size_t j=0;j<B2.cols();j++)
+    {
+        B2(0,j)=(j%2==0)?MAX:-INF;
+        B2(1,j)=INF-1;
+    }
+    std::vector<int> packed(1,-1);          //复用的缓冲区中原有的值不影响结果
+    for(int round=0;round<2;round++)
+    {
+        min_plus_product(A2,B2,C2,packed,2);
+        for(std::size_t j=0;j<B2.cols();j++)
+        {
+            EXPECT_EQ(C2(0,j),(j%2==0)?-1:-2*INF);
+            EXPECT_EQ(C2(1,j),(j%2==0)?INF:-1);
+            EXPECT_EQ(C2(2,j),(j%2==0)?INF:-2*INF);
+        }
+    }
+    A2(2,1)=-INF-1;
+    EXPECT_THROW(min_plus_product(A2,B2,C2),std::invalid_argument);
+
+    EXPECT_THROW(min_plus_product(A,DenseMatrix<int>(3,2),C),std::invalid_argument);
+    EXPECT_THROW(min_plus_product(A,B,A),std::invalid_argument);
+    EXPECT_THROW(min_plus_product(A,B,B),std::invalid_argument);
+}
+//!MinPlusTest:测试 min-plus 微内核
+/*!
+*
+* `test_min_plus_kernels`：本机CPU支持的每一个`int`SIMD微内核，对取值范围边界上的随机数据、各种行数与列数，结果都与标量微内核相同
+*/
+TEST_F(MinPlusTest,test_min_plus_kernels)
+{
+    typedef _MinPlusKernel<int>::KernelType KernelType;
+    std::vector<std::pair<const char*,KernelType>> kernels;
+#ifdef MIN_PLUS_X86_DISPATCH
+    if(IntroductionToAlgorithm::GraphAlgorithm::_min_plus_cpu_has_avx512())
+        kernels.push_back(std::make_pair("avx512",&IntroductionToAlgorithm::GraphAlgorithm::_min_plus_kernel_avx512));
+    if(IntroductionToAlgorithm::GraphAlgorithm::_min_plus_cpu_has_avx2())
+        kernels.push_back(std::make_pair("avx2",&IntroductionToAlgorithm::GraphAlgorithm::_min_plus_kernel_avx2));
+#endif
+    EXPECT_TRUE(_MinPlusKernel<int>::select()==&_MinPlusKernel<int>::run||!kernels.empty());
+    EXPECT_EQ(std::string(_MinPlusKernel<int>::name()),kernels.empty()?"scalar":kernels.front().first);
+    const int INF=unlimit<int>();
+    const int values[]={-INF,-INF+1,-1,0,1,INF-1,INF,INF+1,std::numeric_limits<int>::max()};
+    std::uniform_int_distribution<int> value_dist(0,sizeof(values)/sizeof(values[0])-1);
+    const std::size_t k_num=9;
+    std::vector<int> a(MIN_PLUS_MR*k_num),panel(k_num*MIN_PLUS_NR);
+    for(int round=0;round<50;round++)
+    {
+        for(auto& value:a) value=values[value_dist(_gen)];
+        for(auto& value:panel) value=values[value_dist(_gen)];
+        const int* a_rows[MIN_PLUS_MR];
+        for(std::size_t r=0;r<MIN_PLUS_MR;r++) a_rows[r]=&a[r*k_num];
+        std::size_t row_num=1+round%MIN_PLUS_MR;
+        std::size_t col_num=1+(round*7)%MIN_PLUS_NR;
+        std::vector<int> expect(MIN_PLUS_MR*MIN_PLUS_NR,-7),real;
+        int* c_rows[MIN_PLUS_MR];
+        for(std::size_t r=0;r<MIN_PLUS_MR;r++) c_rows[r]=&expect[r*MIN_PLUS_NR];
+        _MinPlusKernel<int>::run(a_rows,row_num,panel.data(),k_num,c_rows,col_num);
+        for(const auto& kernel:kernels)
+        {
+            real.assign(MIN_PLUS_MR*MIN_PLUS_NR,-7);        //只写入前row_num行、前col_num列
+            for(std::size_t r=0;r<MIN_PLUS_MR;r++) c_rows[r]=&real[r*MIN_PLUS_NR];
+            kernel.second(a_rows,row_num,panel.data(),k_num,c_rows,col_num);
+            EXPECT_EQ(real,expect)<<kernel.first<<" round:"<<round;
+        }
+    }
+}
+#endif // MINPLUS_TEST
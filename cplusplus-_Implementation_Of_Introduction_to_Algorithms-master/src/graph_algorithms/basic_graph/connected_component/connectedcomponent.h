@@ -19,6 +19,14 @@
 #ifndef CONNECTEDCOMPONENT
 #define CONNECTEDCOMPONENT
 #include"../../../set_algorithms/disjoint_set/disjointset.h"
+#include"../../../set_algorithms/concurrent_disjoint_set/concurrentdisjointset.h"
+#include"../../../parallel_algorithms/parallel_for/parallelfor.h"
+#include"../../../parallel_algorithms/atomic_min/atomicmin.h"
+#include"../../../header.h"
+#include<vector>
+#include<atomic>
+#include<random>
+#include<algorithm>
 
 using IntroductionToAlgorithm::SetAlgorithm::DisjointSetNode;
 namespace IntroductionToAlgorithm
@@ -49,7 +57,7 @@ namespace IntroductionToAlgorithm
             //*********** 初始化 ****************
             std::vector<std::shared_ptr<NodeType>> sets;
 
-            for(int i=0;i<GraphType::NUM;i++)
+            for(std::size_t i=0;i<graph->vertexes.size();i++)
             {
                 auto vertex=graph->vertexes.at(i);
                 if(vertex) //添加顶点到`disjoint_set`中
@@ -61,8 +69,7 @@ namespace IntroductionToAlgorithm
                 }
             }
             //****************** 循环  ************************
-            auto edges=graph->edge_tuples();
-            for(const auto&edge:edges)
+            for(const auto&edge:graph->edges())
             {
                 auto from_vertex_set_node=graph->vertexes.at(std::get<0>(edge))->node;
                 auto to_vertex_set_node=graph->vertexes.at(std::get<1>(edge))->node;
@@ -83,7 +90,7 @@ namespace IntroductionToAlgorithm
         *
         * 当满足以下条件之一时，id无效的情况：
         *
-        * - id小于0或者大于等于`GraphType::NUM`
+        * - id小于0或者大于等于`graph->vertexes.size()`
         * - `graph->vertexes.at(id1)`为空
         *
         * 在执行 same_component函数之前必须先执行 connected_component函数对无向图进行预处理。
@@ -98,7 +105,7 @@ namespace IntroductionToAlgorithm
 
             if(!graph)
                 throw std::invalid_argument("same_component error: graph must not be nullptr!");
-            if(id1<0||id1>=GraphType::NUM||!graph->vertexes.at(id1)||id2<0||id2>=GraphType::NUM||!graph->vertexes.at(id2))
+            if(id1<0||static_cast<std::size_t>(id1)>=graph->vertexes.size()||!graph->vertexes.at(id1)||id2<0||static_cast<std::size_t>(id2)>=graph->vertexes.size()||!graph->vertexes.at(id2))
                 throw std::invalid_argument("same_component error: id muse belongs [0,N) and graph->vertexes[id] must not be nullptr!");
 
             if(NodeType::find_set(graph->vertexes.at(id1)->node)==NodeType::find_set(graph->vertexes.at(id2)->node))
@@ -107,6 +114,176 @@ namespace IntroductionToAlgorithm
             }else
                 return false;
         }
+
+        //!_canonical_component_labels：将每个顶点的代表元素转换为规范的连通分量编号
+        /*!
+        * \param graph:指向图的强指针
+        * \param roots:各顶点的代表元素，同一个连通分量中的顶点的代表元素相同
+        * \param labels:输出参数，`labels[v]`为顶点v所在连通分量中`id`最小的顶点；若顶点v不存在则为-1
+        * \param thread_num:线程数量
+        * \return:连通分量的数量
+        *
+        * 它是`parallel_connected_component`的辅助函数
+        */
+        template<typename GraphType,typename RootType>
+        std::size_t _canonical_component_labels(std::shared_ptr<GraphType> graph,const RootType& roots,std::vector<int>& labels,std::size_t thread_num)
+        {
+            using IntroductionToAlgorithm::ParallelAlgorithm::parallel_for;
+            using IntroductionToAlgorithm::ParallelAlgorithm::atomic_fetch_min;
+            const std::size_t num=graph->vertexes.size();
+            std::vector<std::atomic<int>> min_id(num);
+            parallel_for(0,num,thread_num,[&](std::size_t v){min_id[v].store(num,std::memory_order_relaxed);});
+            parallel_for(0,num,thread_num,[&](std::size_t v){
+                if(vertex_exists(graph->vertexes,v)) atomic_fetch_min(min_id[roots[v]],static_cast<int>(v));
+            });
+            labels.resize(num);
+            parallel_for(0,num,thread_num,[&](std::size_t v){
+                labels[v]=vertex_exists(graph->vertexes,v)?min_id[roots[v]].load(std::memory_order_relaxed):-1;
+            });
+            std::size_t component_num=0;
+            for(std::size_t v=0;v<num;v++)
+                if(labels[v]==static_cast<int>(v)) component_num++;
+            return component_num;
+        }
+        //!parallel_connected_component：无向图的连通分量的并行算法（Afforest）
+        /*!
+        * \param graph:指向图的强指针，必须非空。若为空则抛出异常
+        * \param labels:输出参数，大小被设置为顶点的最大容量。`labels[v]`为顶点v所在连通分量中`id`最小的顶点；若顶点v不存在则为-1
+        * \param thread_num:线程数量。若为0则使用硬件支持的并发线程数量。默认为0
+        * \param symmetric:图的每一条无向边是否同时以(u,v)、(v,u)两个方向存储。默认为false
+        * \return:连通分量的数量
+        *
+        * 与`connected_component`相同，图的每一条边(u,v)被视为无向边。它不修改图的顶点，也不需要顶点为`SetVertex`。
+        * 不相交集合森林采用`ConcurrentDisjointSet`：多个线程同时用 compare_exchange 合并集合，不需要加锁。
+        *
+        * ### 算法步骤（Afforest）
+        *
+        * - 采样：并行地对每个顶点u，用它的前两条边(u,v)执行合并。对于大多数实际的图，这一步之后最大的连通分量已经基本形成
+        * - 采样若干个随机顶点，找出它们最常见的代表元素c，即最大连通分量的代表元素
+        * - 并行地对每个顶点u，用它剩下的边执行合并。若`symmetric`为true，则跳过代表元素为c的顶点：
+        *   这些顶点的边的另一个端点v若不在c中，则边(v,u)会在处理v时被合并。当图的大部分顶点都在最大连通分量中时，这一步跳过了大部分边
+        * - 并行地对每个顶点求它的代表元素，然后将每个连通分量中`id`最小的顶点作为它的编号
+        *
+        * 性能：时间复杂度O(V+E)（不相交集合操作的代价近似为常数），可以被p个线程并行执行
+        */
+        template<typename GraphType>
+        std::size_t parallel_connected_component(std::shared_ptr<GraphType> graph,std::vector<int>& labels,std::size_t thread_num=0,bool symmetric=false)
+        {
+            using IntroductionToAlgorithm::SetAlgorithm::ConcurrentDisjointSet;
+            using IntroductionToAlgorithm::ParallelAlgorithm::parallel_for;
+            using IntroductionToAlgorithm::ParallelAlgorithm::thread_num_or_default;
+            if(!graph)
+                throw std::invalid_argument("parallel_connected_component error: graph must not be nullptr!");
+            const std::size_t num=graph->vertexes.size();
+            const std::size_t threads=thread_num_or_default(thread_num);
+            const std::size_t sample_edge_num=2;
+            ConcurrentDisjointSet sets(num);
+            //*********** 采样：每个顶点的前两条边 ****************
+            parallel_for(0,num,threads,[&](std::size_t u){
+                if(!vertex_exists(graph->vertexes,u)) return;
+                std::size_t k=0;
+                for(const auto& neighbor:graph->neighbors(u))
+                {
+                    if(k++==sample_edge_num) break;
+                    sets.union_set(u,neighbor.first);
+                }
+            });
+            //*********** 找出最大连通分量的代表元素 ****************
+            const std::size_t NONE=num;
+            std::size_t largest=NONE;
+            if(symmetric&&num>0)
+            {
+                std::vector<std::size_t> samples;
+                std::mt19937 gen(0);
+                std::uniform_int_distribution<std::size_t> dist(0,num-1);
+                for(int k=0;k<1024;k++)
+                {
+                    std::size_t v=dist(gen);
+                    if(vertex_exists(graph->vertexes,v)) samples.push_back(sets.find_set(v));
+                }
+                std::sort(samples.begin(),samples.end());
+                std::size_t best_count=0;
+                for(std::size_t begin=0,end=0;begin<samples.size();begin=end)
+                {
+                    while(end<samples.size()&&samples[end]==samples[begin]) end++;
+                    if(end-begin>best_count)
+                    {
+                        best_count=end-begin;
+                        largest=samples[begin];
+                    }
+                }
+            }
+            //*********** 剩下的边 ****************
+            parallel_for(0,num,threads,[&](std::size_t u){
+                if(!vertex_exists(graph->vertexes,u)) return;
+                if(largest!=NONE&&sets.find_set(u)==sets.find_set(largest)) return;
+                std::size_t k=0;
+                for(const auto& neighbor:graph->neighbors(u))
+                    if(k++>=sample_edge_num)
+                        sets.union_set(u,neighbor.first);
+            },256);
+            //*********** 计算编号 ****************
+            std::vector<std::size_t> roots(num);
+            parallel_for(0,num,threads,[&](std::size_t v){roots[v]=sets.find_set(v);});
+            return _canonical_component_labels(graph,roots,labels,threads);
+        }
+        //!label_propagation_connected_component：无向图的连通分量的标签传播算法
+        /*!
+        * \param graph:指向图的强指针，必须非空。若为空则抛出异常
+        * \param labels:输出参数，大小被设置为顶点的最大容量。`labels[v]`为顶点v所在连通分量中`id`最小的顶点；若顶点v不存在则为-1
+        * \param thread_num:线程数量。若为0则使用硬件支持的并发线程数量。默认为0
+        * \return:连通分量的数量
+        *
+        * 结果与`parallel_connected_component`完全相同。算法步骤：
+        *
+        * - 每个顶点的标签初始化为它自己的`id`
+        * - 循环，每一轮并行地扫描所有的边(u,v)：用`atomic_fetch_min`将u、v的标签都更新为二者之中较小的值。若某一轮中没有任何标签发生变化，则结束
+        *
+        * 由于标签在同一轮中立即可见，每一轮可以将最小的`id`传播很远的距离。轮数不超过连通分量的直径加1，因此它适合直径很小的图（例如社交网络）；
+        * 对于直径很大的图（例如道路网络）应该使用`parallel_connected_component`。
+        *
+        * 性能：时间复杂度O((V+E)d)，d为轮数
+        */
+        template<typename GraphType>
+        std::size_t label_propagation_connected_component(std::shared_ptr<GraphType> graph,std::vector<int>& labels,std::size_t thread_num=0)
+        {
+            using IntroductionToAlgorithm::ParallelAlgorithm::parallel_for;
+            using IntroductionToAlgorithm::ParallelAlgorithm::thread_num_or_default;
+            using IntroductionToAlgorithm::ParallelAlgorithm::atomic_fetch_min;
+            if(!graph)
+                throw std::invalid_argument("label_propagation_connected_component error: graph must not be nullptr!");
+            const std::size_t num=graph->vertexes.size();
+            const std::size_t threads=thread_num_or_default(thread_num);
+            std::vector<std::atomic<int>> current(num);
+            parallel_for(0,num,threads,[&](std::size_t v){current[v].store(v,std::memory_order_relaxed);});
+            std::atomic<bool> changed(true);
+            while(changed.load())
+            {
+                changed.store(false);
+                parallel_for(0,num,threads,[&](std::size_t u){
+                    if(!vertex_exists(graph->vertexes,u)) return;
+                    bool local_changed=false;
+                    for(const auto& neighbor:graph->neighbors(u))
+                    {
+                        int label_u=current[u].load(std::memory_order_relaxed);
+                        int label_v=current[neighbor.first].load(std::memory_order_relaxed);
+                        if(label_u<label_v)
+                            local_changed|=atomic_fetch_min(current[neighbor.first],label_u)>label_u;
+                        else if(label_v<label_u)
+                            local_changed|=atomic_fetch_min(current[u],label_v)>label_v;
+                    }
+                    if(local_changed) changed.store(true,std::memory_order_relaxed);
+                },256);
+            }
+            labels.resize(num);
+            parallel_for(0,num,threads,[&](std::size_t v){
+                labels[v]=vertex_exists(graph->vertexes,v)?current[v].load(std::memory_order_relaxed):-1;
+            });
+            std::size_t component_num=0;
+            for(std::size_t v=0;v<num;v++)
+                if(labels[v]==static_cast<int>(v)) component_num++;
+            return component_num;
+        }
     }
 }
 #endif // CONNECTEDCOMPONENT
@@ -20,14 +20,22 @@
 #define CONNECTEDCOMPONENT_TEST
 #include"../../../google_test/gtest.h"
 #include"connectedcomponent.h"
+#include"../../../set_algorithms/flat_disjoint_set/flatdisjointset.h"
 #include"../../basic_graph/graph_representation/graph/graph.h"
 #include"../../basic_graph/graph_representation/graph_vertex/set_vertex.h"
+#include"../../basic_graph/graph_representation/csr_graph/csrgraph.h"
+#include<random>
+#include<set>
 
 using IntroductionToAlgorithm::GraphAlgorithm::SetVertex;
 using IntroductionToAlgorithm::SetAlgorithm::DisjointSetNode;
 using IntroductionToAlgorithm::GraphAlgorithm::Graph;
 using IntroductionToAlgorithm::GraphAlgorithm::connected_component;
 using IntroductionToAlgorithm::GraphAlgorithm::same_component;
+using IntroductionToAlgorithm::GraphAlgorithm::CSRGraph;
+using IntroductionToAlgorithm::GraphAlgorithm::parallel_connected_component;
+using IntroductionToAlgorithm::GraphAlgorithm::label_propagation_connected_component;
+using IntroductionToAlgorithm::SetAlgorithm::FlatDisjointSet;
 namespace{
     const int C_NUM=10;  /*!< 图顶点数量*/
 }
@@ -96,5 +104,82 @@ TEST_F(ConnectedComponentTest,test_same_component)
             EXPECT_FALSE(same_component(_graph,i,j));
 }
 
+//!test_parallel_connected_component：测试parallel_connected_component、label_propagation_connected_component
+/*!
+*
+* `test_parallel_connected_component`：每个顶点的编号为它所在连通分量中`id`最小的顶点，且不修改图的顶点
+*/
+TEST_F(ConnectedComponentTest,test_parallel_connected_component)
+{
+    std::vector<int> real_labels;
+    for(int i=0;i<C_NUM;i++)
+        real_labels.push_back(i<C_NUM/2?0:C_NUM/2);
+    for(std::size_t thread_num:{1,4})
+    {
+        std::vector<int> labels;
+        EXPECT_EQ(parallel_connected_component(_graph,labels,thread_num),2);
+        EXPECT_EQ(labels,real_labels);
+        EXPECT_EQ(label_propagation_connected_component(_graph,labels,thread_num),2);
+        EXPECT_EQ(labels,real_labels);
+    }
+    for(int i=0;i<C_NUM;i++)
+        EXPECT_FALSE(_graph->vertexes.at(i)->node);
+    //************* 不存在的顶点的编号为-1  **************
+    auto graph=std::make_shared<GType>(-1);
+    graph->add_vertex(0,3);
+    std::vector<int> labels;
+    EXPECT_EQ(parallel_connected_component(graph,labels),1);
+    EXPECT_EQ(labels,std::vector<int>({-1,-1,-1,3,-1,-1,-1,-1,-1,-1}));
+    EXPECT_THROW(parallel_connected_component(std::shared_ptr<GType>(),labels),std::invalid_argument);
+    EXPECT_THROW(label_propagation_connected_component(std::shared_ptr<GType>(),labels),std::invalid_argument);
+}
+//!test_parallel_connected_component_random：测试parallel_connected_component、label_propagation_connected_component
+/*!
+*
+* `test_parallel_connected_component_random`：在随机的大图上，结果与顺序执行的不相交集合相同，与线程数量以及边是否双向存储无关
+*/
+TEST_F(ConnectedComponentTest,test_parallel_connected_component_random)
+{
+    typedef CSRGraph<SetVertex<int>> CSRType;
+    const int num=20000;
+    std::mt19937 gen(21);
+    std::uniform_int_distribution<int> vertex_dist(0,num-1);
+    std::set<std::pair<int,int>> edge_set;
+    while(edge_set.size()<num*3/4)            //平均度数较小：一个大的连通分量以及许多小的连通分量
+    {
+        int from=vertex_dist(gen),to=vertex_dist(gen);
+        if(from!=to) edge_set.insert(std::make_pair(from,to));
+    }
+    std::vector<CSRType::EdgeTupleType> edges,symmetric_edges;
+    for(const auto& edge:edge_set)
+    {
+        edges.push_back(std::make_tuple(edge.first,edge.second,1));
+        symmetric_edges.push_back(std::make_tuple(edge.first,edge.second,1));
+        if(!edge_set.count(std::make_pair(edge.second,edge.first)))
+            symmetric_edges.push_back(std::make_tuple(edge.second,edge.first,1));
+    }
+    FlatDisjointSet sets(num);
+    for(const auto& edge:edge_set)
+        sets.union_set(edge.first,edge.second);
+    std::vector<int> real_labels(num,num);
+    for(int v=0;v<num;v++)
+        real_labels[sets.find_set(v)]=std::min(real_labels[sets.find_set(v)],v);
+    for(int v=0;v<num;v++)
+        real_labels[v]=real_labels[sets.find_set(v)];
+
+    auto graph=std::make_shared<CSRType>(num,edges.begin(),edges.end(),-1);
+    auto symmetric_graph=std::make_shared<CSRType>(num,symmetric_edges.begin(),symmetric_edges.end(),-1);
+    for(std::size_t thread_num:{1,2,4})
+    {
+        std::vector<int> labels;
+        EXPECT_EQ(parallel_connected_component(graph,labels,thread_num),sets.set_num());
+        EXPECT_EQ(labels,real_labels)<<"thread_num:"<<thread_num;
+        EXPECT_EQ(parallel_connected_component(symmetric_graph,labels,thread_num,true),sets.set_num());
+        EXPECT_EQ(labels,real_labels)<<"thread_num:"<<thread_num;
+        EXPECT_EQ(label_propagation_connected_component(graph,labels,thread_num),sets.set_num());
+        EXPECT_EQ(labels,real_labels)<<"thread_num:"<<thread_num;
+    }
+}
+
 #endif // CONNECTEDCOMPONENT_TEST
 
@@ -20,21 +20,27 @@
 #define BFS
 #include <memory>
 #include <queue>
+#include <vector>
 #include <functional>
 #include "../../../header.h"
+#include "../graph_visitor/graphvisitor.h"
+#include "../graph_representation/vertex_property_map/vertexpropertymap.h"
 namespace IntroductionToAlgorithm
 {
     namespace GraphAlgorithm
     {
 
-        //!breadth_first_search：广度优先搜索，算法导论22章22.2节
+        //!breadth_first_visit：以访问者为回调的广度优先搜索，算法导论22章22.2节
         /*!
         * \param graph:指向图的强引用，必须非空。若为空则抛出异常
         * \param source_id：广度优先搜索的源点`id`，必须有效。若无效则抛出异常
-        * \param pre_action:一个可调用对象，在每次发现一个顶点时调用，调用参数为该顶点的`id`。默认为空操作，即不进行任何操作
-        * \param post_action:一个可调用对象，在每次对一个顶点搜索完成时调用，调用参数为该顶点的`id`。默认为空操作，即不进行任何操作
+        * \param visitor:访问者，可以实现`discover_vertex(v)`、`examine_edge(u,v,w)`、`tree_edge(u,v,w)`、`finish_vertex(v)`中的任意几个（见`NullVisitor`）
         * \return:void
         *
+        * 各钩子的调用时机：发现一个顶点（包括源点）时调用`discover_vertex`；检查从顶点u出发的每一条边(u,v)时调用`examine_edge`；
+        * 若v因此被发现，则先调用`tree_edge(u,v,w)`再调用`discover_vertex(v)`；顶点u的边都检查完毕后调用`finish_vertex(u)`。
+        * 访问者没有实现的钩子在编译期被消除。
+        *
         * `source_id`在以下情况下无效：
         *
         * - `source_id`不在区间`[0,N)`之间时，`source_id`无效
@@ -65,18 +71,15 @@ namespace IntroductionToAlgorithm
         * BFS算法获取的前驱子图G_pai包含一条从源结点s到结点v的唯一简单路径，而且该路径也是图G里面从源s到v之间的一条最短路径，因此前驱子图也称为广度优先树。
         *
         */
-    template<typename GraphType> 
-        void breadth_first_search(std::shared_ptr<GraphType> graph,
-                      typename GraphType::VIDType source_id,
-                      std::function< void(typename GraphType::VIDType)> pre_action=[](typename GraphType::VIDType){},   //lambda表达式
-                      std::function< void(typename GraphType::VIDType)> post_action=[](typename GraphType::VIDType){})
+        template<typename GraphType,typename Visitor>
+        void breadth_first_visit(std::shared_ptr<GraphType> graph,typename GraphType::VIDType source_id,Visitor& visitor)
         {
             typedef typename GraphType::VertexType VertexType;
             typedef typename GraphType::VIDType VIDType;
 
             if(!graph)
                 throw std::invalid_argument("breadth_first_search error: graph must not be nullptr!");
-            if(source_id<0||source_id>=GraphType::NUM||!graph->vertexes.at(source_id))
+            if(source_id<0||static_cast<std::size_t>(source_id)>=graph->vertexes.size()||!graph->vertexes.at(source_id))
                 throw std::invalid_argument("breadth_first_search error: source_id muse belongs [0,N) and graph->vertexes[source_id] must not be nullptr!");
 
             std::queue<std::shared_ptr<VertexType>> v_queue;            //bfs一般都会使用一个临时队列
@@ -91,29 +94,120 @@ namespace IntroductionToAlgorithm
             //************* 处理源顶点 ****************
             graph->vertexes.at(source_id)->set_source();                //set_source将源点颜色设置为灰色，键值设置为0，父结点为空
             v_queue.push(graph->vertexes.at(source_id));                //将源点push入队列
-            pre_action(source_id);                                      //在每次发现一个顶点时执行的操作
+            visit_discover_vertex(visitor,source_id);                   //在每次发现一个顶点时执行的操作
             //************ 处理其他顶点 ***************
             while(!v_queue.empty())
             {
                 auto front = v_queue.front();
-                v_queue.pop();                                          //bfs每次都把队列中的首元素pop掉    
+                v_queue.pop();                                          //bfs每次都把队列中的首元素pop掉
+                VIDType front_id = front->id;
 
-                for(const auto& edge : graph->vertex_edge_tuples(front->id))
+                for(const auto& neighbor : graph->neighbors(front_id))
                 {
-                    VIDType next_id = std::get<1>(edge);                //获取下一个结点，即一条边的终点
-                    auto next_vertex = graph->vertexes.at(next_id);
+                    VIDType next_id = neighbor.first;                   //获取下一个结点，即一条边的终点
+                    visit_examine_edge(visitor,front_id,next_id,neighbor.second);
+                    auto& next_vertex = graph->vertexes[next_id];
                     if(next_vertex->color == VertexType::COLOR::WHITE)  //颜色为白色，表示尚未被访问
                     {
                         next_vertex->set_found(front);                  //把front结点设置为发现结点，结点颜色设置为灰色
                         v_queue.push(next_vertex);                      //把next_vertex顶点压栈
-                        pre_action(next_id);                            //在每次发现一个顶点时执行的操作
+                        visit_tree_edge(visitor,front_id,next_id,neighbor.second);
+                        visit_discover_vertex(visitor,next_id);         //在每次发现一个顶点时执行的操作
                     }
                 }
                 front->color = VertexType::COLOR::BLACK;                //把所有连接的顶点访问完成后，front的颜色设置为黑色
-                post_action(front->id);                                 //在每次对一个顶点搜索完成时执行的操作
+                visit_finish_vertex(visitor,front_id);                  //在每次对一个顶点搜索完成时执行的操作
             }
         }
 
+        //!breadth_first_visit：以顶点属性数组保存状态的广度优先搜索
+        /*!
+        * \param graph:指向图的强引用，必须非空。若为空则抛出异常。只用到`graph->vertexes.size()`与`graph->neighbors(id)`
+        * \param source_id:广度优先搜索的源点`id`，必须有效。若无效则抛出异常
+        * \param properties:保存搜索结果的顶点属性。它被调整为图的顶点数量并初始化，结束后`distance`为到源点的边数（不可达为正无穷），`parent`为广度优先树中的父结点
+        * \param visitor:访问者，钩子的调用时机与`breadth_first_visit(graph,source_id,visitor)`相同
+        * \return:void
+        *
+        * 步骤与`breadth_first_visit(graph,source_id,visitor)`相同，区别在于它不读写顶点对象，颜色、距离、父结点都保存在`properties`的数组中，
+        * 队列中保存的也是顶点`id`。因此同一个图可以同时执行多次搜索，只要每次使用各自的`properties`。
+        */
+        template<typename GraphType,typename KeyType,typename Visitor>
+        void breadth_first_visit(std::shared_ptr<GraphType> graph,typename GraphType::VIDType source_id,SearchProperties<KeyType>& properties,Visitor& visitor)
+        {
+            typedef typename GraphType::VIDType VIDType;
+
+            if(!graph)
+                throw std::invalid_argument("breadth_first_search error: graph must not be nullptr!");
+            if(source_id<0||static_cast<std::size_t>(source_id)>=graph->vertexes.size()||!vertex_exists(graph->vertexes,source_id))
+                throw std::invalid_argument("breadth_first_search error: source_id muse belongs [0,N) and graph->vertexes[source_id] must not be nullptr!");
+
+            properties.reset(graph->vertexes.size());
+            auto& color=properties.color;
+            auto& distance=properties.distance;
+            auto& parent=properties.parent;
+            std::vector<VIDType> v_queue;                               //每个顶点至多入队一次，因此用数组加上队首下标即可
+            v_queue.reserve(graph->vertexes.size());
+            //************* 处理源顶点 ****************
+            color[source_id]=VertexColor::GRAY;
+            distance[source_id]=0;
+            v_queue.push_back(source_id);
+            visit_discover_vertex(visitor,source_id);
+            //************ 处理其他顶点 ***************
+            for(std::size_t head=0;head<v_queue.size();head++)
+            {
+                VIDType front_id=v_queue[head];
+                for(const auto& neighbor : graph->neighbors(front_id))
+                {
+                    VIDType next_id=neighbor.first;
+                    visit_examine_edge(visitor,front_id,next_id,neighbor.second);
+                    if(color[next_id]==VertexColor::WHITE)
+                    {
+                        color[next_id]=VertexColor::GRAY;
+                        distance[next_id]=distance[front_id]+1;
+                        parent[next_id]=front_id;
+                        v_queue.push_back(next_id);
+                        visit_tree_edge(visitor,front_id,next_id,neighbor.second);
+                        visit_discover_vertex(visitor,next_id);
+                    }
+                }
+                color[front_id]=VertexColor::BLACK;
+                visit_finish_vertex(visitor,front_id);
+            }
+        }
+
+        //!_BFSActionVisitor：将`breadth_first_search`的`pre_action`、`post_action`包装为访问者
+        template<typename VIDType> struct _BFSActionVisitor
+        {
+            typedef std::function<void(VIDType)> ActionType;   /*!< 回调的类型*/
+            //!显式构造函数
+            _BFSActionVisitor(const ActionType& pre,const ActionType& post):pre_action(pre),post_action(post){}
+            void discover_vertex(VIDType v){pre_action(v);}
+            void finish_vertex(VIDType v){post_action(v);}
+            const ActionType& pre_action;   /*!< 发现顶点时调用*/
+            const ActionType& post_action;  /*!< 顶点搜索完成时调用*/
+        };
+
+        //!breadth_first_search：广度优先搜索，算法导论22章22.2节
+        /*!
+        * \param graph:指向图的强引用，必须非空。若为空则抛出异常
+        * \param source_id：广度优先搜索的源点`id`，必须有效。若无效则抛出异常
+        * \param pre_action:一个可调用对象，在每次发现一个顶点时调用，调用参数为该顶点的`id`。默认为空操作，即不进行任何操作
+        * \param post_action:一个可调用对象，在每次对一个顶点搜索完成时调用，调用参数为该顶点的`id`。默认为空操作，即不进行任何操作
+        * \return:void
+        *
+        * 它是`breadth_first_visit`的`std::function`版本，为了兼容而保留：`pre_action`对应访问者的`discover_vertex`，
+        * `post_action`对应访问者的`finish_vertex`。每个顶点会产生两次间接调用，性能敏感的场合应当使用`breadth_first_visit`。
+        */
+    template<typename GraphType> 
+        void breadth_first_search(std::shared_ptr<GraphType> graph,
+                      typename GraphType::VIDType source_id,
+                      std::function< void(typename GraphType::VIDType)> pre_action=[](typename GraphType::VIDType){},   //lambda表达式
+                      std::function< void(typename GraphType::VIDType)> post_action=[](typename GraphType::VIDType){})
+        {
+            _BFSActionVisitor<typename GraphType::VIDType> visitor(pre_action,post_action);
+            breadth_first_visit(graph,source_id,visitor);
+        }
+
     }
 }
 
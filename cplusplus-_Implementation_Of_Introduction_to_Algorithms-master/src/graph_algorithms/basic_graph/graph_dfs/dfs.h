@@ -20,10 +20,108 @@
 #define DFS
 #include <memory>
 #include <functional>
+#include <vector>
+#include "../graph_visitor/graphvisitor.h"
+#include "../graph_representation/vertex_property_map/vertexpropertymap.h"
 namespace IntroductionToAlgorithm
 {
     namespace GraphAlgorithm
     {
+        //!_DFSFrame：深度优先搜索的显式栈中的一项，代替递归调用的一层
+        template<typename GraphType> struct _DFSFrame
+        {
+            typedef typename GraphType::NeighborRangeType::iterator NeighborIterator;  /*!< 邻接边区间的迭代器类型*/
+            typename GraphType::VIDType v;  /*!< 顶点*/
+            NeighborIterator next;          /*!< 下一条待搜索的边*/
+            NeighborIterator end;           /*!< 边区间的终止位置*/
+        };
+
+        //!_depth_first_visit_vertex：深度优先搜索的访问过程，以访问者为回调
+        /*!
+        * \param graph:指向图的强引用，要求非空
+        * \param v_id:待访问顶点的`id`，要求有效且为白色
+        * \param time:访问时刻
+        * \param visitor:访问者
+        * \param frames:显式栈，调用前后都为空。由调用者提供以便在多棵深度优先树之间复用
+        *
+        * 与`visit`的步骤相同。各钩子的调用时机：发现v_id时调用`discover_vertex`；检查每一条边(v_id,v)时调用`examine_edge`；
+        * 若v为白色，则先调用`tree_edge(v_id,v,w)`再访问v；v_id完成时调用`finish_vertex`。
+        *
+        * 它不递归：栈中每一项保存顶点以及它的邻接边区间的当前位置（同`tarjan_scc_labels`），发现一个白色顶点时压栈，边区间搜索完时出栈并完成该顶点。
+        * 因此钩子的调用次序与递归版本完全相同，而深度很大的图不会导致调用栈溢出。
+        */
+        template<typename GraphType,typename Visitor>
+        void _depth_first_visit_vertex(const std::shared_ptr<GraphType>& graph,typename GraphType::VIDType v_id,int& time,Visitor& visitor,
+                                       std::vector<_DFSFrame<GraphType>>& frames)
+        {
+            typedef typename GraphType::VIDType VIDType;
+            //*******  发现顶点：压栈，相当于递归调用 *****************
+            auto discover=[&](VIDType v){
+                time++;
+                visit_discover_vertex(visitor,v);
+                graph->vertexes[v]->set_disovered(time);
+                auto range=graph->neighbors(v);
+                frames.push_back(_DFSFrame<GraphType>{v,range.begin(),range.end()});
+            };
+            discover(v_id);
+            while(!frames.empty())
+            {
+                auto& frame=frames.back();
+                VIDType v=frame.v;
+                auto next=frame.next;
+                const auto end=frame.end;
+                bool descended=false;
+                //********  搜索栈顶顶点的边，直到遇到一个白色顶点*************
+                while(next!=end)
+                {
+                    auto another_id=(*next).first;
+                    auto weight=(*next).second;
+                    ++next;
+                    visit_examine_edge(visitor,v,another_id,weight);
+                    const auto& another_vertex=graph->vertexes[another_id];
+                    if(another_vertex->color==GraphType::VertexType::COLOR::WHITE)
+                    {
+                        frame.next=next;
+                        another_vertex->parent=graph->vertexes[v];
+                        visit_tree_edge(visitor,v,another_id,weight);
+                        discover(another_id);                                   //frame 此后失效
+                        descended=true;
+                        break;
+                    }
+                }
+                if(descended) continue;
+                //*********** 完成栈顶顶点的搜索
+                frames.pop_back();
+                time++;
+                graph->vertexes[v]->set_finished(time);                         //完成访问
+                visit_finish_vertex(visitor,v);
+            }
+        }
+        //!_DFSActionVisitor：将`visit`、`depth_first_search`的`std::function`回调包装为访问者
+        /*!
+        * 回调需要的时刻由访问者自己维护：深度优先搜索的时刻恰好在每次发现、完成一个顶点时加一，因此这里的计数与`time`保持一致。
+        * 根结点由`start_vertex`记录，它完成时调用`post_root_action`。
+        */
+        template<typename VIDType> struct _DFSActionVisitor
+        {
+            typedef std::function<void(VIDType,int)> ActionType;   /*!< 回调的类型*/
+            //!显式构造函数
+            _DFSActionVisitor(const ActionType& pre,const ActionType& post,const ActionType& pre_root,const ActionType& post_root,int start_time):
+                pre_action(pre),post_action(post),pre_root_action(pre_root),post_root_action(post_root),time(start_time),root(-1){}
+            void start_vertex(VIDType v){root=v;pre_root_action(v,time);}
+            void discover_vertex(VIDType v){pre_action(v,++time);}
+            void finish_vertex(VIDType v)
+            {
+                post_action(v,++time);
+                if(v==root) post_root_action(v,time);
+            }
+            const ActionType& pre_action;       /*!< 发现顶点时调用*/
+            const ActionType& post_action;      /*!< 顶点完成时调用*/
+            const ActionType& pre_root_action;  /*!< 发现根结点之前调用*/
+            const ActionType& post_root_action; /*!< 根结点完成之后调用*/
+            int time;                           /*!< 当前时刻*/
+            VIDType root;                       /*!< 当前深度优先树的根结点*/
+        };
         //!visit：深度优先搜索的辅助函数，用于访问顶点，算法导论22章22.3节
         /*!
         * \param graph:指向图的强引用，必须非空。若为空则抛出异常
@@ -41,7 +139,7 @@ namespace IntroductionToAlgorithm
         *
         * - 将全局时间 time 递增
         * - 发现结点 v_id
-        * - 对结点 v_id 的每一个相邻结点进行检查，在相邻结点是白色的情况下递归访问该相邻结点
+        * - 对结点 v_id 的每一个相邻结点进行检查，在相邻结点是白色的情况下访问该相邻结点（用显式栈代替递归，见`_depth_first_visit_vertex`）
         * - 当结点 v_id 的相邻结点访问完毕，则全局时间 time 递增，然后将结点 v_id 设置为完成状态
         *
         */
@@ -52,28 +150,148 @@ namespace IntroductionToAlgorithm
         {
             if(!graph)
                 throw std::invalid_argument("visit error: graph must not be nullptr!");
-            if(v_id<0||v_id>=GraphType::NUM||!graph->vertexes.at(v_id))
+            if(v_id<0||static_cast<std::size_t>(v_id)>=graph->vertexes.size()||!graph->vertexes.at(v_id))
                 throw std::invalid_argument("visit error: v_id muse belongs [0,N) and graph->vertexes[v_id] must not be nullptr!");
+            std::function<void(typename GraphType::VIDType,int)> empty_action=[](typename GraphType::VIDType,int){};
+            _DFSActionVisitor<typename GraphType::VIDType> visitor(pre_action,post_action,empty_action,empty_action,time);
+            std::vector<_DFSFrame<GraphType>> frames;
+            _depth_first_visit_vertex(graph,v_id,time,visitor,frames);
+        }
 
-            time++;
-            //*******  发现本顶点 *****************
-            pre_action(v_id, time);
-            graph->vertexes.at(v_id)->set_disovered(time);
-            //********  搜索本顶点相邻的顶点*************
-            for(const auto &edge:graph->vertex_edge_tuples(v_id))
+        //!depth_first_visit：以访问者为回调的深度优先搜索，算法导论22章22.3节
+        /*!
+        * \param graph:指向图的强引用，必须非空。若为空则抛出异常
+        * \param visitor:访问者，可以实现`start_vertex(v)`、`discover_vertex(v)`、`examine_edge(u,v,w)`、`tree_edge(u,v,w)`、`finish_vertex(v)`中的任意几个（见`NullVisitor`）
+        * \param search_order:指定搜索顶点的顺序，如果为空则按照顶点的`id`顺序。默认为空
+        * \return:void
+        *
+        * 步骤与`depth_first_search`相同。每当一个白色顶点成为深度优先森林的一棵树的根时，先调用`start_vertex`，其余钩子的调用时机见`_depth_first_visit_vertex`。
+        * 访问者没有实现的钩子在编译期被消除。
+        */
+        template<typename GraphType,typename Visitor>
+        void depth_first_visit(std::shared_ptr<GraphType> graph,Visitor& visitor,
+                   const std::vector<typename GraphType::VIDType>& search_order=std::vector<typename GraphType::VIDType>())
+        {
+            typedef typename GraphType::VIDType VIDType;
+            typedef typename GraphType::VertexType VertexType;
+            if(!graph)
+                throw std::invalid_argument("depth_first_search error: graph must not be nullptr!");
+            //************  创建真实的 search_order ****************
+            std::vector<VIDType> real_search_order;
+            if(!search_order.size())
+            {
+                for(std::size_t i=0;i<graph->vertexes.size();i++)
+                    real_search_order.push_back(i);
+            }else
+                real_search_order=search_order;
+
+            //************* 初始化顶点 ****************
+            for(auto& v:graph->vertexes)
             {
-                auto another_id=std::get<1>(edge);
-                auto another_vertex=graph->vertexes.at(another_id);
-                if(another_vertex->color==GraphType::VertexType::COLOR::WHITE)
+                if(!v) continue;
+                v->color=VertexType::COLOR::WHITE;
+                v->key=0;
+                v->parent=std::shared_ptr<VertexType>();
+            }
+
+            //*************** 深度优先搜索 *************
+            int time=0;
+            std::vector<_DFSFrame<GraphType>> frames;
+            for(const auto& v_id :real_search_order)
+            {
+                if(v_id<0||static_cast<std::size_t>(v_id)>=graph->vertexes.size()||!graph->vertexes.at(v_id)) //顶点为空
+                    continue;
+                if(graph->vertexes[v_id]->color==VertexType::COLOR::WHITE)
                 {
-                    another_vertex->parent=graph->vertexes.at(v_id);
-                    visit(graph,another_id,time,pre_action,post_action);    //递归调用
+                    visit_start_vertex(visitor,v_id);
+                    _depth_first_visit_vertex(graph,v_id,time,visitor,frames);
                 }
             }
-            //*********** 完成本顶点的搜索
-            time++;
-            graph->vertexes.at(v_id)->set_finished(time);                   //完成访问
-            post_action(v_id,time);
+        }
+
+        //!_depth_first_visit_vertex：以顶点属性数组保存状态的深度优先搜索的访问过程
+        /*!
+        * 与`_depth_first_visit_vertex(graph,v_id,time,visitor,frames)`相同（同样用显式栈代替递归），只是颜色、时间、父结点保存在`properties`中
+        */
+        template<typename GraphType,typename KeyType,typename Visitor>
+        void _depth_first_visit_vertex(const std::shared_ptr<GraphType>& graph,typename GraphType::VIDType v_id,int& time,
+                                       SearchProperties<KeyType>& properties,Visitor& visitor,std::vector<_DFSFrame<GraphType>>& frames)
+        {
+            typedef typename GraphType::VIDType VIDType;
+            auto discover=[&](VIDType v){
+                time++;
+                visit_discover_vertex(visitor,v);
+                properties.color[v]=VertexColor::GRAY;
+                properties.discover_time[v]=time;
+                auto range=graph->neighbors(v);
+                frames.push_back(_DFSFrame<GraphType>{v,range.begin(),range.end()});
+            };
+            discover(v_id);
+            while(!frames.empty())
+            {
+                auto& frame=frames.back();
+                VIDType v=frame.v;
+                auto next=frame.next;
+                const auto end=frame.end;
+                bool descended=false;
+                while(next!=end)
+                {
+                    auto another_id=(*next).first;
+                    auto weight=(*next).second;
+                    ++next;
+                    visit_examine_edge(visitor,v,another_id,weight);
+                    if(properties.color[another_id]==VertexColor::WHITE)
+                    {
+                        frame.next=next;
+                        properties.parent[another_id]=v;
+                        visit_tree_edge(visitor,v,another_id,weight);
+                        discover(another_id);                                   //frame 此后失效
+                        descended=true;
+                        break;
+                    }
+                }
+                if(descended) continue;
+                frames.pop_back();
+                time++;
+                properties.color[v]=VertexColor::BLACK;
+                properties.finish_time[v]=time;
+                visit_finish_vertex(visitor,v);
+            }
+        }
+        //!depth_first_visit：以顶点属性数组保存状态的深度优先搜索
+        /*!
+        * \param graph:指向图的强引用，必须非空。若为空则抛出异常。只用到`graph->vertexes.size()`与`graph->neighbors(id)`
+        * \param properties:保存搜索结果的顶点属性。它被调整为图的顶点数量并初始化，结束后保存每个顶点的`discover_time`、`finish_time`与`parent`
+        * \param visitor:访问者，钩子的调用时机与`depth_first_visit(graph,visitor,search_order)`相同
+        * \param search_order:指定搜索顶点的顺序，如果为空则按照顶点的`id`顺序。默认为空
+        * \return:void
+        *
+        * 步骤与`depth_first_visit(graph,visitor,search_order)`相同，区别在于它不读写顶点对象。
+        */
+        template<typename GraphType,typename KeyType,typename Visitor>
+        void depth_first_visit(std::shared_ptr<GraphType> graph,SearchProperties<KeyType>& properties,Visitor& visitor,
+                   const std::vector<typename GraphType::VIDType>& search_order=std::vector<typename GraphType::VIDType>())
+        {
+            typedef typename GraphType::VIDType VIDType;
+            if(!graph)
+                throw std::invalid_argument("depth_first_search error: graph must not be nullptr!");
+            const VIDType num=graph->vertexes.size();
+            properties.reset(num);
+            int time=0;
+            std::vector<_DFSFrame<GraphType>> frames;
+            auto visit_root=[&](VIDType v_id){
+                if(v_id<0||v_id>=num||!vertex_exists(graph->vertexes,v_id)) return;  //顶点为空
+                if(properties.color[v_id]!=VertexColor::WHITE) return;
+                visit_start_vertex(visitor,v_id);
+                _depth_first_visit_vertex(graph,v_id,time,properties,visitor,frames);
+            };
+            if(!search_order.size())
+            {
+                for(VIDType v_id=0;v_id<num;v_id++)
+                    visit_root(v_id);
+            }else
+                for(const auto& v_id:search_order)
+                    visit_root(v_id);
         }
 
         //!depth_first_search：深度优先搜索，算法导论22章22.3节
@@ -86,6 +304,8 @@ namespace IntroductionToAlgorithm
         * \param search_order:指定搜索顶点的顺序（不同的搜索顺序可能形成的深度优先森林不同)，如果为空则按照顶点的`id`顺序。默认为空
         * \return:void
         *
+        * 它是`depth_first_visit`的`std::function`版本，为了兼容而保留。每个顶点会产生若干次间接调用，性能敏感的场合应当使用`depth_first_visit`。
+        *
         * 深度优先搜索：深度优先搜索总是对最近才发现的结点v的出发边进行搜索，直到该结点的所有出发边都被发现为止。一旦结点v的所有出发边都被发现，则“回溯”到v的前驱结点（v是经过该结点才被发现的）。
         * 该过程一直持续到源结点可以达到的所有结点都被发现为止。如果还存在尚未发现的结点，则深度优先搜索将从这些未被发现的结点中任选一个作为新的源结点，并重复同样的搜索过程。该算法重复整个过程，
         * 直到图中的所有结点被发现为止。
@@ -142,42 +362,8 @@ namespace IntroductionToAlgorithm
                    std::function<void(typename GraphType::VIDType,int)> post_root_action=[](typename GraphType::VIDType,int){},
                    const std::vector<typename GraphType::VIDType>& search_order=std::vector<typename GraphType::VIDType>())
         {
-            typedef typename GraphType::VIDType VIDType;
-            typedef typename GraphType::VertexType VertexType;
-            if(!graph)
-                throw std::invalid_argument("depth_first_search error: graph must not be nullptr!");
-            //************  创建真实的 search_order ****************
-            std::vector<VIDType> real_search_order;
-            if(!search_order.size())
-            {
-                for(int i=0;i<GraphType::NUM;i++)
-                    real_search_order.push_back(i);
-            }else
-                real_search_order=search_order;
-
-            //************* 初始化顶点 ****************
-            for(auto& v:graph->vertexes)
-            {
-                if(!v) continue;
-                v->color=VertexType::COLOR::WHITE;
-                v->key=0;
-                v->parent=std::shared_ptr<VertexType>();
-            }
-
-            //*************** 深度优先搜索 *************
-            int time=0;
-            for(const auto& v_id :real_search_order)
-            {
-                if(v_id<0||v_id>=GraphType::NUM||!graph->vertexes.at(v_id)) //顶点为空
-                    continue;
-                auto v=graph->vertexes.at(v_id);
-                if(v->color==GraphType::VertexType::COLOR::WHITE)
-                {
-                    pre_root_action(v_id,time);
-                    visit(graph,v->id,time,pre_action,post_action);
-                    post_root_action(v_id,time);
-                }
-            }
+            _DFSActionVisitor<typename GraphType::VIDType> visitor(pre_action,post_action,pre_root_action,post_root_action,0);
+            depth_first_visit(graph,visitor,search_order);
         }
    }
 }
@@ -0,0 +1,434 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef GRAPHREORDERING
+#define GRAPHREORDERING
+#include <memory>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <stdexcept>
+#include <cstdlib>
+#include "../graph_representation/graph/graph.h"
+#include "../graph_representation/csr_graph/csrgraph.h"
+namespace IntroductionToAlgorithm
+{
+    namespace GraphAlgorithm
+    {
+        //!VertexOrdering：顶点的重新编号（一个排列），以及新旧编号之间的双向映射
+        /*!
+        * `new_id[v]`为原编号为v的顶点的新编号，`old_id[i]`为新编号为i的顶点的原编号，二者互为逆排列。
+        *
+        * 在重新编号的图上计算的以顶点编号为下标的结果（如距离、父结点），可以用`to_original`转换回原编号；
+        * 顶点编号本身（如源点、父结点的值）用`to_new`、`to_old`转换。
+        */
+        template<typename VIDType> struct VertexOrdering
+        {
+            //!size：返回顶点数量
+            std::size_t size() const {return new_id.size();}
+            //!to_new：原编号转换为新编号。-1（表示无效的顶点）保持不变
+            VIDType to_new(VIDType id) const {return id<0?id:new_id.at(id);}
+            //!to_old：新编号转换为原编号。-1（表示无效的顶点）保持不变
+            VIDType to_old(VIDType id) const {return id<0?id:old_id.at(id);}
+            //!to_original：将以新编号为下标的数组转换为以原编号为下标
+            template<typename T> std::vector<T> to_original(const std::vector<T>& values) const
+            {
+                if(values.size()!=size())
+                    throw std::invalid_argument("to_original error: values.size() must equal to size()!");
+                std::vector<T> result(values.size());
+                for(std::size_t i=0;i<values.size();i++)
+                    result[old_id[i]]=values[i];
+                return result;
+            }
+            //!to_reordered：将以原编号为下标的数组转换为以新编号为下标
+            template<typename T> std::vector<T> to_reordered(const std::vector<T>& values) const
+            {
+                if(values.size()!=size())
+                    throw std::invalid_argument("to_reordered error: values.size() must equal to size()!");
+                std::vector<T> result(values.size());
+                for(std::size_t v=0;v<values.size();v++)
+                    result[new_id[v]]=values[v];
+                return result;
+            }
+            std::vector<VIDType> new_id;    /*!< 原编号 -> 新编号*/
+            std::vector<VIDType> old_id;    /*!< 新编号 -> 原编号*/
+        };
+
+        //!_ReorderAdjacency：计算顶点次序时使用的无向邻接表
+        /*!
+        * 每条有向边(u,v)在u、v的行中各出现一次，同一行内去掉重复的邻居与自环。顶点的度数为它所在行的长度。
+        * 局部性只与“哪些顶点一起被访问”有关，与边的方向无关，因此所有的次序都在无向图上计算。
+        */
+        template<typename VIDType> struct _ReorderAdjacency
+        {
+            std::size_t degree(VIDType v) const {return offsets[v+1]-offsets[v];}
+            std::vector<std::size_t> offsets;   /*!< 顶点u的邻居位于[offsets[u],offsets[u+1])*/
+            std::vector<VIDType> targets;       /*!< 邻居，每一行内按`id`递增排列*/
+            std::vector<bool> exist;            /*!< 顶点是否存在*/
+        };
+        //!_make_reorder_adjacency：检查参数，并构建无向邻接表
+        template<typename GraphType>
+        _ReorderAdjacency<typename GraphType::VIDType> _make_reorder_adjacency(std::shared_ptr<GraphType> graph,const char* name)
+        {
+            typedef typename GraphType::VIDType VIDType;
+            if(!graph)
+                throw std::invalid_argument(std::string(name)+" error: graph must not be nullptr!");
+            const std::size_t num=graph->vertexes.size();
+            _ReorderAdjacency<VIDType> adjacency;
+            adjacency.exist.assign(num,false);
+            std::vector<std::size_t> count(num+1,0);
+            for(std::size_t u=0;u<num;u++)
+            {
+                if(!vertex_exists(graph->vertexes,u)) continue;
+                adjacency.exist[u]=true;
+                for(const auto& neighbor:graph->neighbors(u))
+                    if(static_cast<std::size_t>(neighbor.first)!=u)
+                    {
+                        count[u+1]++;
+                        count[neighbor.first+1]++;
+                    }
+            }
+            for(std::size_t u=0;u<num;u++)
+                count[u+1]+=count[u];
+            std::vector<VIDType> targets(count[num]);
+            std::vector<std::size_t> cursor(count.begin(),count.end()-1);
+            for(std::size_t u=0;u<num;u++)
+            {
+                if(!vertex_exists(graph->vertexes,u)) continue;
+                for(const auto& neighbor:graph->neighbors(u))
+                    if(static_cast<std::size_t>(neighbor.first)!=u)
+                    {
+                        targets[cursor[u]++]=neighbor.first;
+                        targets[cursor[neighbor.first]++]=u;
+                    }
+            }
+            //************ 每一行排序、去重，并压紧 ************
+            adjacency.offsets.assign(num+1,0);
+            for(std::size_t u=0;u<num;u++)
+            {
+                auto begin=targets.begin()+count[u];
+                auto end=targets.begin()+count[u+1];
+                std::sort(begin,end);
+                end=std::unique(begin,end);
+                adjacency.targets.insert(adjacency.targets.end(),begin,end);
+                adjacency.offsets[u+1]=adjacency.targets.size();
+            }
+            return adjacency;
+        }
+        //!_make_vertex_ordering：由新编号次序（依次给出的原编号）构造`VertexOrdering`
+        /*!
+        * `order`中只包含存在的顶点；不存在的顶点按原编号递增的次序排在最后，使得`VertexOrdering`总是一个完整的排列
+        */
+        template<typename VIDType>
+        VertexOrdering<VIDType> _make_vertex_ordering(const _ReorderAdjacency<VIDType>& adjacency,std::vector<VIDType> order)
+        {
+            const std::size_t num=adjacency.exist.size();
+            for(std::size_t v=0;v<num;v++)
+                if(!adjacency.exist[v]) order.push_back(v);
+            VertexOrdering<VIDType> ordering;
+            ordering.old_id=order;
+            ordering.new_id.assign(num,-1);
+            for(std::size_t i=0;i<num;i++)
+                ordering.new_id[order[i]]=i;
+            return ordering;
+        }
+        //!_bfs_component：从`start`出发对它所在的连通分量做广度优先搜索，将访问的顶点追加到`order`
+        /*!
+        * \param by_degree:为`true`时每个顶点的未访问邻居按度数递增（度数相同时按`id`递增）的次序入队，即 Cuthill-McKee 次序；否则按`id`递增的次序入队
+        */
+        template<typename VIDType>
+        void _bfs_component(const _ReorderAdjacency<VIDType>& adjacency,VIDType start,bool by_degree,
+                            std::vector<bool>& visited,std::vector<VIDType>& order)
+        {
+            std::size_t head=order.size();
+            visited[start]=true;
+            order.push_back(start);
+            while(head<order.size())
+            {
+                VIDType u=order[head++];
+                std::size_t first=order.size();
+                for(std::size_t k=adjacency.offsets[u];k<adjacency.offsets[u+1];k++)
+                {
+                    VIDType v=adjacency.targets[k];
+                    if(visited[v]) continue;
+                    visited[v]=true;
+                    order.push_back(v);
+                }
+                if(by_degree)
+                    std::stable_sort(order.begin()+first,order.end(),[&adjacency](VIDType a,VIDType b){
+                        return adjacency.degree(a)<adjacency.degree(b);});
+            }
+        }
+        //!_pseudo_peripheral_vertex：从`start`出发寻找所在连通分量的一个伪外围顶点（George-Liu 算法）
+        /*!
+        * 反复从当前顶点逐层做广度优先搜索，取最后一层中度数最小的顶点；若它的离心率（层数）更大则继续，否则停止，最多8轮。
+        * 伪外围顶点的离心率接近分量的直径，从它出发的层次结构又窄又深，Cuthill-McKee 次序的带宽更小。
+        *
+        * `visited`在返回时恢复为调用前的状态
+        */
+        template<typename VIDType>
+        VIDType _pseudo_peripheral_vertex(const _ReorderAdjacency<VIDType>& adjacency,VIDType start,std::vector<bool>& visited)
+        {
+            std::vector<VIDType> reached,level,next;
+            std::size_t eccentricity=0;
+            for(int round=0;round<8;round++)
+            {
+                reached.assign(1,start);
+                level.assign(1,start);
+                visited[start]=true;
+                std::size_t depth=0;
+                while(true)
+                {
+                    next.clear();
+                    for(VIDType u:level)
+                        for(std::size_t k=adjacency.offsets[u];k<adjacency.offsets[u+1];k++)
+                        {
+                            VIDType v=adjacency.targets[k];
+                            if(visited[v]) continue;
+                            visited[v]=true;
+                            next.push_back(v);
+                        }
+                    if(next.empty()) break;
+                    reached.insert(reached.end(),next.begin(),next.end());
+                    level.swap(next);
+                    depth++;
+                }
+                for(VIDType v:reached) visited[v]=false;
+                if(round>0&&depth<=eccentricity) break;
+                eccentricity=depth;
+                start=*std::min_element(level.begin(),level.end(),[&adjacency](VIDType a,VIDType b){
+                    return adjacency.degree(a)<adjacency.degree(b);});
+            }
+            return start;
+        }
+
+        //!degree_ordering：按度数递减的次序重新编号
+        /*!
+        * \param graph:指向图的强指针，必须非空，否则抛出异常
+        * \return: 顶点的新编号。度数为无向度数（去掉重复边与自环），度数相同时按原编号递增
+        *
+        * 度数大的顶点被大多数边访问。把它们集中在编号最小的一段，使得它们的顶点数据与行偏移常驻缓存，适用于R-MAT、社交网络等度数分布很不均匀的图。
+        *
+        * - 时间复杂度 O(V log V + E log Δ)
+        */
+        template<typename GraphType>
+        VertexOrdering<typename GraphType::VIDType> degree_ordering(std::shared_ptr<GraphType> graph)
+        {
+            typedef typename GraphType::VIDType VIDType;
+            auto adjacency=_make_reorder_adjacency(graph,"degree_ordering");
+            std::vector<VIDType> order;
+            for(std::size_t v=0;v<adjacency.exist.size();v++)
+                if(adjacency.exist[v]) order.push_back(v);
+            std::stable_sort(order.begin(),order.end(),[&adjacency](VIDType a,VIDType b){
+                return adjacency.degree(a)>adjacency.degree(b);});
+            return _make_vertex_ordering(adjacency,order);
+        }
+        //!bfs_ordering：按广度优先搜索的访问次序重新编号
+        /*!
+        * \param graph:指向图的强指针，必须非空，否则抛出异常
+        * \param source_id:第一个搜索的源点，必须有效，否则抛出异常。默认为第一个存在的顶点
+        * \return: 顶点的新编号。其余的连通分量依次从原编号最小的未访问顶点开始搜索
+        *
+        * 广度优先搜索的同一层、相邻层的顶点编号相邻，之后从同一个源点出发的遍历所访问的顶点数据几乎是顺序的。
+        */
+        template<typename GraphType>
+        VertexOrdering<typename GraphType::VIDType> bfs_ordering(std::shared_ptr<GraphType> graph,typename GraphType::VIDType source_id=-1)
+        {
+            typedef typename GraphType::VIDType VIDType;
+            auto adjacency=_make_reorder_adjacency(graph,"bfs_ordering");
+            const std::size_t num=adjacency.exist.size();
+            if(source_id!=-1&&(source_id<0||static_cast<std::size_t>(source_id)>=num||!adjacency.exist[source_id]))
+                throw std::invalid_argument("bfs_ordering error: source_id muse belongs [0,N) and graph->vertexes[source_id] must not be nullptr!");
+            std::vector<bool> visited(num,false);
+            std::vector<VIDType> order;
+            if(source_id!=-1)
+                _bfs_component(adjacency,source_id,false,visited,order);
+            for(std::size_t v=0;v<num;v++)
+                if(adjacency.exist[v]&&!visited[v])
+                    _bfs_component(adjacency,VIDType(v),false,visited,order);
+            return _make_vertex_ordering(adjacency,order);
+        }
+        //!dfs_ordering：按深度优先搜索的发现次序（先序）重新编号
+        /*!
+        * \param graph:指向图的强指针，必须非空，否则抛出异常
+        * \return: 顶点的新编号。连通分量依次从原编号最小的未访问顶点开始搜索
+        *
+        * 深度优先搜索以显式的栈实现，大图也不会栈溢出。一条搜索路径上的顶点编号连续，适用于沿路径访问的算法。
+        */
+        template<typename GraphType>
+        VertexOrdering<typename GraphType::VIDType> dfs_ordering(std::shared_ptr<GraphType> graph)
+        {
+            typedef typename GraphType::VIDType VIDType;
+            auto adjacency=_make_reorder_adjacency(graph,"dfs_ordering");
+            const std::size_t num=adjacency.exist.size();
+            std::vector<bool> visited(num,false);
+            std::vector<VIDType> order;
+            std::vector<std::pair<VIDType,std::size_t>> stack;     //(顶点，下一条待检查的边)
+            for(std::size_t s=0;s<num;s++)
+            {
+                if(!adjacency.exist[s]||visited[s]) continue;
+                visited[s]=true;
+                order.push_back(s);
+                stack.push_back(std::make_pair(VIDType(s),adjacency.offsets[s]));
+                while(!stack.empty())
+                {
+                    auto& top=stack.back();
+                    if(top.second==adjacency.offsets[top.first+1])
+                    {
+                        stack.pop_back();
+                        continue;
+                    }
+                    VIDType v=adjacency.targets[top.second++];
+                    if(visited[v]) continue;
+                    visited[v]=true;
+                    order.push_back(v);
+                    stack.push_back(std::make_pair(v,adjacency.offsets[v]));
+                }
+            }
+            return _make_vertex_ordering(adjacency,order);
+        }
+        //!reverse_cuthill_mckee_ordering：按逆 Cuthill-McKee 次序重新编号
+        /*!
+        * \param graph:指向图的强指针，必须非空，否则抛出异常
+        * \return: 顶点的新编号
+        *
+        * 对每个连通分量（按最小度数的顶点依次处理），从一个伪外围顶点出发做广度优先搜索，每个顶点的未访问邻居按度数递增的次序入队，
+        * 得到 Cuthill-McKee 次序；最后将整个次序反转。
+        *
+        * 它使邻接矩阵的非零元集中在对角线附近（带宽、轮廓小）：每条边的两个端点编号接近，
+        * 遍历一个顶点的邻居时访问的顶点数据落在同一段内存中。适用于网格、路网、有限元网格等近似平面的图。
+        *
+        * - 时间复杂度 O(V log V + E log Δ)，寻找伪外围顶点最多做常数次广度优先搜索
+        */
+        template<typename GraphType>
+        VertexOrdering<typename GraphType::VIDType> reverse_cuthill_mckee_ordering(std::shared_ptr<GraphType> graph)
+        {
+            typedef typename GraphType::VIDType VIDType;
+            auto adjacency=_make_reorder_adjacency(graph,"reverse_cuthill_mckee_ordering");
+            const std::size_t num=adjacency.exist.size();
+            std::vector<VIDType> candidates;
+            for(std::size_t v=0;v<num;v++)
+                if(adjacency.exist[v]) candidates.push_back(v);
+            std::stable_sort(candidates.begin(),candidates.end(),[&adjacency](VIDType a,VIDType b){
+                return adjacency.degree(a)<adjacency.degree(b);});
+            std::vector<bool> visited(num,false);
+            std::vector<VIDType> order;
+            for(VIDType v:candidates)
+            {
+                if(visited[v]) continue;
+                VIDType start=_pseudo_peripheral_vertex(adjacency,v,visited);
+                _bfs_component(adjacency,start,true,visited,order);
+            }
+            std::reverse(order.begin(),order.end());
+            return _make_vertex_ordering(adjacency,order);
+        }
+        //!ordering_bandwidth：返回图在给定编号下的带宽与平均边跨度
+        /*!
+        * \param graph:指向图的强指针，必须非空，否则抛出异常
+        * \param ordering:顶点的新编号，大小必须为顶点数量，否则抛出异常
+        * \return: (带宽，平均边跨度)。带宽为所有边 |new_id[u]-new_id[v]| 的最大值，平均边跨度为其平均值，用于衡量次序的局部性
+        */
+        template<typename GraphType>
+        std::pair<std::size_t,double> ordering_bandwidth(std::shared_ptr<GraphType> graph,const VertexOrdering<typename GraphType::VIDType>& ordering)
+        {
+            if(!graph)
+                throw std::invalid_argument("ordering_bandwidth error: graph must not be nullptr!");
+            if(ordering.size()!=graph->vertexes.size())
+                throw std::invalid_argument("ordering_bandwidth error: ordering.size() must equal to vertex number!");
+            std::size_t bandwidth=0,edge_num=0;
+            double span=0;
+            for(std::size_t u=0;u<graph->vertexes.size();u++)
+            {
+                if(!vertex_exists(graph->vertexes,u)) continue;
+                for(const auto& neighbor:graph->neighbors(u))
+                {
+                    std::size_t gap=std::abs(static_cast<long long>(ordering.new_id[u])-ordering.new_id[neighbor.first]);
+                    bandwidth=std::max(bandwidth,gap);
+                    span+=gap;
+                    edge_num++;
+                }
+            }
+            return std::make_pair(bandwidth,edge_num>0?span/edge_num:0.0);
+        }
+
+        //!_reordered_edges：返回按新编号重新标记的所有边
+        template<typename GraphType>
+        std::vector<typename GraphType::EdgeTupleType> _reordered_edges(const GraphType& graph,const VertexOrdering<typename GraphType::VIDType>& ordering)
+        {
+            auto edges=graph.edge_tuples();
+            for(auto& edge:edges)
+            {
+                std::get<0>(edge)=ordering.new_id[std::get<0>(edge)];
+                std::get<1>(edge)=ordering.new_id[std::get<1>(edge)];
+            }
+            return edges;
+        }
+        //!_check_reorder_graph：检查`reorder_graph`的参数
+        template<typename GraphType,typename VIDType>
+        void _check_reorder_graph(std::shared_ptr<GraphType> graph,const VertexOrdering<VIDType>& ordering)
+        {
+            if(!graph)
+                throw std::invalid_argument("reorder_graph error: graph must not be nullptr!");
+            if(ordering.size()!=graph->vertexes.size()||ordering.old_id.size()!=ordering.size())
+                throw std::invalid_argument("reorder_graph error: ordering.size() must equal to vertex number!");
+        }
+        //!reorder_graph：按新编号重新标记`CSRGraph`
+        /*!
+        * \param graph:指向图的强指针，必须非空，否则抛出异常
+        * \param ordering:顶点的新编号，大小必须为顶点数量，否则抛出异常
+        * \return: 新的图。原编号为v的顶点成为新图中编号为`ordering.new_id[v]`的顶点，`key`相同；边与权重相同，端点按新编号标记
+        *
+        * 新图的行偏移、终点数组按新编号排列，因此按新编号相邻的顶点的邻接表在内存中也相邻。
+        * 在新图上的计算结果可以用`ordering.to_original`转换回原编号。
+        */
+        template<typename VType>
+        std::shared_ptr<CSRGraph<VType>> reorder_graph(std::shared_ptr<CSRGraph<VType>> graph,const VertexOrdering<typename CSRGraph<VType>::VIDType>& ordering)
+        {
+            _check_reorder_graph(graph,ordering);
+            auto result=std::make_shared<CSRGraph<VType>>(graph->vertexes.size(),graph->invalid_weight);
+            if(!graph->vertexes.materialized())
+                result->vertexes=graph->vertexes;   //原图尚未创建顶点对象：所有顶点都存在且key相同，新图同样按需创建
+            else
+                for(std::size_t v=0;v<graph->vertexes.size();v++)
+                    if(graph->vertexes[v])
+                        result->vertexes[ordering.new_id[v]]=std::make_shared<VType>(graph->vertexes[v]->key,ordering.new_id[v]);
+            auto edges=_reordered_edges(*graph,ordering);
+            result->set_edges(edges.begin(),edges.end());
+            return result;
+        }
+        //!reorder_graph：按新编号重新标记`Graph`
+        /*!
+        * \param graph:指向图的强指针，必须非空，否则抛出异常
+        * \param ordering:顶点的新编号，大小必须为`N`，否则抛出异常
+        * \return: 新的图，含义同`CSRGraph`的版本。新图的邻接矩阵与邻接表都按新编号重建
+        */
+        template<unsigned N,typename VType>
+        std::shared_ptr<Graph<N,VType>> reorder_graph(std::shared_ptr<Graph<N,VType>> graph,const VertexOrdering<typename Graph<N,VType>::VIDType>& ordering)
+        {
+            _check_reorder_graph(graph,ordering);
+            auto result=std::make_shared<Graph<N,VType>>(graph->matrix.invalid_weight);
+            for(std::size_t v=0;v<N;v++)
+                if(graph->vertexes[v])
+                    result->vertexes[ordering.new_id[v]]=std::make_shared<VType>(graph->vertexes[v]->key,ordering.new_id[v]);
+            auto edges=_reordered_edges(*graph,ordering);
+            result->add_edges(edges.begin(),edges.end());
+            return result;
+        }
+    }
+}
+#endif // GRAPHREORDERING
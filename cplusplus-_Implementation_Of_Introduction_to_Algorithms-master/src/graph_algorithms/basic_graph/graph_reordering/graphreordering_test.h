@@ -0,0 +1,214 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef GRAPHREORDERING_TEST
+#define GRAPHREORDERING_TEST
+#include <random>
+#include <algorithm>
+#include "../../../google_test/gtest.h"
+#include "graphreordering.h"
+#include "../graph_bfs/bfs.h"
+#include "../graph_visitor/graphvisitor.h"
+#include "../graph_representation/graph_vertex/vertex.h"
+#include "../graph_representation/vertex_property_map/vertexpropertymap.h"
+#include "../../graph_generator/graphgenerator.h"
+
+using IntroductionToAlgorithm::GraphAlgorithm::VertexOrdering;
+using IntroductionToAlgorithm::GraphAlgorithm::degree_ordering;
+using IntroductionToAlgorithm::GraphAlgorithm::bfs_ordering;
+using IntroductionToAlgorithm::GraphAlgorithm::dfs_ordering;
+using IntroductionToAlgorithm::GraphAlgorithm::reverse_cuthill_mckee_ordering;
+using IntroductionToAlgorithm::GraphAlgorithm::ordering_bandwidth;
+using IntroductionToAlgorithm::GraphAlgorithm::reorder_graph;
+using IntroductionToAlgorithm::GraphAlgorithm::CSRGraph;
+using IntroductionToAlgorithm::GraphAlgorithm::Graph;
+using IntroductionToAlgorithm::GraphAlgorithm::Vertex;
+using IntroductionToAlgorithm::GraphAlgorithm::SearchProperties;
+using IntroductionToAlgorithm::GraphAlgorithm::NullVisitor;
+using IntroductionToAlgorithm::GraphAlgorithm::breadth_first_visit;
+using IntroductionToAlgorithm::GraphAlgorithm::grid_graph;
+using IntroductionToAlgorithm::GraphAlgorithm::erdos_renyi_graph;
+
+//!GraphReorderingTest:测试类，用于为测试提供基础数据
+/*!
+*
+* `GraphReorderingTest`是 `::testing::Test` 的子类。它主要用于为每一个`TEST_F`准备测试环境
+*/
+class GraphReorderingTest:public ::testing::Test
+{
+public:
+    typedef CSRGraph<Vertex<int>> GType; /*!< 模板实例化的图类型*/
+protected:
+    void SetUp()
+    {
+        //********* 30x30的网格图，顶点编号被随机打乱 **********
+        auto grid=grid_graph(30,30,3);
+        std::vector<int> shuffle(grid.vertex_num);
+        for(std::size_t v=0;v<shuffle.size();v++) shuffle[v]=v;
+        std::shuffle(shuffle.begin(),shuffle.end(),std::mt19937(3));
+        for(auto& edge:grid.edges)
+        {
+            std::get<0>(edge)=shuffle[std::get<0>(edge)];
+            std::get<1>(edge)=shuffle[std::get<1>(edge)];
+        }
+        _grid=std::make_shared<GType>(grid.vertex_num,grid.edges.begin(),grid.edges.end(),unlimit<int>());
+        auto random=erdos_renyi_graph(500,1200,3);      //稀疏的随机有向图，有多个连通分量
+        _random=std::make_shared<GType>(random.vertex_num,random.edges.begin(),random.edges.end(),unlimit<int>());
+    }
+    void TearDown(){}
+    //!_check_permutation：检查`new_id`与`old_id`是互逆的排列
+    static void _check_permutation(const VertexOrdering<int>& ordering,std::size_t num)
+    {
+        ASSERT_EQ(ordering.size(),num);
+        ASSERT_EQ(ordering.old_id.size(),num);
+        for(std::size_t v=0;v<num;v++)
+        {
+            ASSERT_GE(ordering.new_id[v],0);
+            ASSERT_LT(ordering.new_id[v],int(num));
+            EXPECT_EQ(ordering.old_id[ordering.new_id[v]],int(v));
+        }
+    }
+    std::shared_ptr<GType> _grid;    /*!< 顶点编号被打乱的网格图*/
+    std::shared_ptr<GType> _random;  /*!< 随机有向图*/
+};
+//!test_orderings:测试各种顶点次序
+/*!
+*
+* 各种次序都是完整的排列；度数次序中度数不增；广度优先次序从给定的源点开始
+*/
+TEST_F(GraphReorderingTest,test_orderings)
+{
+    for(auto graph:{_grid,_random})
+    {
+        _check_permutation(degree_ordering(graph),graph->vertexes.size());
+        _check_permutation(bfs_ordering(graph),graph->vertexes.size());
+        _check_permutation(dfs_ordering(graph),graph->vertexes.size());
+        _check_permutation(reverse_cuthill_mckee_ordering(graph),graph->vertexes.size());
+    }
+    auto degree=degree_ordering(_random);
+    auto inverse=_random->inverse();
+    auto total_degree=[&](int v){
+        std::vector<int> neighbors;
+        for(const auto& neighbor:_random->neighbors(v)) if(neighbor.first!=v) neighbors.push_back(neighbor.first);
+        for(const auto& neighbor:inverse->neighbors(v)) if(neighbor.first!=v) neighbors.push_back(neighbor.first);
+        std::sort(neighbors.begin(),neighbors.end());
+        return std::unique(neighbors.begin(),neighbors.end())-neighbors.begin();
+    };
+    for(int i=1;i<500;i++)
+        EXPECT_GE(total_degree(degree.old_id[i-1]),total_degree(degree.old_id[i]));
+    auto bfs=bfs_ordering(_grid,123);
+    EXPECT_EQ(bfs.old_id[0],123);
+    EXPECT_EQ(bfs.to_new(123),0);
+    EXPECT_EQ(bfs.to_old(-1),-1);
+}
+//!test_rcm_bandwidth:测试逆 Cuthill-McKee 次序的带宽
+/*!
+*
+* 打乱编号的网格图的带宽接近顶点数量；逆 Cuthill-McKee 次序将它恢复到与网格宽度同一量级，广度优先次序也明显减小平均边跨度
+*/
+TEST_F(GraphReorderingTest,test_rcm_bandwidth)
+{
+    VertexOrdering<int> identity;
+    for(int v=0;v<900;v++)
+    {
+        identity.new_id.push_back(v);
+        identity.old_id.push_back(v);
+    }
+    auto shuffled=ordering_bandwidth(_grid,identity);
+    auto rcm=ordering_bandwidth(_grid,reverse_cuthill_mckee_ordering(_grid));
+    auto bfs=ordering_bandwidth(_grid,bfs_ordering(_grid));
+    EXPECT_GT(shuffled.first,600);
+    EXPECT_LE(rcm.first,60);
+    EXPECT_LT(rcm.second*5,shuffled.second);
+    EXPECT_LT(bfs.second*5,shuffled.second);
+}
+//!test_reorder_graph:测试重新标记图
+/*!
+*
+* 新图的边与原图的边一一对应、权重相同；在新图上广度优先搜索的距离转换回原编号后与原图相同
+*/
+TEST_F(GraphReorderingTest,test_reorder_graph)
+{
+    auto ordering=reverse_cuthill_mckee_ordering(_random);
+    auto reordered=reorder_graph(_random,ordering);
+    ASSERT_EQ(reordered->edge_num(),_random->edge_num());
+    for(const auto& edge:_random->edge_tuples())
+    {
+        int u=ordering.to_new(std::get<0>(edge)),v=ordering.to_new(std::get<1>(edge));
+        ASSERT_TRUE(reordered->has_edge(u,v));
+        EXPECT_EQ(reordered->weight(u,v),std::get<2>(edge));
+    }
+    for(int v=0;v<500;v++)
+        EXPECT_EQ(reordered->vertexes[ordering.to_new(v)]->id,ordering.to_new(v));
+    SearchProperties<int> expect,actual;
+    for(int source:{0,17,499})
+    {
+        NullVisitor visitor;
+        breadth_first_visit(_random,source,expect,visitor);
+        breadth_first_visit(reordered,ordering.to_new(source),actual,visitor);
+        std::vector<int> distance(actual.distance.begin(),actual.distance.end());
+        EXPECT_EQ(ordering.to_original(distance),std::vector<int>(expect.distance.begin(),expect.distance.end()));
+        EXPECT_EQ(ordering.to_reordered(ordering.to_original(distance)),distance);
+    }
+}
+//!test_reorder_matrix_graph:测试重新标记含有空顶点的`Graph`
+/*!
+*
+* 不存在的顶点排在新编号的最后；顶点的`key`、边与权重都被保留
+*/
+TEST_F(GraphReorderingTest,test_reorder_matrix_graph)
+{
+    typedef Graph<8,Vertex<int>> MType;
+    auto graph=std::make_shared<MType>(-1);
+    for(int v:{0,2,3,5,6})
+        graph->add_vertex(v*10,v);
+    for(const auto& edge:{std::make_tuple(0,6,1),std::make_tuple(6,2,2),std::make_tuple(2,5,3),std::make_tuple(5,3,4)})
+        graph->add_edge(edge);
+    auto ordering=reverse_cuthill_mckee_ordering(graph);
+    _check_permutation(ordering,8);
+    for(int v:{1,4,7})
+        EXPECT_GE(ordering.to_new(v),5);
+    EXPECT_EQ(ordering_bandwidth(graph,ordering).first,1);      //一条链
+    auto reordered=reorder_graph(graph,ordering);
+    for(int v:{0,2,3,5,6})
+    {
+        ASSERT_TRUE(reordered->vertexes[ordering.to_new(v)]);
+        EXPECT_EQ(reordered->vertexes[ordering.to_new(v)]->key,v*10);
+    }
+    for(int v:{1,4,7})
+        EXPECT_FALSE(reordered->vertexes[ordering.to_new(v)]);
+    EXPECT_EQ(reordered->edge_tuples().size(),4);
+    EXPECT_EQ(reordered->weight(ordering.to_new(2),ordering.to_new(5)),3);
+}
+//!test_reordering_invalid:测试无效的参数
+/*!
+*
+* 空的图、无效的源点、大小不匹配的次序或数组抛出异常
+*/
+TEST_F(GraphReorderingTest,test_reordering_invalid)
+{
+    EXPECT_THROW(degree_ordering(std::shared_ptr<GType>()),std::invalid_argument);
+    EXPECT_THROW(reverse_cuthill_mckee_ordering(std::shared_ptr<GType>()),std::invalid_argument);
+    EXPECT_THROW(bfs_ordering(_grid,900),std::invalid_argument);
+    EXPECT_THROW(bfs_ordering(_grid,-2),std::invalid_argument);
+    auto ordering=bfs_ordering(_random);
+    EXPECT_THROW(reorder_graph(_grid,ordering),std::invalid_argument);
+    EXPECT_THROW(ordering_bandwidth(_grid,ordering),std::invalid_argument);
+    EXPECT_THROW(ordering.to_original(std::vector<int>(3)),std::invalid_argument);
+}
+#endif // GRAPHREORDERING_TEST
@@ -20,6 +20,10 @@
 #define ADJLISTGRAPH
 #include<vector>
 #include<array>
+#include<tuple>
+#include<algorithm>
+#include<stdexcept>
+#include"../neighbor_range/neighborrange.h"
 namespace IntroductionToAlgorithm
 {
     namespace GraphAlgorithm
@@ -29,7 +33,7 @@ namespace IntroductionToAlgorithm
         * 图的邻接表主要包含一个数据：
         *
         * - `array`：邻接表，类型为`std::array<std::vector<std::pair<VIDType,EWeightType>>,N> `，为`N`行，每一行代表一个节点：
-        *                                                            把节点号和权重组成一个pair值
+        *                                                            把节点号和权重组成一个pair值。每一行按照节点号从小到大排列
         * 为了便于计算，这里并不管理边和顶点，只是维护邻接表。边、顶点与邻接表的同步由使用者确保。
         */
         template<unsigned N> struct ADJListGraph
@@ -37,6 +41,8 @@ namespace IntroductionToAlgorithm
             typedef int VIDType;                                            /*!< 顶点编号的类型*/
             typedef int EWeightType;                                        /*!< 权重的类型*/
             typedef std::tuple<VIDType,VIDType,EWeightType> EdgeTupleType;  /*!< 边的三元素（顶点1编号，顶点2编号，权重)组成的元组*/
+            typedef std::pair<VIDType,EWeightType> NeighborType;            /*!< 邻接表中的一项：（另一个顶点编号，权重）*/
+            typedef NeighborRange<typename std::vector<NeighborType>::const_iterator> NeighborRangeType; /*!< 从某个顶点出发的边的区间类型*/
             static const unsigned NUM=N;                                    /*!< 顶点的最大容量*/
             //!add_edge:添加一条边
             /*!
@@ -46,6 +52,8 @@ namespace IntroductionToAlgorithm
             *
             * 如果指定节点之间的边已经存在，则抛出`std::invalid_argument`异常
             * > 要求边的顶点均在`[0,N)`这个半闭半开区间。如果任何一个值超过该区间则认为顶点`id`无效，直接返回而不作添加
+            *
+            * 新的边按照节点号插入到邻接表对应行的有序位置
             */
             void add_edge(const EdgeTupleType& edge_tuple)
             {
@@ -54,9 +62,11 @@ namespace IntroductionToAlgorithm
                 auto wt=std::get<2>(edge_tuple);
                 if(id1<0||id1>=N||id2<0||id2>=N)
                     return;
-                if(has_edge(id1,id2))
+                auto& vec=array.at(id1);
+                auto iter=_lower_bound(vec,id2);
+                if(iter!=vec.end()&&iter->first==id2)
                     throw std::invalid_argument("edge add error,edge has already exist.");
-                array.at(id1).push_back(std::make_pair(id2,wt));
+                vec.insert(iter,std::make_pair(id2,wt));
             }
             //!add_edges:添加一组边
             /*!
@@ -93,17 +103,11 @@ namespace IntroductionToAlgorithm
             {
                 if(id1<0||id1>=N||id2<0||id2>=N)
                     return;
-                if(!has_edge(id1,id2))    
-                    throw std::invalid_argument("edge adjust error,edge does not exist.");
                 auto& vec = array.at(id1);            //这里必须用引用类型，因为要修改邻接表
-                for(auto& pair : vec)
-                {
-                    if(pair.first == id2)
-                    {
-                        pair.second = wt;             //修改一条边上的权重
-                        break;
-                    }
-                }
+                auto iter=_lower_bound(vec,id2);
+                if(iter==vec.end()||iter->first!=id2)
+                    throw std::invalid_argument("edge adjust error,edge does not exist.");
+                iter->second = wt;                    //修改一条边上的权重
             }            
             //!edge_tuples:返回图中所有边的三元素元组集合，这里集合采用`std::vector<std::tuple<VIDType, VIDType, EWeightType>>`
             /*!
@@ -121,12 +125,32 @@ namespace IntroductionToAlgorithm
                     }
                 return result;
             }
+            //!neighbors:返回图中从指定顶点出发的边的区间
+            /*!
+            * \param id: 指定顶点`id`
+            * \return  : 一个`NeighborRange`，其元素为`std::pair<VIDType,EWeightType>`（另一个顶点编号，权重），按照另一个顶点编号从小到大排列
+            *
+            * - 如果指定的顶点`id`不在`[0,N)`之间，则无效，抛出异常
+            *
+            * 该区间直接引用邻接表的对应行，不分配内存。
+            */
+            NeighborRangeType neighbors(VIDType id) const
+            {
+                if(id<0||static_cast<unsigned>(id)>=N)
+                {
+                    throw std::invalid_argument("neighbors: id must belongs [0,N),");
+                }
+                const auto& vec=array.at(id);
+                return NeighborRangeType(vec.begin(),vec.end());
+            }
             //!vertex_edge_tuples:返回图中从指定顶点出发的边的三元素元组集合，这里集合采用`std::vector<std::tuple<VIDType,VIDType,EWeightType>>`
             /*!
             * \param id: 指定顶点`id`
             * \return  : 图中指定顶点出发的边的三元素元组集合
             *
             * - 如果指定的顶点`id`不在`[0,N)`之间，则无效
+            *
+            * 它是`neighbors(id)`的包装，会分配一个新的`std::vector`。遍历图时应该使用`neighbors(id)`
             */
             const std::vector<EdgeTupleType> 
             vertex_edge_tuples(VIDType id) const
@@ -136,7 +160,7 @@ namespace IntroductionToAlgorithm
                     throw std::invalid_argument("vertex_edge_tuples: id must belongs [0,N),");
                 }
                 std::vector<EdgeTupleType> result;
-                for(const auto& pair:array.at(id))
+                for(const auto& pair:neighbors(id))
                 {
                     result.push_back(std::make_tuple(id, pair.first, pair.second));
                 }
@@ -160,12 +184,8 @@ namespace IntroductionToAlgorithm
                     throw std::invalid_argument("has_edge: id_from  and id _to must belongs [0,N),");
                 }
                 const auto& vec=array.at(id_from);
-                for(const auto& pair:vec)
-                {
-                    if(pair.first==id_to)
-                        return true;
-                }
-                return false;
+                auto iter=_lower_bound(vec,id_to);
+                return iter!=vec.end()&&iter->first==id_to;
             }
             //!weight:返回图中指定顶点之间的边的权重
             /*!
@@ -181,20 +201,25 @@ namespace IntroductionToAlgorithm
             */
             EWeightType weight(VIDType id_from, VIDType id_to) const    //函数不改变内容
             {
-                if(has_edge(id_from,id_to))
-                {
-                    const auto& vec=array.at(id_from);
-                    for(const auto& pair:vec)
-                    {
-                        if(pair.first==id_to)
-                            return pair.second;
-                    }
-                }else
-                {
+                if(!has_edge(id_from,id_to))
                     throw std::invalid_argument("weight error: the edge does not exist.");
-                }
+                const auto& vec=array.at(id_from);
+                return _lower_bound(vec,id_to)->second;
             }
             std::array<std::vector<std::pair<VIDType,EWeightType>>,N> array; /*!< 图的邻接表*/
+        private:
+            //!_lower_bound:在邻接表的一行中二分查找第一个节点号不小于`id`的位置
+            /*!
+            * \param vec: 邻接表的一行
+            * \param id: 待查找的节点号
+            * \return  : 对应位置的迭代器
+            */
+            template<typename VecType>
+            static auto _lower_bound(VecType& vec,VIDType id)->decltype(vec.begin())
+            {
+                return std::lower_bound(vec.begin(),vec.end(),id,
+                    [](const std::pair<VIDType,EWeightType>& pair,VIDType val){return pair.first<val;});
+            }
         };
     }
 }
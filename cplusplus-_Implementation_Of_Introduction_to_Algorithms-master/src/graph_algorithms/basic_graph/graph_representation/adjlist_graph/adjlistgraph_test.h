@@ -174,5 +174,35 @@ TEST_F(GraphADJListTest,test_vertex_edge_tuples)
     }
 }
 
+//!GraphADJListTest:测试图的邻接表
+/*!
+*
+* `test_neighbors`：测试`neighbors(...)`成员方法：无论边的添加次序如何，区间都按照另一个顶点编号从小到大排列
+*/
+TEST_F(GraphADJListTest,test_neighbors)
+{
+    EXPECT_THROW(graph->neighbors(-1),std::invalid_argument);
+    EXPECT_THROW(graph->neighbors(ADJ_NUM),std::invalid_argument);
+    for(int i=0;i<ADJ_NUM;i++)
+        EXPECT_TRUE(graph->neighbors(i).empty());
+
+    for(int i=0;i<ADJ_NUM;i++)
+        for(int j=ADJ_NUM-1;j>=0;j--)           //逆序添加
+        {
+            graph->add_edge(std::make_tuple(i,j,i*j));
+        }
+    for(int i=0;i<ADJ_NUM;i++)
+    {
+        int j=0;
+        for(const auto& neighbor:graph->neighbors(i))
+        {
+            EXPECT_EQ(neighbor.first,j)<<"i:"<<i;
+            EXPECT_EQ(neighbor.second,i*j)<<"i:"<<i;
+            j++;
+        }
+        EXPECT_EQ(j,ADJ_NUM);
+    }
+}
+
 #endif // ADJLISTGRAPH_TEST
 
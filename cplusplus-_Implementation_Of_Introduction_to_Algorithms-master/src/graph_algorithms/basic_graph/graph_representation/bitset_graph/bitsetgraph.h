@@ -0,0 +1,409 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef BITSETGRAPH
+#define BITSETGRAPH
+#include<array>
+#include<vector>
+#include<tuple>
+#include<memory>
+#include<iterator>
+#include<algorithm>
+#include<stdexcept>
+#include<cstdint>
+#include"../../../../header.h"
+#include"../neighbor_range/neighborrange.h"
+
+namespace IntroductionToAlgorithm
+{
+    namespace GraphAlgorithm
+    {
+        //!_bitset_popcount：返回整数中1的位数
+        inline unsigned _bitset_popcount(std::uint64_t bits)
+        {
+#if defined(__GNUC__)
+            return __builtin_popcountll(bits);
+#else
+            unsigned count=0;
+            for(;bits;bits&=bits-1) count++;
+            return count;
+#endif
+        }
+
+        //!BitsetMatrixGraph：无权图的位矩阵表示，算法导论22章22.1节
+        /*!
+        * `MatrixGraph<N>`为每一对顶点保存一个`int`权重，以`invalid_weight`表示没有边。对于无权图，每一项只需要一位：
+        *
+        * - `bits`：一个`N*WORDS`个 64位 字组成的`std::array`，`WORDS=(N+63)/64`在编译期确定。第`r`行占`bits[r*WORDS..(r+1)*WORDS)`，
+        *   其中第`c`位为1表示存在边(r,c)。每一行最后一个字中超过`N`的位总是0
+        *
+        * 与`MatrixGraph<N>`相比，空间为它的1/32；`has_edge`是一次位测试。更重要的是，一行就是一个顶点的邻居集合，
+        * 广度优先搜索、传递闭包、连通分量、二分图判定都可以写成整行的按位与、按位或（见`bitset_breadth_first_search`等），每条指令处理64个顶点。
+        *
+        * 它适用于 N 较小（不超过4096）而边较稠密的图。所有的边权重都视为1。与`MatrixGraph`相同，这里不管理顶点，`[0,N)`中的每个编号都是一个顶点。
+        * `N=4096`时对象大小为 2MB，应该用`std::make_shared`在堆上创建，而不是作为局部变量。
+        */
+        template<unsigned N> struct BitsetMatrixGraph
+        {
+            static_assert(N>0&&N<=4096,"BitsetMatrixGraph: N must belongs [1,4096]");
+            typedef int VIDType;                                            /*!< 顶点编号的类型*/
+            typedef int EWeightType;                                        /*!< 权重的类型*/
+            typedef std::tuple<VIDType,VIDType,EWeightType> EdgeTupleType;  /*!< 边的三元素（顶点1编号，顶点2编号，权重)组成的元组*/
+            typedef std::pair<VIDType,EWeightType> NeighborType;            /*!< 从某个顶点出发的一条边：（另一个顶点编号，权重）*/
+            static const unsigned NUM=N;                                    /*!< 顶点的最大容量*/
+            static const std::size_t WORDS=(N+63)/64;                       /*!< 每一行的字数*/
+
+            //!NeighborIterator：遍历一行中为1的位的迭代器，解引用得到`NeighborType`的值（权重为1）
+            class NeighborIterator
+            {
+            public:
+                typedef std::input_iterator_tag iterator_category;          /*!< 迭代器类别*/
+                typedef NeighborType value_type;                            /*!< 解引用的值类型*/
+                typedef std::ptrdiff_t difference_type;                     /*!< 迭代器距离类型*/
+                typedef const NeighborType* pointer;                        /*!< 指针类型*/
+                typedef NeighborType reference;                             /*!< 解引用的返回类型（按值返回）*/
+                //!显式构造函数
+                /*!
+                * \param row: 一行的起始地址
+                * \param word: 起始字。为`WORDS`时构造终止迭代器
+                */
+                NeighborIterator(const std::uint64_t* row,std::size_t word):_row(row),_word(word),_bits(word<WORDS?row[word]:0)
+                {
+                    _skip();
+                }
+                NeighborType operator*() const {return NeighborType(_word*64+lowest_bit(_bits),1);}
+                NeighborIterator& operator++() {_bits&=_bits-1;_skip();return *this;}
+                NeighborIterator operator++(int) {NeighborIterator old=*this;++*this;return old;}
+                bool operator==(const NeighborIterator& other) const {return _word==other._word&&_bits==other._bits;}
+                bool operator!=(const NeighborIterator& other) const {return !(*this==other);}
+            private:
+                //!_skip:跳过全0的字
+                void _skip()
+                {
+                    while(!_bits&&_word<WORDS)
+                        if(++_word<WORDS) _bits=_row[_word];
+                }
+                const std::uint64_t* _row;  /*!< 一行的起始地址*/
+                std::size_t _word;          /*!< 当前字*/
+                std::uint64_t _bits;        /*!< 当前字中还没有遍历的位*/
+            };
+            typedef NeighborRange<NeighborIterator> NeighborRangeType;     /*!< 从某个顶点出发的边的区间类型*/
+
+            //!默认构造函数，构造没有边的图
+            BitsetMatrixGraph() {bits.fill(0);}
+
+            //!add_edge:添加一条边
+            /*!
+            * \param  id1:边的起点
+            * \param  id2:边的终点
+            *
+            * 如果顶点`id`不在`[0,N)`之间，或者边已经存在，则抛出`std::invalid_argument`异常
+            */
+            void add_edge(VIDType id1,VIDType id2)
+            {
+                if(has_edge(id1,id2))
+                    throw std::invalid_argument("edge add error,edge has already exist.");
+                bits[id1*WORDS+id2/64]|=std::uint64_t(1)<<(id2%64);
+            }
+            //!add_edge:添加一条边
+            /*!
+            * \param  edge_tuple:一条边的三元素元组，权重被忽略
+            *
+            * 与`add_edge(id1,id2)`相同
+            */
+            void add_edge(const EdgeTupleType& edge_tuple)
+            {
+                add_edge(std::get<0>(edge_tuple),std::get<1>(edge_tuple));
+            }
+            //!add_edges:添加一组边
+            /*!
+            * \param  begin:边容器的起始迭代器
+            * \param  end:边容器的终止迭代器
+            */
+            template<typename Iterator> void add_edges(const Iterator&begin,const Iterator&end)
+            {
+                for(Iterator iter=begin;iter!=end;++iter)
+                    add_edge(*iter);
+            }
+            //!remove_edge:删除一条边
+            /*!
+            * \param  id1:边的起点
+            * \param  id2:边的终点
+            *
+            * 如果顶点`id`不在`[0,N)`之间，或者边不存在，则抛出`std::invalid_argument`异常
+            */
+            void remove_edge(VIDType id1,VIDType id2)
+            {
+                if(!has_edge(id1,id2))
+                    throw std::invalid_argument("edge remove error,edge does not exist.");
+                bits[id1*WORDS+id2/64]&=~(std::uint64_t(1)<<(id2%64));
+            }
+            //!has_edge:返回图中指定顶点之间是否存在边
+            /*!
+            * \param id_from: 第一个顶点的`id`
+            * \param id_to: 第二个顶点的`id`
+            * \return  :第一个顶点和第二个顶点之间是否存在边
+            *
+            * 当`id_from`与`id_to`不在区间`[0,N)`之间时，抛出异常
+            */
+            bool has_edge(VIDType id_from,VIDType id_to) const
+            {
+                if(id_from<0||static_cast<unsigned>(id_from)>=N||id_to<0||static_cast<unsigned>(id_to)>=N)
+                    throw std::invalid_argument("has_edge: id_from  and id _to must belongs [0,N),");
+                return (bits[id_from*WORDS+id_to/64]>>(id_to%64))&1;
+            }
+            //!weight:返回图中指定顶点之间的边的权重，即1。边不存在时抛出异常
+            EWeightType weight(VIDType id_from,VIDType id_to) const
+            {
+                if(!has_edge(id_from,id_to))
+                    throw std::invalid_argument("weight error: the edge does not exist.");
+                return 1;
+            }
+            //!row:返回顶点出发的边所在的行，共`WORDS`个字
+            const std::uint64_t* row(VIDType id) const
+            {
+                if(id<0||static_cast<unsigned>(id)>=N)
+                    throw std::invalid_argument("row: id must belongs [0,N),");
+                return bits.data()+id*WORDS;
+            }
+            //!neighbors:返回图中从指定顶点出发的边的区间，按照另一个顶点编号从小到大排列，不分配内存。`id`无效时抛出异常
+            NeighborRangeType neighbors(VIDType id) const
+            {
+                const std::uint64_t* data=row(id);
+                return NeighborRangeType(NeighborIterator(data,0),NeighborIterator(data,WORDS));
+            }
+            //!out_degree:返回顶点的出度，即它所在行中1的位数
+            std::size_t out_degree(VIDType id) const
+            {
+                const std::uint64_t* data=row(id);
+                std::size_t degree=0;
+                for(std::size_t w=0;w<WORDS;w++) degree+=_bitset_popcount(data[w]);
+                return degree;
+            }
+            //!edge_num:返回边的数量
+            std::size_t edge_num() const
+            {
+                std::size_t count=0;
+                for(auto word:bits) count+=_bitset_popcount(word);
+                return count;
+            }
+            //!edge_tuples:返回图中所有边的三元素元组集合，按(起点，终点)递增排列，权重均为1
+            const std::vector<EdgeTupleType> edge_tuples() const
+            {
+                std::vector<EdgeTupleType> result;
+                for(unsigned u=0;u<N;u++)
+                    for(const auto& neighbor:neighbors(u))
+                        result.push_back(std::make_tuple(VIDType(u),neighbor.first,neighbor.second));
+                return result;
+            }
+
+            std::array<std::uint64_t,N*WORDS> bits;    /*!< 位矩阵，按行存放*/
+        };
+
+        //!_bitset_symmetric_rows：返回每个顶点的无向邻居集合，即位矩阵与它的转置的按位或
+        template<unsigned N>
+        std::vector<std::uint64_t> _bitset_symmetric_rows(const BitsetMatrixGraph<N>& graph)
+        {
+            const std::size_t WORDS=BitsetMatrixGraph<N>::WORDS;
+            std::vector<std::uint64_t> rows(graph.bits.begin(),graph.bits.end());
+            for(unsigned u=0;u<N;u++)
+                for(const auto& neighbor:graph.neighbors(u))
+                    rows[neighbor.first*WORDS+u/64]|=std::uint64_t(1)<<(u%64);
+            return rows;
+        }
+        //!_bitset_expand：从`frontier`中的顶点出发，一层一层地扩展到`visited`之外的顶点
+        /*!
+        * \param rows:各顶点的邻居集合，每行`WORDS`个字
+        * \param frontier:初始边界，调用后为空
+        * \param visited:已经访问的顶点，调用后包含所有新访问的顶点
+        * \param level_action:每扩展出一层时调用`level_action(next,depth)`，`next`为该层的顶点集合
+        *
+        * 每一层：`next = (OR_{u∈frontier} rows[u]) & ~visited`，然后`visited |= next`、`frontier = next`。
+        * 每个顶点只进入边界一次，因此总的时间为 O(N*WORDS) 次字运算
+        */
+        template<std::size_t WORDS,typename LevelAction>
+        void _bitset_expand(const std::uint64_t* rows,std::array<std::uint64_t,WORDS>& frontier,
+                            std::array<std::uint64_t,WORDS>& visited,LevelAction level_action)
+        {
+            std::array<std::uint64_t,WORDS> next;
+            for(std::size_t depth=1;;depth++)
+            {
+                next.fill(0);
+                for(std::size_t w=0;w<WORDS;w++)
+                    for(std::uint64_t word=frontier[w];word;word&=word-1)
+                    {
+                        const std::uint64_t* row=rows+(w*64+lowest_bit(word))*WORDS;
+                        for(std::size_t k=0;k<WORDS;k++) next[k]|=row[k];
+                    }
+                std::uint64_t any=0;
+                for(std::size_t k=0;k<WORDS;k++)
+                {
+                    next[k]&=~visited[k];
+                    visited[k]|=next[k];
+                    any|=next[k];
+                }
+                if(!any) return;
+                level_action(next,depth);
+                frontier=next;
+            }
+        }
+
+        //!bitset_breadth_first_search：位矩阵图的广度优先搜索，算法导论22章22.2节
+        /*!
+        * \param graph:指向图的强指针，必须非空，否则抛出异常
+        * \param source_id:源点，必须在`[0,N)`之间，否则抛出异常
+        * \return: 源点到各顶点的距离（边数），不可达的顶点为`unlimit<int>()`
+        *
+        * 边界与已访问集合都是位集，每一层由边界中顶点的行按位或得到，一次处理64个候选顶点，而不是逐条边检查。
+        *
+        * - 时间复杂度 O(N^2/64)
+        */
+        template<unsigned N>
+        std::vector<int> bitset_breadth_first_search(std::shared_ptr<BitsetMatrixGraph<N>> graph,int source_id)
+        {
+            const std::size_t WORDS=BitsetMatrixGraph<N>::WORDS;
+            if(!graph)
+                throw std::invalid_argument("bitset_breadth_first_search error: graph must not be nullptr!");
+            if(source_id<0||static_cast<unsigned>(source_id)>=N)
+                throw std::invalid_argument("bitset_breadth_first_search error: source_id muse belongs [0,N)!");
+            std::vector<int> distance(N,unlimit<int>());
+            distance[source_id]=0;
+            std::array<std::uint64_t,WORDS> frontier,visited;
+            frontier.fill(0);
+            frontier[source_id/64]=std::uint64_t(1)<<(source_id%64);
+            visited=frontier;
+            _bitset_expand<WORDS>(graph->bits.data(),frontier,visited,[&distance](const std::array<std::uint64_t,WORDS>& level,std::size_t depth){
+                for(std::size_t w=0;w<WORDS;w++)
+                    for(std::uint64_t word=level[w];word;word&=word-1)
+                        distance[w*64+lowest_bit(word)]=depth;
+            });
+            return distance;
+        }
+        //!bitset_transitive_closure：有向图的传递闭包，算法导论25章25.2节
+        /*!
+        * \param graph:指向图的强指针，必须非空，否则抛出异常
+        * \return: 传递闭包。边(i,j)存在当且仅当存在从i到j的路径；每个顶点到自身都有长度为0的路径，因此每个(i,i)都是闭包中的边
+        *
+        * 算法导论的`TRANSITIVE-CLOSURE`对每个中间结点k计算 t_ij = t_ij OR (t_ik AND t_kj)。固定i、k时，对所有的j这就是：
+        * 若 t_ik 为1，则第i行按位或上第k行。因此整个算法是 N^2 次“测试一位、按位或一行”。
+        *
+        * - 时间复杂度 O(N^3/64)
+        */
+        template<unsigned N>
+        std::shared_ptr<BitsetMatrixGraph<N>> bitset_transitive_closure(std::shared_ptr<BitsetMatrixGraph<N>> graph)
+        {
+            const std::size_t WORDS=BitsetMatrixGraph<N>::WORDS;
+            if(!graph)
+                throw std::invalid_argument("bitset_transitive_closure error: graph must not be nullptr!");
+            auto closure=std::make_shared<BitsetMatrixGraph<N>>(*graph);
+            auto& bits=closure->bits;
+            for(unsigned i=0;i<N;i++)
+                bits[i*WORDS+i/64]|=std::uint64_t(1)<<(i%64);
+            for(unsigned k=0;k<N;k++)
+            {
+                const std::uint64_t* row_k=bits.data()+k*WORDS;
+                for(unsigned i=0;i<N;i++)
+                {
+                    std::uint64_t* row_i=bits.data()+i*WORDS;
+                    if(i!=k&&((row_i[k/64]>>(k%64))&1))
+                        for(std::size_t w=0;w<WORDS;w++) row_i[w]|=row_k[w];
+                }
+            }
+            return closure;
+        }
+        //!bitset_connected_components：位矩阵图的连通分量，算法导论22章22.3节
+        /*!
+        * \param graph:指向图的强指针，必须非空，否则抛出异常。边的方向被忽略，即视为无向图
+        * \return: 各顶点所在的连通分量的编号。分量按其最小顶点编号递增的次序编号为0,1,2...
+        *
+        * 先将位矩阵与它的转置按位或得到无向的邻居集合，然后每次从编号最小的未访问顶点出发，以按位或逐层扩展（见`bitset_breadth_first_search`）。
+        *
+        * - 时间复杂度 O(N^2/64 + E)
+        */
+        template<unsigned N>
+        std::vector<int> bitset_connected_components(std::shared_ptr<BitsetMatrixGraph<N>> graph)
+        {
+            const std::size_t WORDS=BitsetMatrixGraph<N>::WORDS;
+            if(!graph)
+                throw std::invalid_argument("bitset_connected_components error: graph must not be nullptr!");
+            auto rows=_bitset_symmetric_rows(*graph);
+            std::vector<int> component(N,-1);
+            std::array<std::uint64_t,WORDS> frontier,visited;
+            visited.fill(0);
+            int count=0;
+            for(unsigned s=0;s<N;s++)
+            {
+                if(component[s]!=-1) continue;
+                frontier.fill(0);
+                frontier[s/64]=std::uint64_t(1)<<(s%64);
+                visited[s/64]|=frontier[s/64];
+                component[s]=count;
+                _bitset_expand<WORDS>(rows.data(),frontier,visited,[&component,count](const std::array<std::uint64_t,WORDS>& level,std::size_t){
+                    for(std::size_t w=0;w<WORDS;w++)
+                        for(std::uint64_t word=level[w];word;word&=word-1)
+                            component[w*64+lowest_bit(word)]=count;
+                });
+                count++;
+            }
+            return component;
+        }
+        //!bitset_is_bipartite：判断位矩阵图是否为二分图，算法导论22章练习22.2-7
+        /*!
+        * \param graph:指向图的强指针，必须非空，否则抛出异常。边的方向被忽略，即视为无向图
+        * \return: 是否可以将顶点分为两个集合，使得每条边的两个端点属于不同的集合
+        *
+        * 对每个连通分量逐层扩展，偶数层的顶点放入集合`even`，奇数层的顶点放入集合`odd`。
+        * 图是二分图当且仅当没有边的两个端点在同一个集合中，即对每个顶点u，`rows[u] & side(u)`全为0（自环使图不是二分图）。
+        *
+        * - 时间复杂度 O(N^2/64 + E)
+        */
+        template<unsigned N>
+        bool bitset_is_bipartite(std::shared_ptr<BitsetMatrixGraph<N>> graph)
+        {
+            const std::size_t WORDS=BitsetMatrixGraph<N>::WORDS;
+            if(!graph)
+                throw std::invalid_argument("bitset_is_bipartite error: graph must not be nullptr!");
+            auto rows=_bitset_symmetric_rows(*graph);
+            std::array<std::uint64_t,WORDS> frontier,visited,even,odd;
+            visited.fill(0);
+            even.fill(0);
+            odd.fill(0);
+            for(unsigned s=0;s<N;s++)
+            {
+                if((visited[s/64]>>(s%64))&1) continue;
+                frontier.fill(0);
+                frontier[s/64]=std::uint64_t(1)<<(s%64);
+                visited[s/64]|=frontier[s/64];
+                even[s/64]|=frontier[s/64];
+                _bitset_expand<WORDS>(rows.data(),frontier,visited,[&even,&odd](const std::array<std::uint64_t,WORDS>& level,std::size_t depth){
+                    auto& side=depth%2==0?even:odd;
+                    for(std::size_t w=0;w<WORDS;w++) side[w]|=level[w];
+                });
+            }
+            for(unsigned u=0;u<N;u++)
+            {
+                const auto& side=((even[u/64]>>(u%64))&1)?even:odd;
+                const std::uint64_t* row=rows.data()+u*WORDS;
+                for(std::size_t w=0;w<WORDS;w++)
+                    if(row[w]&side[w]) return false;
+            }
+            return true;
+        }
+    }
+}
+#endif // BITSETGRAPH
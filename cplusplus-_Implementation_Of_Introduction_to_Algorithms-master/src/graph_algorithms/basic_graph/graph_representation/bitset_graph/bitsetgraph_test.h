@@ -0,0 +1,188 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef BITSETGRAPH_TEST
+#define BITSETGRAPH_TEST
+#include <random>
+#include <queue>
+#include "../../../../google_test/gtest.h"
+#include "bitsetgraph.h"
+#include "../matrix_graph/matrixgraph.h"
+
+using IntroductionToAlgorithm::GraphAlgorithm::BitsetMatrixGraph;
+using IntroductionToAlgorithm::GraphAlgorithm::MatrixGraph;
+using IntroductionToAlgorithm::GraphAlgorithm::bitset_breadth_first_search;
+using IntroductionToAlgorithm::GraphAlgorithm::bitset_transitive_closure;
+using IntroductionToAlgorithm::GraphAlgorithm::bitset_connected_components;
+using IntroductionToAlgorithm::GraphAlgorithm::bitset_is_bipartite;
+
+namespace {
+    const unsigned BG_N= 150; /*!< 测试的图顶点数量，不是64的倍数*/
+}
+
+//!BitsetGraphTest:测试类，用于为测试提供基础数据
+/*!
+*
+* `BitsetGraphTest`是 `::testing::Test` 的子类。它主要用于为每一个`TEST_F`准备测试环境
+*/
+class BitsetGraphTest:public ::testing::Test
+{
+public:
+    typedef BitsetMatrixGraph<BG_N> GType; /*!< 模板实例化的图类型*/
+    typedef MatrixGraph<BG_N> MType; /*!< 作为对照的矩阵图类型*/
+protected:
+    void SetUp()
+    {
+        //****  同样的随机稀疏有向图（平均出度1.2，有多个连通分量）分别存入位矩阵图与矩阵图   ****
+        _graph=std::make_shared<GType>();
+        _matrix=std::make_shared<MType>(-1);
+        std::mt19937 gen(9);
+        std::uniform_int_distribution<int> vertex_dist(0,BG_N-1);
+        for(int i=0;i<180;i++)
+        {
+            int u=vertex_dist(gen),v=vertex_dist(gen);
+            if(_graph->has_edge(u,v)) continue;
+            _graph->add_edge(u,v);
+            _matrix->add_edge(std::make_tuple(u,v,1));
+        }
+    }
+    void TearDown(){}
+    //!_expect_bfs：在矩阵图上用队列做广度优先搜索，作为期望结果
+    /*!
+    * \param undirected:是否忽略边的方向
+    */
+    std::vector<int> _expect_bfs(int source,bool undirected) const
+    {
+        std::vector<int> distance(BG_N,unlimit<int>());
+        std::queue<int> queue;
+        distance[source]=0;
+        queue.push(source);
+        while(!queue.empty())
+        {
+            int u=queue.front();
+            queue.pop();
+            for(int v=0;v<int(BG_N);v++)
+                if((_matrix->has_edge(u,v)||(undirected&&_matrix->has_edge(v,u)))&&!(distance[v]<unlimit<int>()))
+                {
+                    distance[v]=distance[u]+1;
+                    queue.push(v);
+                }
+        }
+        return distance;
+    }
+    std::shared_ptr<GType> _graph;      /*!< 位矩阵图*/
+    std::shared_ptr<MType> _matrix;     /*!< 同样的边构成的矩阵图*/
+};
+//!test_bitset_graph:测试位矩阵图的基本操作
+/*!
+*
+* 边的添加、删除、查询、邻居区间、出度与矩阵图一致；无效的顶点、重复的边抛出异常；空间为矩阵图的1/32
+*/
+TEST_F(BitsetGraphTest,test_bitset_graph)
+{
+    EXPECT_EQ(_graph->edge_tuples(),_matrix->edge_tuples());
+    EXPECT_EQ(_graph->edge_num(),_matrix->edge_tuples().size());
+    for(int u=0;u<int(BG_N);u++)
+    {
+        std::vector<std::pair<int,int>> expect(_matrix->neighbors(u).begin(),_matrix->neighbors(u).end());
+        std::vector<std::pair<int,int>> actual(_graph->neighbors(u).begin(),_graph->neighbors(u).end());
+        EXPECT_EQ(actual,expect);
+        EXPECT_EQ(_graph->out_degree(u),expect.size());
+    }
+    GType graph;
+    EXPECT_TRUE(graph.neighbors(0).empty());
+    graph.add_edge(3,149);
+    graph.add_edge(std::make_tuple(3,64,7));                //权重被忽略
+    EXPECT_TRUE(graph.has_edge(3,149));
+    EXPECT_EQ(graph.weight(3,64),1);
+    EXPECT_THROW(graph.add_edge(3,64),std::invalid_argument);
+    graph.remove_edge(3,64);
+    EXPECT_FALSE(graph.has_edge(3,64));
+    EXPECT_THROW(graph.remove_edge(3,64),std::invalid_argument);
+    EXPECT_THROW(graph.weight(3,64),std::invalid_argument);
+    EXPECT_THROW(graph.has_edge(0,150),std::invalid_argument);
+    EXPECT_THROW(graph.neighbors(-1),std::invalid_argument);
+    EXPECT_EQ(graph.edge_num(),1);
+    EXPECT_GE(sizeof(MatrixGraph<1024>)/sizeof(BitsetMatrixGraph<1024>),32);
+}
+//!test_bitset_bfs:测试位矩阵图的广度优先搜索
+/*!
+*
+* 从每个源点出发的距离与逐条边的广度优先搜索相同
+*/
+TEST_F(BitsetGraphTest,test_bitset_bfs)
+{
+    for(int source=0;source<int(BG_N);source++)
+        EXPECT_EQ(bitset_breadth_first_search(_graph,source),_expect_bfs(source,false))<<source;
+    EXPECT_THROW(bitset_breadth_first_search(_graph,150),std::invalid_argument);
+    EXPECT_THROW(bitset_breadth_first_search(std::shared_ptr<GType>(),0),std::invalid_argument);
+}
+//!test_bitset_closure:测试位矩阵图的传递闭包
+/*!
+*
+* 闭包中的边(i,j)存在当且仅当从i可以到达j（包括i==j）
+*/
+TEST_F(BitsetGraphTest,test_bitset_closure)
+{
+    auto closure=bitset_transitive_closure(_graph);
+    for(int i=0;i<int(BG_N);i++)
+    {
+        auto distance=_expect_bfs(i,false);
+        for(int j=0;j<int(BG_N);j++)
+            ASSERT_EQ(closure->has_edge(i,j),distance[j]<unlimit<int>())<<i<<"->"<<j;
+    }
+}
+//!test_bitset_components:测试位矩阵图的连通分量与二分图判定
+/*!
+*
+* 两个顶点在同一个分量中当且仅当忽略方向时可以互相到达；偶数长度的环、树是二分图，奇数长度的环、自环不是
+*/
+TEST_F(BitsetGraphTest,test_bitset_components)
+{
+    auto component=bitset_connected_components(_graph);
+    int last=-1;
+    for(int u=0;u<int(BG_N);u++)
+    {
+        auto distance=_expect_bfs(u,true);
+        for(int v=0;v<int(BG_N);v++)
+            ASSERT_EQ(component[u]==component[v],distance[v]<unlimit<int>())<<u<<","<<v;
+        if(component[u]>last)       //按最小顶点编号的次序编号
+        {
+            EXPECT_EQ(component[u],++last);
+        }
+    }
+    EXPECT_THROW(bitset_connected_components(std::shared_ptr<GType>()),std::invalid_argument);
+    //********* 二分图 *********
+    auto cycle=[](int length){
+        auto graph=std::make_shared<GType>();
+        for(int i=0;i<length;i++)
+            graph->add_edge((i+1)%length,i);        //反向的边也要被视为无向边
+        return graph;
+    };
+    EXPECT_TRUE(bitset_is_bipartite(cycle(100)));
+    EXPECT_FALSE(bitset_is_bipartite(cycle(101)));
+    EXPECT_TRUE(bitset_is_bipartite(std::make_shared<GType>()));
+    auto tree=std::make_shared<GType>();
+    for(int i=1;i<int(BG_N);i++)
+        tree->add_edge(i/2,i);
+    EXPECT_TRUE(bitset_is_bipartite(tree));
+    tree->add_edge(149,149);
+    EXPECT_FALSE(bitset_is_bipartite(tree));
+    EXPECT_THROW(bitset_is_bipartite(std::shared_ptr<GType>()),std::invalid_argument);
+}
+#endif // BITSETGRAPH_TEST
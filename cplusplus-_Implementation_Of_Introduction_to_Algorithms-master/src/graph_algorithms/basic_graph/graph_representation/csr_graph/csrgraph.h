@@ -0,0 +1,412 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef CSRGRAPH
+#define CSRGRAPH
+#include<vector>
+#include<tuple>
+#include<memory>
+#include<algorithm>
+#include<stdexcept>
+#include<string>
+#include<iterator>
+#include"../neighbor_range/neighborrange.h"
+#include"../edge_range/edgerange.h"
+#include"../lazy_vertex_array/lazyvertexarray.h"
+namespace IntroductionToAlgorithm
+{
+    namespace GraphAlgorithm
+    {
+        //!CSRGraph：图的压缩稀疏行(Compressed Sparse Row)表示，算法导论22章22.1节
+        /*!
+        * `Graph<N,VType>`在编译期确定顶点数量，并且同时用`N*N`的矩阵和邻接表保存每一条边，对稀疏图来说空间为 O(N^2)。
+        * `CSRGraph`的顶点数量、边数量都在运行期确定，它主要包含以下数据：
+        *
+        * - `vertexes`：顶点集合，类型为`LazyVertexArray<VertexType>`，用法与`std::vector<std::shared_ptr<VertexType>>`相同。它的大小就是图的顶点数量
+        * - `offsets`：行偏移数组，大小为`顶点数量+1`。顶点`u`出发的边位于`[offsets[u],offsets[u+1])`区间
+        * - `targets`：边的终点数组，大小为边的数量。每一行内终点按`id`递增排列
+        * - `weights`：边的权重数组，与`targets`一一对应
+        * - `invalid_weight`：无效权重。权重为该值的边不会被加入图中
+        * - `sorted_edge_cache`：`sorted_edges()`的按权重排序的边的下标数组的缓存，默认不开启，修改边时失效
+        *
+        * 图的边一次性从边的三元素元组序列中构建（`set_edges`），构建过程采用两趟计数排序，时间复杂度为 O(V+E)，不需要对边做比较排序。
+        * 建成之后的图支持修改边的权重，但不支持逐条添加边。
+        *
+        * 它对外提供与`Graph`相同的`neighbors`/`vertex_edge_tuples`/`edge_tuples`/`has_edge`/`weight`/`inverse`接口，
+        * 因此`breadth_first_search`、`dijkstra`、`kruskal`等以`graph->vertexes.size()`作为顶点数量的算法可以直接作用于它。
+        *
+        * 空间：每个顶点占一个行偏移，每条边占一个终点`id`和一个权重。顶点指针数组与顶点对象直到第一次通过`vertexes`访问时才创建（见`LazyVertexArray`），
+        * 图自身的接口以及只通过`vertex_exists`、`neighbors`访问图的算法都不会创建它们。
+        */
+        template<typename VType> struct CSRGraph
+        {
+            typedef int VIDType;     /*!< 顶点编号的类型*/
+            typedef int EWeightType; /*!< 权重的类型*/
+            typedef std::tuple<VIDType, VIDType, EWeightType> EdgeTupleType; /*!< 边的三元素（顶点1编号，顶点2编号，权重)组成的元组*/
+            typedef VType VertexType; /*!< 顶点的类型*/
+            typedef std::pair<VIDType,EWeightType> NeighborType; /*!< 从某个顶点出发的一条边：（另一个顶点编号，权重）*/
+
+            //!NeighborIterator：同时遍历`targets`与`weights`中一行的迭代器，解引用得到`NeighborType`的值
+            class NeighborIterator
+            {
+            public:
+                typedef std::input_iterator_tag iterator_category;  /*!< 迭代器类别*/
+                typedef NeighborType value_type;                    /*!< 解引用的值类型*/
+                typedef std::ptrdiff_t difference_type;             /*!< 迭代器距离类型*/
+                typedef const NeighborType* pointer;                /*!< 指针类型*/
+                typedef NeighborType reference;                     /*!< 解引用的返回类型（按值返回）*/
+                //!显式构造函数
+                /*!
+                * \param target: 指向`targets`中的某一项
+                * \param weight: 指向`weights`中对应的一项
+                */
+                NeighborIterator(const VIDType* target,const EWeightType* weight):_target(target),_weight(weight){}
+                //!默认构造函数，构造一个不指向任何边的迭代器
+                NeighborIterator():_target(nullptr),_weight(nullptr){}
+                NeighborType operator*() const {return NeighborType(*_target,*_weight);}
+                NeighborIterator& operator++() {++_target;++_weight;return *this;}
+                NeighborIterator operator++(int) {NeighborIterator old=*this;++*this;return old;}
+                NeighborIterator operator+(difference_type n) const {return NeighborIterator(_target+n,_weight+n);}
+                bool operator==(const NeighborIterator& other) const {return _target==other._target;}
+                bool operator!=(const NeighborIterator& other) const {return _target!=other._target;}
+            private:
+                const VIDType* _target;         /*!< 当前边的终点*/
+                const EWeightType* _weight;     /*!< 当前边的权重*/
+            };
+            typedef NeighborRange<NeighborIterator> NeighborRangeType; /*!< 从某个顶点出发的边的区间类型*/
+            typedef EdgeRange<CSRGraph> EdgeRangeType; /*!< 图中所有边的区间类型*/
+            typedef SortedEdgeRange<CSRGraph> SortedEdgesType; /*!< 图中按权重排序的所有边的区间类型*/
+
+            //!显式构造函数，指定顶点数量和`invalid_weight`
+            /*!
+            * \param  vertex_num:顶点的最大容量
+            * \param  val:无效权重值
+            *
+            * 构造完成后图中没有顶点对象也没有边，需要通过`add_vertex`添加顶点，通过`set_edges`设置边
+            */
+            explicit CSRGraph(std::size_t vertex_num,EWeightType val=0) :
+                vertexes(vertex_num),next_empty_vertex(0),offsets(vertex_num+1,0),invalid_weight(val)
+            {}
+            //!显式构造函数，从边的集合构建图
+            /*!
+            * \param  vertex_num:顶点数量
+            * \param  begin:边容器的起始迭代器
+            * \param  end:边容器的终止迭代器
+            * \param  val:无效权重值
+            *
+            * `[0,vertex_num)`中的每一个`id`都对应一个存在的顶点，然后调用`set_edges`构建边。
+            * 顶点对象（`key`为`KeyType()`）直到第一次通过`vertexes`访问时才创建
+            */
+            template<typename Iterator>
+            CSRGraph(std::size_t vertex_num,const Iterator&begin,const Iterator&end,EWeightType val=0) :
+                CSRGraph(vertex_num,val)
+            {
+                vertexes=LazyVertexArray<VertexType>(vertex_num,true);
+                next_empty_vertex=vertex_num;
+                set_edges(begin,end);
+            }
+
+            //!vertex_num:返回顶点的最大容量
+            std::size_t vertex_num() const {return vertexes.size();}
+            //!edge_num:返回边的数量
+            std::size_t edge_num() const {return targets.size();}
+
+            //!add_vertex:添加一个顶点
+            /*!
+            * \param  key:顶点存放的数据
+            * \return: 顶点的id
+            *
+            * 从`next_empty_vertex`指定的位置处开始寻找可以添加顶点的地方。如果找不到可以添加顶点的地方，则抛出`std::invalid_argument`异常
+            */
+            VIDType add_vertex(const typename VertexType::KeyType& key)
+            {
+                while(next_empty_vertex<vertexes.size() && vertexes.exists(next_empty_vertex))
+                    next_empty_vertex++;
+                if(next_empty_vertex>=vertexes.size())
+                    throw std::invalid_argument("add_vertex error:CSRGraph Vertex is full, can not add vertex.");
+                VIDType v_id=next_empty_vertex;
+                vertexes.at(next_empty_vertex)=std::make_shared<VertexType>(key,v_id);
+                next_empty_vertex++;
+                return v_id;
+            }
+            //!add_vertex:添加一个顶点
+            /*!
+            * \param  key:顶点存放的数据
+            * \param id:指定该顶点的`id`
+            * \return: 顶点的id
+            *
+            * - 如果`id`不在`[0,vertex_num())`之间，则抛出异常
+            * - 如果已经存在某个顶点的`id`为指定的`id`，则抛出异常
+            */
+            VIDType add_vertex(const typename VertexType::KeyType &key,VIDType id)
+            {
+                if(!_valid_id(id))
+                    throw std::invalid_argument("add_vertex error:id must >=0 and <vertex_num.");
+                if(vertexes.exists(id))
+                    throw std::invalid_argument("add_vertex error: vertex of id has existed.");
+                vertexes.at(id)=std::make_shared<VertexType>(key,id);
+                return id;
+            }
+            //!modify_vertex:修改一个顶点的数据
+            /*!
+            * \param  newkey:新的数据
+            * \param id:指定该顶点的`id`
+            *
+            * 如果`id`无效或者该顶点不存在，则抛出异常
+            */
+            void modify_vertex(const typename VertexType::KeyType &newkey,VIDType id)
+            {
+                _check_vertex(id,"modify_vertex");
+                vertexes.at(id)->key=newkey;
+            }
+
+            //!set_edges:从边的集合构建图的所有边
+            /*!
+            * \param  begin:边容器的起始迭代器（要求为前向迭代器，因为需要遍历两次）
+            * \param  end:边容器的终止迭代器
+            *
+            * 图原有的边全部被替换。边的检查规则与`Graph::add_edge`相同：
+            *
+            * - 如果边指定的任何一个顶点`id`无效或者顶点不存在，则抛出异常
+            * - 如果边的权重是无效权重，则忽略该边
+            * - 如果存在重复的边，则抛出异常
+            *
+            * 发生异常时图保持原样。构建过程为两趟计数排序：
+            *
+            * - 第一趟按终点分桶，得到按终点排列的临时数组
+            * - 第二趟按终点递增的次序将边分发到起点所在的行，于是每一行内的终点自然有序
+            *
+            * 两趟都直接把前缀和数组当作写入位置使用，不另外分配游标数组。时间复杂度 O(V+E)，额外空间 O(V+E)
+            */
+            template<typename Iterator> void set_edges(const Iterator&begin,const Iterator&end)
+            {
+                const std::size_t n=vertexes.size();
+                std::vector<std::size_t> new_offsets(n+1,0);
+                std::vector<std::size_t> in_offsets(n+1,0);
+                //************* 第一遍：检查并计数 ****************
+                for(Iterator iter=begin;iter!=end;++iter)
+                {
+                    auto id1=std::get<0>(*iter);
+                    auto id2=std::get<1>(*iter);
+                    if(!_valid_id(id1)||!_valid_id(id2))
+                        throw std::invalid_argument("set_edges error:id must >=0 and <vertex_num.");
+                    if(!vertexes.exists(id1) || !vertexes.exists(id2))
+                        throw std::invalid_argument("set_edges error: vertex of id does not exist.");
+                    if(std::get<2>(*iter)==invalid_weight) continue;
+                    new_offsets[id1+1]++;
+                    in_offsets[id2+1]++;
+                }
+                for(std::size_t i=0;i<n;i++)
+                {
+                    new_offsets[i+1]+=new_offsets[i];
+                    in_offsets[i+1]+=in_offsets[i];
+                }
+                const std::size_t m=new_offsets[n];
+                //************* 第二遍：按终点分桶。in_offsets[v]作为桶v的写入位置，结束时变为桶v的终止位置 ****************
+                std::vector<VIDType> in_sources(m);
+                std::vector<EWeightType> in_weights(m);
+                for(Iterator iter=begin;iter!=end;++iter)
+                {
+                    if(std::get<2>(*iter)==invalid_weight) continue;
+                    auto index=in_offsets[std::get<1>(*iter)]++;
+                    in_sources[index]=std::get<0>(*iter);
+                    in_weights[index]=std::get<2>(*iter);
+                }
+                //************* 按终点递增的次序分发到起点所在的行。new_offsets[u]作为行u的写入位置 ****************
+                std::vector<VIDType> new_targets(m);
+                std::vector<EWeightType> new_weights(m);
+                for(std::size_t to=0,k=0;to<n;to++)
+                    for(;k<in_offsets[to];k++)
+                    {
+                        auto index=new_offsets[in_sources[k]]++;
+                        new_targets[index]=to;
+                        new_weights[index]=in_weights[k];
+                    }
+                for(std::size_t u=n;u>0;u--)                        //new_offsets[u]此时为行u的终止位置，右移一位恢复为起始位置
+                    new_offsets[u]=new_offsets[u-1];
+                new_offsets[0]=0;
+                //************* 检查重复边：有序行内相邻终点相同即为重复 ****************
+                for(std::size_t u=0;u<n;u++)
+                    for(std::size_t k=new_offsets[u]+1;k<new_offsets[u+1];k++)
+                        if(new_targets[k]==new_targets[k-1])
+                            throw std::invalid_argument("set_edges error,edge has already exist.");
+                offsets.swap(new_offsets);
+                targets.swap(new_targets);
+                weights.swap(new_weights);
+                sorted_edge_cache.invalidate();
+            }
+            //!adjust_edge:修改一条边的权重
+            /*!
+            * \param  id1:待修改边的第一个顶点
+            * \param  id2:待修改边的第二个顶点
+            * \param  wt:新的权重
+            *
+            * 如果边指定的任何一个顶点无效，或者指定的边不存在，则抛出异常
+            */
+            void adjust_edge(VIDType id1,VIDType id2,EWeightType wt)
+            {
+                _check_vertex(id1,"adjust_edge");
+                _check_vertex(id2,"adjust_edge");
+                auto index=_edge_index(id1,id2);
+                if(index==targets.size())
+                    throw std::invalid_argument("edge adjust error,edge does not exist.");
+                weights[index]=wt;
+                sorted_edge_cache.invalidate();
+            }
+            //!edge_tuples:返回图中所有边的三元素元组集合，这里集合采用`std::vector<std::tuple<VIDType,VIDType,EWeightType>>`
+            /*!
+            * \return  :图中所有边的三元素元组集合
+            *
+            * 边按照(起点，终点)递增的次序排列，与`Graph::edge_tuples`的次序相同
+            */
+            const std::vector<EdgeTupleType> edge_tuples() const
+            {
+                std::vector<EdgeTupleType> result;
+                result.reserve(targets.size());
+                for(std::size_t u=0;u+1<offsets.size();u++)
+                    for(std::size_t k=offsets[u];k<offsets[u+1];k++)
+                        result.push_back(std::make_tuple(VIDType(u),targets[k],weights[k]));
+                return result;
+            }
+            //!edges:返回图中所有边的区间
+            /*!
+            * \return  : 一个`EdgeRange`，按(起点，终点)递增的次序直接从`targets`、`weights`中读出每一条边。它不分配内存
+            */
+            EdgeRangeType edges() const {return EdgeRangeType(this);}
+            //!sorted_edges:返回按(权重，起点，终点)递增排序的所有边
+            /*!
+            * \return  : 一个`SortedEdgeRange`，解引用得到`EdgeTupleType`。它只持有排序后的边的下标，边从`targets`、`weights`中读出
+            *
+            * 默认每次调用都重新排序。调用`sorted_edge_cache.enable()`之后下标数组缓存在图中，直到`set_edges`、`adjust_edge`修改了边。
+            * 直接修改`targets`、`weights`不会使缓存失效。见`SortedEdgeCache`
+            */
+            SortedEdgesType sorted_edges() const {return sorted_edge_cache.get(this);}
+            //!neighbors:返回图中从指定顶点出发的边的区间
+            /*!
+            * \param id: 指定顶点`id`
+            * \return  : 一个`NeighborRange`，其元素为`std::pair<VIDType,EWeightType>`（另一个顶点编号，权重），按终点递增排列
+            *
+            * 该区间直接引用`targets`、`weights`的`[offsets[id],offsets[id+1])`部分，不分配内存。
+            * 如果`id`无效或者该顶点不存在，则抛出异常
+            */
+            NeighborRangeType neighbors(VIDType id) const
+            {
+                _check_vertex(id,"neighbors");
+                return NeighborRangeType(NeighborIterator(targets.data()+offsets[id],weights.data()+offsets[id]),
+                                         NeighborIterator(targets.data()+offsets[id+1],weights.data()+offsets[id+1]));
+            }
+            //!vertex_edge_tuples:返回图中从指定顶点出发的边的三元素元组集合
+            /*!
+            * \param id: 指定顶点`id`
+            * \return  :图中指定顶点出发的边的三元素元组集合，按终点递增排列
+            *
+            * 它是`neighbors(id)`的包装，会分配一个新的`std::vector`。如果`id`无效或者该顶点不存在，则抛出异常
+            */
+            const std::vector<EdgeTupleType> vertex_edge_tuples(VIDType id) const
+            {
+                _check_vertex(id,"vertex_edge_tuples");
+                std::vector<EdgeTupleType> result;
+                result.reserve(offsets[id+1]-offsets[id]);
+                for(const auto& pair:neighbors(id))
+                    result.push_back(std::make_tuple(id,pair.first,pair.second));
+                return result;
+            }
+            //!has_edge:返回图中指定顶点之间是否存在边
+            /*!
+            * \param id_from: 第一个顶点的`id`
+            * \param id_to: 第二个顶点的`id`
+            * \return  :第一个顶点和第二个顶点之间是否存在边
+            *
+            * 在`id_from`所在的有序行内二分查找，时间复杂度 O(lg(deg))。如果任何一个顶点无效，则抛出异常
+            */
+            bool has_edge(VIDType id_from,VIDType id_to) const
+            {
+                _check_vertex(id_from,"has_edge");
+                _check_vertex(id_to,"has_edge");
+                return _edge_index(id_from,id_to)!=targets.size();
+            }
+            //!weight:返回图中指定顶点之间的边的权重
+            /*!
+            * \param id_from: 第一个顶点的`id`
+            * \param id_to: 第二个顶点的`id`
+            * \return  :第一个顶点和第二个顶点之间的边的权重
+            *
+            * 如果任何一个顶点无效，或者两个顶点之间没有边，则抛出异常
+            */
+            EWeightType weight(VIDType id_from,VIDType id_to) const
+            {
+                _check_vertex(id_from,"weight");
+                _check_vertex(id_to,"weight");
+                auto index=_edge_index(id_from,id_to);
+                if(index==targets.size())
+                    throw std::invalid_argument("weight error: the edge does not exist.");
+                return weights[index];
+            }
+            //!inverse:返回图的一个镜像
+            /*!
+            * \return  :图的一个镜像的一个强引用
+            *
+            * 镜像图的顶点是原图顶点的深拷贝（原图尚未创建顶点对象时镜像图同样按需创建），边是原图的边的反向
+            */
+            std::shared_ptr<CSRGraph> inverse() const
+            {
+                std::shared_ptr<CSRGraph> graph=std::make_shared<CSRGraph>(vertexes.size(),invalid_weight);
+                graph->vertexes=vertexes.clone();
+                graph->next_empty_vertex=next_empty_vertex;
+                auto edges=edge_tuples();
+                for(auto&edge :edges)
+                    std::swap(std::get<0>(edge),std::get<1>(edge));
+                graph->set_edges(edges.begin(),edges.end());
+                return graph;
+            }
+
+            LazyVertexArray<VertexType> vertexes;               /*!< 顶点集合*/
+            std::size_t next_empty_vertex;                      /*!< 顶点集合中下一个为空的位置*/
+            std::vector<std::size_t> offsets;                   /*!< 行偏移数组，大小为顶点数量+1*/
+            std::vector<VIDType> targets;                       /*!< 边的终点数组*/
+            std::vector<EWeightType> weights;                   /*!< 边的权重数组*/
+            const EWeightType invalid_weight;                   /*!< 无效权重*/
+            SortedEdgeCache<VIDType> sorted_edge_cache;         /*!< 按权重排序的边的下标数组的缓存*/
+        private:
+            //!_valid_id:判断顶点`id`是否在`[0,vertex_num())`之间
+            bool _valid_id(VIDType id) const
+            {
+                return id>=0 && static_cast<std::size_t>(id)<vertexes.size();
+            }
+            //!_check_vertex:检查顶点`id`有效且顶点存在，否则抛出异常
+            void _check_vertex(VIDType id,const char* who) const
+            {
+                if(!_valid_id(id))
+                    throw std::invalid_argument(std::string(who)+" error:id must >=0 and <vertex_num.");
+                if(!vertexes.exists(id))
+                    throw std::invalid_argument(std::string(who)+" error: vertex of id does not exist.");
+            }
+            //!_edge_index:返回边(id_from,id_to)在`targets`中的下标；若边不存在则返回`targets.size()`
+            std::size_t _edge_index(VIDType id_from,VIDType id_to) const
+            {
+                auto row_begin=targets.begin()+offsets[id_from];
+                auto row_end=targets.begin()+offsets[id_from+1];
+                auto iter=std::lower_bound(row_begin,row_end,id_to);
+                if(iter==row_end||*iter!=id_to)
+                    return targets.size();
+                return iter-targets.begin();
+            }
+        };
+    }
+}
+#endif // CSRGRAPH
@@ -0,0 +1,239 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef CSRGRAPH_TEST
+#define CSRGRAPH_TEST
+#include "../../../../google_test/gtest.h"
+#include "csrgraph.h"
+#include "../graph/graph.h"
+#include "../graph_vertex/vertex.h"
+#include "../graph_vertex/bfs_vertex.h"
+#include "../graph_vertex/vertexp.h"
+#include "../graph_vertex/set_vertex.h"
+#include "../../graph_bfs/bfs.h"
+#include "../../../single_source_shortest_path/dijkstra/dijkstra.h"
+#include "../../../minimum_spanning_tree/kruskal/kruskal.h"
+
+using IntroductionToAlgorithm::GraphAlgorithm::CSRGraph;
+using IntroductionToAlgorithm::GraphAlgorithm::Graph;
+using IntroductionToAlgorithm::GraphAlgorithm::Vertex;
+using IntroductionToAlgorithm::GraphAlgorithm::BFS_Vertex;
+using IntroductionToAlgorithm::GraphAlgorithm::VertexP;
+using IntroductionToAlgorithm::GraphAlgorithm::SetVertex;
+using IntroductionToAlgorithm::GraphAlgorithm::breadth_first_search;
+using IntroductionToAlgorithm::GraphAlgorithm::dijkstra;
+using IntroductionToAlgorithm::GraphAlgorithm::kruskal;
+
+namespace {
+    const int CSR_N= 10; /*!< 测试的图顶点数量*/
+}
+
+//!CSRGraphTest:测试类，用于为测试提供基础数据
+/*!
+*
+* `CSRGraphTest`是 `::testing::Test` 的子类。它主要用于为每一个`TEST_F`准备测试环境
+*/
+class CSRGraphTest:public ::testing::Test
+{
+public:
+typedef CSRGraph<Vertex<int>> GType; /*!< 模板实例化的图类型，该图的顶点类型为`Vertex<int>`*/
+typedef GType::EdgeTupleType EdgeTupleType; /*!< 边的三元素元组类型*/
+
+protected:
+    void SetUp(){
+        //****  含顶点图和边图：10个顶点，45条边，边乱序给出   ****
+        for(int i=CSR_N-1;i>=0;i--)
+            for(int j=CSR_N-1;j>i;j--)
+                _edges.push_back(std::make_tuple(i,j,i*10+j));
+        _graph=std::make_shared<GType>(CSR_N,_edges.begin(),_edges.end(),-1); //边的无效权重为-1
+    }
+    void TearDown(){}
+
+    std::vector<EdgeTupleType> _edges;  /*!< 图的边*/
+    std::shared_ptr<GType> _graph;      /*!< 指向一个含有n结点,m条边的图*/
+};
+
+//!csr_graph_test:CSRGraph
+/*!
+*
+* 测试`add_vertex`方法成员。
+*/
+TEST_F(CSRGraphTest,test_add_vertex)
+{
+    GType graph(CSR_N,-1);
+    for(int i=0;i<CSR_N;i++)
+    {
+        EXPECT_EQ(graph.add_vertex(i*2),i);
+        EXPECT_EQ(graph.vertexes.at(i)->key,i*2);
+        EXPECT_EQ(graph.vertexes.at(i)->id,i);
+    }
+    EXPECT_THROW(graph.add_vertex(0),std::invalid_argument);
+    EXPECT_THROW(graph.add_vertex(0,0),std::invalid_argument);
+    EXPECT_THROW(graph.add_vertex(0,CSR_N),std::invalid_argument);
+    EXPECT_THROW(graph.add_vertex(0,-1),std::invalid_argument);
+    graph.modify_vertex(99,3);
+    EXPECT_EQ(graph.vertexes.at(3)->key,99);
+}
+
+//!csr_graph_test:CSRGraph
+/*!
+*
+* 测试`set_edges`方法成员。
+*/
+TEST_F(CSRGraphTest,test_set_edges)
+{
+    EXPECT_EQ(_graph->vertex_num(),CSR_N);
+    EXPECT_EQ(_graph->edge_num(),CSR_N*(CSR_N-1)/2);
+    //************ 无效权重的边被忽略  ***********
+    std::vector<EdgeTupleType> edges({std::make_tuple(0,1,-1),std::make_tuple(1,0,5)});
+    GType graph(CSR_N,edges.begin(),edges.end(),-1);
+    EXPECT_EQ(graph.edge_num(),1);
+    EXPECT_FALSE(graph.has_edge(0,1));
+    EXPECT_TRUE(graph.has_edge(1,0));
+    //************ 无效顶点、重复边抛出异常，且图保持原样  ***********
+    std::vector<EdgeTupleType> bad_id({std::make_tuple(0,CSR_N,1)});
+    EXPECT_THROW(graph.set_edges(bad_id.begin(),bad_id.end()),std::invalid_argument);
+    std::vector<EdgeTupleType> duplicated({std::make_tuple(2,3,1),std::make_tuple(2,3,2)});
+    EXPECT_THROW(graph.set_edges(duplicated.begin(),duplicated.end()),std::invalid_argument);
+    EXPECT_EQ(graph.edge_num(),1);
+    EXPECT_TRUE(graph.has_edge(1,0));
+    GType empty_graph(CSR_N,-1);
+    EXPECT_THROW(empty_graph.set_edges(edges.begin(),edges.end()),std::invalid_argument);
+}
+
+//!csr_graph_test:CSRGraph
+/*!
+*
+* 测试`edge_tuples`、`vertex_edge_tuples`方法成员：结果与`Graph`相同
+*/
+TEST_F(CSRGraphTest,test_edge_tuples)
+{
+    auto graph=std::make_shared<Graph<CSR_N,Vertex<int>>>(-1);
+    for(int i=0;i<CSR_N;i++)
+        graph->add_vertex(0);
+    graph->add_edges(_edges.begin(),_edges.end());
+    EXPECT_EQ(_graph->edge_tuples(),graph->edge_tuples());
+    for(int i=0;i<CSR_N;i++)
+        EXPECT_EQ(_graph->vertex_edge_tuples(i),graph->vertex_edge_tuples(i))<<"i:"<<i;
+    EXPECT_THROW(_graph->vertex_edge_tuples(CSR_N),std::invalid_argument);
+}
+
+//!csr_graph_test:CSRGraph
+/*!
+*
+* 测试`neighbors`方法成员：结果与`vertex_edge_tuples`一致
+*/
+TEST_F(CSRGraphTest,test_neighbors)
+{
+    EXPECT_THROW(_graph->neighbors(CSR_N),std::invalid_argument);
+    EXPECT_TRUE(_graph->neighbors(CSR_N-1).empty());
+    for(int i=0;i<CSR_N;i++)
+    {
+        std::vector<EdgeTupleType> tuples;
+        for(const auto& neighbor:_graph->neighbors(i))
+            tuples.push_back(std::make_tuple(i,neighbor.first,neighbor.second));
+        EXPECT_EQ(_graph->vertex_edge_tuples(i),tuples);
+    }
+}
+
+//!csr_graph_test:CSRGraph
+/*!
+*
+* 测试`has_edge`、`weight`、`adjust_edge`方法成员。
+*/
+TEST_F(CSRGraphTest,test_has_edge_weight)
+{
+    for(int i=0;i<CSR_N;i++)
+        for(int j=0;j<CSR_N;j++)
+        {
+            if(i<j)
+            {
+                EXPECT_TRUE(_graph->has_edge(i,j));
+                EXPECT_EQ(_graph->weight(i,j),i*10+j);
+                _graph->adjust_edge(i,j,i+j);
+                EXPECT_EQ(_graph->weight(i,j),i+j);
+            }else
+            {
+                EXPECT_FALSE(_graph->has_edge(i,j));
+                EXPECT_THROW(_graph->weight(i,j),std::invalid_argument);
+                EXPECT_THROW(_graph->adjust_edge(i,j,1),std::invalid_argument);
+            }
+        }
+    EXPECT_THROW(_graph->has_edge(-1,0),std::invalid_argument);
+    EXPECT_THROW(_graph->has_edge(0,CSR_N),std::invalid_argument);
+}
+
+//!csr_graph_test:CSRGraph
+/*!
+*
+* 测试`inverse`方法成员。
+*/
+TEST_F(CSRGraphTest,test_inverse)
+{
+    auto inverse_graph=_graph->inverse();
+    EXPECT_EQ(inverse_graph->edge_num(),_graph->edge_num());
+    for(int i=0;i<CSR_N;i++)
+    {
+        EXPECT_EQ(inverse_graph->vertexes.at(i)->id,i);
+        for(int j=0;j<CSR_N;j++)
+            EXPECT_EQ(inverse_graph->has_edge(j,i),_graph->has_edge(i,j));
+    }
+}
+
+//!csr_graph_test:CSRGraph
+/*!
+*
+* 测试`breadth_first_search`、`dijkstra`、`kruskal`直接作用于`CSRGraph`，结果与`Graph`相同
+*/
+TEST_F(CSRGraphTest,test_algorithms)
+{
+    //************ breadth_first_search ***********
+    {
+        auto csr=std::make_shared<CSRGraph<BFS_Vertex<int>>>(CSR_N,_edges.begin(),_edges.end(),-1);
+        auto graph=std::make_shared<Graph<CSR_N,BFS_Vertex<int>>>(-1);
+        for(int i=0;i<CSR_N;i++) graph->add_vertex(0);
+        graph->add_edges(_edges.begin(),_edges.end());
+        std::ostringstream os1,os2;
+        breadth_first_search(csr,0,[&os1](int id){os1<<id<<",";});
+        breadth_first_search(graph,0,[&os2](int id){os2<<id<<",";});
+        EXPECT_EQ(os1.str(),os2.str());
+        for(int i=0;i<CSR_N;i++)
+            EXPECT_EQ(csr->vertexes.at(i)->key,graph->vertexes.at(i)->key)<<"i:"<<i;
+        EXPECT_THROW(breadth_first_search(csr,CSR_N),std::invalid_argument);
+    }
+    //************ dijkstra ***********
+    {
+        auto csr=std::make_shared<CSRGraph<VertexP<int>>>(CSR_N,_edges.begin(),_edges.end(),-1);
+        dijkstra(csr,0);
+        EXPECT_EQ(csr->vertexes.at(0)->key,0);
+        for(int i=1;i<CSR_N;i++)
+        {
+            EXPECT_EQ(csr->vertexes.at(i)->key,i)<<"i:"<<i;  //最短路径为直接边 (0,i)，权重为i
+            EXPECT_EQ(csr->vertexes.at(i)->parent,csr->vertexes.at(0))<<"i:"<<i;
+        }
+    }
+    //************ kruskal ***********
+    {
+        auto csr=std::make_shared<CSRGraph<SetVertex<int>>>(CSR_N,_edges.begin(),_edges.end(),-1);
+        auto graph=std::make_shared<Graph<CSR_N,SetVertex<int>>>(-1);
+        for(int i=0;i<CSR_N;i++) graph->add_vertex(0);
+        graph->add_edges(_edges.begin(),_edges.end());
+        EXPECT_EQ(kruskal(csr),kruskal(graph));
+    }
+}
+#endif // CSRGRAPH_TEST
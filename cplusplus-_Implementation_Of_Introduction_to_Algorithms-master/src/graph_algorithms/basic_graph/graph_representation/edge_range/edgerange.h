@@ -0,0 +1,260 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef EDGERANGE
+#define EDGERANGE
+#include<vector>
+#include<tuple>
+#include<utility>
+#include<memory>
+#include<iterator>
+#include<algorithm>
+#include<cstddef>
+#include"../../../../header.h"
+namespace IntroductionToAlgorithm
+{
+    namespace GraphAlgorithm
+    {
+        //!EdgeIterator：按起点递增的次序遍历图中所有边的迭代器，解引用得到边的三元素元组（按值返回）
+        /*!
+        * 它依次遍历每个存在的顶点的`neighbors`区间，跳过不存在的顶点与没有出边的顶点。
+        * 迭代器只保存图的指针、当前起点与当前行的一对迭代器，不分配内存。
+        */
+        template<typename GraphType> class EdgeIterator
+        {
+        public:
+            typedef typename GraphType::NeighborRangeType::iterator RowIterator;   /*!< 一行（一个起点的出边）的迭代器类型*/
+            typedef std::input_iterator_tag iterator_category;                  /*!< 迭代器类别*/
+            typedef typename GraphType::EdgeTupleType value_type;               /*!< 解引用的值类型*/
+            typedef std::ptrdiff_t difference_type;                             /*!< 迭代器距离类型*/
+            typedef const value_type* pointer;                                  /*!< 指针类型*/
+            typedef value_type reference;                                       /*!< 解引用的返回类型（按值返回）*/
+            //!显式构造函数
+            /*!
+            * \param graph: 图，迭代器不拥有它
+            * \param from: 从该起点开始寻找第一条边。若为顶点数量则构造终止迭代器
+            */
+            EdgeIterator(const GraphType* graph,std::size_t from):_graph(graph),_from(from),_current(),_end()
+            {
+                _skip_empty_rows();
+            }
+            value_type operator*() const
+            {
+                const auto& neighbor=*_current;
+                return value_type(static_cast<typename GraphType::VIDType>(_from),neighbor.first,neighbor.second);
+            }
+            EdgeIterator& operator++()
+            {
+                ++_current;
+                if(!(_current!=_end))
+                {
+                    _from++;
+                    _skip_empty_rows();
+                }
+                return *this;
+            }
+            EdgeIterator operator++(int) {EdgeIterator old=*this;++*this;return old;}
+            bool operator==(const EdgeIterator& other) const
+            {
+                if(_from!=other._from) return false;
+                return _from==_graph->vertexes.size()||!(_current!=other._current);
+            }
+            bool operator!=(const EdgeIterator& other) const {return !(*this==other);}
+        private:
+            //!_skip_empty_rows：从`_from`开始寻找第一个有出边的存在的顶点，并定位到它的第一条出边
+            void _skip_empty_rows()
+            {
+                const std::size_t num=_graph->vertexes.size();
+                for(;_from<num;_from++)
+                {
+                    if(!vertex_exists(_graph->vertexes,_from)) continue;
+                    auto row=_graph->neighbors(_from);
+                    if(row.empty()) continue;
+                    _current=row.begin();
+                    _end=row.end();
+                    return;
+                }
+            }
+            const GraphType* _graph;    /*!< 图*/
+            std::size_t _from;          /*!< 当前边的起点*/
+            RowIterator _current;       /*!< 当前边在行中的位置*/
+            RowIterator _end;           /*!< 当前行的终止位置*/
+        };
+
+        //!EdgeRange：图中所有边的只读区间，按（起点，终点）递增的次序
+        /*!
+        * 它是`edge_tuples()`的惰性版本：不复制、不排序，边直接从图的存储中逐条读出。典型用法为：
+        *
+        *       for(const auto& edge:graph->edges())
+        *           visit(std::get<0>(edge),std::get<1>(edge),std::get<2>(edge));
+        *
+        * 与`NeighborRange`相同，在遍历期间修改图的边会使该区间失效。
+        */
+        template<typename GraphType> class EdgeRange
+        {
+        public:
+            typedef EdgeIterator<GraphType> iterator;   /*!< 区间的迭代器类型*/
+            //!显式构造函数
+            explicit EdgeRange(const GraphType* graph):_graph(graph){}
+            //!begin:返回区间的起始迭代器
+            iterator begin() const {return iterator(_graph,0);}
+            //!end:返回区间的终止迭代器
+            iterator end() const {return iterator(_graph,_graph->vertexes.size());}
+            //!empty:返回区间是否为空
+            bool empty() const {return !(begin()!=end());}
+        private:
+            const GraphType* _graph;    /*!< 图*/
+        };
+
+        //!SortedEdgeIterator：按（权重，起点，终点）递增的次序遍历图中所有边的迭代器，解引用得到边的三元素元组（按值返回）
+        /*!
+        * 它遍历排序后的下标数组。每个下标为（起点，该边在起点的`neighbors`区间中的序号），解引用时从图的存储中读出终点与权重。
+        */
+        template<typename GraphType> class SortedEdgeIterator
+        {
+        public:
+            typedef std::pair<typename GraphType::VIDType,typename GraphType::VIDType> IndexType;   /*!< 边的下标类型：（起点，序号）*/
+            typedef typename std::vector<IndexType>::const_iterator IndexIterator;                  /*!< 下标数组的迭代器类型*/
+            typedef std::input_iterator_tag iterator_category;                  /*!< 迭代器类别*/
+            typedef typename GraphType::EdgeTupleType value_type;               /*!< 解引用的值类型*/
+            typedef std::ptrdiff_t difference_type;                             /*!< 迭代器距离类型*/
+            typedef const value_type* pointer;                                  /*!< 指针类型*/
+            typedef value_type reference;                                       /*!< 解引用的返回类型（按值返回）*/
+            //!显式构造函数
+            /*!
+            * \param graph: 图，迭代器不拥有它
+            * \param current: 当前边在下标数组中的位置
+            */
+            SortedEdgeIterator(const GraphType* graph,IndexIterator current):_graph(graph),_current(current){}
+            value_type operator*() const
+            {
+                const auto neighbor=*(_graph->neighbors(_current->first).begin()+_current->second);
+                return value_type(_current->first,neighbor.first,neighbor.second);
+            }
+            SortedEdgeIterator& operator++() {++_current;return *this;}
+            SortedEdgeIterator operator++(int) {SortedEdgeIterator old=*this;++*this;return old;}
+            bool operator==(const SortedEdgeIterator& other) const {return _current==other._current;}
+            bool operator!=(const SortedEdgeIterator& other) const {return _current!=other._current;}
+        private:
+            const GraphType* _graph;    /*!< 图*/
+            IndexIterator _current;     /*!< 当前边的下标*/
+        };
+
+        //!SortedEdgeRange：图中所有边的只读区间，按（权重，起点，终点）递增的次序
+        /*!
+        * 它是`sorted_edges()`的返回值，只持有图的指针与排序后的下标数组，不复制边。典型用法为：
+        *
+        *       for(const auto& edge:graph->sorted_edges())
+        *           visit(std::get<0>(edge),std::get<1>(edge),std::get<2>(edge));
+        *
+        * 与`EdgeRange`相同，修改图的边会使该区间失效。
+        */
+        template<typename GraphType> class SortedEdgeRange
+        {
+        public:
+            typedef SortedEdgeIterator<GraphType> iterator;                             /*!< 区间的迭代器类型*/
+            typedef typename iterator::IndexType IndexType;                             /*!< 边的下标类型*/
+            typedef std::shared_ptr<const std::vector<IndexType>> IndexPointer;         /*!< 下标数组的指针类型*/
+            //!显式构造函数
+            /*!
+            * \param graph: 图，区间不拥有它
+            * \param index: 排序后的下标数组
+            */
+            SortedEdgeRange(const GraphType* graph,IndexPointer index):_graph(graph),_index(index){}
+            //!begin:返回区间的起始迭代器
+            iterator begin() const {return iterator(_graph,_index->begin());}
+            //!end:返回区间的终止迭代器
+            iterator end() const {return iterator(_graph,_index->end());}
+            //!empty:返回区间是否为空
+            bool empty() const {return _index->empty();}
+            //!size:返回边的数量
+            std::size_t size() const {return _index->size();}
+            //!index:返回排序后的下标数组
+            const IndexPointer& index() const {return _index;}
+        private:
+            const GraphType* _graph;    /*!< 图*/
+            IndexPointer _index;        /*!< 排序后的下标数组*/
+        };
+
+        //!make_sorted_edge_index：构建图中所有边按（权重，起点，终点）递增排列的下标数组
+        /*!
+        * \param graph: 图
+        * \return: 下标数组，每一项为（起点，该边在起点的`neighbors`区间中的序号）
+        *
+        * 每一行内的边按终点递增排列，因此序号的次序就是终点的次序，对（权重，起点，序号）排序即得到（权重，起点，终点）的次序。
+        * 排序期间临时占用每条边一个三元素元组的空间，返回的下标数组每条边只占两个`VIDType`
+        */
+        template<typename GraphType>
+        std::shared_ptr<const std::vector<std::pair<typename GraphType::VIDType,typename GraphType::VIDType>>> make_sorted_edge_index(const GraphType& graph)
+        {
+            typedef typename GraphType::VIDType VIDType;
+            typedef typename GraphType::EWeightType EWeightType;
+            std::vector<std::tuple<EWeightType,VIDType,VIDType>> keyed;
+            for(std::size_t u=0;u<graph.vertexes.size();u++)
+            {
+                if(!vertex_exists(graph.vertexes,u)) continue;
+                VIDType slot=0;
+                for(const auto& neighbor:graph.neighbors(static_cast<VIDType>(u)))
+                    keyed.push_back(std::make_tuple(neighbor.second,static_cast<VIDType>(u),slot++));
+            }
+            std::sort(keyed.begin(),keyed.end());
+            auto index=std::make_shared<std::vector<std::pair<VIDType,VIDType>>>();
+            index->reserve(keyed.size());
+            for(const auto& key:keyed)
+                index->push_back(std::make_pair(std::get<1>(key),std::get<2>(key)));
+            return index;
+        }
+
+        //!SortedEdgeCache：图中按权重排序的边的下标数组的缓存
+        /*!
+        * 图将它作为成员。默认不缓存：每次`sorted_edges()`都重新排序，图中不保留任何额外数据。
+        * 调用`enable()`之后，第一次`sorted_edges()`构建的下标数组保存在图中，之后直接复用，直到图的边被修改（添加边、设置边、修改权重）时由图调用`invalidate`丢弃。
+        * 需要在同一个图上多次按权重遍历边（如多次运行`kruskal`）时才值得开启，代价是每条边两个`VIDType`的空间。
+        *
+        * 第一次构建不是线程安全的：开启缓存后，多个线程同时对一个没有缓存的图调用`sorted_edges()`是数据竞争。
+        */
+        template<typename VIDType> class SortedEdgeCache
+        {
+        public:
+            typedef std::shared_ptr<const std::vector<std::pair<VIDType,VIDType>>> IndexPointer; /*!< 下标数组的指针类型*/
+            SortedEdgeCache():_enabled(false){}
+            //!get:返回图中按权重排序的边的区间。没有缓存时构建下标数组，开启了缓存则保存它
+            template<typename GraphType> SortedEdgeRange<GraphType> get(const GraphType* graph) const
+            {
+                if(_index) return SortedEdgeRange<GraphType>(graph,_index);
+                auto index=make_sorted_edge_index(*graph);
+                if(_enabled) _index=index;
+                return SortedEdgeRange<GraphType>(graph,index);
+            }
+            //!enable:开启缓存
+            void enable() {_enabled=true;}
+            //!disable:关闭缓存并丢弃已有的下标数组
+            void disable() {_enabled=false;_index.reset();}
+            //!enabled:返回是否开启了缓存
+            bool enabled() const {return _enabled;}
+            //!invalidate:丢弃缓存
+            void invalidate() {_index.reset();}
+            //!cached:返回是否有缓存
+            bool cached() const {return static_cast<bool>(_index);}
+        private:
+            bool _enabled;                  /*!< 是否开启缓存*/
+            mutable IndexPointer _index;    /*!< 缓存的下标数组，为空表示没有缓存*/
+        };
+    }
+}
+#endif // EDGERANGE
@@ -0,0 +1,127 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef EDGERANGE_TEST
+#define EDGERANGE_TEST
+#include <algorithm>
+#include "../../../../google_test/gtest.h"
+#include "edgerange.h"
+#include "../graph/graph.h"
+#include "../csr_graph/csrgraph.h"
+#include "../graph_vertex/vertex.h"
+
+using IntroductionToAlgorithm::GraphAlgorithm::Graph;
+using IntroductionToAlgorithm::GraphAlgorithm::CSRGraph;
+using IntroductionToAlgorithm::GraphAlgorithm::Vertex;
+
+namespace {
+    const int ER_N= 10; /*!< 测试的图顶点数量*/
+}
+
+//!EdgeRangeTest:测试类，用于为测试提供基础数据
+/*!
+*
+* `EdgeRangeTest`是 `::testing::Test` 的子类。它主要用于为每一个`TEST_F`准备测试环境
+*/
+class EdgeRangeTest:public ::testing::Test
+{
+public:
+    typedef Graph<ER_N,Vertex<int>> GType; /*!< 模板实例化的图类型*/
+    typedef CSRGraph<Vertex<int>> CType; /*!< 模板实例化的压缩稀疏行图类型*/
+    typedef GType::EdgeTupleType EdgeTupleType; /*!< 边的三元素元组类型*/
+protected:
+    void SetUp()
+    {
+        //****  顶点1、4不存在，顶点3、9没有出边；边乱序给出，权重有重复   ****
+        _graph=std::make_shared<GType>(-1);
+        for(int i=0;i<ER_N;i++)
+            if(i!=1&&i!=4) _graph->add_vertex(i,i);
+        _edges={std::make_tuple(8,2,5),std::make_tuple(0,9,3),std::make_tuple(2,3,5),std::make_tuple(0,2,7),
+                std::make_tuple(7,0,1),std::make_tuple(5,6,3),std::make_tuple(6,5,2),std::make_tuple(2,0,5)};
+        _graph->add_edges(_edges.begin(),_edges.end());
+        _csr_graph=std::make_shared<CType>(ER_N,_edges.begin(),_edges.end(),-1);
+        std::sort(_edges.begin(),_edges.end());
+    }
+    void TearDown(){}
+    std::vector<EdgeTupleType> _edges;      /*!< 按(起点，终点)排序的边*/
+    std::shared_ptr<GType> _graph;          /*!< 含有空顶点的图*/
+    std::shared_ptr<CType> _csr_graph;      /*!< 同样的边构成的压缩稀疏行图*/
+};
+//!test_edges:测试边的区间
+/*!
+*
+* `edges()`按(起点，终点)递增的次序给出所有边，跳过不存在的顶点与没有出边的顶点；空的图的区间为空
+*/
+TEST_F(EdgeRangeTest,test_edges)
+{
+    EXPECT_EQ(std::vector<EdgeTupleType>(_graph->edges().begin(),_graph->edges().end()),_edges);
+    EXPECT_EQ(std::vector<EdgeTupleType>(_csr_graph->edges().begin(),_csr_graph->edges().end()),_edges);
+    EXPECT_EQ(_graph->edge_tuples(),_edges);
+    std::size_t count=0;
+    for(const auto& edge:_csr_graph->edges())
+        EXPECT_EQ(edge,_edges[count++]);
+    EXPECT_EQ(count,_edges.size());
+    EXPECT_FALSE(_graph->edges().empty());
+    auto empty=std::make_shared<GType>(-1);
+    EXPECT_TRUE(empty->edges().empty());
+    for(int i=0;i<ER_N;i++) empty->add_vertex(i);
+    EXPECT_TRUE(empty->edges().empty());
+    EXPECT_TRUE(CType(0).edges().empty());
+}
+//!test_sorted_edges:测试按权重排序的边
+/*!
+*
+* `sorted_edges()`按(权重，起点，终点)递增排列；默认不缓存；开启缓存后重复调用复用同一个下标数组，修改边之后缓存失效
+*/
+TEST_F(EdgeRangeTest,test_sorted_edges)
+{
+    auto expect=_edges;
+    std::sort(expect.begin(),expect.end(),[](const EdgeTupleType& e1,const EdgeTupleType& e2){
+        return std::make_tuple(std::get<2>(e1),std::get<0>(e1),std::get<1>(e1))<std::make_tuple(std::get<2>(e2),std::get<0>(e2),std::get<1>(e2));});
+    auto to_vector=[](const GType::SortedEdgesType& range){return std::vector<EdgeTupleType>(range.begin(),range.end());};
+    //************ Graph ************
+    auto sorted=_graph->sorted_edges();
+    EXPECT_EQ(sorted.size(),expect.size());
+    EXPECT_EQ(to_vector(sorted),expect);
+    EXPECT_FALSE(_graph->sorted_edge_cache.cached());      //默认不缓存
+    EXPECT_NE(_graph->sorted_edges().index(),sorted.index());
+    _graph->sorted_edge_cache.enable();
+    sorted=_graph->sorted_edges();
+    EXPECT_TRUE(_graph->sorted_edge_cache.cached());
+    EXPECT_EQ(_graph->sorted_edges().index(),sorted.index());
+    _graph->adjust_edge(7,0,10);
+    EXPECT_FALSE(_graph->sorted_edge_cache.cached());
+    EXPECT_EQ(to_vector(_graph->sorted_edges()).back(),std::make_tuple(7,0,10));
+    _graph->add_edge(std::make_tuple(3,9,0));
+    EXPECT_EQ(*_graph->sorted_edges().begin(),std::make_tuple(3,9,0));
+    _graph->sorted_edge_cache.disable();
+    EXPECT_FALSE(_graph->sorted_edge_cache.cached());
+    EXPECT_TRUE(std::make_shared<GType>(-1)->sorted_edges().empty());
+    //************ CSRGraph ************
+    auto csr_to_vector=[](const CType::SortedEdgesType& range){return std::vector<EdgeTupleType>(range.begin(),range.end());};
+    EXPECT_EQ(csr_to_vector(_csr_graph->sorted_edges()),expect);
+    _csr_graph->sorted_edge_cache.enable();
+    auto csr_sorted=_csr_graph->sorted_edges();
+    EXPECT_EQ(_csr_graph->sorted_edges().index(),csr_sorted.index());
+    _csr_graph->adjust_edge(0,9,20);
+    EXPECT_EQ(csr_to_vector(_csr_graph->sorted_edges()).back(),std::make_tuple(0,9,20));
+    std::vector<EdgeTupleType> edges={std::make_tuple(1,2,1)};
+    _csr_graph->set_edges(edges.begin(),edges.end());
+    EXPECT_EQ(csr_to_vector(_csr_graph->sorted_edges()),edges);
+}
+#endif // EDGERANGE_TEST
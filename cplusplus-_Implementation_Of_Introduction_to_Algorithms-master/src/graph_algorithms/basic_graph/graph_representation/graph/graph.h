@@ -20,6 +20,7 @@
 #define GRAPH
 #include "../matrix_graph/matrixgraph.h"
 #include "../adjlist_graph/adjlistgraph.h"
+#include "../edge_range/edgerange.h"
 #include <array>
 #include <memory>
 #include <assert.h>
@@ -35,6 +36,7 @@ namespace IntroductionToAlgorithm
         * - `adjList`：图的邻接表表示，类型为`ADJListGraph<N>`
         * - `vertexes`：顶点集合，类型为`std::array<std::shared_ptr<VertexType>,N>`。它是一个`std::array`，其元素类型为指向顶点的强引用
         * - `next_empty_vertex`：顶点集合中，下一个为空的位置，类型为`std::size_t`。它用于添加顶点。
+        * - `sorted_edge_cache`：`sorted_edges()`的按权重排序的边的下标数组的缓存，默认不开启，`add_edge`、`adjust_edge`时失效
 
         * 图支持插入、修改顶点操作，插入、修改边操作（由图的矩阵以及图的邻接表来代理），以及返回边、返回权重（由图的矩阵以及图的邻接表来代理）。
         *
@@ -45,6 +47,9 @@ namespace IntroductionToAlgorithm
             typedef int EWeightType; /*!< 权重的类型*/
             typedef std::tuple<VIDType, VIDType, EWeightType> EdgeTupleType; /*!< 边的三元素（顶点1编号，顶点2编号，权重)组成的元组*/
             typedef VType VertexType; /*!< 顶点的类型*/
+            typedef typename ADJListGraph<N>::NeighborRangeType NeighborRangeType; /*!< 从某个顶点出发的边的区间类型*/
+            typedef EdgeRange<Graph> EdgeRangeType; /*!< 图中所有边的区间类型*/
+            typedef SortedEdgeRange<Graph> SortedEdgesType; /*!< 图中按权重排序的所有边的区间类型*/
             static const unsigned NUM = N; /*!< 顶点的最大容量*/
 
             //!显式构造函数，为图的矩阵指定`invalid_weight`
@@ -138,6 +143,7 @@ namespace IntroductionToAlgorithm
                 if(std::get<2>(edge_tuple)==matrix.invalid_weight) return;
                 matrix.add_edge(edge_tuple);
                 adjList.add_edge(edge_tuple);
+                sorted_edge_cache.invalidate();
             }
             //!add_edges:添加一组边
             /*!
@@ -179,37 +185,57 @@ namespace IntroductionToAlgorithm
                     throw std::invalid_argument("adjust edge error: vertex of id does not exist.");
                 matrix.adjust_edge(id1,id2,wt);
                 adjList.adjust_edge(id1,id2,wt);
+                sorted_edge_cache.invalidate();
             }
             //!edge_tuples:返回图中所有边的三元素元组集合，这里集合采用`std::vector<std::tuple<VIDType,VIDType,EWeightType>>`
             /*!
             * \return  :图中所有边的三元素元组集合
             *
-            * 要求图的矩阵和图的邻接表都返回同样的结果
+            * 边按照(起点，终点)递增的次序排列。它由`edges()`物化而来，不需要排序，也不再扫描图的矩阵。
+            * 只需要遍历边时应该使用`edges()`
             */
             const std::vector<EdgeTupleType> edge_tuples() const
             {
-                auto edges1=matrix.edge_tuples();
-                auto edges2=adjList.edge_tuples();
-                auto compare=[](const EdgeTupleType& e1,const EdgeTupleType&e2)->bool {
-                    if(
-                            (std::get<0>(e1) < std::get<0>(e2))||
-                            ( (std::get<0>(e1) == std::get<0>(e2))&&(std::get<1>(e1) < std::get<1>(e2)) ) ||
-                            ( (std::get<0>(e1) == std::get<0>(e2))&&(std::get<1>(e1) == std::get<1>(e2))&&(std::get<2>(e1) < std::get<2>(e2)) )
-                        ) return true;
-                   return false;
-                };
-                std::sort(edges1.begin(),edges1.end(),compare);
-                std::sort(edges2.begin(),edges2.end(),compare);
-                assert(edges1==edges2);
-                return edges1;
+                return std::vector<EdgeTupleType>(edges().begin(),edges().end());
             }
+            //!edges:返回图中所有边的区间
+            /*!
+            * \return  : 一个`EdgeRange`，按(起点，终点)递增的次序直接从邻接表中读出每一条边，解引用得到`EdgeTupleType`。它不分配内存
+            */
+            EdgeRangeType edges() const {return EdgeRangeType(this);}
+            //!sorted_edges:返回按(权重，起点，终点)递增排序的所有边
+            /*!
+            * \return  : 一个`SortedEdgeRange`，解引用得到`EdgeTupleType`。它只持有排序后的边的下标，边从邻接表中读出
+            *
+            * 默认每次调用都重新排序。调用`sorted_edge_cache.enable()`之后下标数组缓存在图中，直到`add_edge`、`adjust_edge`修改了边。
+            * 直接修改`matrix`、`adjList`不会使缓存失效。见`SortedEdgeCache`
+            */
+            SortedEdgesType sorted_edges() const {return sorted_edge_cache.get(this);}
 
+            //!neighbors:返回图中从指定顶点出发的边的区间
+            /*!
+            * \param id: 指定顶点`id`
+            * \return  : 一个`NeighborRange`，其元素为`std::pair<VIDType,EWeightType>`（另一个顶点编号，权重），按照另一个顶点编号从小到大排列
+            *
+            * 该区间来自图的邻接表，不分配内存。
+            *
+            * - 如果指定的顶点`id`不在`[0,N)`之间，则无效
+            * - 如果不存在某个顶点与指定的顶点`id`相同，则无效
+            */
+            NeighborRangeType neighbors(VIDType id) const
+            {
+                if(id<0||static_cast<unsigned>(id)>=N)
+                    throw std::invalid_argument("neighbors error:id must >=0 and <N.");
+                if(!vertexes.at(id))
+                    throw std::invalid_argument("neighbors error: vertex of id does not exist.");
+                return adjList.neighbors(id);
+            }
             //!vertex_edge_tuples:返回图中从指定顶点出发的边的三元素元组集合，这里集合采用`std::vector<std::tuple<VIDType,VIDType,EWeightType>>`
             /*!
             * \param id: 指定顶点`id`
             * \return  :图中指定顶点出发的边的三元素元组集合
             *
-            * 要求图的矩阵和图的邻接表都返回同样的结果
+            * 它是`neighbors(id)`的包装，会分配一个新的`std::vector`。遍历图时应该使用`neighbors(id)`。要求图的矩阵和图的邻接表都返回同样的结果
             *
             * - 如果指定的顶点`id`不在`[0,N)`之间，则无效
             * - 如果不存在某个顶点与指定的顶点`id`相同，则无效
@@ -222,20 +248,11 @@ namespace IntroductionToAlgorithm
                 if(!vertexes.at(id))
                     throw std::invalid_argument("vertex_edge_tuples error: vertex of id does not exist.");
 
-                auto edges1=matrix.vertex_edge_tuples(id);
-                auto edges2=adjList.vertex_edge_tuples(id);
-                auto compare=[](const EdgeTupleType& e1,const EdgeTupleType&e2)->bool {
-                if(
-                    (std::get<0>(e1) < std::get<0>(e2))||
-                    ( (std::get<0>(e1) == std::get<0>(e2))&&(std::get<1>(e1) < std::get<1>(e2)) ) ||
-                    ( (std::get<0>(e1) == std::get<0>(e2))&&(std::get<1>(e1) == std::get<1>(e2))&&(std::get<2>(e1) < std::get<2>(e2)) )
-                    ) return true;
-                   return false;
-                };
-                std::sort(edges1.begin(),edges1.end(),compare);
-                std::sort(edges2.begin(),edges2.end(),compare);
-                assert(edges1==edges2);
-                return edges1;
+                std::vector<EdgeTupleType> result;
+                for(const auto& pair:neighbors(id))
+                    result.push_back(std::make_tuple(id,pair.first,pair.second));
+                assert(result==matrix.vertex_edge_tuples(id));      //邻接表与矩阵的每一行都按另一个顶点编号有序
+                return result;
             }
 
             //!has_edge:返回图中指定顶点之间是否存在边
@@ -318,6 +335,7 @@ namespace IntroductionToAlgorithm
             std::size_t next_empty_vertex;
             MatrixGraph<N> matrix;
             ADJListGraph<N> adjList;
+            SortedEdgeCache<VIDType> sorted_edge_cache;         /*!< 按权重排序的边的下标数组的缓存*/
         };
     }
 }
@@ -229,7 +229,7 @@ TEST_F(GraphTest,test_adjust_edge)
 //!graph_test:Graph
 /*!
 *
-* 测试`edge_tuples`方法成员。
+* 测试`edge_tuples`方法成员：结果按(起点，终点)有序，且与图的矩阵给出的边相同
 */
 TEST_F(GraphTest,test_edge_tuples)
 {
@@ -240,6 +240,7 @@ TEST_F(GraphTest,test_edge_tuples)
         for(int j=i+1;j<G_N;j++)
             real_tuples.push_back(std::make_tuple(i,j,i*10+j));
     EXPECT_EQ(_n_vertexes_m_edges_graph->edge_tuples(),real_tuples);
+    EXPECT_EQ(_n_vertexes_m_edges_graph->matrix.edge_tuples(),real_tuples);
 }
 
 //!graph_test:Graph
@@ -322,5 +323,25 @@ TEST_F(GraphTest,test_inverse)
         EXPECT_TRUE(founded);
     }
 }
+//!graph_test:Graph
+/*!
+*
+* 测试`neighbors`方法成员：结果与`vertex_edge_tuples`一致
+*/
+TEST_F(GraphTest,test_neighbors)
+{
+    for(int i=0;i<G_N;i++)
+    {
+        EXPECT_THROW(_empty_graph->neighbors(i),std::invalid_argument);//空图：没有顶点没有边
+        EXPECT_TRUE(_n_vertexes_graph->neighbors(i).empty());//无边有顶点的图：没有边
+    }
+    for(int i=0;i<G_N;i++)
+    {
+        std::vector<typename GType::EdgeTupleType> tuples;
+        for(const auto& neighbor:_n_vertexes_m_edges_graph->neighbors(i))
+            tuples.push_back(std::make_tuple(i,neighbor.first,neighbor.second));
+        EXPECT_EQ(_n_vertexes_m_edges_graph->vertex_edge_tuples(i),tuples);
+    }
+}
 #endif // GRAPH_TEST
 
@@ -0,0 +1,508 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef GRAPHSNAPSHOT
+#define GRAPHSNAPSHOT
+#include<vector>
+#include<memory>
+#include<string>
+#include<fstream>
+#include<istream>
+#include<algorithm>
+#include<stdexcept>
+#include<iterator>
+#include<cstdint>
+#include<cstring>
+#include<sys/mman.h>
+#include<sys/stat.h>
+#include<fcntl.h>
+#include<unistd.h>
+#include"../neighbor_range/neighborrange.h"
+#include"../../../../header.h"
+namespace IntroductionToAlgorithm
+{
+    namespace GraphAlgorithm
+    {
+        const char GRAPH_SNAPSHOT_MAGIC[8]={'I','T','A','G','R','A','P','H'};  /*!< 快照文件的魔数*/
+        const std::uint32_t GRAPH_SNAPSHOT_VERSION=1;                           /*!< 快照格式的版本号*/
+        const std::uint32_t GRAPH_SNAPSHOT_ENDIAN_TAG=0x01020304;               /*!< 字节序标记，用于拒绝另一种字节序的机器写出的快照*/
+
+        //!GraphSnapshotHeader：图快照文件的头部
+        /*!
+        * 快照文件的布局为（均为写出快照的机器的本机字节序）：
+        *
+        * - 头部：48字节，即本结构体
+        * - `offsets`：`vertex_num+1`个`std::uint64_t`，顶点`u`出发的边位于`[offsets[u],offsets[u+1])`区间
+        * - `targets`：`edge_num`个`int32`，边的终点，每一行内按`id`递增排列
+        * - `weights`：`edge_num`个`int32`，与`targets`一一对应
+        *
+        * 头部长度为8的倍数，因此`mmap`之后三个数组都是自然对齐的，可以直接当作数组访问。
+        * `checksum`为三个数组所有字节的 64位 FNV-1a 散列值。
+        */
+        struct GraphSnapshotHeader
+        {
+            char magic[8];              /*!< 魔数，必须为`GRAPH_SNAPSHOT_MAGIC`*/
+            std::uint32_t version;      /*!< 格式版本号*/
+            std::uint32_t endian_tag;   /*!< 字节序标记，必须为`GRAPH_SNAPSHOT_ENDIAN_TAG`*/
+            std::uint32_t vid_bytes;    /*!< 顶点编号的字节数*/
+            std::uint32_t weight_bytes; /*!< 权重的字节数*/
+            std::uint64_t vertex_num;   /*!< 顶点数量*/
+            std::uint64_t edge_num;     /*!< 边的数量*/
+            std::uint64_t checksum;     /*!< 数据部分的校验和*/
+        };
+        static_assert(sizeof(GraphSnapshotHeader)==48,"GraphSnapshotHeader must be 48 bytes");
+
+        //!_snapshot_checksum：以`seed`为初值，继续计算一段内存的 64位 FNV-1a 散列值
+        /*!
+        * \param seed:初值。第一段数据应以`14695981039346656037`为初值
+        * \param data:数据的起始地址
+        * \param bytes:数据的字节数
+        * \return: 新的散列值
+        */
+        inline std::uint64_t _snapshot_checksum(std::uint64_t seed,const void* data,std::size_t bytes)
+        {
+            const unsigned char* p=static_cast<const unsigned char*>(data);
+            for(std::size_t i=0;i<bytes;i++)
+            {
+                seed^=p[i];
+                seed*=1099511628211ULL;
+            }
+            return seed;
+        }
+
+        //!write_graph_snapshot：将CSR形式的图写入快照文件
+        /*!
+        * \param path:快照文件路径。若文件已存在则覆盖
+        * \param vertex_num:顶点数量
+        * \param offsets:行偏移数组，大小为`vertex_num+1`
+        * \param targets:边的终点数组，大小为`offsets[vertex_num]`
+        * \param weights:边的权重数组，大小为`offsets[vertex_num]`
+        * \return: void
+        *
+        * 在写入之前检查`offsets[0]==0`、`offsets`单调不减、所有终点位于`[0,vertex_num)`，否则抛出异常。
+        * 先写入校验和为0的头部，边写数据边计算校验和，最后回写头部。文件无法写入时抛出异常。
+        *
+        * - 时间复杂度 O(V+E)
+        */
+        inline void write_graph_snapshot(const std::string& path,std::size_t vertex_num,const std::size_t* offsets,const int* targets,const int* weights)
+        {
+            if(offsets[0]!=0)
+                throw std::invalid_argument("write_graph_snapshot error: offsets[0] must be 0!");
+            for(std::size_t u=0;u<vertex_num;u++)
+                if(offsets[u+1]<offsets[u])
+                    throw std::invalid_argument("write_graph_snapshot error: offsets must be non-decreasing!");
+            const std::size_t edge_num=offsets[vertex_num];
+            for(std::size_t k=0;k<edge_num;k++)
+                if(targets[k]<0||static_cast<std::size_t>(targets[k])>=vertex_num)
+                    throw std::invalid_argument("write_graph_snapshot error: target must >=0 and <vertex_num!");
+
+            std::ofstream out(path,std::ios::binary|std::ios::trunc);
+            if(!out)
+                throw std::invalid_argument("write_graph_snapshot error: can not open "+path);
+            GraphSnapshotHeader header;
+            std::memcpy(header.magic,GRAPH_SNAPSHOT_MAGIC,sizeof(header.magic));
+            header.version=GRAPH_SNAPSHOT_VERSION;
+            header.endian_tag=GRAPH_SNAPSHOT_ENDIAN_TAG;
+            header.vid_bytes=sizeof(int);
+            header.weight_bytes=sizeof(int);
+            header.vertex_num=vertex_num;
+            header.edge_num=edge_num;
+            header.checksum=0;
+            out.write(reinterpret_cast<const char*>(&header),sizeof(header));
+
+            std::uint64_t checksum=14695981039346656037ULL;
+            std::vector<std::uint64_t> buffer;                   //std::size_t 不一定是 64位，分块转换后写出
+            for(std::size_t begin=0;begin<=vertex_num;begin+=4096)
+            {
+                std::size_t end=std::min(begin+4096,vertex_num+1);
+                buffer.assign(offsets+begin,offsets+end);
+                checksum=_snapshot_checksum(checksum,buffer.data(),buffer.size()*sizeof(std::uint64_t));
+                out.write(reinterpret_cast<const char*>(buffer.data()),buffer.size()*sizeof(std::uint64_t));
+            }
+            checksum=_snapshot_checksum(checksum,targets,edge_num*sizeof(int));
+            out.write(reinterpret_cast<const char*>(targets),edge_num*sizeof(int));
+            checksum=_snapshot_checksum(checksum,weights,edge_num*sizeof(int));
+            out.write(reinterpret_cast<const char*>(weights),edge_num*sizeof(int));
+
+            header.checksum=checksum;
+            out.seekp(0);
+            out.write(reinterpret_cast<const char*>(&header),sizeof(header));
+            out.flush();
+            if(!out)
+                throw std::invalid_argument("write_graph_snapshot error: write "+path+" failed!");
+        }
+        //!write_graph_snapshot：将图写入快照文件
+        /*!
+        * \param path:快照文件路径。若文件已存在则覆盖
+        * \param graph:指向图的强指针，必须非空。若为空则抛出异常
+        * \return: void
+        *
+        * 它通过`graph->neighbors(u)`获取边，因此适用于`Graph`、`CSRGraph`等图类型。不存在的顶点没有出边。
+        *
+        * - 时间复杂度 O(V+E)
+        */
+        template<typename GraphType>
+        void write_graph_snapshot(const std::string& path,std::shared_ptr<GraphType> graph)
+        {
+            if(!graph)
+                throw std::invalid_argument("write_graph_snapshot error: graph must not be nullptr!");
+            const std::size_t num=graph->vertexes.size();
+            std::vector<std::size_t> offsets(num+1,0);
+            std::vector<int> targets;
+            std::vector<int> weights;
+            for(std::size_t u=0;u<num;u++)
+            {
+                if(vertex_exists(graph->vertexes,u))
+                    for(const auto& neighbor:graph->neighbors(u))
+                    {
+                        targets.push_back(neighbor.first);
+                        weights.push_back(neighbor.second);
+                    }
+                offsets[u+1]=targets.size();
+            }
+            write_graph_snapshot(path,num,offsets.data(),targets.data(),weights.data());
+        }
+
+        //!convert_edge_list_to_snapshot：将边列表文本转换为快照文件
+        /*!
+        * \param in:文本输入流
+        * \param path:快照文件路径
+        * \return: void
+        *
+        * 文本格式与`GraphIO::read_file`相同：首先是顶点数量`N`和边数量`M`，然后是`M`对顶点编号`u v`。
+        * 与`GraphIO`一致，每一对顶点表示一条无向、权重为1的边，因此快照中同时包含(u,v)与(v,u)，重复的边只保留一条。
+        * 文本格式错误或者顶点编号无效时抛出异常。
+        *
+        * 边按起点做计数排序，然后对每一行排序去重。
+        *
+        * - 时间复杂度 O(V+ElgE)
+        */
+        inline void convert_edge_list_to_snapshot(std::istream& in,const std::string& path)
+        {
+            long long n=0,m=0;
+            if(!(in>>n>>m)||n<0||m<0)
+                throw std::invalid_argument("convert_edge_list_to_snapshot error: bad header, expect `N M`!");
+            std::vector<std::pair<int,int>> edges;
+            edges.reserve(m);
+            for(long long i=0;i<m;i++)
+            {
+                long long u,v;
+                if(!(in>>u>>v))
+                    throw std::invalid_argument("convert_edge_list_to_snapshot error: expect M edges!");
+                if(u<0||u>=n||v<0||v>=n)
+                    throw std::invalid_argument("convert_edge_list_to_snapshot error: id must >=0 and <N!");
+                edges.push_back(std::make_pair(int(u),int(v)));
+            }
+
+            std::vector<std::size_t> offsets(n+1,0);
+            for(const auto& edge:edges)
+            {
+                offsets[edge.first+1]++;
+                offsets[edge.second+1]++;
+            }
+            for(long long u=0;u<n;u++)
+                offsets[u+1]+=offsets[u];
+            std::vector<int> targets(offsets[n]);
+            std::vector<std::size_t> pos(offsets.begin(),offsets.end()-1);
+            for(const auto& edge:edges)
+            {
+                targets[pos[edge.first]++]=edge.second;
+                targets[pos[edge.second]++]=edge.first;
+            }
+            //********** 每一行排序去重，并原地压缩 **********
+            std::size_t size=0;
+            for(long long u=0;u<n;u++)
+            {
+                auto row_begin=targets.begin()+offsets[u];
+                auto row_end=targets.begin()+offsets[u+1];
+                std::sort(row_begin,row_end);
+                row_end=std::unique(row_begin,row_end);
+                offsets[u]=size;
+                size=std::copy(row_begin,row_end,targets.begin()+size)-targets.begin();
+            }
+            offsets[n]=size;
+            targets.resize(size);
+            std::vector<int> weights(size,1);
+            write_graph_snapshot(path,n,offsets.data(),targets.data(),weights.data());
+        }
+        //!convert_adjacency_matrix_to_snapshot：将邻接矩阵文本转换为快照文件
+        /*!
+        * \param in:文本输入流
+        * \param path:快照文件路径
+        * \return: void
+        *
+        * 文本格式与`GraphIO::read_file_adj`以及`adj*.mtx`相同：首先是顶点数量`N`，然后是按行给出的`N*N`个0/1值。
+        * 第`i`行第`j`列非0表示一条从`i`到`j`、权重为1的边。文本格式错误时抛出异常。
+        *
+        * 矩阵按行读取，因此边天然按(起点，终点)递增排列，不需要排序。
+        *
+        * - 时间复杂度 O(V^2)
+        */
+        inline void convert_adjacency_matrix_to_snapshot(std::istream& in,const std::string& path)
+        {
+            long long n=0;
+            if(!(in>>n)||n<0)
+                throw std::invalid_argument("convert_adjacency_matrix_to_snapshot error: bad header, expect `N`!");
+            std::vector<std::size_t> offsets(n+1,0);
+            std::vector<int> targets;
+            for(long long i=0;i<n;i++)
+            {
+                for(long long j=0;j<n;j++)
+                {
+                    int value;
+                    if(!(in>>value))
+                        throw std::invalid_argument("convert_adjacency_matrix_to_snapshot error: expect N*N values!");
+                    if(value) targets.push_back(int(j));
+                }
+                offsets[i+1]=targets.size();
+            }
+            std::vector<int> weights(targets.size(),1);
+            write_graph_snapshot(path,n,offsets.data(),targets.data(),weights.data());
+        }
+
+        //!GraphSnapshot：以只读`mmap`方式打开的图快照，算法导论22章22.1节
+        /*!
+        * 从文本构建`Graph`/`CSRGraph`需要逐个解析数字、逐条插入边，对大图来说启动时间很长。
+        * 快照文件由`write_graph_snapshot`或者`convert_*_to_snapshot`一次性写出，之后每次使用时只需`mmap`整个文件：
+        *
+        * - `offsets`、`targets`、`weights`直接指向映射的内存，不做任何解析、也不做任何拷贝。页面由操作系统按需载入，
+        *   多个进程打开同一个快照时共享页缓存
+        * - 构造时默认只检查魔数、版本号、字节序、字段宽度、文件大小以及`offsets`的最后一项，这些检查都是 O(1) 的，因此载入是即时的
+        * - 构造时令`verify`为`true`（或者之后调用`verify()`），额外检查校验和、`offsets`的单调性以及终点的范围，
+        *   这需要读一遍整个文件，时间复杂度 O(V+E)。对于来源不可信的快照应当这样做
+        *
+        * 它对外提供与`CSRGraph`相同的`VIDType`/`EWeightType`/`neighbors`/`vertex_num`/`edge_num`接口。
+        * 快照中没有顶点对象，`vertexes`是一个只支持`size()`与`operator[]`的视图，`operator[]`总是返回`true`（表示顶点存在）。
+        * 因此只通过`graph->vertexes.size()`、`graph->vertexes[id]`与`graph->neighbors(id)`访问图的算法
+        * （如`tarjan_scc_labels`、`kahn_topology_sort`、`parallel_connected_component`、`make_residual_graph`）可以直接作用于它；
+        * 需要在顶点对象上记录`key`、`parent`等属性的算法则不能。
+        *
+        * 它不可复制，但可以移动。析构时解除映射。
+        */
+        class GraphSnapshot
+        {
+        public:
+            typedef int VIDType;     /*!< 顶点编号的类型*/
+            typedef int EWeightType; /*!< 权重的类型*/
+            typedef std::pair<VIDType,EWeightType> NeighborType; /*!< 从某个顶点出发的一条边：（另一个顶点编号，权重）*/
+
+            //!NeighborIterator：同时遍历`targets`与`weights`中一行的迭代器，解引用得到`NeighborType`的值
+            class NeighborIterator
+            {
+            public:
+                typedef std::input_iterator_tag iterator_category;  /*!< 迭代器类别*/
+                typedef NeighborType value_type;                    /*!< 解引用的值类型*/
+                typedef std::ptrdiff_t difference_type;             /*!< 迭代器距离类型*/
+                typedef const NeighborType* pointer;                /*!< 指针类型*/
+                typedef NeighborType reference;                     /*!< 解引用的返回类型（按值返回）*/
+                //!显式构造函数
+                /*!
+                * \param target: 指向`targets`中的某一项
+                * \param weight: 指向`weights`中对应的一项
+                */
+                NeighborIterator(const VIDType* target,const EWeightType* weight):_target(target),_weight(weight){}
+                NeighborType operator*() const {return NeighborType(*_target,*_weight);}
+                NeighborIterator& operator++() {++_target;++_weight;return *this;}
+                NeighborIterator operator++(int) {NeighborIterator old=*this;++*this;return old;}
+                bool operator==(const NeighborIterator& other) const {return _target==other._target;}
+                bool operator!=(const NeighborIterator& other) const {return _target!=other._target;}
+            private:
+                const VIDType* _target;         /*!< 当前边的终点*/
+                const EWeightType* _weight;     /*!< 当前边的权重*/
+            };
+            typedef NeighborRange<NeighborIterator> NeighborRangeType; /*!< 从某个顶点出发的边的区间类型*/
+
+            //!VertexView：顶点集合的视图。快照中的每一个顶点都存在
+            class VertexView
+            {
+            public:
+                //!显式构造函数
+                /*!
+                * \param num: 顶点数量
+                */
+                explicit VertexView(std::size_t num=0):_num(num){}
+                //!size:返回顶点数量
+                std::size_t size() const {return _num;}
+                //!operator[]:返回顶点是否存在，总是为`true`
+                bool operator[](std::size_t) const {return true;}
+            private:
+                std::size_t _num;   /*!< 顶点数量*/
+            };
+
+            //!显式构造函数，以只读方式映射快照文件
+            /*!
+            * \param path:快照文件路径
+            * \param verify:是否检查校验和以及数据的一致性（读一遍整个文件）。默认为`false`，即只检查头部与文件大小
+            *
+            * 文件无法打开或映射、头部无效、文件大小与头部不符、或者`verify`为`true`且检查失败时，抛出异常
+            */
+            explicit GraphSnapshot(const std::string& path,bool verify=false):
+                vertexes(0),offsets(nullptr),targets(nullptr),weights(nullptr),_data(nullptr),_size(0),_checksum(0)
+            {
+                int fd=::open(path.c_str(),O_RDONLY);
+                if(fd<0)
+                    throw std::invalid_argument("GraphSnapshot error: can not open "+path);
+                struct stat st;
+                if(::fstat(fd,&st)!=0||static_cast<std::size_t>(st.st_size)<sizeof(GraphSnapshotHeader))
+                {
+                    ::close(fd);
+                    throw std::invalid_argument("GraphSnapshot error: "+path+" is too small to be a snapshot!");
+                }
+                void* data=::mmap(nullptr,st.st_size,PROT_READ,MAP_PRIVATE,fd,0);
+                ::close(fd);                                        //映射建立后不再需要文件描述符
+                if(data==MAP_FAILED)
+                    throw std::invalid_argument("GraphSnapshot error: can not mmap "+path);
+                _data=data;
+                _size=st.st_size;
+                try
+                {
+                    _attach();
+                    if(verify&&!this->verify())
+                        throw std::invalid_argument("GraphSnapshot error: "+path+" is corrupted!");
+                }catch(...)
+                {
+                    _unmap();
+                    throw;
+                }
+            }
+            GraphSnapshot(const GraphSnapshot&)=delete;
+            GraphSnapshot& operator=(const GraphSnapshot&)=delete;
+            //!移动构造函数：映射转移给新对象，`other`成为没有顶点也没有边的空快照
+            GraphSnapshot(GraphSnapshot&& other):
+                vertexes(other.vertexes),offsets(other.offsets),targets(other.targets),weights(other.weights),
+                _data(other._data),_size(other._size),_checksum(other._checksum)
+            {
+                other._clear();
+            }
+            //!移动赋值运算符：先解除自己的映射，再接管`other`的映射，`other`成为空快照
+            GraphSnapshot& operator=(GraphSnapshot&& other)
+            {
+                if(this!=&other)
+                {
+                    _unmap();
+                    vertexes=other.vertexes;
+                    offsets=other.offsets;
+                    targets=other.targets;
+                    weights=other.weights;
+                    _data=other._data;
+                    _size=other._size;
+                    _checksum=other._checksum;
+                    other._clear();
+                }
+                return *this;
+            }
+            ~GraphSnapshot(){_unmap();}
+
+            //!vertex_num:返回顶点数量
+            std::size_t vertex_num() const {return vertexes.size();}
+            //!edge_num:返回边的数量
+            std::size_t edge_num() const {return offsets?offsets[vertexes.size()]:0;}
+            //!checksum:返回头部记录的校验和
+            std::uint64_t checksum() const {return _checksum;}
+            //!neighbors:返回图中从指定顶点出发的边的区间
+            /*!
+            * \param id: 指定顶点`id`
+            * \return  : 一个`NeighborRange`，其元素为`std::pair<VIDType,EWeightType>`（另一个顶点编号，权重）
+            *
+            * 该区间直接引用映射内存中`targets`、`weights`的`[offsets[id],offsets[id+1])`部分，不分配内存。如果`id`无效，则抛出异常
+            */
+            NeighborRangeType neighbors(VIDType id) const
+            {
+                if(id<0||static_cast<std::size_t>(id)>=vertexes.size())
+                    throw std::invalid_argument("neighbors error:id must >=0 and <vertex_num.");
+                return NeighborRangeType(NeighborIterator(targets+offsets[id],weights+offsets[id]),
+                                         NeighborIterator(targets+offsets[id+1],weights+offsets[id+1]));
+            }
+            //!verify:检查快照数据的一致性
+            /*!
+            * \return: 校验和与头部一致、`offsets`从0开始单调不减、所有终点位于`[0,vertex_num)`时返回`true`。空快照（被移动之后）返回`false`
+            *
+            * - 时间复杂度 O(V+E)，需要读一遍整个文件
+            */
+            bool verify() const
+            {
+                if(!_data) return false;
+                const char* payload=static_cast<const char*>(_data)+sizeof(GraphSnapshotHeader);
+                if(_snapshot_checksum(14695981039346656037ULL,payload,_size-sizeof(GraphSnapshotHeader))!=_checksum)
+                    return false;
+                const std::size_t num=vertexes.size();
+                if(offsets[0]!=0) return false;
+                for(std::size_t u=0;u<num;u++)
+                    if(offsets[u+1]<offsets[u]) return false;
+                for(std::size_t k=0;k<edge_num();k++)
+                    if(targets[k]<0||static_cast<std::size_t>(targets[k])>=num) return false;
+                return true;
+            }
+
+            VertexView vertexes;            /*!< 顶点集合的视图*/
+            const std::uint64_t* offsets;   /*!< 行偏移数组，大小为顶点数量+1，指向映射的内存*/
+            const VIDType* targets;         /*!< 边的终点数组，指向映射的内存*/
+            const EWeightType* weights;     /*!< 边的权重数组，指向映射的内存*/
+        private:
+            //!_attach:检查头部与文件大小，并设置各数组的指针
+            void _attach()
+            {
+                GraphSnapshotHeader header;
+                std::memcpy(&header,_data,sizeof(header));
+                if(std::memcmp(header.magic,GRAPH_SNAPSHOT_MAGIC,sizeof(header.magic))!=0)
+                    throw std::invalid_argument("GraphSnapshot error: bad magic, not a graph snapshot!");
+                if(header.version!=GRAPH_SNAPSHOT_VERSION)
+                    throw std::invalid_argument("GraphSnapshot error: unsupported snapshot version!");
+                if(header.endian_tag!=GRAPH_SNAPSHOT_ENDIAN_TAG)
+                    throw std::invalid_argument("GraphSnapshot error: snapshot is written by a machine of different byte order!");
+                if(header.vid_bytes!=sizeof(VIDType)||header.weight_bytes!=sizeof(EWeightType))
+                    throw std::invalid_argument("GraphSnapshot error: snapshot id or weight width mismatch!");
+                const std::uint64_t body=_size-sizeof(header);
+                if(header.vertex_num>=body/sizeof(std::uint64_t)
+                   ||header.edge_num>(body-(header.vertex_num+1)*sizeof(std::uint64_t))/(sizeof(VIDType)+sizeof(EWeightType))
+                   ||body!=(header.vertex_num+1)*sizeof(std::uint64_t)+header.edge_num*(sizeof(VIDType)+sizeof(EWeightType)))
+                    throw std::invalid_argument("GraphSnapshot error: file size does not match the header!");
+                const char* base=static_cast<const char*>(_data)+sizeof(header);
+                offsets=reinterpret_cast<const std::uint64_t*>(base);
+                targets=reinterpret_cast<const VIDType*>(base+(header.vertex_num+1)*sizeof(std::uint64_t));
+                weights=reinterpret_cast<const EWeightType*>(targets+header.edge_num);
+                if(offsets[header.vertex_num]!=header.edge_num)
+                    throw std::invalid_argument("GraphSnapshot error: offsets does not match edge_num!");
+                vertexes=VertexView(header.vertex_num);
+                _checksum=header.checksum;
+            }
+            //!_unmap:解除映射，之后成为空快照
+            void _unmap()
+            {
+                if(_data) ::munmap(_data,_size);
+                _clear();
+            }
+            //!_clear:不解除映射，只将视图与指针置为空快照的状态。映射已经被解除或者转移给了其它对象时使用
+            void _clear()
+            {
+                vertexes=VertexView(0);
+                offsets=nullptr;
+                targets=nullptr;
+                weights=nullptr;
+                _data=nullptr;
+                _size=0;
+                _checksum=0;
+            }
+
+            void* _data;            /*!< 映射内存的起始地址*/
+            std::size_t _size;      /*!< 映射内存的字节数*/
+            std::uint64_t _checksum;/*!< 头部记录的校验和*/
+        };
+    }
+}
+#endif // GRAPHSNAPSHOT
@@ -0,0 +1,223 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef GRAPHSNAPSHOT_TEST
+#define GRAPHSNAPSHOT_TEST
+#include<sstream>
+#include<fstream>
+#include<cstdio>
+#include<random>
+#include "../../../../google_test/gtest.h"
+#include "graphsnapshot.h"
+#include "../csr_graph/csrgraph.h"
+#include "../graph_vertex/vertex.h"
+#include "../../strong_connected_component/strongconnectedcomponent.h"
+#include "../../connected_component/connectedcomponent.h"
+#include "../../../max_flow/dinic/dinic.h"
+
+using IntroductionToAlgorithm::GraphAlgorithm::GraphSnapshot;
+using IntroductionToAlgorithm::GraphAlgorithm::GraphSnapshotHeader;
+using IntroductionToAlgorithm::GraphAlgorithm::write_graph_snapshot;
+using IntroductionToAlgorithm::GraphAlgorithm::convert_edge_list_to_snapshot;
+using IntroductionToAlgorithm::GraphAlgorithm::convert_adjacency_matrix_to_snapshot;
+using IntroductionToAlgorithm::GraphAlgorithm::CSRGraph;
+using IntroductionToAlgorithm::GraphAlgorithm::Vertex;
+using IntroductionToAlgorithm::GraphAlgorithm::tarjan_scc_labels;
+using IntroductionToAlgorithm::GraphAlgorithm::parallel_connected_component;
+using IntroductionToAlgorithm::GraphAlgorithm::dinic;
+
+namespace {
+    const int SNAPSHOT_N= 1000; /*!< 测试的图顶点数量*/
+}
+
+//!GraphSnapshotTest:测试类，用于为测试提供基础数据
+/*!
+*
+* `GraphSnapshotTest`是 `::testing::Test` 的子类。它主要用于为每一个`TEST_F`准备测试环境
+*/
+class GraphSnapshotTest:public ::testing::Test
+{
+public:
+typedef CSRGraph<Vertex<int>> GType; /*!< 模板实例化的图类型，该图的顶点类型为`Vertex<int>`*/
+typedef GType::EdgeTupleType EdgeTupleType; /*!< 边的三元素元组类型*/
+
+protected:
+    void SetUp(){
+        //****  1000个顶点、5000条随机有向边的图  ****
+        std::mt19937 engine(15);
+        std::uniform_int_distribution<int> id_dist(0,SNAPSHOT_N-1);
+        std::uniform_int_distribution<int> weight_dist(1,100);
+        std::vector<EdgeTupleType> edges;
+        for(int i=0;i<5000;i++)
+        {
+            int u=id_dist(engine),v=id_dist(engine);
+            if(u!=v) edges.push_back(std::make_tuple(u,v,weight_dist(engine)));
+        }
+        std::sort(edges.begin(),edges.end(),[](const EdgeTupleType& a,const EdgeTupleType& b)
+                  {return std::get<0>(a)<std::get<0>(b)||(std::get<0>(a)==std::get<0>(b)&&std::get<1>(a)<std::get<1>(b));});
+        edges.erase(std::unique(edges.begin(),edges.end(),[](const EdgeTupleType& a,const EdgeTupleType& b)
+                  {return std::get<0>(a)==std::get<0>(b)&&std::get<1>(a)==std::get<1>(b);}),edges.end());
+        _graph=std::make_shared<GType>(SNAPSHOT_N,edges.begin(),edges.end(),0);
+        _path="/tmp/graph_snapshot_test.bin";
+    }
+    void TearDown(){
+        std::remove(_path.c_str());
+    }
+    //!_write_text:将文本写入快照文件路径，用于构造损坏的快照
+    void _write_text(const std::string& text)
+    {
+        std::ofstream out(_path,std::ios::binary|std::ios::trunc);
+        out<<text;
+    }
+
+    std::shared_ptr<GType> _graph;  /*!< 指向一个含有随机边的图*/
+    std::string _path;              /*!< 快照文件的路径*/
+};
+
+//!graph_snapshot_test:GraphSnapshot
+/*!
+*
+* 测试`write_graph_snapshot`与`GraphSnapshot`：快照的边与原图完全相同
+*/
+TEST_F(GraphSnapshotTest,test_round_trip)
+{
+    write_graph_snapshot(_path,_graph);
+    GraphSnapshot snapshot(_path,true);
+    EXPECT_EQ(snapshot.vertex_num(),_graph->vertex_num());
+    EXPECT_EQ(snapshot.edge_num(),_graph->edge_num());
+    for(int i=0;i<SNAPSHOT_N;i++)
+    {
+        EXPECT_TRUE(snapshot.vertexes[i]);
+        std::vector<std::pair<int,int>> expect,real;
+        for(const auto& neighbor:_graph->neighbors(i)) expect.push_back(neighbor);
+        for(const auto& neighbor:snapshot.neighbors(i)) real.push_back(neighbor);
+        EXPECT_EQ(real,expect)<<"i:"<<i;
+    }
+    EXPECT_THROW(snapshot.neighbors(-1),std::invalid_argument);
+    EXPECT_THROW(snapshot.neighbors(SNAPSHOT_N),std::invalid_argument);
+    //************ 移动之后原快照不再持有映射，成为空快照  ***********
+    GraphSnapshot moved(std::move(snapshot));
+    EXPECT_EQ(moved.edge_num(),_graph->edge_num());
+    EXPECT_TRUE(moved.verify());
+    EXPECT_EQ(snapshot.vertex_num(),0);
+    EXPECT_EQ(snapshot.edge_num(),0);
+    EXPECT_FALSE(snapshot.verify());
+    EXPECT_THROW(snapshot.neighbors(0),std::invalid_argument);
+    //************ 移动赋值  ***********
+    snapshot=std::move(moved);
+    EXPECT_EQ(snapshot.vertex_num(),_graph->vertex_num());
+    EXPECT_EQ(snapshot.edge_num(),_graph->edge_num());
+    EXPECT_EQ(moved.vertex_num(),0);
+    EXPECT_EQ(moved.edge_num(),0);
+    moved=std::move(snapshot);
+    EXPECT_EQ(moved.vertex_num(),_graph->vertex_num());
+    EXPECT_EQ(snapshot.vertex_num(),0);
+    moved=GraphSnapshot(_path);                //移动赋值解除原有的映射
+    EXPECT_EQ(moved.edge_num(),_graph->edge_num());
+    //************ 空图：重写文件之前先解除映射  ***********
+    moved=std::move(snapshot);
+    EXPECT_EQ(moved.vertex_num(),0);
+    write_graph_snapshot(_path,std::make_shared<GType>(0));
+    GraphSnapshot empty(_path);
+    EXPECT_EQ(empty.vertex_num(),0);
+    EXPECT_EQ(empty.edge_num(),0);
+}
+
+//!graph_snapshot_test:GraphSnapshot
+/*!
+*
+* 测试损坏的快照：文件不存在、魔数错误、文件被截断时抛出异常；数据被修改时只有校验才抛出异常，默认载入时不读取数据
+*/
+TEST_F(GraphSnapshotTest,test_invalid_snapshot)
+{
+    EXPECT_THROW(GraphSnapshot("/tmp/graph_snapshot_test_not_exist.bin"),std::invalid_argument);
+    _write_text("0 0\n");
+    EXPECT_THROW(GraphSnapshot snapshot(_path),std::invalid_argument);
+    _write_text(std::string(sizeof(GraphSnapshotHeader)+8,'\0'));
+    EXPECT_THROW(GraphSnapshot snapshot(_path),std::invalid_argument);
+    //************ 截断  ***********
+    write_graph_snapshot(_path,_graph);
+    std::string content;
+    {
+        std::ifstream in(_path,std::ios::binary);
+        content.assign(std::istreambuf_iterator<char>(in),std::istreambuf_iterator<char>());
+    }
+    _write_text(content.substr(0,content.size()-4));
+    EXPECT_THROW(GraphSnapshot snapshot(_path),std::invalid_argument);
+    //************ 修改最后一条边的权重：只有校验时才能发现  ***********
+    content[content.size()-1]^=1;
+    _write_text(content);
+    EXPECT_THROW(GraphSnapshot snapshot(_path,true),std::invalid_argument);
+    GraphSnapshot unchecked(_path);     //默认不校验
+    EXPECT_FALSE(unchecked.verify());
+    //************ 写入无效的CSR数组  ***********
+    std::size_t offsets[]={0,1};
+    int targets[]={1};
+    int weights[]={1};
+    EXPECT_THROW(write_graph_snapshot(_path,1,offsets,targets,weights),std::invalid_argument);
+}
+
+//!graph_snapshot_test:GraphSnapshot
+/*!
+*
+* 测试`convert_edge_list_to_snapshot`与`convert_adjacency_matrix_to_snapshot`：
+* 两种文本描述同一个无向图，转换得到的快照相同
+*/
+TEST_F(GraphSnapshotTest,test_convert)
+{
+    std::istringstream edge_list("4 4\n0 1\n1 2\n2 3\n1 0\n");  //(1,0)与(0,1)重复
+    convert_edge_list_to_snapshot(edge_list,_path);
+    GraphSnapshot from_list(_path);
+    std::istringstream matrix("4\n0 1 0 0\n1 0 1 0\n0 1 0 1\n0 0 1 0\n");
+    std::string matrix_path=_path+".mtx";
+    convert_adjacency_matrix_to_snapshot(matrix,matrix_path);
+    GraphSnapshot from_matrix(matrix_path);
+    std::remove(matrix_path.c_str());
+
+    EXPECT_EQ(from_list.edge_num(),6);
+    EXPECT_EQ(from_list.checksum(),from_matrix.checksum());
+    std::vector<std::pair<int,int>> real;
+    for(const auto& neighbor:from_list.neighbors(1)) real.push_back(neighbor);
+    std::vector<std::pair<int,int>> expect({std::make_pair(0,1),std::make_pair(2,1)});
+    EXPECT_EQ(real,expect);
+
+    std::istringstream bad_id("2 1\n0 2\n");
+    EXPECT_THROW(convert_edge_list_to_snapshot(bad_id,_path),std::invalid_argument);
+    std::istringstream too_short("2 2\n0 1\n");
+    EXPECT_THROW(convert_edge_list_to_snapshot(too_short,_path),std::invalid_argument);
+    std::istringstream bad_matrix("2\n0 1\n1");
+    EXPECT_THROW(convert_adjacency_matrix_to_snapshot(bad_matrix,_path),std::invalid_argument);
+}
+
+//!graph_snapshot_test:GraphSnapshot
+/*!
+*
+* 测试`tarjan_scc_labels`、`parallel_connected_component`、`dinic`直接作用于`GraphSnapshot`，结果与`CSRGraph`相同
+*/
+TEST_F(GraphSnapshotTest,test_algorithms)
+{
+    write_graph_snapshot(_path,_graph);
+    auto snapshot=std::make_shared<GraphSnapshot>(_path);
+    std::vector<int> expect,real;
+    EXPECT_EQ(tarjan_scc_labels(snapshot,real),tarjan_scc_labels(_graph,expect));
+    EXPECT_EQ(real,expect);
+    EXPECT_EQ(parallel_connected_component(snapshot,real,2),parallel_connected_component(_graph,expect,2));
+    EXPECT_EQ(real,expect);
+    EXPECT_EQ(dinic(snapshot,0,SNAPSHOT_N-1),dinic(_graph,0,SNAPSHOT_N-1));
+}
+#endif // GRAPHSNAPSHOT_TEST
@@ -65,6 +65,8 @@ namespace IntroductionToAlgorithm
              * 顶点的颜色默认设为白色
              */
              BFS_Vertex(const KeyType&k,VIDType d):color(COLOR::WHITE),Vertex<KeyType>(k,d){}
+             //!析构函数：以循环而不是递归释放父结点链，见`release_parent_chain`
+             ~BFS_Vertex(){release_parent_chain(parent);}
 
              //!set_source：设本顶点为源点
              /*!
@@ -68,6 +68,8 @@ namespace IntroductionToAlgorithm
              DFS_Vertex(const KeyType&k,VIDType d):
                  color(COLOR::WHITE),discover_time(-1),finish_time(-1),Vertex<KeyType>(k,d)
              {}
+             //!析构函数：以循环而不是递归释放父结点链，见`release_parent_chain`
+             ~DFS_Vertex(){release_parent_chain(parent);}
              //!set_disovered：发现本顶点
              /*!
              *
@@ -69,6 +69,26 @@ namespace IntroductionToAlgorithm
             KeyType key;  /*!< 顶点存储数据*/
             const VIDType id;   /*!< 顶点id，一旦顶点生成则id不可变*/
         };        
+        //!release_parent_chain：以循环而不是递归释放父结点链
+        /*!
+        * \param parent:顶点的`parent`成员，函数返回后为空
+        * \return: void
+        *
+        * 搜索树中的顶点以`parent`强引用父结点。若直接析构，最后一个持有者释放时会沿父结点链逐层递归析构，
+        * 链很长时（例如在一条链上深度优先搜索得到的树）会导致调用栈溢出。这里每次释放一层之前，
+        * 若本顶点是父结点的唯一持有者，则先把父结点的`parent`取出来，于是每个顶点析构时它的`parent`已经为空。
+        *
+        * 带有`parent`成员的顶点类型在析构函数中调用它
+        */
+        template<typename VertexType> void release_parent_chain(std::shared_ptr<VertexType>& parent)
+        {
+            std::shared_ptr<VertexType> current=std::move(parent);
+            while(current&&current.use_count()==1)
+            {
+                std::shared_ptr<VertexType> next=std::move(current->parent);
+                current=std::move(next);
+            }
+        }
     }
 }
 #endif // VERTEX
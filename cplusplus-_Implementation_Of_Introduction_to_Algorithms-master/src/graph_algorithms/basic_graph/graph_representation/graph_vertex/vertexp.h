@@ -47,6 +47,8 @@ namespace IntroductionToAlgorithm
             * \param  d:顶点的编号
             */
             VertexP(const KeyType&k,VIDType d):Vertex<KeyType>(k,d){}
+            //!析构函数：以循环而不是递归释放父结点链，见`release_parent_chain`
+            ~VertexP(){release_parent_chain(parent);}
 
             //!to_string：返回顶点的字符串描述
             /*!
@@ -0,0 +1,150 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef LAZYVERTEXARRAY
+#define LAZYVERTEXARRAY
+#include<vector>
+#include<memory>
+#include<mutex>
+#include<atomic>
+#include<cstddef>
+namespace IntroductionToAlgorithm
+{
+    namespace GraphAlgorithm
+    {
+        //!LazyVertexArray：按需创建顶点对象的顶点集合
+        /*!
+        * `CSRGraph`用它作为`vertexes`。它在用法上与`std::vector<std::shared_ptr<VertexType>>`相同（`size`、`operator[]`、`at`、`begin`、`end`），
+        * 但是顶点指针数组以及顶点对象直到第一次通过这些接口访问某个顶点时才被创建，在此之前它只占用常数空间：
+        *
+        * - 普通模式：所有顶点都不存在，第一次访问时创建一个全为空指针的数组，之后由使用者逐个添加顶点
+        * - 隐式模式：`[0,size())`中的每个顶点都存在。第一次访问时为每一个`id`创建一个`key`为`KeyType()`的顶点对象
+        *
+        * 判断顶点是否存在应当使用`exists`（或者`vertex_exists`），它不会创建顶点对象。于是只通过`vertex_exists`、`neighbors`访问图的算法
+        * （各种顶点属性表版本的算法、并行算法的计算部分）在隐式模式的图上只需要 O(V+E) 个整数的空间。
+        *
+        * 创建过程通过`std::call_once`保证线程安全；但是创建之后通过`operator[]`修改顶点指针与`std::vector`一样不是线程安全的。
+        */
+        template<typename VertexType> class LazyVertexArray
+        {
+        public:
+            typedef std::shared_ptr<VertexType> PointerType;                           /*!< 顶点指针的类型*/
+            typedef typename std::vector<PointerType>::iterator iterator;              /*!< 迭代器类型*/
+            typedef typename std::vector<PointerType>::const_iterator const_iterator;  /*!< 常量迭代器类型*/
+
+            //!显式构造函数
+            /*!
+            * \param num:顶点数量
+            * \param implicit:是否为隐式模式（所有顶点都存在）
+            */
+            explicit LazyVertexArray(std::size_t num=0,bool implicit=false):
+                _num(num),_implicit(implicit),_ready(false),_once(new std::once_flag){}
+            //!复制构造函数：复制顶点指针（不复制顶点对象），尚未创建时复制的结果同样尚未创建
+            LazyVertexArray(const LazyVertexArray& other):
+                _num(other._num),_implicit(other._implicit),_objects(other._objects),
+                _ready(other._ready.load(std::memory_order_acquire)),_once(new std::once_flag){}
+            //!复制赋值运算符
+            LazyVertexArray& operator=(const LazyVertexArray& other)
+            {
+                if(this!=&other)
+                {
+                    _num=other._num;
+                    _implicit=other._implicit;
+                    _objects=other._objects;
+                    _ready.store(other._ready.load(std::memory_order_acquire),std::memory_order_release);
+                    _once.reset(new std::once_flag);
+                }
+                return *this;
+            }
+
+            //!size:返回顶点数量
+            std::size_t size() const {return _num;}
+            //!exists:返回指定`id`的顶点是否存在。它不会创建顶点对象，可以被多个线程同时调用
+            bool exists(std::size_t id) const
+            {
+                if(!_ready.load(std::memory_order_acquire)) return _implicit;
+                return static_cast<bool>(_objects[id]);
+            }
+            //!materialized:返回顶点指针数组是否已经创建
+            bool materialized() const {return _ready.load(std::memory_order_acquire);}
+
+            //!operator[]:返回指定`id`的顶点指针的引用，必要时先创建顶点
+            PointerType& operator[](std::size_t id) {_materialize();return _objects[id];}
+            //!operator[]:返回指定`id`的顶点指针的常量引用，必要时先创建顶点
+            const PointerType& operator[](std::size_t id) const {_materialize();return _objects[id];}
+            //!at:返回指定`id`的顶点指针的引用，必要时先创建顶点。`id`越界时抛出`std::out_of_range`
+            PointerType& at(std::size_t id) {_materialize();return _objects.at(id);}
+            //!at:返回指定`id`的顶点指针的常量引用，必要时先创建顶点。`id`越界时抛出`std::out_of_range`
+            const PointerType& at(std::size_t id) const {_materialize();return _objects.at(id);}
+            //!begin:返回起始迭代器，必要时先创建顶点
+            iterator begin() {_materialize();return _objects.begin();}
+            //!end:返回终止迭代器，必要时先创建顶点
+            iterator end() {_materialize();return _objects.end();}
+            //!begin:返回起始常量迭代器，必要时先创建顶点
+            const_iterator begin() const {_materialize();return _objects.begin();}
+            //!end:返回终止常量迭代器，必要时先创建顶点
+            const_iterator end() const {_materialize();return _objects.end();}
+
+            //!clone:返回顶点集合的深拷贝
+            /*!
+            * \return: 新的顶点集合。尚未创建时结果同样尚未创建；否则为每一个存在的顶点复制一个`key`、`id`相同的新顶点对象
+            */
+            LazyVertexArray clone() const
+            {
+                if(!materialized()) return *this;
+                LazyVertexArray result(_num);
+                for(std::size_t i=0;i<_num;i++)
+                    if(_objects[i])
+                        result[i]=std::make_shared<VertexType>(_objects[i]->key,_objects[i]->id);
+                return result;
+            }
+        private:
+            //!_materialize:创建顶点指针数组；隐式模式下同时为每一个`id`创建顶点对象。只执行一次
+            void _materialize() const
+            {
+                if(_ready.load(std::memory_order_acquire)) return;
+                std::call_once(*_once,[this](){
+                    _objects.resize(_num);
+                    if(_implicit)
+                        for(std::size_t i=0;i<_num;i++)
+                            _objects[i]=std::make_shared<VertexType>(typename VertexType::KeyType(),i);
+                    _ready.store(true,std::memory_order_release);
+                });
+            }
+            std::size_t _num;                               /*!< 顶点数量*/
+            bool _implicit;                                 /*!< 是否为隐式模式*/
+            mutable std::vector<PointerType> _objects;      /*!< 顶点指针数组，创建之前为空*/
+            mutable std::atomic<bool> _ready;               /*!< 顶点指针数组是否已经创建*/
+            std::unique_ptr<std::once_flag> _once;          /*!< 保证只创建一次*/
+        };
+
+        //!vertex_exists：返回`LazyVertexArray`中指定`id`的顶点是否存在，不创建顶点对象
+        /*!
+        * \param vertexes:顶点集合
+        * \param id:顶点`id`
+        * \return: 顶点是否存在
+        *
+        * 它比`header.h`中的通用版本更特殊，因此对`CSRGraph::vertexes`调用`vertex_exists`时选择本版本
+        */
+        template<typename VertexType> bool vertex_exists(const LazyVertexArray<VertexType>& vertexes,std::size_t id)
+        {
+            return vertexes.exists(id);
+        }
+    }
+}
+#endif // LAZYVERTEXARRAY
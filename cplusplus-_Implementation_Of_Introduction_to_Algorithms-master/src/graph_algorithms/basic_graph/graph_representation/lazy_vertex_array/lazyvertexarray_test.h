@@ -0,0 +1,110 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef LAZYVERTEXARRAY_TEST
+#define LAZYVERTEXARRAY_TEST
+#include "../../../../google_test/gtest.h"
+#include "lazyvertexarray.h"
+#include "../csr_graph/csrgraph.h"
+#include "../graph_vertex/vertex.h"
+#include "../../../../header.h"
+
+using IntroductionToAlgorithm::GraphAlgorithm::LazyVertexArray;
+using IntroductionToAlgorithm::GraphAlgorithm::CSRGraph;
+using IntroductionToAlgorithm::GraphAlgorithm::Vertex;
+using IntroductionToAlgorithm::GraphAlgorithm::vertex_exists;
+
+//!test_implicit:测试隐式模式的顶点集合
+/*!
+*
+* 判断顶点是否存在不创建顶点对象；第一次访问时为每一个`id`创建顶点；深拷贝得到不同的顶点对象
+*/
+TEST(LazyVertexArrayTest,test_implicit)
+{
+    LazyVertexArray<Vertex<int>> vertexes(5,true);
+    EXPECT_EQ(vertexes.size(),5);
+    for(std::size_t i=0;i<5;i++)
+        EXPECT_TRUE(vertex_exists(vertexes,i));
+    EXPECT_FALSE(vertexes.materialized());
+    auto lazy_copy=vertexes.clone();
+    EXPECT_FALSE(lazy_copy.materialized());
+
+    EXPECT_EQ(vertexes[3]->id,3);
+    EXPECT_TRUE(vertexes.materialized());
+    int count=0;
+    for(const auto& vertex:vertexes)
+    {
+        EXPECT_EQ(vertex->id,count++);
+        EXPECT_EQ(vertex->key,0);
+    }
+    EXPECT_EQ(count,5);
+    EXPECT_THROW(vertexes.at(5),std::out_of_range);
+    vertexes[1].reset();
+    EXPECT_FALSE(vertex_exists(vertexes,1));
+
+    vertexes[2]->key=7;
+    auto copy=vertexes.clone();
+    EXPECT_TRUE(copy.materialized());
+    EXPECT_FALSE(copy.exists(1));
+    EXPECT_EQ(copy[2]->key,7);
+    EXPECT_NE(copy[2],vertexes[2]);
+}
+//!test_normal:测试普通模式的顶点集合
+/*!
+*
+* 所有顶点开始时都不存在；添加顶点之后只有该顶点存在
+*/
+TEST(LazyVertexArrayTest,test_normal)
+{
+    LazyVertexArray<Vertex<int>> vertexes(4);
+    EXPECT_FALSE(vertex_exists(vertexes,0));
+    EXPECT_FALSE(vertexes.materialized());
+    vertexes[2]=std::make_shared<Vertex<int>>(9,2);
+    EXPECT_TRUE(vertexes.materialized());
+    for(std::size_t i=0;i<4;i++)
+        EXPECT_EQ(vertex_exists(vertexes,i),i==2);
+    LazyVertexArray<Vertex<int>> shared=vertexes;       //复制只复制顶点指针
+    EXPECT_EQ(shared[2],vertexes[2]);
+}
+//!test_csr_graph:测试压缩稀疏行图的顶点按需创建
+/*!
+*
+* 从边构建的图在访问边、查询边时不创建顶点对象；`inverse`保持按需创建；第一次访问`vertexes`之后顶点对象与以前的行为相同
+*/
+TEST(LazyVertexArrayTest,test_csr_graph)
+{
+    typedef CSRGraph<Vertex<int>> GType;
+    std::vector<GType::EdgeTupleType> edges={std::make_tuple(0,1,2),std::make_tuple(1,2,3),std::make_tuple(2,0,4)};
+    GType graph(3,edges.begin(),edges.end(),-1);
+    EXPECT_TRUE(graph.has_edge(0,1));
+    EXPECT_EQ(graph.weight(2,0),4);
+    EXPECT_EQ(graph.edge_tuples(),edges);
+    EXPECT_EQ(std::vector<GType::EdgeTupleType>(graph.edges().begin(),graph.edges().end()),edges);
+    EXPECT_THROW(graph.add_vertex(1),std::invalid_argument);
+    auto inverse=graph.inverse();
+    EXPECT_TRUE(inverse->has_edge(1,0));
+    EXPECT_FALSE(graph.vertexes.materialized());
+    EXPECT_FALSE(inverse->vertexes.materialized());
+
+    graph.modify_vertex(5,1);
+    EXPECT_TRUE(graph.vertexes.materialized());
+    EXPECT_EQ(graph.vertexes.at(1)->key,5);
+    EXPECT_EQ(graph.vertexes.at(2)->id,2);
+    EXPECT_EQ(graph.inverse()->vertexes.at(1)->key,5);
+}
+#endif // LAZYVERTEXARRAY_TEST
@@ -20,6 +20,8 @@
 #define MATRIXGRAPH
 #include<array>
 #include<map>
+#include<iterator>
+#include"../neighbor_range/neighborrange.h"
 
 namespace IntroductionToAlgorithm
 {
@@ -40,6 +42,44 @@ namespace IntroductionToAlgorithm
             typedef int EWeightType;                                        /*!< 权重的类型*/
             typedef std::tuple<VIDType,VIDType,EWeightType> EdgeTupleType;  /*!< 边的三元素（顶点1编号，顶点2编号，权重)组成的元组*/
             static const unsigned NUM=N;                                    /*!< 顶点的最大容量*/
+            typedef std::pair<VIDType,EWeightType> NeighborType;            /*!< 从某个顶点出发的一条边：（另一个顶点编号，权重）*/
+
+            //!NeighborIterator：遍历矩阵某一行中有效权重的迭代器
+            /*!
+            * 它跳过该行中等于`invalid_weight`的项，解引用得到`NeighborType`的值
+            */
+            class NeighborIterator
+            {
+            public:
+                typedef std::input_iterator_tag iterator_category;          /*!< 迭代器类别*/
+                typedef NeighborType value_type;                            /*!< 解引用的值类型*/
+                typedef std::ptrdiff_t difference_type;                     /*!< 迭代器距离类型*/
+                typedef const NeighborType* pointer;                        /*!< 指针类型*/
+                typedef NeighborType reference;                             /*!< 解引用的返回类型（按值返回）*/
+                //!显式构造函数
+                /*!
+                * \param row: 矩阵的一行
+                * \param index: 起始列。若该列为无效权重，则前进到下一个有效列
+                * \param invalid: 无效权重
+                */
+                NeighborIterator(const EWeightType* row,unsigned index,EWeightType invalid):_row(row),_index(index),_invalid(invalid)
+                {
+                    _skip();
+                }
+                NeighborType operator*() const {return NeighborType(_index,_row[_index]);}
+                NeighborIterator& operator++() {_index++;_skip();return *this;}
+                NeighborIterator operator++(int) {NeighborIterator old=*this;++*this;return old;}
+                bool operator==(const NeighborIterator& other) const {return _index==other._index;}
+                bool operator!=(const NeighborIterator& other) const {return _index!=other._index;}
+            private:
+                //!_skip:跳过无效权重的列
+                void _skip(){ while(_index<N&&_row[_index]==_invalid) _index++; }
+                const EWeightType* _row;    /*!< 矩阵的一行*/
+                unsigned _index;            /*!< 当前列*/
+                EWeightType _invalid;       /*!< 无效权重*/
+            };
+            typedef NeighborRange<NeighborIterator> NeighborRangeType;     /*!< 从某个顶点出发的边的区间类型*/
+
             //!显式构造函数，指定`invalid_weight`
             /*!
             * \param  val:无效权重值
@@ -130,6 +170,24 @@ namespace IntroductionToAlgorithm
                     }
                 return result;
             }
+            //!neighbors:返回图中从指定顶点出发的边的区间
+            /*!
+            * \param id: 指定顶点`id`
+            * \return  : 一个`NeighborRange`，其元素为`std::pair<VIDType,EWeightType>`（另一个顶点编号，权重），按照另一个顶点编号从小到大排列
+            *
+            * - 如果指定的顶点`id`不在`[0,N)`之间，则无效，抛出异常
+            *
+            * 该区间直接扫描矩阵的对应行，不分配内存。遍历一行的时间复杂度为O(N)
+            */
+            NeighborRangeType neighbors(VIDType id) const
+            {
+                if(id < 0 || static_cast<unsigned>(id) >= N)
+                {
+                    throw std::invalid_argument("neighbors: id must belongs [0,N),");
+                }
+                const EWeightType* row=matrix.at(id).data();
+                return NeighborRangeType(NeighborIterator(row,0,invalid_weight),NeighborIterator(row,N,invalid_weight));
+            }
             //!vertex_edge_tuples:返回图中从指定顶点出发的边的三元素元组集合，这里集合采用`std::vector<std::tuple<VIDType,VIDType,EWeightType>>`
             /*!
             * \param id: 指定顶点`id`
@@ -137,6 +195,8 @@ namespace IntroductionToAlgorithm
             *
             *
             * - 如果指定的顶点`id`不在`[0,N)`之间，则无效
+            *
+            * 它是`neighbors(id)`的包装，会分配一个新的`std::vector`。遍历图时应该使用`neighbors(id)`
             */
             const std::vector<EdgeTupleType> 
             vertex_edge_tuples(VIDType id) const
@@ -146,12 +206,8 @@ namespace IntroductionToAlgorithm
                     throw std::invalid_argument("vertex_edge_tuples: id must belongs [0,N),");
                 }
                 std::vector<EdgeTupleType> result;
-                for(unsigned j = 0; j < N; j++)
-                {
-                    int val = matrix.at(id).at(j);
-                    if(val != invalid_weight)
-                        result.push_back(std::make_tuple(id,j,val));
-                }
+                for(const auto& pair:neighbors(id))
+                    result.push_back(std::make_tuple(id,pair.first,pair.second));
                 return result;
             }
 
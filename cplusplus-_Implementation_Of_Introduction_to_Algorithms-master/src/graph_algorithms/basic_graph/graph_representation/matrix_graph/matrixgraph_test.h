@@ -181,5 +181,35 @@ TEST_F(GraphMatrixTest, test_vertex_edge_tuples)
     }
 }
 
+//!GraphMatrixTest:测试图的矩阵
+/*!
+*
+* `test_neighbors`：测试`neighbors(...)`成员方法：区间跳过无效权重
+*/
+TEST_F(GraphMatrixTest, test_neighbors)
+{
+    EXPECT_THROW(graph->neighbors(-1),std::invalid_argument);
+    EXPECT_THROW(graph->neighbors(MTXNUM),std::invalid_argument);
+    for(int i = 0; i < MTXNUM; i++)
+        EXPECT_TRUE(graph->neighbors(i).empty());
+
+    for(int i = 0; i < MTXNUM; i++)
+        for(int j = i%2; j < MTXNUM; j+=2)      //只添加奇偶性相同的顶点之间的边
+        {
+            graph->add_edge(std::make_tuple(i, j, i*j));
+        }
+    for(int i = 0; i < MTXNUM; i++)
+    {
+        int j = i%2;
+        for(const auto& neighbor:graph->neighbors(i))
+        {
+            EXPECT_EQ(neighbor.first, j) << "i:" << i;
+            EXPECT_EQ(neighbor.second, i*j) << "i:" << i;
+            j+=2;
+        }
+        EXPECT_GE(j, MTXNUM);
+    }
+}
+
 #endif // MATRIXGRAPH_TEST
 
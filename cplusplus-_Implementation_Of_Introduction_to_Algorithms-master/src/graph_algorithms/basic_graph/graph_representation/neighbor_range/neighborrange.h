@@ -0,0 +1,60 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef NEIGHBORRANGE
+#define NEIGHBORRANGE
+#include<iterator>
+#include<utility>
+#include<cstddef>
+namespace IntroductionToAlgorithm
+{
+    namespace GraphAlgorithm
+    {
+        //!NeighborRange：图中某个顶点出发的边的只读区间
+        /*!
+        * 它只保存一对迭代器，不拥有数据，因此构造它不涉及任何堆内存分配。对它解引用得到`std::pair<VIDType,EWeightType>`（或它的常量引用），
+        * 其中`first`为边的另一个顶点的`id`，`second`为边的权重。典型用法为：
+        *
+        *       for(const auto& neighbor:graph->neighbors(id))
+        *           visit(neighbor.first,neighbor.second);
+        *
+        * 该区间依赖于图的内部存储。在遍历期间修改图的边（添加边、设置边）会使该区间失效。
+        */
+        template<typename Iterator> class NeighborRange
+        {
+        public:
+            typedef Iterator iterator;          /*!< 区间的迭代器类型*/
+            //!显式构造函数
+            /*!
+            * \param begin:区间的起始迭代器
+            * \param end:区间的终止迭代器
+            */
+            NeighborRange(Iterator begin,Iterator end):_begin(begin),_end(end){}
+            //!begin:返回区间的起始迭代器
+            Iterator begin() const {return _begin;}
+            //!end:返回区间的终止迭代器
+            Iterator end() const {return _end;}
+            //!empty:返回区间是否为空
+            bool empty() const {return !(_begin!=_end);}
+        private:
+            Iterator _begin;    /*!< 区间的起始迭代器*/
+            Iterator _end;      /*!< 区间的终止迭代器*/
+        };
+    }
+}
+#endif // NEIGHBORRANGE
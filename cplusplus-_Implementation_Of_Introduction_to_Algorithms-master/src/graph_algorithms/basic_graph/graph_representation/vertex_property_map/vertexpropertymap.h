@@ -0,0 +1,218 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef VERTEXPROPERTYMAP
+#define VERTEXPROPERTYMAP
+#include<vector>
+#include<memory>
+#include<algorithm>
+#include<stdexcept>
+#include<cstddef>
+#include"../../../../header.h"
+namespace IntroductionToAlgorithm
+{
+    namespace GraphAlgorithm
+    {
+        //!VertexColor：顶点的颜色，与`BFS_Vertex::COLOR`、`DFS_Vertex::COLOR`含义相同，但只占一个字节
+        enum class VertexColor:unsigned char{WHITE,GRAY,BLACK};
+
+        //!VertexPropertyMap：以顶点`id`为下标的顶点属性数组
+        /*!
+        * 它把所有顶点的同一个属性连续地存放在一个数组中（结构体数组变为数组结构体），下标就是顶点的`id`。
+        * 与把属性保存在`std::shared_ptr<Vertex>`指向的顶点对象中相比：
+        *
+        * - 读写属性不需要解引用指针，也不修改引用计数
+        * - 对所有顶点的同一个属性的扫描（初始化、求和等）是顺序访问内存的
+        * - 属性与图分离：同一个图上的多个查询可以各自使用一组属性，互不干扰
+        *
+        * 注意：`T`不能为`bool`（`std::vector<bool>`不能返回元素的引用）。
+        */
+        template<typename T> class VertexPropertyMap
+        {
+        public:
+            typedef T ValueType;                                            /*!< 属性的类型*/
+            typedef typename std::vector<T>::iterator iterator;             /*!< 迭代器类型*/
+            typedef typename std::vector<T>::const_iterator const_iterator; /*!< 常量迭代器类型*/
+
+            //!默认构造函数：空的属性数组
+            VertexPropertyMap(){}
+            //!显式构造函数
+            /*!
+            * \param num:顶点数量
+            * \param value:所有顶点的初始属性值
+            */
+            explicit VertexPropertyMap(std::size_t num,const T& value=T()):_data(num,value){}
+            //!operator[]:返回顶点`id`的属性，不检查下标
+            T& operator[](std::size_t id){return _data[id];}
+            //!operator[]:返回顶点`id`的属性，不检查下标
+            const T& operator[](std::size_t id) const {return _data[id];}
+            //!at:返回顶点`id`的属性。若`id`越界则抛出`std::out_of_range`异常
+            T& at(std::size_t id){return _data.at(id);}
+            //!at:返回顶点`id`的属性。若`id`越界则抛出`std::out_of_range`异常
+            const T& at(std::size_t id) const {return _data.at(id);}
+            //!size:返回顶点数量
+            std::size_t size() const {return _data.size();}
+            //!fill:将所有顶点的属性设置为`value`
+            void fill(const T& value){std::fill(_data.begin(),_data.end(),value);}
+            //!resize:将顶点数量调整为`num`，并将所有顶点的属性设置为`value`
+            void resize(std::size_t num,const T& value=T()){_data.assign(num,value);}
+            //!data:返回底层数组的首地址
+            T* data(){return _data.data();}
+            //!data:返回底层数组的首地址
+            const T* data() const {return _data.data();}
+            iterator begin(){return _data.begin();}
+            iterator end(){return _data.end();}
+            const_iterator begin() const {return _data.begin();}
+            const_iterator end() const {return _data.end();}
+        private:
+            std::vector<T> _data;   /*!< 属性数组*/
+        };
+
+        //!SearchProperties：搜索与最短路径算法使用的一组顶点属性
+        /*!
+        * 它对应于`BFS_Vertex`、`DFS_Vertex`、`VertexP`中的各个成员：
+        *
+        * - `distance`：对应`key`，即广度优先搜索中到源点的边数、最短路径算法中的最短路径估计
+        * - `parent`：对应`parent`，保存父结点的`id`，-1表示没有父结点
+        * - `color`：对应`color`
+        * - `discover_time`、`finish_time`：深度优先搜索中顶点的发现时间和完成时间，-1表示未发现、未完成
+        *
+        * 接受它的算法（`breadth_first_visit`、`depth_first_visit`、`dijkstra`的相应重载版本）只通过`graph->vertexes.size()`、`graph->neighbors(id)`访问图，
+        * 不读写顶点对象。因此顶点对象是可选的：可以是没有任何算法状态的`Vertex`，也可以是`GraphSnapshot`这样根本没有顶点对象的图。
+        * 若需要把结果写回顶点对象，调用`copy_to_vertexes`。
+        */
+        template<typename KType> struct SearchProperties
+        {
+            typedef KType KeyType;  /*!< 距离的类型*/
+            typedef int VIDType;    /*!< 顶点编号的类型*/
+
+            //!默认构造函数：空的属性集合，算法会将它调整为图的顶点数量
+            SearchProperties(){}
+            //!显式构造函数
+            /*!
+            * \param num:顶点数量
+            */
+            explicit SearchProperties(std::size_t num){reset(num);}
+            //!reset:将属性调整为`num`个顶点，并初始化：距离为正无穷，没有父结点，颜色为白色，时间为-1
+            /*!
+            * \param num:顶点数量
+            *
+            * 顶点数量不变时不会重新分配内存
+            */
+            void reset(std::size_t num)
+            {
+                if(distance.size()!=num)
+                {
+                    distance.resize(num);
+                    parent.resize(num);
+                    color.resize(num);
+                    discover_time.resize(num);
+                    finish_time.resize(num);
+                }
+                distance.fill(unlimit<KeyType>());
+                parent.fill(-1);
+                color.fill(VertexColor::WHITE);
+                discover_time.fill(-1);
+                finish_time.fill(-1);
+            }
+            //!size:返回顶点数量
+            std::size_t size() const {return distance.size();}
+            //!path:返回从搜索树的根到顶点`id`的路径
+            /*!
+            * \param id:路径的终点，必须在`[0,size())`之间，否则抛出异常
+            * \return: 路径上的顶点`id`，从根开始到`id`结束。若`id`未被发现则返回空路径
+            */
+            std::vector<VIDType> path(VIDType id) const
+            {
+                if(id<0||static_cast<std::size_t>(id)>=size())
+                    throw std::invalid_argument("path error: id must belongs [0,size)!");
+                std::vector<VIDType> result;
+                if(color[id]==VertexColor::WHITE) return result;
+                for(VIDType v=id;v>=0;v=parent[v])
+                    result.push_back(v);
+                std::reverse(result.begin(),result.end());
+                return result;
+            }
+
+            VertexPropertyMap<KeyType> distance;        /*!< 距离*/
+            VertexPropertyMap<VIDType> parent;          /*!< 父结点的`id`*/
+            VertexPropertyMap<VertexColor> color;       /*!< 颜色*/
+            VertexPropertyMap<int> discover_time;       /*!< 发现时间*/
+            VertexPropertyMap<int> finish_time;         /*!< 完成时间*/
+        };
+
+        //!FlowProperties：推送-重贴标签算法使用的一组顶点属性
+        /*!
+        * 它对应于`FlowVertex`中的高度`h`与超额流量（`FlowVertex`用`key`保存超额流量）。
+        * `highest_label_push_relabel`的相应重载版本通过它读写高度与超额流量，算法结束之后调用者仍然可以检查它们。
+        */
+        template<typename EWeightType> struct FlowProperties
+        {
+            //!默认构造函数：空的属性集合，算法会将它调整为网络的结点数量
+            FlowProperties(){}
+            //!显式构造函数
+            /*!
+            * \param num:结点数量
+            */
+            explicit FlowProperties(std::size_t num){reset(num);}
+            //!reset:将属性调整为`num`个结点，并将高度与超额流量置为0
+            void reset(std::size_t num)
+            {
+                if(height.size()!=num)
+                {
+                    height.resize(num);
+                    excess.resize(num);
+                }
+                height.fill(0);
+                excess.fill(0);
+            }
+            //!size:返回结点数量
+            std::size_t size() const {return height.size();}
+
+            VertexPropertyMap<int> height;              /*!< 高度h*/
+            VertexPropertyMap<EWeightType> excess;      /*!< 超额流量e*/
+        };
+
+        //!copy_to_vertexes：将一组搜索属性写回图的顶点对象
+        /*!
+        * \param properties:搜索属性，其顶点数量必须等于`graph->vertexes.size()`，否则抛出异常
+        * \param graph:指向图的强指针，必须非空，否则抛出异常。其顶点类型必须有`key`、`parent`成员（如`VertexP`、`BFS_Vertex`、`DFS_Vertex`）
+        *
+        * 它把`distance`写入`key`，把父结点的`id`转换为指向父结点的强指针写入`parent`。空的顶点被跳过。
+        * 用于让只处理顶点对象的代码（如`get_path`）读取基于属性的算法的结果。
+        */
+        template<typename GraphType,typename KeyType>
+        void copy_to_vertexes(const SearchProperties<KeyType>& properties,std::shared_ptr<GraphType> graph)
+        {
+            typedef typename GraphType::VertexType VertexType;
+            if(!graph)
+                throw std::invalid_argument("copy_to_vertexes error: graph must not be nullptr!");
+            if(properties.size()!=graph->vertexes.size())
+                throw std::invalid_argument("copy_to_vertexes error: properties.size() must equal graph->vertexes.size()!");
+            for(std::size_t id=0;id<properties.size();id++)
+            {
+                auto& vertex=graph->vertexes[id];
+                if(!vertex) continue;
+                vertex->key=properties.distance[id];
+                auto parent_id=properties.parent[id];
+                vertex->parent=parent_id>=0?graph->vertexes[parent_id]:std::shared_ptr<VertexType>();
+            }
+        }
+    }
+}
+#endif // VERTEXPROPERTYMAP
@@ -0,0 +1,200 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef VERTEXPROPERTYMAP_TEST
+#define VERTEXPROPERTYMAP_TEST
+#include "../../../../google_test/gtest.h"
+#include "vertexpropertymap.h"
+#include "../csr_graph/csrgraph.h"
+#include "../graph_vertex/vertex.h"
+#include "../graph_vertex/vertexp.h"
+#include "../graph_vertex/bfs_vertex.h"
+#include "../graph_vertex/dfs_vertex.h"
+#include "../../graph_bfs/bfs.h"
+#include "../../graph_dfs/dfs.h"
+#include "../../graph_visitor/graphvisitor.h"
+#include "../../../single_source_shortest_path/dijkstra/dijkstra.h"
+#include "../../../graph_generator/graphgenerator.h"
+
+using IntroductionToAlgorithm::GraphAlgorithm::VertexPropertyMap;
+using IntroductionToAlgorithm::GraphAlgorithm::VertexColor;
+using IntroductionToAlgorithm::GraphAlgorithm::SearchProperties;
+using IntroductionToAlgorithm::GraphAlgorithm::FlowProperties;
+using IntroductionToAlgorithm::GraphAlgorithm::copy_to_vertexes;
+using IntroductionToAlgorithm::GraphAlgorithm::CSRGraph;
+using IntroductionToAlgorithm::GraphAlgorithm::Vertex;
+using IntroductionToAlgorithm::GraphAlgorithm::VertexP;
+using IntroductionToAlgorithm::GraphAlgorithm::BFS_Vertex;
+using IntroductionToAlgorithm::GraphAlgorithm::DFS_Vertex;
+using IntroductionToAlgorithm::GraphAlgorithm::NullVisitor;
+using IntroductionToAlgorithm::GraphAlgorithm::breadth_first_visit;
+using IntroductionToAlgorithm::GraphAlgorithm::depth_first_visit;
+using IntroductionToAlgorithm::GraphAlgorithm::dijkstra;
+using IntroductionToAlgorithm::GraphAlgorithm::erdos_renyi_graph;
+
+//!test_property_map:测试VertexPropertyMap
+/*!
+*
+* 测试`VertexPropertyMap`的构造、读写、`fill`与`resize`
+*/
+TEST(VertexPropertyMapTest,test_property_map)
+{
+    VertexPropertyMap<int> empty_map;
+    EXPECT_EQ(empty_map.size(),0);
+    VertexPropertyMap<int> map(5,7);
+    EXPECT_EQ(map.size(),5);
+    for(int i=0;i<5;i++)
+        EXPECT_EQ(map[i],7);
+    map[2]=3;
+    EXPECT_EQ(map.at(2),3);
+    EXPECT_EQ(map.data()[2],3);
+    EXPECT_THROW(map.at(5),std::out_of_range);
+    map.fill(1);
+    int sum=0;
+    for(auto value:map) sum+=value;
+    EXPECT_EQ(sum,5);
+    map.resize(3,9);
+    EXPECT_EQ(map.size(),3);
+    EXPECT_EQ(map[0],9);
+}
+//!test_search_properties:测试SearchProperties与FlowProperties
+/*!
+*
+* 测试`reset`的初始值，以及`path`
+*/
+TEST(VertexPropertyMapTest,test_search_properties)
+{
+    SearchProperties<int> properties(4);
+    EXPECT_EQ(properties.size(),4);
+    for(int i=0;i<4;i++)
+    {
+        EXPECT_EQ(properties.distance[i],unlimit<int>());
+        EXPECT_EQ(properties.parent[i],-1);
+        EXPECT_TRUE(properties.color[i]==VertexColor::WHITE);
+        EXPECT_EQ(properties.discover_time[i],-1);
+        EXPECT_EQ(properties.finish_time[i],-1);
+    }
+    //******* 搜索树：0->2->3，顶点1未被发现 *******
+    properties.color[0]=properties.color[2]=properties.color[3]=VertexColor::BLACK;
+    properties.parent[2]=0;
+    properties.parent[3]=2;
+    std::vector<int> expect_path={0,2,3};
+    EXPECT_EQ(properties.path(3),expect_path);
+    EXPECT_TRUE(properties.path(1).empty());
+    EXPECT_THROW(properties.path(4),std::invalid_argument);
+    properties.reset(4);
+    EXPECT_EQ(properties.parent[3],-1);
+
+    FlowProperties<int> flow(3);
+    EXPECT_EQ(flow.size(),3);
+    EXPECT_EQ(flow.height[2],0);
+    EXPECT_EQ(flow.excess[2],0);
+}
+//!test_property_algorithms:测试以顶点属性数组保存状态的搜索算法
+/*!
+*
+* 在随机图上，`breadth_first_visit`、`depth_first_visit`、`dijkstra`的属性版本与顶点对象版本的结果相同。
+* 属性版本作用于顶点类型为`Vertex<int>`（没有任何算法状态）的图
+*/
+TEST(VertexPropertyMapTest,test_property_algorithms)
+{
+    auto edge_list=erdos_renyi_graph(200,800,18);
+    const auto& edges=edge_list.edges;
+    auto plain=std::make_shared<CSRGraph<Vertex<int>>>(edge_list.vertex_num,edges.begin(),edges.end(),unlimit<int>());
+    auto bfs_graph=std::make_shared<CSRGraph<BFS_Vertex<int>>>(edge_list.vertex_num,edges.begin(),edges.end(),unlimit<int>());
+    auto dfs_graph=std::make_shared<CSRGraph<DFS_Vertex<int>>>(edge_list.vertex_num,edges.begin(),edges.end(),unlimit<int>());
+    auto path_graph=std::make_shared<CSRGraph<VertexP<int>>>(edge_list.vertex_num,edges.begin(),edges.end(),unlimit<int>());
+    NullVisitor visitor;
+    SearchProperties<int> properties;
+    //*********** 广度优先搜索 **********
+    breadth_first_visit(bfs_graph,0,visitor);
+    breadth_first_visit(plain,0,properties,visitor);
+    EXPECT_EQ(properties.size(),edge_list.vertex_num);
+    for(std::size_t i=0;i<edge_list.vertex_num;i++)
+    {
+        const auto& vertex=bfs_graph->vertexes[i];
+        EXPECT_EQ(properties.distance[i],vertex->key)<<"i:"<<i;
+        EXPECT_EQ(properties.parent[i],vertex->parent?vertex->parent->id:-1)<<"i:"<<i;
+    }
+    //*********** 深度优先搜索 **********
+    depth_first_visit(dfs_graph,visitor);
+    depth_first_visit(plain,properties,visitor);
+    for(std::size_t i=0;i<edge_list.vertex_num;i++)
+    {
+        const auto& vertex=dfs_graph->vertexes[i];
+        EXPECT_EQ(properties.discover_time[i],vertex->discover_time)<<"i:"<<i;
+        EXPECT_EQ(properties.finish_time[i],vertex->finish_time)<<"i:"<<i;
+        EXPECT_EQ(properties.parent[i],vertex->parent?vertex->parent->id:-1)<<"i:"<<i;
+        EXPECT_TRUE(properties.color[i]==VertexColor::BLACK);
+    }
+    //*********** dijkstra：同一个图上两组属性互不干扰 **********
+    SearchProperties<int> other_properties;
+    dijkstra(path_graph,0);
+    dijkstra(plain,0,properties);
+    dijkstra(plain,1,other_properties);
+    EXPECT_EQ(properties.distance[0],0);
+    EXPECT_EQ(other_properties.distance[1],0);
+    for(std::size_t i=0;i<edge_list.vertex_num;i++)
+        EXPECT_EQ(properties.distance[i],path_graph->vertexes[i]->key)<<"i:"<<i;
+    EXPECT_FALSE(plain->vertexes.materialized());  //属性版本不创建顶点对象
+    //*********** 写回顶点对象 **********
+    auto copy_graph=std::make_shared<CSRGraph<VertexP<int>>>(edge_list.vertex_num,edges.begin(),edges.end(),unlimit<int>());
+    copy_to_vertexes(properties,copy_graph);
+    for(std::size_t i=0;i<edge_list.vertex_num;i++)
+    {
+        const auto& vertex=copy_graph->vertexes[i];
+        EXPECT_EQ(vertex->key,properties.distance[i]);
+        EXPECT_EQ(vertex->parent?vertex->parent->id:-1,properties.parent[i]);
+    }
+    SearchProperties<int> small_properties(3);
+    EXPECT_THROW(copy_to_vertexes(small_properties,copy_graph),std::invalid_argument);
+    EXPECT_THROW(dijkstra(plain,-1,properties),std::invalid_argument);
+    EXPECT_THROW(breadth_first_visit(std::shared_ptr<CSRGraph<Vertex<int>>>(),0,properties,visitor),std::invalid_argument);
+}
+//!test_deep_dfs:测试深度很大的图上的深度优先搜索
+/*!
+*
+* 一条有一百万个顶点的链，深度优先树的深度等于顶点数量。深度优先搜索用显式栈代替递归，顶点对象的父结点链以循环释放，
+* 因此在默认大小的调用栈上也不会溢出
+*/
+TEST(VertexPropertyMapTest,test_deep_dfs)
+{
+    const int num=1000000;
+    std::vector<CSRGraph<Vertex<int>>::EdgeTupleType> edges;
+    for(int i=0;i+1<num;i++)
+        edges.push_back(std::make_tuple(i,i+1,1));
+    NullVisitor visitor;
+    //*********** 属性版本 **********
+    auto plain=std::make_shared<CSRGraph<Vertex<int>>>(num,edges.begin(),edges.end(),unlimit<int>());
+    SearchProperties<int> properties;
+    depth_first_visit(plain,properties,visitor);
+    for(int i=0;i<num;i++)
+    {
+        EXPECT_EQ(properties.discover_time[i],i+1);
+        EXPECT_EQ(properties.finish_time[i],2*num-i);
+        EXPECT_EQ(properties.parent[i],i-1);
+    }
+    //*********** 顶点对象版本 **********
+    auto dfs_graph=std::make_shared<CSRGraph<DFS_Vertex<int>>>(num,edges.begin(),edges.end(),unlimit<int>());
+    depth_first_visit(dfs_graph,visitor);
+    EXPECT_EQ(dfs_graph->vertexes[num-1]->discover_time,num);
+    EXPECT_EQ(dfs_graph->vertexes[0]->finish_time,2*num);
+    EXPECT_EQ(dfs_graph->vertexes[num-1]->parent,dfs_graph->vertexes[num-2]);
+    dfs_graph.reset();                      //父结点链长一百万，析构时不递归
+}
+#endif // VERTEXPROPERTYMAP_TEST
@@ -0,0 +1,125 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef GRAPHVISITOR
+#define GRAPHVISITOR
+#include<type_traits>
+#include<utility>
+namespace IntroductionToAlgorithm
+{
+    namespace GraphAlgorithm
+    {
+        //!NullVisitor：不实现任何钩子的访问者
+        /*!
+        * 图的遍历算法（如`breadth_first_visit`、`depth_first_visit`）接受一个模板参数类型的访问者，在遍历的各个时刻调用它的钩子：
+        *
+        * - `start_vertex(v)`：顶点v成为深度优先森林的一棵树的根（只用于深度优先搜索）
+        * - `discover_vertex(v)`：发现顶点v
+        * - `examine_edge(u,v,w)`：检查边(u,v)，w为边的权重
+        * - `tree_edge(u,v,w)`：边(u,v)成为搜索树的一条边，在`discover_vertex(v)`之前调用
+        * - `finish_vertex(v)`：顶点v搜索完成
+        *
+        * 访问者只需要实现它关心的钩子。是否实现了某个钩子在编译期检测（见`HasDiscoverVertex`等），
+        * 没有实现的钩子不会生成任何代码；实现了的钩子是普通的成员函数调用，可以被内联。
+        * 与`std::function`相比，既没有每个顶点/每条边一次的间接调用，也不妨碍编译器优化遍历的内层循环。
+        *
+        * `NullVisitor`不实现任何钩子，因此以它遍历的开销与不带任何回调的遍历相同。
+        */
+        struct NullVisitor
+        {
+        };
+        //!NoAction：接受任意参数、什么也不做的可调用对象，用作`kruskal`、`prim`等算法的回调的默认值
+        /*!
+        * 它可以隐式转换为任意参数类型的`std::function<void(...)>`，因此也可以用作`std::function`类型参数的默认值
+        */
+        struct NoAction
+        {
+            template<typename... Args> void operator()(Args&&...) const {}
+        };
+
+        //!_VoidType：将任意类型映射为`void`，用于SFINAE检测表达式是否合法
+        template<typename...> struct _VoidType
+        {
+            typedef void type;  /*!< 总是`void`*/
+        };
+
+        //!HasStartVertex：检测访问者是否实现了`start_vertex(v)`
+        template<typename Visitor,typename VIDType,typename=void> struct HasStartVertex:std::false_type{};
+        template<typename Visitor,typename VIDType> struct HasStartVertex<Visitor,VIDType,
+            typename _VoidType<decltype(std::declval<Visitor&>().start_vertex(std::declval<VIDType>()))>::type>:std::true_type{};
+        //!HasDiscoverVertex：检测访问者是否实现了`discover_vertex(v)`
+        template<typename Visitor,typename VIDType,typename=void> struct HasDiscoverVertex:std::false_type{};
+        template<typename Visitor,typename VIDType> struct HasDiscoverVertex<Visitor,VIDType,
+            typename _VoidType<decltype(std::declval<Visitor&>().discover_vertex(std::declval<VIDType>()))>::type>:std::true_type{};
+        //!HasExamineEdge：检测访问者是否实现了`examine_edge(u,v,w)`
+        template<typename Visitor,typename VIDType,typename EWeightType,typename=void> struct HasExamineEdge:std::false_type{};
+        template<typename Visitor,typename VIDType,typename EWeightType> struct HasExamineEdge<Visitor,VIDType,EWeightType,
+            typename _VoidType<decltype(std::declval<Visitor&>().examine_edge(std::declval<VIDType>(),std::declval<VIDType>(),std::declval<EWeightType>()))>::type>:std::true_type{};
+        //!HasTreeEdge：检测访问者是否实现了`tree_edge(u,v,w)`
+        template<typename Visitor,typename VIDType,typename EWeightType,typename=void> struct HasTreeEdge:std::false_type{};
+        template<typename Visitor,typename VIDType,typename EWeightType> struct HasTreeEdge<Visitor,VIDType,EWeightType,
+            typename _VoidType<decltype(std::declval<Visitor&>().tree_edge(std::declval<VIDType>(),std::declval<VIDType>(),std::declval<EWeightType>()))>::type>:std::true_type{};
+        //!HasFinishVertex：检测访问者是否实现了`finish_vertex(v)`
+        template<typename Visitor,typename VIDType,typename=void> struct HasFinishVertex:std::false_type{};
+        template<typename Visitor,typename VIDType> struct HasFinishVertex<Visitor,VIDType,
+            typename _VoidType<decltype(std::declval<Visitor&>().finish_vertex(std::declval<VIDType>()))>::type>:std::true_type{};
+
+        //!_start_vertex：访问者实现了`start_vertex`时调用它，否则什么也不做
+        template<typename Visitor,typename VIDType> inline void _start_vertex(Visitor& visitor,VIDType v,std::true_type) {visitor.start_vertex(v);}
+        template<typename Visitor,typename VIDType> inline void _start_vertex(Visitor&,VIDType,std::false_type) {}
+        //!_discover_vertex：访问者实现了`discover_vertex`时调用它，否则什么也不做
+        template<typename Visitor,typename VIDType> inline void _discover_vertex(Visitor& visitor,VIDType v,std::true_type) {visitor.discover_vertex(v);}
+        template<typename Visitor,typename VIDType> inline void _discover_vertex(Visitor&,VIDType,std::false_type) {}
+        //!_examine_edge：访问者实现了`examine_edge`时调用它，否则什么也不做
+        template<typename Visitor,typename VIDType,typename EWeightType> inline void _examine_edge(Visitor& visitor,VIDType u,VIDType v,EWeightType w,std::true_type) {visitor.examine_edge(u,v,w);}
+        template<typename Visitor,typename VIDType,typename EWeightType> inline void _examine_edge(Visitor&,VIDType,VIDType,EWeightType,std::false_type) {}
+        //!_tree_edge：访问者实现了`tree_edge`时调用它，否则什么也不做
+        template<typename Visitor,typename VIDType,typename EWeightType> inline void _tree_edge(Visitor& visitor,VIDType u,VIDType v,EWeightType w,std::true_type) {visitor.tree_edge(u,v,w);}
+        template<typename Visitor,typename VIDType,typename EWeightType> inline void _tree_edge(Visitor&,VIDType,VIDType,EWeightType,std::false_type) {}
+        //!_finish_vertex：访问者实现了`finish_vertex`时调用它，否则什么也不做
+        template<typename Visitor,typename VIDType> inline void _finish_vertex(Visitor& visitor,VIDType v,std::true_type) {visitor.finish_vertex(v);}
+        template<typename Visitor,typename VIDType> inline void _finish_vertex(Visitor&,VIDType,std::false_type) {}
+
+        //!visit_start_vertex：若访问者实现了`start_vertex(v)`则调用它，否则不生成任何代码
+        template<typename Visitor,typename VIDType> inline void visit_start_vertex(Visitor& visitor,VIDType v)
+        {
+            _start_vertex(visitor,v,HasStartVertex<Visitor,VIDType>());
+        }
+        //!visit_discover_vertex：若访问者实现了`discover_vertex(v)`则调用它，否则不生成任何代码
+        template<typename Visitor,typename VIDType> inline void visit_discover_vertex(Visitor& visitor,VIDType v)
+        {
+            _discover_vertex(visitor,v,HasDiscoverVertex<Visitor,VIDType>());
+        }
+        //!visit_examine_edge：若访问者实现了`examine_edge(u,v,w)`则调用它，否则不生成任何代码
+        template<typename Visitor,typename VIDType,typename EWeightType> inline void visit_examine_edge(Visitor& visitor,VIDType u,VIDType v,EWeightType w)
+        {
+            _examine_edge(visitor,u,v,w,HasExamineEdge<Visitor,VIDType,EWeightType>());
+        }
+        //!visit_tree_edge：若访问者实现了`tree_edge(u,v,w)`则调用它，否则不生成任何代码
+        template<typename Visitor,typename VIDType,typename EWeightType> inline void visit_tree_edge(Visitor& visitor,VIDType u,VIDType v,EWeightType w)
+        {
+            _tree_edge(visitor,u,v,w,HasTreeEdge<Visitor,VIDType,EWeightType>());
+        }
+        //!visit_finish_vertex：若访问者实现了`finish_vertex(v)`则调用它，否则不生成任何代码
+        template<typename Visitor,typename VIDType> inline void visit_finish_vertex(Visitor& visitor,VIDType v)
+        {
+            _finish_vertex(visitor,v,HasFinishVertex<Visitor,VIDType>());
+        }
+    }
+}
+#endif // GRAPHVISITOR
@@ -0,0 +1,188 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef GRAPHVISITOR_TEST
+#define GRAPHVISITOR_TEST
+#include "../../../google_test/gtest.h"
+#include "graphvisitor.h"
+#include "../graph_bfs/bfs.h"
+#include "../graph_dfs/dfs.h"
+#include "../graph_representation/graph/graph.h"
+#include "../graph_representation/graph_vertex/bfs_vertex.h"
+#include "../graph_representation/graph_vertex/dfs_vertex.h"
+#include <sstream>
+namespace  {
+    const int VISITOR_N= 8;  /*!< 测试的图顶点数量*/
+}
+
+using IntroductionToAlgorithm::GraphAlgorithm::Graph;
+using IntroductionToAlgorithm::GraphAlgorithm::BFS_Vertex;
+using IntroductionToAlgorithm::GraphAlgorithm::DFS_Vertex;
+using IntroductionToAlgorithm::GraphAlgorithm::NullVisitor;
+using IntroductionToAlgorithm::GraphAlgorithm::NoAction;
+using IntroductionToAlgorithm::GraphAlgorithm::HasStartVertex;
+using IntroductionToAlgorithm::GraphAlgorithm::HasDiscoverVertex;
+using IntroductionToAlgorithm::GraphAlgorithm::HasExamineEdge;
+using IntroductionToAlgorithm::GraphAlgorithm::HasTreeEdge;
+using IntroductionToAlgorithm::GraphAlgorithm::HasFinishVertex;
+using IntroductionToAlgorithm::GraphAlgorithm::breadth_first_visit;
+using IntroductionToAlgorithm::GraphAlgorithm::breadth_first_search;
+using IntroductionToAlgorithm::GraphAlgorithm::depth_first_visit;
+using IntroductionToAlgorithm::GraphAlgorithm::depth_first_search;
+
+//!RecordVisitor：测试用的访问者，记录每一个钩子的调用
+struct RecordVisitor
+{
+    RecordVisitor():examine_num(0),tree_num(0){}
+    void start_vertex(int v){os<<"s"<<v<<",";}
+    void discover_vertex(int v){os<<"d"<<v<<",";}
+    void examine_edge(int,int,int){examine_num++;}
+    void tree_edge(int u,int v,int){os<<"t"<<u<<"-"<<v<<",";tree_num++;}
+    void finish_vertex(int v){os<<"f"<<v<<",";}
+    std::ostringstream os;  /*!< 钩子的调用记录*/
+    int examine_num;        /*!< examine_edge 的调用次数*/
+    int tree_num;           /*!< tree_edge 的调用次数*/
+};
+//!DiscoverVisitor：测试用的访问者，只实现了`discover_vertex`
+struct DiscoverVisitor
+{
+    void discover_vertex(int v){os<<v<<",";}
+    std::ostringstream os;  /*!< 发现顶点的次序*/
+};
+
+//!GraphVisitorTest:测试类，用于为测试提供基础数据
+/*!
+*
+* `GraphVisitorTest`是 `::testing::Test` 的子类。它主要用于为每一个`TEST_F`准备测试环境
+*/
+class GraphVisitorTest:public ::testing::Test
+{
+public:
+    typedef Graph<VISITOR_N,BFS_Vertex<int>> BFSGType; /*!< 顶点类型为`BFS_Vertex<int>`的图类型*/
+    typedef Graph<VISITOR_N,DFS_Vertex<int>> DFSGType; /*!< 顶点类型为`DFS_Vertex<int>`的图类型*/
+protected:
+    void SetUp(){
+        //****  两个连通分量：0-1-2-3 加上 1-3、2-0；4-5-6；顶点 7 孤立 ****
+        _bfs_graph=std::make_shared<BFSGType>(-1);
+        _dfs_graph=std::make_shared<DFSGType>(-1);
+        for(int i=0;i<VISITOR_N;i++)
+        {
+            _bfs_graph->add_vertex(i);
+            _dfs_graph->add_vertex(i);
+        }
+        int edges[][2]={{0,1},{1,2},{2,3},{1,3},{2,0},{4,5},{5,6}};
+        for(const auto& edge:edges)
+        {
+            _bfs_graph->add_edge(std::make_tuple(edge[0],edge[1],1));
+            _dfs_graph->add_edge(std::make_tuple(edge[0],edge[1],1));
+        }
+    }
+    void TearDown(){}
+    std::shared_ptr<BFSGType> _bfs_graph;  /*!< 用于广度优先搜索的有向图*/
+    std::shared_ptr<DFSGType> _dfs_graph;  /*!< 用于深度优先搜索的有向图*/
+};
+//!test_traits:测试钩子的编译期检测
+/*!
+*
+* 测试`HasStartVertex`等类型萃取
+*/
+TEST(GraphVisitorTraitsTest,test_traits)
+{
+    bool null_has_discover=HasDiscoverVertex<NullVisitor,int>::value;
+    bool null_has_examine=HasExamineEdge<NullVisitor,int,int>::value;
+    bool record_has_start=HasStartVertex<RecordVisitor,int>::value;
+    bool record_has_tree=HasTreeEdge<RecordVisitor,int,int>::value;
+    bool record_has_finish=HasFinishVertex<RecordVisitor,int>::value;
+    bool discover_has_discover=HasDiscoverVertex<DiscoverVisitor,int>::value;
+    bool discover_has_finish=HasFinishVertex<DiscoverVisitor,int>::value;
+    EXPECT_FALSE(null_has_discover);
+    EXPECT_FALSE(null_has_examine);
+    EXPECT_TRUE(record_has_start);
+    EXPECT_TRUE(record_has_tree);
+    EXPECT_TRUE(record_has_finish);
+    EXPECT_TRUE(discover_has_discover);
+    EXPECT_FALSE(discover_has_finish);
+
+    NoAction action;
+    action();
+    action(1,2);  //任何参数都可以
+}
+//!test_bfs_visitor:测试breadth_first_visit方法
+/*!
+*
+* 测试`breadth_first_visit`的钩子次序，以及它与`breadth_first_search`的一致性
+*/
+TEST_F(GraphVisitorTest,test_bfs_visitor)
+{
+    NullVisitor null_visitor;
+    EXPECT_THROW(breadth_first_visit(_bfs_graph,VISITOR_N,null_visitor),std::invalid_argument);
+    EXPECT_THROW(breadth_first_visit(std::shared_ptr<BFSGType>(),0,null_visitor),std::invalid_argument);
+
+    RecordVisitor visitor;
+    breadth_first_visit(_bfs_graph,0,visitor);
+    EXPECT_EQ(visitor.os.str(),"d0,t0-1,d1,f0,t1-2,d2,t1-3,d3,f1,f2,f3,");
+    EXPECT_EQ(visitor.examine_num,5);
+    EXPECT_EQ(visitor.tree_num,3);
+    EXPECT_EQ(_bfs_graph->vertexes.at(3)->key,2);
+    EXPECT_EQ(_bfs_graph->vertexes.at(3)->parent,_bfs_graph->vertexes.at(1));
+    //****** 与 std::function 版本比较 ******
+    DiscoverVisitor discover;
+    breadth_first_visit(_bfs_graph,0,discover);
+    std::ostringstream os;
+    std::function<void(int)> pre_action=[&os](int v){os<<v<<",";};
+    breadth_first_search(_bfs_graph,0,pre_action);
+    EXPECT_EQ(discover.os.str(),os.str());
+}
+//!test_dfs_visitor:测试depth_first_visit方法
+/*!
+*
+* 测试`depth_first_visit`的钩子次序，以及它与`depth_first_search`的一致性
+*/
+TEST_F(GraphVisitorTest,test_dfs_visitor)
+{
+    NullVisitor null_visitor;
+    EXPECT_THROW(depth_first_visit(std::shared_ptr<DFSGType>(),null_visitor),std::invalid_argument);
+
+    RecordVisitor visitor;
+    depth_first_visit(_dfs_graph,visitor);
+    EXPECT_EQ(visitor.os.str(),"s0,d0,t0-1,d1,t1-2,d2,t2-3,d3,f3,f2,f1,f0,s4,d4,t4-5,d5,t5-6,d6,f6,f5,f4,s7,d7,f7,");
+    EXPECT_EQ(visitor.examine_num,7);
+    EXPECT_EQ(visitor.tree_num,5);
+    //****** 与 std::function 版本比较：时刻、根结点回调与原来一致 ******
+    std::vector<int> discovered(VISITOR_N),finished(VISITOR_N);
+    for(int i=0;i<VISITOR_N;i++)
+    {
+        discovered[i]=_dfs_graph->vertexes.at(i)->discover_time;
+        finished[i]=_dfs_graph->vertexes.at(i)->finish_time;
+    }
+    std::ostringstream os;
+    std::function<void(int,int)> pre_action=[&os](int v,int t){os<<"d"<<v<<"@"<<t<<",";};
+    std::function<void(int,int)> post_action=[&os](int v,int t){os<<"f"<<v<<"@"<<t<<",";};
+    std::function<void(int,int)> pre_root_action=[&os](int v,int t){os<<"s"<<v<<"@"<<t<<",";};
+    std::function<void(int,int)> post_root_action=[&os](int v,int t){os<<"e"<<v<<"@"<<t<<",";};
+    std::vector<int> search_order={4,0};
+    depth_first_search(_dfs_graph,pre_action,post_action,pre_root_action,post_root_action,search_order);
+    EXPECT_EQ(os.str(),"s4@0,d4@1,d5@2,d6@3,f6@4,f5@5,f4@6,e4@6,s0@6,d0@7,d1@8,d2@9,d3@10,f3@11,f2@12,f1@13,f0@14,e0@14,");
+    depth_first_search(_dfs_graph);
+    for(int i=0;i<VISITOR_N;i++)
+    {
+        EXPECT_EQ(_dfs_graph->vertexes.at(i)->discover_time,discovered[i]);
+        EXPECT_EQ(_dfs_graph->vertexes.at(i)->finish_time,finished[i]);
+    }
+}
+#endif // GRAPHVISITOR_TEST
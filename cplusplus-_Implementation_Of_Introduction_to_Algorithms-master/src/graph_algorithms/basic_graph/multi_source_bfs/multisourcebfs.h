@@ -0,0 +1,242 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef MULTISOURCEBFS
+#define MULTISOURCEBFS
+#include <memory>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include <cstdint>
+#include "../../../header.h"
+#include "../../../parallel_algorithms/parallel_for/parallelfor.h"
+namespace IntroductionToAlgorithm
+{
+    namespace GraphAlgorithm
+    {
+        //!MultiSourceBFSResult：多源广度优先搜索的结果
+        /*!
+        * `distance`按源点优先的次序存放：第i个源点到顶点v的距离（边数）为`distance[i*vertex_num+v]`，不可达为`unlimit<VIDType>()`
+        */
+        template<typename VIDType> struct MultiSourceBFSResult
+        {
+            //!at：返回第i个源点到顶点v的距离
+            VIDType at(std::size_t i,std::size_t v) const {return distance[i*vertex_num+v];}
+            std::vector<VIDType> sources;   /*!< 源点，与调用时的次序相同*/
+            std::size_t vertex_num;         /*!< 顶点数量*/
+            std::vector<VIDType> distance;  /*!< 各源点到各顶点的距离*/
+        };
+
+        //!_MSBFSAdjacency：多源广度优先搜索使用的压缩稀疏行邻接表
+        template<typename VIDType> struct _MSBFSAdjacency
+        {
+            std::vector<std::size_t> offsets;   /*!< 顶点u的出边位于[offsets[u],offsets[u+1])*/
+            std::vector<VIDType> targets;       /*!< 出边的终点*/
+        };
+        //!_make_msbfs_adjacency：检查参数，并构建压缩稀疏行邻接表
+        template<typename GraphType>
+        _MSBFSAdjacency<typename GraphType::VIDType> _make_msbfs_adjacency(std::shared_ptr<GraphType> graph,
+                      const std::vector<typename GraphType::VIDType>& sources,const char* name)
+        {
+            if(!graph)
+                throw std::invalid_argument(std::string(name)+" error: graph must not be nullptr!");
+            const std::size_t num=graph->vertexes.size();
+            for(auto source:sources)
+                if(source<0||static_cast<std::size_t>(source)>=num||!vertex_exists(graph->vertexes,source))
+                    throw std::invalid_argument(std::string(name)+" error: source muse belongs [0,N) and graph->vertexes[source] must not be nullptr!");
+            _MSBFSAdjacency<typename GraphType::VIDType> adjacency;
+            adjacency.offsets.assign(num+1,0);
+            for(std::size_t u=0;u<num;u++)
+            {
+                if(vertex_exists(graph->vertexes,u))
+                    for(const auto& neighbor:graph->neighbors(u))
+                        adjacency.targets.push_back(neighbor.first);
+                adjacency.offsets[u+1]=adjacency.targets.size();
+            }
+            return adjacency;
+        }
+        //!_multi_source_bfs_batch：同时从至多 64*Words 个源点出发的广度优先搜索
+        /*!
+        * \param adjacency:邻接表
+        * \param sources:本批源点的起始地址
+        * \param count:本批源点的数量，不超过 64*Words
+        * \param first_index:本批第一个源点在全部源点中的下标
+        * \param action:发现顶点时调用`action(i,v,d)`，表示第i个源点到v的距离为d
+        *
+        * 每个顶点有三个 64*Words 位的位集：`seen`（哪些源点已经发现了它）、`visit`（哪些源点的当前边界包含它）、`next`（下一层边界）。一层的推进分两步：
+        *
+        * - 对当前边界中的每个顶点v的每条出边(v,n)：`next[n] |= visit[v]`。一次扫描邻接表就推进了所有源点
+        * - 对被触及的每个顶点n：`next[n] &= ~seen[n]`，`seen[n] |= next[n]`。非零的`next[n]`中每一位对应一个新发现n的源点
+        *
+        * 位集的字数`Words`是编译期常量，逐字的 OR/ANDNOT 循环可以被编译器展开、向量化。这里不像`min_plus_product`那样手写 AVX 内建函数：
+        * 每条边只对`next[n]`做一次 Words 个字的按位或，`n`是随机的邻居，耗时在于访存而不是运算，在启用 AVX2 的编译选项下`Words=4`的循环本身就会被编译为一条 256 位的指令。
+        * 边界与被触及的顶点都保存在列表中，因此每一层的工作量与边界的出边数量成正比，而不是 O(V)。
+        */
+        template<std::size_t Words,typename VIDType,typename Action>
+        void _multi_source_bfs_batch(const _MSBFSAdjacency<VIDType>& adjacency,const VIDType* sources,std::size_t count,
+                                     std::size_t first_index,Action& action)
+        {
+            const std::size_t num=adjacency.offsets.size()-1;
+            std::vector<std::uint64_t> seen(num*Words,0);
+            std::vector<std::uint64_t> visit(num*Words,0);
+            std::vector<std::uint64_t> next(num*Words,0);
+            std::vector<VIDType> frontier;          //visit非零的顶点
+            std::vector<VIDType> touched;           //next非零的顶点
+            for(std::size_t i=0;i<count;i++)
+            {
+                VIDType source=sources[i];
+                std::uint64_t* block=&visit[source*Words];
+                if(std::none_of(block,block+Words,[](std::uint64_t word){return word!=0;}))   //重复的源点只入边界一次
+                    frontier.push_back(source);
+                block[i/64]|=std::uint64_t(1)<<(i%64);
+                seen[source*Words+i/64]|=std::uint64_t(1)<<(i%64);
+                action(first_index+i,source,VIDType(0));
+            }
+            for(VIDType level=1;!frontier.empty();level++)
+            {
+                //********* 第一步：沿出边传播边界 *********
+                for(VIDType v:frontier)
+                {
+                    const std::uint64_t* mask=&visit[v*Words];
+                    for(std::size_t k=adjacency.offsets[v];k<adjacency.offsets[v+1];k++)
+                    {
+                        std::uint64_t* target=&next[adjacency.targets[k]*Words];
+                        std::uint64_t any=0;
+                        for(std::size_t w=0;w<Words;w++) any|=target[w];
+                        if(!any) touched.push_back(adjacency.targets[k]);
+                        for(std::size_t w=0;w<Words;w++) target[w]|=mask[w];
+                    }
+                }
+                for(VIDType v:frontier)
+                    std::fill(&visit[v*Words],&visit[v*Words]+Words,0);
+                frontier.clear();
+                //********* 第二步：去掉已经发现过的源点，得到新的边界 *********
+                for(VIDType n:touched)
+                {
+                    std::uint64_t* fresh=&next[n*Words];
+                    std::uint64_t* known=&seen[n*Words];
+                    std::uint64_t any=0;
+                    for(std::size_t w=0;w<Words;w++)
+                    {
+                        fresh[w]&=~known[w];
+                        known[w]|=fresh[w];
+                        any|=fresh[w];
+                    }
+                    if(!any) continue;
+                    frontier.push_back(n);
+                    for(std::size_t w=0;w<Words;w++)
+                    {
+                        visit[n*Words+w]=fresh[w];
+                        for(std::uint64_t bits=fresh[w];bits;bits&=bits-1)
+                            action(first_index+w*64+lowest_bit(bits),n,level);
+                    }
+                }
+                for(VIDType n:touched)
+                    std::fill(&next[n*Words],&next[n*Words]+Words,0);
+                touched.clear();
+            }
+        }
+
+        //!multi_source_breadth_first_visit：位并行的多源广度优先搜索（MS-BFS）
+        /*!
+        * \param graph:指向图的强引用，必须非空。若为空则抛出异常
+        * \param sources:源点。每个源点必须有效，否则抛出异常；可以重复
+        * \param action:一个可调用对象。第i个源点发现顶点v时调用`action(i,v,d)`，d为距离（边数）。每个（源点，可达顶点）恰好调用一次
+        * \return: void
+        *
+        * ### 算法原理
+        *
+        * 对每个源点各执行一次`breadth_first_search`需要 |S| 次遍历整个图，并且每次都要重置所有顶点的状态。
+        * 多源广度优先搜索（Then 等，2014）将源点分为每批 64*Words 个，每一批只遍历一次邻接表：顶点上的位集记录哪些源点发现了它、
+        * 哪些源点的边界包含它，一次按位或就把一条边上所有源点的边界一起推进（见`_multi_source_bfs_batch`）。
+        * 不同源点的搜索在图的相同区域内重叠得越多，节省得越多：在直径很小的小世界图（如R-MAT）上，|S|=256 时比逐个搜索快数倍。
+        * 反之，在网格、路网等直径很大的图上各源点的边界很少同时经过同一个顶点，每个顶点几乎要为每个源点各处理一次，
+        * 而每次处理的是 3*Words 个字而不是一个距离，工作集也大得多，此时它比逐个执行`breadth_first_visit`更慢。
+        *
+        * 同一批内，距离较小的发现先于距离较大的发现；批与批之间按照源点的次序进行。`Words`默认为4（每批256个源点）。
+        *
+        * 算法的时间复杂度为 O(|S|/(64*Words) * (V+E) * Words)，空间为 O(V*Words)
+        */
+        template<std::size_t Words=4,typename GraphType,typename Action>
+        void multi_source_breadth_first_visit(std::shared_ptr<GraphType> graph,const std::vector<typename GraphType::VIDType>& sources,Action action)
+        {
+            static_assert(Words>0,"Words must be positive");
+            auto adjacency=_make_msbfs_adjacency(graph,sources,"multi_source_breadth_first_visit");
+            for(std::size_t first=0;first<sources.size();first+=64*Words)
+                _multi_source_bfs_batch<Words>(adjacency,sources.data()+first,std::min(64*Words,sources.size()-first),first,action);
+        }
+        //!multi_source_breadth_first_search：计算多个源点到所有顶点的距离
+        /*!
+        * \param graph:指向图的强引用，必须非空。若为空则抛出异常
+        * \param sources:源点。每个源点必须有效，否则抛出异常；可以重复
+        * \param thread_num：线程数量，不同批的源点由不同的线程处理。若为0则使用硬件支持的并发线程数量。默认为1
+        * \return: `MultiSourceBFSResult`，其中的距离与对每个源点执行`breadth_first_search`得到的`key`相同
+        *
+        * 结果的大小为 |S|*V，对于很大的图与很多的源点，应当使用`multi_source_breadth_first_visit`或者`closeness_centrality`，不保存完整的距离
+        */
+        template<std::size_t Words=4,typename GraphType>
+        MultiSourceBFSResult<typename GraphType::VIDType> multi_source_breadth_first_search(std::shared_ptr<GraphType> graph,
+                      const std::vector<typename GraphType::VIDType>& sources,std::size_t thread_num=1)
+        {
+            typedef typename GraphType::VIDType VIDType;
+            static_assert(Words>0,"Words must be positive");
+            auto adjacency=_make_msbfs_adjacency(graph,sources,"multi_source_breadth_first_search");
+            MultiSourceBFSResult<VIDType> result;
+            result.sources=sources;
+            result.vertex_num=adjacency.offsets.size()-1;
+            result.distance.assign(sources.size()*result.vertex_num,unlimit<VIDType>());
+            const std::size_t batch=64*Words;
+            ParallelAlgorithm::parallel_for(0,(sources.size()+batch-1)/batch,thread_num,[&](std::size_t index){
+                auto action=[&result](std::size_t i,VIDType v,VIDType d){result.distance[i*result.vertex_num+v]=d;};  //各批写入不相交的行
+                const std::size_t first=index*batch;
+                _multi_source_bfs_batch<Words>(adjacency,sources.data()+first,std::min(batch,sources.size()-first),first,action);
+            },1);
+            return result;
+        }
+        //!closeness_centrality：计算多个顶点的接近中心度
+        /*!
+        * \param graph:指向图的强引用，必须非空。若为空则抛出异常
+        * \param sources:需要计算的顶点。每个顶点必须有效，否则抛出异常
+        * \param thread_num：线程数量，不同批的顶点由不同的线程处理。若为0则使用硬件支持的并发线程数量。默认为1
+        * \return: 与`sources`一一对应的接近中心度
+        *
+        * 顶点s的接近中心度为 (r-1)/sum(d(s,v))，其中r为s可达的顶点数量（含s），求和遍历s可达的顶点；s不能到达其它顶点时为0。
+        * 它使用多源广度优先搜索，只为每个源点累加距离之和与可达顶点数，空间为 O(V*Words+|S|)
+        */
+        template<std::size_t Words=4,typename GraphType>
+        std::vector<double> closeness_centrality(std::shared_ptr<GraphType> graph,const std::vector<typename GraphType::VIDType>& sources,std::size_t thread_num=1)
+        {
+            typedef typename GraphType::VIDType VIDType;
+            static_assert(Words>0,"Words must be positive");
+            auto adjacency=_make_msbfs_adjacency(graph,sources,"closeness_centrality");
+            std::vector<unsigned long long> distance_sum(sources.size(),0);
+            std::vector<std::size_t> reached(sources.size(),0);
+            const std::size_t batch=64*Words;
+            ParallelAlgorithm::parallel_for(0,(sources.size()+batch-1)/batch,thread_num,[&](std::size_t index){
+                auto action=[&](std::size_t i,VIDType,VIDType d){distance_sum[i]+=d;reached[i]++;};
+                const std::size_t first=index*batch;
+                _multi_source_bfs_batch<Words>(adjacency,sources.data()+first,std::min(batch,sources.size()-first),first,action);
+            },1);
+            std::vector<double> result(sources.size(),0);
+            for(std::size_t i=0;i<sources.size();i++)
+                if(distance_sum[i]>0) result[i]=double(reached[i]-1)/distance_sum[i];
+            return result;
+        }
+    }
+}
+#endif // MULTISOURCEBFS
@@ -0,0 +1,145 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef MULTISOURCEBFS_TEST
+#define MULTISOURCEBFS_TEST
+#include <random>
+#include "../../../google_test/gtest.h"
+#include "multisourcebfs.h"
+#include "../graph_bfs/bfs.h"
+#include "../graph_visitor/graphvisitor.h"
+#include "../graph_representation/csr_graph/csrgraph.h"
+#include "../graph_representation/graph_vertex/vertex.h"
+#include "../graph_representation/vertex_property_map/vertexpropertymap.h"
+#include "../../graph_generator/graphgenerator.h"
+
+using IntroductionToAlgorithm::GraphAlgorithm::CSRGraph;
+using IntroductionToAlgorithm::GraphAlgorithm::Vertex;
+using IntroductionToAlgorithm::GraphAlgorithm::SearchProperties;
+using IntroductionToAlgorithm::GraphAlgorithm::NullVisitor;
+using IntroductionToAlgorithm::GraphAlgorithm::breadth_first_visit;
+using IntroductionToAlgorithm::GraphAlgorithm::multi_source_breadth_first_visit;
+using IntroductionToAlgorithm::GraphAlgorithm::multi_source_breadth_first_search;
+using IntroductionToAlgorithm::GraphAlgorithm::closeness_centrality;
+using IntroductionToAlgorithm::GraphAlgorithm::erdos_renyi_graph;
+
+//!MultiSourceBFSTest:测试类，用于为测试提供基础数据
+/*!
+*
+* `MultiSourceBFSTest`是 `::testing::Test` 的子类。它主要用于为每一个`TEST_F`准备测试环境
+*/
+class MultiSourceBFSTest:public ::testing::Test
+{
+public:
+    typedef CSRGraph<Vertex<int>> GType; /*!< 模板实例化的图类型*/
+protected:
+    void SetUp()
+    {
+        auto edges=erdos_renyi_graph(500,1500,7);     //稀疏的随机有向图，有不可达的顶点对
+        _graph=std::make_shared<GType>(edges.vertex_num,edges.edges.begin(),edges.edges.end(),unlimit<int>());
+        std::mt19937 gen(7);
+        std::uniform_int_distribution<int> vertex_dist(0,499);
+        for(int i=0;i<300;i++)
+            _sources.push_back(vertex_dist(gen));
+        _sources.push_back(_sources.front());        //重复的源点
+        //********* 逐个源点执行广度优先搜索，作为期望结果 **********
+        SearchProperties<int> properties;
+        for(int source:_sources)
+        {
+            NullVisitor visitor;
+            breadth_first_visit(_graph,source,properties,visitor);
+            _expect.push_back(std::vector<int>(properties.distance.begin(),properties.distance.end()));
+        }
+    }
+    void TearDown(){}
+    std::shared_ptr<GType> _graph;          /*!< 随机有向图*/
+    std::vector<int> _sources;              /*!< 源点*/
+    std::vector<std::vector<int>> _expect;  /*!< 各源点逐个搜索得到的距离*/
+};
+//!test_msbfs_distance:测试多源广度优先搜索的距离
+/*!
+*
+* 不同的位集宽度、线程数量下，`multi_source_breadth_first_search`的距离与逐个执行广度优先搜索相同
+*/
+TEST_F(MultiSourceBFSTest,test_msbfs_distance)
+{
+    auto check=[this](const IntroductionToAlgorithm::GraphAlgorithm::MultiSourceBFSResult<int>& result){
+        ASSERT_EQ(result.distance.size(),_sources.size()*500);
+        EXPECT_EQ(result.sources,_sources);
+        for(std::size_t i=0;i<_sources.size();i++)
+            for(int v=0;v<500;v++)
+                ASSERT_EQ(result.at(i,v),_expect[i][v])<<"source "<<i<<" vertex "<<v;
+    };
+    check(multi_source_breadth_first_search(_graph,_sources));
+    check(multi_source_breadth_first_search<1>(_graph,_sources,3));
+    check(multi_source_breadth_first_search<2>(_graph,_sources,0));
+    EXPECT_TRUE(multi_source_breadth_first_search(_graph,std::vector<int>()).distance.empty());
+}
+//!test_msbfs_visit:测试多源广度优先搜索的回调
+/*!
+*
+* 每个（源点，可达顶点）恰好回调一次，距离正确；同一批内按照距离不减的次序回调
+*/
+TEST_F(MultiSourceBFSTest,test_msbfs_visit)
+{
+    std::vector<std::vector<int>> visited(_sources.size(),std::vector<int>(500,-1));
+    int last_level=0;
+    bool ordered=true;
+    multi_source_breadth_first_visit<8>(_graph,_sources,[&](std::size_t i,int v,int d){
+        EXPECT_EQ(visited[i][v],-1);
+        visited[i][v]=d;
+        if(d<last_level) ordered=false;
+        last_level=d;
+    });
+    EXPECT_TRUE(ordered);                           //512个源点为一批
+    for(std::size_t i=0;i<_sources.size();i++)
+        for(int v=0;v<500;v++)
+            EXPECT_EQ(visited[i][v],_expect[i][v]<unlimit<int>()?_expect[i][v]:-1);
+}
+//!test_closeness:测试接近中心度
+/*!
+*
+* `closeness_centrality`与由逐个搜索的距离计算的结果相同
+*/
+TEST_F(MultiSourceBFSTest,test_closeness)
+{
+    auto closeness=closeness_centrality<1>(_graph,_sources,2);
+    ASSERT_EQ(closeness.size(),_sources.size());
+    for(std::size_t i=0;i<_sources.size();i++)
+    {
+        long long sum=0,reached=0;
+        for(int d:_expect[i])
+            if(d<unlimit<int>()) {sum+=d;reached++;}
+        double expect=sum>0?double(reached-1)/sum:0;
+        EXPECT_DOUBLE_EQ(closeness[i],expect);
+    }
+}
+//!test_msbfs_invalid:测试无效的参数
+/*!
+*
+* 空的图、无效的源点抛出异常
+*/
+TEST_F(MultiSourceBFSTest,test_msbfs_invalid)
+{
+    std::vector<int> invalid_sources={0,500};
+    EXPECT_THROW(multi_source_breadth_first_search(std::shared_ptr<GType>(),_sources),std::invalid_argument);
+    EXPECT_THROW(multi_source_breadth_first_search(_graph,invalid_sources),std::invalid_argument);
+    invalid_sources={-1};
+    EXPECT_THROW(closeness_centrality(_graph,invalid_sources),std::invalid_argument);
+}
+#endif // MULTISOURCEBFS_TEST
@@ -0,0 +1,266 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef PARALLELBFS
+#define PARALLELBFS
+#include <memory>
+#include <vector>
+#include <atomic>
+#include <limits>
+#include <algorithm>
+#include <stdexcept>
+#include <cstdint>
+#include "../../../header.h"
+#include "../../../parallel_algorithms/parallel_for/parallelfor.h"
+namespace IntroductionToAlgorithm
+{
+    namespace GraphAlgorithm
+    {
+        //!ParallelBFSResult：并行广度优先搜索的结果
+        /*!
+        * 三个数组都以顶点`id`为下标（`order`除外）：
+        *
+        * - `distance`：源点到各顶点的最短路径距离（边数）。不可达的顶点为`unlimit<VIDType>()`
+        * - `parent`：各顶点在广度优先树中的父结点`id`。源点、不可达的顶点为-1
+        * - `order`：所有可达顶点按照被发现的次序排列，与`breadth_first_search`调用`pre_action`的次序相同
+        */
+        template<typename VIDType> struct ParallelBFSResult
+        {
+            std::vector<VIDType> distance;  /*!< 源点到各顶点的距离*/
+            std::vector<VIDType> parent;    /*!< 各顶点的父结点`id`*/
+            std::vector<VIDType> order;     /*!< 顶点被发现的次序*/
+        };
+
+        //!parallel_breadth_first_search：方向优化的并行广度优先搜索
+        /*!
+        * \param graph:指向图的强引用，必须非空。若为空则抛出异常
+        * \param source_id：广度优先搜索的源点`id`，必须有效。若无效则抛出异常
+        * \param thread_num：线程数量。若为0则使用硬件支持的并发线程数量
+        * \param alpha：由自顶向下切换到自底向上的参数。当 m_f*alpha > m_u 时切换，其中 m_f 为当前边界出发的边数， m_u 为未访问顶点出发的边数。为0时始终自顶向下。默认为14
+        * \param beta：由自底向上切换回自顶向下的参数。当边界顶点数 n_f*beta < |V| 且边界在缩小时切换。默认为24
+        * \return: `ParallelBFSResult`，同时结果写回到顶点：`key`为距离，`parent`为父结点，可达顶点为黑色，不可达顶点为白色
+        *
+        * 算法逐层推进（level-synchronous）。第 d 层的边界为所有距离为 d 的顶点，按照它们被发现的次序排列。每一层选择以下两种方式之一计算第 d+1 层：
+        *
+        * - 自顶向下：各线程并行扫描边界顶点`u`的出边`(u,v)`；若`v`尚未被访问，则用原子操作把`v`的候选父结点更新为次序更靠前的`u`，
+        *   并用原子的`fetch_or`在访问位图上认领`v`
+        * - 自底向上：各线程并行扫描所有未访问的顶点`v`的入边`(u,v)`（基于图的转置），在属于边界的`u`中选取次序最靠前的一个作为父结点。
+        *   当边界很大时，这样避免了对已访问顶点的大量无效检查和原子竞争
+        *
+        * 两种方式的选择采用 Beamer 的启发式规则（见`alpha`、`beta`）。图的转置在第一次自底向上时才构建。
+        *
+        * 顺序的`breadth_first_search`中，顶点`v`的父结点是队列中第一个与`v`相邻的上一层顶点，而第 d+1 层的入队次序是按照父结点的次序、同一父结点内按照邻接次序排列的。
+        * 由于各种图的`neighbors`都按照顶点`id`递增排列，因此每一层结束时按照（父结点次序，顶点`id`）对新发现的顶点排序，就得到与顺序版本完全相同的次序、距离和父结点。
+        *
+        * 内部使用以`id`为下标的数组和压缩稀疏行邻接表，不通过`std::shared_ptr`访问顶点；只在最后一次性写回顶点。
+        *
+        * 算法的时间复杂度为 O(E+V)（加上每层排序的开销）
+        */
+        template<typename GraphType>
+        ParallelBFSResult<typename GraphType::VIDType> parallel_breadth_first_search(std::shared_ptr<GraphType> graph,
+                      typename GraphType::VIDType source_id,std::size_t thread_num=0,std::size_t alpha=14,std::size_t beta=24)
+        {
+            typedef typename GraphType::VertexType VertexType;
+            typedef typename GraphType::VIDType VIDType;
+            typedef typename VertexType::KeyType KeyType;
+            using IntroductionToAlgorithm::ParallelAlgorithm::parallel_blocks;
+            using IntroductionToAlgorithm::ParallelAlgorithm::parallel_for;
+
+            if(!graph)
+                throw std::invalid_argument("parallel_breadth_first_search error: graph must not be nullptr!");
+            if(source_id<0||static_cast<std::size_t>(source_id)>=graph->vertexes.size()||!graph->vertexes.at(source_id))
+                throw std::invalid_argument("parallel_breadth_first_search error: source_id muse belongs [0,N) and graph->vertexes[source_id] must not be nullptr!");
+
+            const std::size_t num=graph->vertexes.size();
+            const std::size_t threads=ParallelAlgorithm::thread_num_or_default(thread_num);
+            const std::size_t NO_RANK=std::numeric_limits<std::size_t>::max();
+            const VIDType UNREACHED=unlimit<VIDType>();
+
+            //************* 构建压缩稀疏行邻接表 ****************
+            std::vector<std::size_t> offsets(num+1,0);
+            parallel_for(0,num,threads,[&](std::size_t i){
+                std::size_t degree=0;
+                if(vertex_exists(graph->vertexes,i))
+                    for(const auto& neighbor:graph->neighbors(i)) {(void)neighbor;degree++;}
+                offsets[i+1]=degree;
+            });
+            for(std::size_t i=0;i<num;i++) offsets[i+1]+=offsets[i];
+            std::vector<VIDType> targets(offsets[num]);
+            parallel_for(0,num,threads,[&](std::size_t i){
+                if(!vertex_exists(graph->vertexes,i)) return;
+                std::size_t k=offsets[i];
+                for(const auto& neighbor:graph->neighbors(i)) targets[k++]=neighbor.first;
+            });
+            std::vector<std::size_t> in_offsets;        //图的转置，第一次自底向上时构建
+            std::vector<VIDType> in_targets;
+            auto build_inverse=[&](){
+                std::unique_ptr<std::atomic<std::size_t>[]> cursor(new std::atomic<std::size_t>[num+1]);
+                for(std::size_t i=0;i<=num;i++) cursor[i].store(0,std::memory_order_relaxed);
+                parallel_for(0,targets.size(),threads,[&](std::size_t k){cursor[targets[k]+1].fetch_add(1,std::memory_order_relaxed);});
+                in_offsets.assign(num+1,0);
+                for(std::size_t i=0;i<num;i++)
+                {
+                    in_offsets[i+1]=in_offsets[i]+cursor[i+1].load(std::memory_order_relaxed);
+                    cursor[i].store(in_offsets[i],std::memory_order_relaxed);
+                }
+                in_targets.resize(targets.size());
+                parallel_for(0,num,threads,[&](std::size_t u){
+                    for(std::size_t k=offsets[u];k<offsets[u+1];k++)
+                        in_targets[cursor[targets[k]].fetch_add(1,std::memory_order_relaxed)]=u;
+                });
+            };
+
+            //************* 初始化 ****************
+            ParallelBFSResult<VIDType> result;
+            result.distance.assign(num,UNREACHED);
+            result.parent.assign(num,-1);
+            result.order.reserve(num);
+            std::vector<std::size_t> rank(num,NO_RANK);                                         //顶点被发现的次序
+            std::unique_ptr<std::atomic<std::size_t>[]> candidate(new std::atomic<std::size_t>[num]); //候选父结点的次序
+            const std::size_t words=(num+63)/64;
+            std::unique_ptr<std::atomic<std::uint64_t>[]> visited(new std::atomic<std::uint64_t>[words]); //访问位图
+            parallel_for(0,num,threads,[&](std::size_t i){candidate[i].store(NO_RANK,std::memory_order_relaxed);});
+            for(std::size_t i=0;i<words;i++) visited[i].store(0,std::memory_order_relaxed);
+            auto claim=[&](std::size_t v)->bool{                                                //在访问位图上认领顶点，返回是否由本次调用认领
+                std::uint64_t mask=std::uint64_t(1)<<(v%64);
+                return !(visited[v/64].fetch_or(mask,std::memory_order_relaxed)&mask);
+            };
+
+            claim(source_id);
+            result.distance[source_id]=0;
+            rank[source_id]=0;
+            result.order.push_back(source_id);
+
+            std::size_t level_begin=0;
+            VIDType level=0;
+            std::size_t edges_frontier=offsets[source_id+1]-offsets[source_id];                 // m_f
+            std::size_t edges_unvisited=offsets[num]-edges_frontier;                            // m_u
+            std::size_t last_frontier_size=0;
+            bool bottom_up=false;
+            std::vector<std::vector<std::pair<std::size_t,VIDType>>> founds(threads);           //每个块新发现的顶点：（父结点次序，顶点）
+            while(level_begin<result.order.size())
+            {
+                const std::size_t level_end=result.order.size();
+                const std::size_t frontier_size=level_end-level_begin;
+                //********** 方向选择 ************
+                if(!bottom_up)
+                {
+                    if(alpha&&edges_frontier*alpha>edges_unvisited) bottom_up=true;
+                }else if(frontier_size*beta<num&&frontier_size<last_frontier_size)
+                    bottom_up=false;
+                last_frontier_size=frontier_size;
+                for(auto& found:founds) found.clear();
+
+                if(!bottom_up)
+                {
+                    //********** 自顶向下 ************
+                    parallel_blocks(level_begin,level_end,threads,[&](std::size_t begin,std::size_t end,std::size_t index){
+                        auto& found=founds[index];
+                        for(std::size_t r=begin;r<end;r++)
+                        {
+                            VIDType u=result.order[r];
+                            for(std::size_t k=offsets[u];k<offsets[u+1];k++)
+                            {
+                                VIDType v=targets[k];
+                                if(result.distance[v]!=UNREACHED) continue;                     //在之前的层中已访问
+                                std::size_t old=candidate[v].load(std::memory_order_relaxed);
+                                while(r<old&&!candidate[v].compare_exchange_weak(old,r,std::memory_order_relaxed));
+                                if(claim(v)) found.push_back(std::make_pair(NO_RANK,v));
+                            }
+                        }
+                    },64);
+                }else
+                {
+                    //********** 自底向上 ************
+                    if(in_offsets.empty()) build_inverse();
+                    parallel_blocks(0,num,threads,[&](std::size_t begin,std::size_t end,std::size_t index){
+                        auto& found=founds[index];
+                        for(std::size_t v=begin;v<end;v++)
+                        {
+                            if(result.distance[v]!=UNREACHED) continue;
+                            std::size_t best=NO_RANK;
+                            for(std::size_t k=in_offsets[v];k<in_offsets[v+1];k++)
+                            {
+                                VIDType u=in_targets[k];
+                                if(result.distance[u]==level&&rank[u]<best) best=rank[u];    //u属于边界
+                            }
+                            if(best!=NO_RANK)
+                            {
+                                candidate[v].store(best,std::memory_order_relaxed);
+                                claim(v);
+                                found.push_back(std::make_pair(NO_RANK,v));
+                            }
+                        }
+                    },1024);
+                }
+                //********** 按照（父结点次序，顶点id）排序新发现的顶点 ************
+                parallel_for(0,founds.size(),threads,[&](std::size_t index){
+                    for(auto& item:founds[index])
+                        item.first=candidate[item.second].load(std::memory_order_relaxed);
+                    std::sort(founds[index].begin(),founds[index].end());
+                },1);
+                std::vector<std::pair<std::size_t,VIDType>> next;
+                for(const auto& found:founds)
+                {
+                    std::size_t middle=next.size();
+                    next.insert(next.end(),found.begin(),found.end());
+                    std::inplace_merge(next.begin(),next.begin()+middle,next.end());
+                }
+                //********** 记录新的一层 ************
+                result.order.resize(level_end+next.size());
+                std::vector<std::size_t> degree_sums(threads,0);
+                parallel_blocks(0,next.size(),threads,[&](std::size_t begin,std::size_t end,std::size_t index){
+                    std::size_t degree_sum=0;
+                    for(std::size_t i=begin;i<end;i++)
+                    {
+                        VIDType v=next[i].second;
+                        result.order[level_end+i]=v;
+                        rank[v]=level_end+i;
+                        result.distance[v]=level+1;
+                        result.parent[v]=result.order[next[i].first];
+                        degree_sum+=offsets[v+1]-offsets[v];
+                    }
+                    degree_sums[index]=degree_sum;
+                });
+                edges_frontier=0;
+                for(auto degree_sum:degree_sums) edges_frontier+=degree_sum;
+                edges_unvisited-=edges_frontier;
+                level_begin=level_end;
+                level++;
+            }
+
+            //************* 写回顶点 ****************
+            parallel_for(0,num,threads,[&](std::size_t i){
+                auto vertex=graph->vertexes[i];
+                if(!vertex) return;
+                if(result.distance[i]==UNREACHED)
+                {
+                    vertex->key=unlimit<KeyType>();
+                    vertex->color=VertexType::COLOR::WHITE;
+                }else
+                {
+                    vertex->key=result.distance[i];
+                    vertex->color=VertexType::COLOR::BLACK;
+                }
+                vertex->parent=result.parent[i]>=0?graph->vertexes[result.parent[i]]:std::shared_ptr<VertexType>();
+            });
+            return result;
+        }
+    }
+}
+#endif // PARALLELBFS
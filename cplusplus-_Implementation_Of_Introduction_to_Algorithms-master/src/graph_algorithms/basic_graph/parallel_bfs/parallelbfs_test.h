@@ -0,0 +1,150 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef PARALLELBFS_TEST
+#define PARALLELBFS_TEST
+#include <random>
+#include <set>
+#include "../../../google_test/gtest.h"
+#include "parallelbfs.h"
+#include "../graph_bfs/bfs.h"
+#include "../graph_representation/graph/graph.h"
+#include "../graph_representation/csr_graph/csrgraph.h"
+#include "../graph_representation/graph_vertex/bfs_vertex.h"
+
+using IntroductionToAlgorithm::GraphAlgorithm::Graph;
+using IntroductionToAlgorithm::GraphAlgorithm::CSRGraph;
+using IntroductionToAlgorithm::GraphAlgorithm::BFS_Vertex;
+using IntroductionToAlgorithm::GraphAlgorithm::breadth_first_search;
+using IntroductionToAlgorithm::GraphAlgorithm::parallel_breadth_first_search;
+
+//!ParallelBFSTest:测试类，用于为测试提供基础数据
+/*!
+*
+* `ParallelBFSTest`是 `::testing::Test` 的子类。它主要用于为每一个`TEST_F`准备测试环境
+*/
+class ParallelBFSTest:public ::testing::Test
+{
+public:
+typedef CSRGraph<BFS_Vertex<int>> GType; /*!< 模板实例化的图类型，该图的顶点类型为`BFS_Vertex<int>`*/
+typedef GType::EdgeTupleType EdgeTupleType; /*!< 边的三元素元组类型*/
+protected:
+    void SetUp(){
+        //****  随机有向图：4000个顶点，约24000条边；顶点3999不可达   ****
+        const int num=4000;
+        std::mt19937 gen(20160101);
+        std::uniform_int_distribution<int> dist(0,num-2);
+        std::set<std::pair<int,int>> edge_set;
+        while(edge_set.size()<24000)
+            edge_set.insert(std::make_pair(dist(gen),dist(gen)));
+        for(const auto& edge:edge_set)
+            _edges.push_back(std::make_tuple(edge.first,edge.second,1));
+        _graph=std::make_shared<GType>(num,_edges.begin(),_edges.end());
+        _sequential_graph=std::make_shared<GType>(num,_edges.begin(),_edges.end());
+        breadth_first_search(_sequential_graph,0,[this](int id){_sequential_order.push_back(id);});
+    }
+    void TearDown(){}
+
+    //!_expect_same：检查并行搜索的结果与顺序搜索的结果相同
+    void _expect_same(const IntroductionToAlgorithm::GraphAlgorithm::ParallelBFSResult<int>& result)
+    {
+        EXPECT_EQ(result.order,_sequential_order);
+        for(std::size_t i=0;i<_graph->vertexes.size();i++)
+        {
+            auto vertex=_graph->vertexes[i];
+            auto sequential_vertex=_sequential_graph->vertexes[i];
+            EXPECT_EQ(vertex->key,sequential_vertex->key)<<"i:"<<i;
+            EXPECT_EQ(vertex->color,sequential_vertex->color)<<"i:"<<i;
+            EXPECT_EQ(result.distance[i],sequential_vertex->key)<<"i:"<<i;
+            if(sequential_vertex->parent)
+            {
+                EXPECT_EQ(result.parent[i],sequential_vertex->parent->id)<<"i:"<<i;
+                EXPECT_EQ(vertex->parent,_graph->vertexes[sequential_vertex->parent->id])<<"i:"<<i;
+            }else
+            {
+                EXPECT_EQ(result.parent[i],-1)<<"i:"<<i;
+                EXPECT_FALSE(vertex->parent)<<"i:"<<i;
+            }
+        }
+    }
+
+    std::vector<EdgeTupleType> _edges;          /*!< 图的边*/
+    std::shared_ptr<GType> _graph;              /*!< 执行并行搜索的图*/
+    std::shared_ptr<GType> _sequential_graph;   /*!< 执行顺序搜索的图*/
+    std::vector<int> _sequential_order;         /*!< 顺序搜索发现顶点的次序*/
+};
+
+//!parallelbfs_test:parallel_breadth_first_search
+/*!
+*
+* 测试参数无效时抛出异常
+*/
+TEST_F(ParallelBFSTest,test_invalid)
+{
+    EXPECT_THROW(parallel_breadth_first_search(std::shared_ptr<GType>(),0),std::invalid_argument);
+    EXPECT_THROW(parallel_breadth_first_search(_graph,-1),std::invalid_argument);
+    EXPECT_THROW(parallel_breadth_first_search(_graph,_graph->vertex_num()),std::invalid_argument);
+}
+//!parallelbfs_test:parallel_breadth_first_search
+/*!
+*
+* 测试只采用自顶向下、只采用自底向上以及方向优化时，不同线程数量下的结果都与`breadth_first_search`相同
+*/
+TEST_F(ParallelBFSTest,test_same_as_sequential)
+{
+    for(std::size_t thread_num:{1,2,4})
+    {
+        _expect_same(parallel_breadth_first_search(_graph,0,thread_num,0));           //始终自顶向下
+        _expect_same(parallel_breadth_first_search(_graph,0,thread_num,1000000,0));   //尽可能自底向上
+        _expect_same(parallel_breadth_first_search(_graph,0,thread_num));             //方向优化
+    }
+}
+//!parallelbfs_test:parallel_breadth_first_search
+/*!
+*
+* 测试作用于`Graph`：含不存在的顶点的图
+*/
+TEST_F(ParallelBFSTest,test_graph)
+{
+    typedef Graph<10,BFS_Vertex<int>> SmallGraphType;
+    auto graph=std::make_shared<SmallGraphType>(-1);
+    auto sequential_graph=std::make_shared<SmallGraphType>(-1);
+    for(int i=0;i<8;i++)                    //顶点8、9不存在
+    {
+        graph->add_vertex(0);
+        sequential_graph->add_vertex(0);
+    }
+    std::vector<SmallGraphType::EdgeTupleType> edges({std::make_tuple(0,3,1),std::make_tuple(0,1,1),std::make_tuple(1,4,1),
+        std::make_tuple(3,4,1),std::make_tuple(3,2,1),std::make_tuple(4,5,1),std::make_tuple(2,5,1),std::make_tuple(6,7,1)});
+    graph->add_edges(edges.begin(),edges.end());
+    sequential_graph->add_edges(edges.begin(),edges.end());
+    std::vector<int> sequential_order;
+    breadth_first_search(sequential_graph,0,[&sequential_order](int id){sequential_order.push_back(id);});
+    for(std::size_t alpha:{0,1000000})
+    {
+        auto result=parallel_breadth_first_search(graph,0,2,alpha,0);
+        EXPECT_EQ(result.order,sequential_order);
+        EXPECT_EQ(result.parent[5],4);      //4在队列中先于2
+        for(int i=0;i<8;i++)
+        {
+            EXPECT_EQ(graph->vertexes[i]->key,sequential_graph->vertexes[i]->key)<<"i:"<<i;
+            EXPECT_EQ(result.distance[i],sequential_graph->vertexes[i]->key)<<"i:"<<i;
+        }
+    }
+}
+#endif // PARALLELBFS_TEST
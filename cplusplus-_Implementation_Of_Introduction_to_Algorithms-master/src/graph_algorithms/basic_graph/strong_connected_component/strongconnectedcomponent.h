@@ -20,6 +20,8 @@
 #define STRONGCONNECTEDCOMPONENT
 #include"../graph_dfs/dfs.h"
 #include<set>
+#include<vector>
+#include<algorithm>
 namespace IntroductionToAlgorithm
 {
     namespace GraphAlgorithm
@@ -73,6 +75,128 @@ namespace IntroductionToAlgorithm
                     real_result.push_back(item);
             return real_result;
         }
+
+        //!tarjan_scc_labels：强连通分量的Tarjan算法，计算每个顶点所属的强连通分量
+        /*!
+        * \param graph:指向图的强引用，必须非空。若为空则抛出异常
+        * \param labels:输出参数，大小被设置为顶点的最大容量。`labels[v]`为顶点v所属的强连通分量的编号；若顶点v不存在则为-1
+        * \return:强连通分量的数量（包括只有一个顶点的强连通分量）
+        *
+        * 强连通分量的编号为`[0,返回值)`，且它们按照分量图的拓扑次序编号：若存在边(u,v)，则`labels[u]<=labels[v]`。
+        *
+        * Tarjan算法只需要一次深度优先搜索，不需要转置图。深度优先搜索中每个顶点v记录两个整数：
+        *
+        * - index(v)：v被发现的次序
+        * - lowlink(v)：从v出发，经过深度优先树中v的后代以及至多一条指向栈中顶点的边，所能到达的顶点的最小index
+        *
+        * 被发现的顶点依次压入一个栈中。当v完成时，若lowlink(v)==index(v)，则v是一个强连通分量的根，栈中v及其之上的顶点就构成这个强连通分量。
+        * 强连通分量按照这种方式被找到的次序，是分量图的逆拓扑次序。
+        *
+        * 与`scc`不同，本实现：
+        *
+        * - 用一个显式的栈代替递归，栈中每一项保存顶点以及它的邻接边区间的当前位置。因此深度很大的图不会导致调用栈溢出
+        * - index、lowlink等状态保存在整数数组中，不修改图的顶点，也不需要顶点为`DFS_Vertex`
+        * - 除了与顶点数量成正比的几个数组之外，不分配内存
+        *
+        * 性能：时间复杂度O(V+E)
+        *
+        */
+        template<typename GraphType> std::size_t tarjan_scc_labels(std::shared_ptr<GraphType> graph,std::vector<int>& labels)
+        {
+            typedef typename GraphType::VIDType VIDType;
+            typedef typename GraphType::NeighborRangeType::iterator NeighborIterator;
+            //!Frame：显式栈中的一项
+            struct Frame
+            {
+                VIDType v;              /*!< 顶点*/
+                NeighborIterator next;  /*!< 下一条待搜索的边*/
+                NeighborIterator end;   /*!< 边区间的终止位置*/
+            };
+            if(!graph)
+                throw std::invalid_argument("tarjan_scc_labels error: graph must not be nullptr!");
+            const std::size_t num=graph->vertexes.size();
+            std::vector<int> index(num,-1),lowlink(num,0);
+            std::vector<char> on_stack(num,0);
+            std::vector<VIDType> vertex_stack;
+            std::vector<Frame> frames;
+            vertex_stack.reserve(num);
+            labels.assign(num,-1);
+            int counter=0;
+            std::size_t component_num=0;
+            auto discover=[&](VIDType v){
+                index[v]=lowlink[v]=counter++;
+                vertex_stack.push_back(v);
+                on_stack[v]=1;
+                auto range=graph->neighbors(v);
+                frames.push_back(Frame{v,range.begin(),range.end()});
+            };
+            for(std::size_t root=0;root<num;root++)
+            {
+                if(!vertex_exists(graph->vertexes,root)||index[root]>=0) continue;
+                discover(root);
+                while(!frames.empty())
+                {
+                    Frame& frame=frames.back();
+                    VIDType v=frame.v;
+                    if(frame.next!=frame.end)
+                    {
+                        VIDType w=(*frame.next).first;
+                        ++frame.next;
+                        if(index[w]<0)
+                            discover(w);                                //相当于递归调用，frame 此后失效
+                        else if(on_stack[w])
+                            lowlink[v]=std::min(lowlink[v],index[w]);
+                        continue;
+                    }
+                    //**********  v 完成  ***********
+                    frames.pop_back();
+                    if(lowlink[v]==index[v])                            //v 是强连通分量的根
+                    {
+                        VIDType w;
+                        do{
+                            w=vertex_stack.back();
+                            vertex_stack.pop_back();
+                            on_stack[w]=0;
+                            labels[w]=component_num;
+                        }while(w!=v);
+                        component_num++;
+                    }
+                    if(!frames.empty())
+                    {
+                        VIDType u=frames.back().v;
+                        lowlink[u]=std::min(lowlink[u],lowlink[v]);
+                    }
+                }
+            }
+            //********** 逆拓扑次序的编号转换为拓扑次序的编号  *************
+            for(auto& label:labels)
+                if(label>=0) label=component_num-1-label;
+            return component_num;
+        }
+        //!tarjan_scc：强连通分量的Tarjan算法
+        /*!
+        * \param graph:指向图的强引用，必须非空。若为空则抛出异常
+        * \return:强连通分量的`std::vector`，每一个强连通分量，由一组顶点`id`组成的`std::vector`表示。
+        *
+        * 与`scc`的返回值格式相同：只包含顶点数量大于1的强连通分量。强连通分量之间按照分量图的拓扑次序排列，每个强连通分量中的顶点按照`id`从小到大排列。
+        *
+        * 它是`tarjan_scc_labels`的包装。
+        *
+        * 性能：时间复杂度O(V+E)
+        */
+        template<typename GraphType> std::vector<std::vector<typename GraphType::VIDType>> tarjan_scc(std::shared_ptr<GraphType> graph)
+        {
+            std::vector<int> labels;
+            std::size_t component_num=tarjan_scc_labels(graph,labels);
+            std::vector<std::vector<typename GraphType::VIDType>> components(component_num);
+            for(std::size_t v=0;v<labels.size();v++)
+                if(labels[v]>=0) components[labels[v]].push_back(v);
+            std::vector<std::vector<typename GraphType::VIDType>> result;
+            for(auto& component:components)
+                if(component.size()>1)
+                    result.push_back(std::move(component));
+            return result;
+        }
     }
 }
 #endif // STRONGCONNECTEDCOMPONENT
@@ -22,9 +22,16 @@
 #include "strongconnectedcomponent.h"
 #include "../../../graph_algorithms/basic_graph/graph_representation/graph/graph.h"
 #include "../../../graph_algorithms/basic_graph/graph_representation/graph_vertex/dfs_vertex.h"
+#include "../../../graph_algorithms/basic_graph/graph_representation/graph_vertex/vertex.h"
+#include "../../../graph_algorithms/basic_graph/graph_representation/csr_graph/csrgraph.h"
+#include <random>
 using IntroductionToAlgorithm::GraphAlgorithm::Graph;
 using IntroductionToAlgorithm::GraphAlgorithm::DFS_Vertex;
+using IntroductionToAlgorithm::GraphAlgorithm::CSRGraph;
+using IntroductionToAlgorithm::GraphAlgorithm::Vertex;
 using IntroductionToAlgorithm::GraphAlgorithm::scc;
+using IntroductionToAlgorithm::GraphAlgorithm::tarjan_scc;
+using IntroductionToAlgorithm::GraphAlgorithm::tarjan_scc_labels;
 
 namespace {
     const int SCC_N= 10;  /*!< 测试的图顶点数量*/
@@ -89,5 +96,66 @@ TEST_F(SCCTest,test_scc)
     EXPECT_EQ(scc_vertexes,real_vertexes);
 
 }
+
+//!test_tarjan_scc:测试tarjan_scc、tarjan_scc_labels方法
+/*!
+*
+* 在测试图以及随机图上，`tarjan_scc`与`scc`给出相同的强连通分量；`tarjan_scc_labels`的编号满足分量图的拓扑次序
+*/
+TEST_F(SCCTest,test_tarjan_scc)
+{
+    typedef  DFS_Vertex<double>::VIDType VIDType;
+    typedef std::vector<std::vector<VIDType>> ResultType;
+    //!sorted：将每个强连通分量中的顶点排序，然后将强连通分量排序
+    auto sorted=[](ResultType result){
+        for(auto& component:result)
+            std::sort(component.begin(),component.end());
+        std::sort(result.begin(),result.end());
+        return result;
+    };
+    EXPECT_EQ(tarjan_scc(_list_graph).size(),0);
+    EXPECT_EQ(tarjan_scc(_scc_graph),sorted(scc(_scc_graph)));
+    std::mt19937 gen(225);
+    std::uniform_int_distribution<int> dist(0,SCC_N-1);
+    for(int round=0;round<50;round++)
+    {
+        auto graph=std::make_shared<GType>(-1);
+        for(int i=0;i<SCC_N;i++)
+            graph->add_vertex(0);
+        for(int k=0;k<SCC_N*3/2;k++)
+        {
+            int from=dist(gen),to=dist(gen);
+            if(!graph->has_edge(from,to)) graph->add_edge(std::make_tuple(from,to,1));
+        }
+        EXPECT_EQ(sorted(tarjan_scc(graph)),sorted(scc(graph)))<<"round:"<<round;
+        std::vector<int> labels;
+        std::size_t component_num=tarjan_scc_labels(graph,labels);
+        EXPECT_EQ(*std::max_element(labels.begin(),labels.end())+1,component_num);
+        for(const auto& edge:graph->edge_tuples())
+            EXPECT_LE(labels[std::get<0>(edge)],labels[std::get<1>(edge)])<<"round:"<<round;
+    }
+    EXPECT_THROW(tarjan_scc(std::shared_ptr<GType>()),std::invalid_argument);
+}
+//!test_tarjan_scc_deep:测试tarjan_scc_labels方法
+/*!
+*
+* 在一个很长的环上执行Tarjan算法：深度优先搜索的深度等于顶点数量，迭代实现不会导致调用栈溢出
+*/
+TEST_F(SCCTest,test_tarjan_scc_deep)
+{
+    const int num=200000;
+    typedef CSRGraph<Vertex<int>> CSRType;
+    std::vector<CSRType::EdgeTupleType> edges;
+    for(int i=0;i<num-1;i++)
+        edges.push_back(std::make_tuple(i,i+1,1));
+    edges.push_back(std::make_tuple(num-2,0,1));  //顶点 num-1 单独构成一个强连通分量
+    auto graph=std::make_shared<CSRType>(num,edges.begin(),edges.end(),-1);
+    std::vector<int> labels;
+    EXPECT_EQ(tarjan_scc_labels(graph,labels),2);
+    for(int i=0;i<num-1;i++)
+        EXPECT_EQ(labels[i],0);
+    EXPECT_EQ(labels[num-1],1);
+    EXPECT_EQ(tarjan_scc(graph).size(),1);
+}
 #endif // STRONGCONNECTEDCOMPONENT_TEST
 
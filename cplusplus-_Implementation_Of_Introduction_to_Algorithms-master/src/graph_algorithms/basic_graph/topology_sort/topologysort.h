@@ -21,6 +21,7 @@
 #include "../graph_dfs/dfs.h"
 #include <vector>
 #include <functional>
+#include <stdexcept>
 namespace IntroductionToAlgorithm
 {
     namespace GraphAlgorithm
@@ -57,6 +58,128 @@ namespace IntroductionToAlgorithm
             depth_first_search(graph,empty_action,finish_action,empty_action,empty_action);
             return sorted_result;
         }
+
+        //!iterative_topology_sort：拓扑排序的迭代实现
+        /*!
+        * \param graph:指向图的强引用，必须非空。若为空则抛出异常
+        * \return:拓扑排序结果，它是顶点`id`组成的`std::vector`，表示顶点的拓扑排序后的顺序
+        *
+        * 它与`topology_sort`的原理相同：按照顶点`id`从小到大选择深度优先森林的树根，将结点按照完成时间降序排列。对于有向无环图，两者的结果完全相同。区别在于：
+        *
+        * - 用一个显式的栈代替递归，栈中每一项保存顶点以及它的邻接边区间的当前位置。因此深度很大的图不会导致调用栈溢出
+        * - 顶点的颜色保存在一个字节数组中，不修改图的顶点，也不需要顶点为`DFS_Vertex`
+        * - 完成的结点从后往前直接写入结果数组，而不是插入到结果的头部（后者为 O(V^2)）
+        * - 若深度优先搜索遇到后向边（即图中有环），则抛出异常
+        *
+        * 性能：时间复杂度O(V+E)
+        *
+        */
+        template<typename GraphType> std::vector<typename GraphType::VIDType>
+        iterative_topology_sort(std::shared_ptr<GraphType> graph)
+        {
+            typedef typename GraphType::VIDType VIDType;
+            typedef typename GraphType::NeighborRangeType::iterator NeighborIterator;
+            //!Frame：显式栈中的一项
+            struct Frame
+            {
+                VIDType v;              /*!< 顶点*/
+                NeighborIterator next;  /*!< 下一条待搜索的边*/
+                NeighborIterator end;   /*!< 边区间的终止位置*/
+            };
+            enum Color:char{WHITE,GRAY,BLACK};
+            if(!graph)
+                throw std::invalid_argument("iterative_topology_sort error: graph must not be nullptr!");
+            const std::size_t num=graph->vertexes.size();
+            std::vector<char> color(num,WHITE);
+            std::size_t vertex_num=0;
+            for(const auto& vertex:graph->vertexes)
+                if(vertex) vertex_num++;
+            std::vector<VIDType> sorted_result(vertex_num);
+            std::size_t position=vertex_num;                        //下一个完成的结点写入 sorted_result[position-1]
+            std::vector<Frame> frames;
+            auto discover=[&](VIDType v){
+                color[v]=GRAY;
+                auto range=graph->neighbors(v);
+                frames.push_back(Frame{v,range.begin(),range.end()});
+            };
+            for(std::size_t root=0;root<num;root++)
+            {
+                if(!vertex_exists(graph->vertexes,root)||color[root]!=WHITE) continue;
+                discover(root);
+                while(!frames.empty())
+                {
+                    Frame& frame=frames.back();
+                    if(frame.next!=frame.end)
+                    {
+                        VIDType w=(*frame.next).first;
+                        ++frame.next;
+                        if(color[w]==WHITE)
+                            discover(w);
+                        else if(color[w]==GRAY)
+                            throw std::invalid_argument("iterative_topology_sort error: graph must be acyclic!");
+                        continue;
+                    }
+                    color[frame.v]=BLACK;
+                    sorted_result[--position]=frame.v;
+                    frames.pop_back();
+                }
+            }
+            return sorted_result;
+        }
+        //!kahn_topology_sort：拓扑排序的Kahn算法
+        /*!
+        * \param graph:指向图的强引用，必须非空。若为空则抛出异常
+        * \return:拓扑排序结果，它是顶点`id`组成的`std::vector`，表示顶点的拓扑排序后的顺序
+        *
+        * Kahn算法不需要深度优先搜索：
+        *
+        * - 计算每个顶点的入度，将入度为0的顶点压入栈中
+        * - 循环，条件为栈非空：弹出栈顶顶点u，将u追加到结果中，然后对u的每一条边(u,v)，将v的入度减1。若v的入度变为0，则将v压入栈中
+        *
+        * 若最终结果中的顶点数量少于图中顶点的数量，则图中有环（环上的顶点入度永远不会变为0），此时抛出异常。
+        *
+        * 初始时入度为0的顶点按照`id`从大到小压栈，因此`id`小的顶点先被弹出。入度、栈都保存在整数数组中，不修改图的顶点，也不需要顶点为`DFS_Vertex`。
+        * 结果是一个合法的拓扑排序，但不一定与`topology_sort`相同。
+        *
+        * 性能：时间复杂度O(V+E)
+        *
+        */
+        template<typename GraphType> std::vector<typename GraphType::VIDType>
+        kahn_topology_sort(std::shared_ptr<GraphType> graph)
+        {
+            typedef typename GraphType::VIDType VIDType;
+            if(!graph)
+                throw std::invalid_argument("kahn_topology_sort error: graph must not be nullptr!");
+            const std::size_t num=graph->vertexes.size();
+            std::vector<std::size_t> in_degree(num,0);
+            std::size_t vertex_num=0;
+            for(std::size_t u=0;u<num;u++)
+            {
+                if(!vertex_exists(graph->vertexes,u)) continue;
+                vertex_num++;
+                for(const auto& neighbor:graph->neighbors(u))
+                    in_degree[neighbor.first]++;
+            }
+            std::vector<VIDType> sorted_result;
+            std::vector<VIDType> stack;
+            sorted_result.reserve(vertex_num);
+            stack.reserve(vertex_num);
+            for(std::size_t u=num;u>0;u--)
+                if(vertex_exists(graph->vertexes,u-1)&&in_degree[u-1]==0)
+                    stack.push_back(u-1);
+            while(!stack.empty())
+            {
+                VIDType u=stack.back();
+                stack.pop_back();
+                sorted_result.push_back(u);
+                for(const auto& neighbor:graph->neighbors(u))
+                    if(--in_degree[neighbor.first]==0)
+                        stack.push_back(neighbor.first);
+            }
+            if(sorted_result.size()!=vertex_num)
+                throw std::invalid_argument("kahn_topology_sort error: graph must be acyclic!");
+            return sorted_result;
+        }
     }
 }
 
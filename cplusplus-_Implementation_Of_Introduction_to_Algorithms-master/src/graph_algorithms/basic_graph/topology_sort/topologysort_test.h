@@ -22,10 +22,17 @@
 #include"topologysort.h"
 #include"../../basic_graph/graph_representation/graph_vertex/dfs_vertex.h"
 #include"../../basic_graph/graph_representation/graph/graph.h"
+#include"../../basic_graph/graph_representation/csr_graph/csrgraph.h"
+#include"../../basic_graph/graph_representation/graph_vertex/vertex.h"
+#include<random>
 
 using IntroductionToAlgorithm::GraphAlgorithm::Graph;
+using IntroductionToAlgorithm::GraphAlgorithm::CSRGraph;
+using IntroductionToAlgorithm::GraphAlgorithm::Vertex;
 using IntroductionToAlgorithm::GraphAlgorithm::DFS_Vertex;
 using IntroductionToAlgorithm::GraphAlgorithm::topology_sort;
+using IntroductionToAlgorithm::GraphAlgorithm::iterative_topology_sort;
+using IntroductionToAlgorithm::GraphAlgorithm::kahn_topology_sort;
 
 namespace {
     const int TPS_N= 10;  /*!< 测试的图顶点数量*/
@@ -89,5 +96,66 @@ TEST_F(TopologySortTest,test_topology_sort)
     EXPECT_EQ(topology_sort(_list_graph),real_result);
 }
 
+//!test_iterative_topology_sort:测试iterative_topology_sort、kahn_topology_sort方法
+/*!
+*
+* 在测试图以及随机的有向无环图上，`iterative_topology_sort`的结果与`topology_sort`相同，`kahn_topology_sort`的结果是一个合法的拓扑排序；
+* 有环的图抛出异常
+*/
+TEST_F(TopologySortTest,test_iterative_topology_sort)
+{
+    typedef  DFS_Vertex<double>::VIDType VIDType;
+    for(const auto& graph:{_1v_graph,_1e_graph,_list_graph})
+    {
+        EXPECT_EQ(iterative_topology_sort(graph),topology_sort(graph));
+        EXPECT_EQ(kahn_topology_sort(graph),topology_sort(graph));
+    }
+    //****** 随机的有向无环图：边总是从 id 较小的顶点指向 id 较大的顶点 *****
+    std::mt19937 gen(22);
+    std::uniform_int_distribution<int> dist(0,TPS_N-1);
+    for(int round=0;round<20;round++)
+    {
+        auto graph=std::make_shared<GType>(-1);
+        for(int i=0;i<TPS_N;i++)
+            graph->add_vertex(0);
+        for(int k=0;k<TPS_N*2;k++)
+        {
+            int from=dist(gen),to=dist(gen);
+            if(from==to||graph->has_edge(std::min(from,to),std::max(from,to))) continue;
+            graph->add_edge(std::make_tuple(std::min(from,to),std::max(from,to),1));
+        }
+        EXPECT_EQ(iterative_topology_sort(graph),topology_sort(graph))<<"round:"<<round;
+        std::vector<VIDType> order=kahn_topology_sort(graph);
+        std::vector<int> position(TPS_N,-1);
+        for(std::size_t i=0;i<order.size();i++)
+            position[order[i]]=i;
+        for(const auto& edge:graph->edge_tuples())
+            EXPECT_LT(position[std::get<0>(edge)],position[std::get<1>(edge)])<<"round:"<<round;
+    }
+    //****** 有环的图  **********
+    _list_graph->add_edge(std::make_tuple(TPS_N-1,0,1));
+    EXPECT_THROW(iterative_topology_sort(_list_graph),std::invalid_argument);
+    EXPECT_THROW(kahn_topology_sort(_list_graph),std::invalid_argument);
+    EXPECT_THROW(iterative_topology_sort(std::shared_ptr<GType>()),std::invalid_argument);
+}
+//!test_iterative_topology_sort_deep:测试iterative_topology_sort、kahn_topology_sort方法
+/*!
+*
+* 在一条很长的链上执行拓扑排序：深度优先搜索的深度等于顶点数量，迭代实现不会导致调用栈溢出
+*/
+TEST_F(TopologySortTest,test_iterative_topology_sort_deep)
+{
+    const int num=200000;
+    typedef CSRGraph<Vertex<int>> CSRType;
+    std::vector<CSRType::EdgeTupleType> edges;
+    for(int i=num-1;i>0;i--)
+        edges.push_back(std::make_tuple(i,i-1,1));    //链条从右到左
+    auto graph=std::make_shared<CSRType>(num,edges.begin(),edges.end(),-1);
+    std::vector<int> real_result;
+    for(int i=num-1;i>=0;i--)
+        real_result.push_back(i);
+    EXPECT_EQ(iterative_topology_sort(graph),real_result);
+    EXPECT_EQ(kahn_topology_sort(graph),real_result);
+}
 #endif // TOPOLOGYSORT_TEST
 
@@ -0,0 +1,636 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef GRAPHBENCHMARK
+#define GRAPHBENCHMARK
+#include<vector>
+#include<string>
+#include<memory>
+#include<chrono>
+#include<fstream>
+#include<ostream>
+#include<sstream>
+#include<iomanip>
+#include<functional>
+#include<algorithm>
+#include<queue>
+#include<sys/resource.h>
+#include"../../header.h"
+#include"../graph_generator/graphgenerator.h"
+#include"../basic_graph/graph_representation/csr_graph/csrgraph.h"
+#include"../basic_graph/graph_representation/graph_vertex/vertex.h"
+#include"../basic_graph/graph_representation/graph_vertex/bfs_vertex.h"
+#include"../basic_graph/graph_representation/graph_vertex/dfs_vertex.h"
+#include"../basic_graph/graph_representation/graph_vertex/vertexp.h"
+#include"../basic_graph/graph_representation/graph_vertex/set_vertex.h"
+#include"../basic_graph/graph_bfs/bfs.h"
+#include"../basic_graph/parallel_bfs/parallelbfs.h"
+#include"../basic_graph/multi_source_bfs/multisourcebfs.h"
+#include"../basic_graph/graph_reordering/graphreordering.h"
+#include"../basic_graph/graph_dfs/dfs.h"
+#include"../basic_graph/strong_connected_component/strongconnectedcomponent.h"
+#include"../single_source_shortest_path/dijkstra/dijkstra.h"
+#include"../single_source_shortest_path/bellman_ford/bellmanford.h"
+#include"../single_source_shortest_path/delta_stepping/deltastepping.h"
+#include"../single_source_shortest_path/shortest_path_query/shortestpathquery.h"
+#include"../single_source_shortest_path/contraction_hierarchy/contractionhierarchy.h"
+#include"../single_source_shortest_path/dag_shortest_path/dagshortpath.h"
+#include"../single_source_shortest_path/dag_shortest_path/dagschedule.h"
+#include"../all_node_pair_shortest_path/floyd_warshall/floyd_warshall.h"
+#include"../all_node_pair_shortest_path/johnson/johnson.h"
+#include"../all_node_pair_shortest_path/matrix_shortest_path/matrix_shortest_path.h"
+#include"../minimum_spanning_tree/kruskal/kruskal.h"
+#include"../minimum_spanning_tree/prim/prim.h"
+#include"../minimum_spanning_tree/boruvka/boruvka.h"
+#include"../max_flow/dinic/dinic.h"
+#include"../max_flow/highest_label_push_relabel/highestlabelpushrelabel.h"
+namespace IntroductionToAlgorithm
+{
+    namespace GraphAlgorithm
+    {
+        //!BenchmarkRecord：一次计时的结果
+        struct BenchmarkRecord
+        {
+            std::string graph;          /*!< 图的名字，如`rmat-16`*/
+            std::size_t vertex_num;     /*!< 顶点数量*/
+            std::size_t edge_num;       /*!< 边的数量*/
+            std::string algorithm;      /*!< 算法的名字*/
+            std::size_t thread_num;     /*!< 线程数量*/
+            bool skipped;               /*!< 是否因规模超过限制而跳过*/
+            double seconds;             /*!< 运行时间（秒）*/
+            double edges_per_second;    /*!< 每秒处理的边数：edge_num/seconds*/
+            long peak_rss_kb;           /*!< 运行期间进程的峰值常驻内存（KB）*/
+            long long result;           /*!< 算法结果的摘要（如最短路径长度之和、最小生成树的权重），用于发现结果的变化*/
+        };
+
+        //!BenchmarkOptions：基准测试的选项
+        struct BenchmarkOptions
+        {
+            //!默认构造函数
+            BenchmarkOptions():thread_num(1),dense_limit(2048),bellman_ford_limit(1<<16),contraction_degree_limit(64){}
+            std::size_t thread_num;                 /*!< 并行算法使用的线程数量，0表示使用硬件支持的并发线程数量*/
+            std::size_t dense_limit;                /*!< 顶点数量超过它时跳过 O(V^2) 空间的`floyd_warshall`、`johnson`*/
+            std::size_t bellman_ford_limit;         /*!< 顶点数量超过它时跳过 O(VE) 的`bellman_ford`*/
+            std::size_t contraction_degree_limit;   /*!< 顶点的最大出度超过它时跳过收缩层次（其预处理在度数很大的图上太慢）*/
+            std::vector<std::string> algorithms;    /*!< 只运行这些算法；为空表示运行全部算法*/
+        };
+
+        //!reset_peak_rss:将进程的峰值常驻内存重置为当前的常驻内存
+        /*!
+        * \return: 是否重置成功
+        *
+        * 向`/proc/self/clear_refs`写入`5`（Linux 4.0 及以上）。不支持时返回`false`，此后`peak_rss_kb`给出的是进程启动以来的峰值
+        */
+        inline bool reset_peak_rss()
+        {
+            std::ofstream out("/proc/self/clear_refs");
+            if(!out) return false;
+            out<<"5";
+            out.flush();
+            return bool(out);
+        }
+        //!peak_rss_kb:返回进程的峰值常驻内存（KB）
+        /*!
+        * \return: 读取`/proc/self/status`中的`VmHWM`；不支持时返回`getrusage`给出的`ru_maxrss`
+        */
+        inline long peak_rss_kb()
+        {
+            std::ifstream in("/proc/self/status");
+            std::string line;
+            while(std::getline(in,line))
+                if(line.compare(0,6,"VmHWM:")==0)
+                    return std::stol(line.substr(6));
+            struct rusage usage;
+            getrusage(RUSAGE_SELF,&usage);
+            return usage.ru_maxrss;
+        }
+
+        //!benchmark_csv:以CSV格式输出基准测试的结果
+        /*!
+        * \param records:基准测试的结果
+        * \param out:输出流
+        * \return: void
+        *
+        * 第一行为表头，之后每条记录一行。被跳过的记录`skipped`列为1，时间等列为0
+        */
+        inline void benchmark_csv(const std::vector<BenchmarkRecord>& records,std::ostream& out)
+        {
+            out<<"graph,vertices,edges,algorithm,threads,skipped,seconds,edges_per_second,peak_rss_kb,result\n";
+            for(const auto& record:records)
+                out<<record.graph<<","<<record.vertex_num<<","<<record.edge_num<<","<<record.algorithm<<","
+                   <<record.thread_num<<","<<int(record.skipped)<<","<<std::setprecision(6)<<record.seconds<<","
+                   <<std::setprecision(6)<<record.edges_per_second<<","<<record.peak_rss_kb<<","<<record.result<<"\n";
+        }
+        //!benchmark_json:以JSON格式输出基准测试的结果
+        /*!
+        * \param records:基准测试的结果
+        * \param out:输出流
+        * \return: void
+        *
+        * 输出一个JSON数组，每条记录是一个对象，键与`benchmark_csv`的表头相同
+        */
+        inline void benchmark_json(const std::vector<BenchmarkRecord>& records,std::ostream& out)
+        {
+            auto quote=[](const std::string& str)
+            {
+                std::string result="\"";
+                for(char ch:str)
+                {
+                    if(ch=='"'||ch=='\\') result+='\\';
+                    result+=ch;
+                }
+                return result+"\"";
+            };
+            out<<"[";
+            for(std::size_t i=0;i<records.size();i++)
+            {
+                const auto& record=records[i];
+                out<<(i?",\n ":"\n ")<<"{\"graph\":"<<quote(record.graph)<<",\"vertices\":"<<record.vertex_num
+                   <<",\"edges\":"<<record.edge_num<<",\"algorithm\":"<<quote(record.algorithm)
+                   <<",\"threads\":"<<record.thread_num<<",\"skipped\":"<<(record.skipped?"true":"false")
+                   <<",\"seconds\":"<<std::setprecision(6)<<record.seconds
+                   <<",\"edges_per_second\":"<<std::setprecision(6)<<record.edges_per_second
+                   <<",\"peak_rss_kb\":"<<record.peak_rss_kb<<",\"result\":"<<record.result<<"}";
+            }
+            out<<"\n]\n";
+        }
+
+        //!_BenchmarkRunner：对一个图依次运行各个算法并记录结果
+        class _BenchmarkRunner
+        {
+        public:
+            //!显式构造函数
+            /*!
+            * \param name:图的名字
+            * \param graph:生成的图
+            * \param options:基准测试的选项
+            */
+            _BenchmarkRunner(const std::string& name,const GraphEdgeList& graph,const BenchmarkOptions& options):
+                _name(name),_graph(graph),_options(options){}
+            //!run:运行一个算法并记录结果
+            /*!
+            * \param algorithm:算法的名字。若它不在`options.algorithms`中则直接返回
+            * \param thread_num:算法使用的线程数量
+            * \param skip:是否跳过该算法（只记录一条`skipped`的记录）
+            * \param prepare:计时之前执行的准备工作（如构造图），不计入时间
+            * \param action:被计时的算法，返回结果摘要
+            * \return: void
+            */
+            void run(const std::string& algorithm,std::size_t thread_num,bool skip,
+                     std::function<void()> prepare,std::function<long long()> action)
+            {
+                const auto& names=_options.algorithms;
+                if(!names.empty()&&std::find(names.begin(),names.end(),algorithm)==names.end())
+                    return;
+                BenchmarkRecord record={_name,_graph.vertex_num,_graph.edges.size(),algorithm,thread_num,skip,0,0,0,0};
+                if(!skip)
+                {
+                    prepare();
+                    reset_peak_rss();
+                    auto begin=std::chrono::steady_clock::now();
+                    record.result=action();
+                    auto end=std::chrono::steady_clock::now();
+                    record.seconds=std::chrono::duration<double>(end-begin).count();
+                    record.edges_per_second=record.seconds>0?record.edge_num/record.seconds:0;
+                    record.peak_rss_kb=peak_rss_kb();
+                }
+                records.push_back(record);
+            }
+            std::vector<BenchmarkRecord> records;   /*!< 已经记录的结果*/
+        private:
+            std::string _name;                  /*!< 图的名字*/
+            const GraphEdgeList& _graph;        /*!< 生成的图*/
+            const BenchmarkOptions& _options;   /*!< 基准测试的选项*/
+        };
+        //!_finite_key_sum:返回图中所有`key`有限的顶点的`key`之和，用作最短路径算法的结果摘要
+        template<typename GraphType> long long _finite_key_sum(std::shared_ptr<GraphType> graph)
+        {
+            long long sum=0;
+            for(const auto& vertex:graph->vertexes)
+                if(vertex&&vertex->key<unlimit<typename GraphType::EWeightType>())
+                    sum+=vertex->key;
+            return sum;
+        }
+        //!_black_vertex_num:返回图中黑色顶点的数量，用作空回调遍历的结果摘要
+        template<typename GraphType> long long _black_vertex_num(std::shared_ptr<GraphType> graph)
+        {
+            long long count=0;
+            for(const auto& vertex:graph->vertexes)
+                if(vertex&&vertex->color==GraphType::VertexType::COLOR::BLACK)
+                    count++;
+            return count;
+        }
+        //!_bfs_noop_loop:手写的广度优先搜索，作为`bfs_noop_visitor`的基准
+        /*!
+        * 与`breadth_first_visit(graph,source_id,visitor)`的步骤完全相同（初始化、队列、`set_source`、`set_found`、着色），只是没有任何回调。
+        * 若`NullVisitor`的空钩子确实被编译器消除，则两者的用时相同
+        */
+        template<typename GraphType> void _bfs_noop_loop(std::shared_ptr<GraphType> graph,typename GraphType::VIDType source_id)
+        {
+            typedef typename GraphType::VertexType VertexType;
+            std::queue<std::shared_ptr<VertexType>> v_queue;
+            for(auto& v:graph->vertexes)
+            {
+                if(!v) continue;
+                v->color=VertexType::COLOR::WHITE;
+                v->key=unlimit<typename VertexType::KeyType>();
+                v->parent=std::shared_ptr<VertexType>();
+            }
+            graph->vertexes.at(source_id)->set_source();
+            v_queue.push(graph->vertexes.at(source_id));
+            while(!v_queue.empty())
+            {
+                auto front=v_queue.front();
+                v_queue.pop();
+                for(const auto& neighbor:graph->neighbors(front->id))
+                {
+                    auto& next_vertex=graph->vertexes[neighbor.first];
+                    if(next_vertex->color==VertexType::COLOR::WHITE)
+                    {
+                        next_vertex->set_found(front);
+                        v_queue.push(next_vertex);
+                    }
+                }
+                front->color=VertexType::COLOR::BLACK;
+            }
+        }
+        //!_dfs_noop_loop_vertex:`_dfs_noop_loop`的访问过程，与`_depth_first_visit_vertex(graph,v_id,time,visitor,frames)`相同但没有回调
+        template<typename GraphType> void _dfs_noop_loop_vertex(const std::shared_ptr<GraphType>& graph,typename GraphType::VIDType v_id,int& time,
+                                                                std::vector<_DFSFrame<GraphType>>& frames)
+        {
+            auto discover=[&](typename GraphType::VIDType v){
+                graph->vertexes[v]->set_disovered(++time);
+                auto range=graph->neighbors(v);
+                frames.push_back(_DFSFrame<GraphType>{v,range.begin(),range.end()});
+            };
+            discover(v_id);
+            while(!frames.empty())
+            {
+                auto& frame=frames.back();
+                auto v=frame.v;
+                auto next=frame.next;
+                const auto end=frame.end;
+                bool descended=false;
+                while(next!=end)
+                {
+                    auto another_id=(*next).first;
+                    ++next;
+                    const auto& another_vertex=graph->vertexes[another_id];
+                    if(another_vertex->color==GraphType::VertexType::COLOR::WHITE)
+                    {
+                        frame.next=next;
+                        another_vertex->parent=graph->vertexes[v];
+                        discover(another_id);
+                        descended=true;
+                        break;
+                    }
+                }
+                if(descended) continue;
+                frames.pop_back();
+                graph->vertexes[v]->set_finished(++time);
+            }
+        }
+        //!_dfs_noop_loop:手写的深度优先搜索，作为`dfs_noop_visitor`的基准
+        /*!
+        * 与`depth_first_visit(graph,visitor)`的步骤完全相同，只是没有任何回调
+        */
+        template<typename GraphType> void _dfs_noop_loop(std::shared_ptr<GraphType> graph)
+        {
+            typedef typename GraphType::VertexType VertexType;
+            for(auto& v:graph->vertexes)
+            {
+                if(!v) continue;
+                v->color=VertexType::COLOR::WHITE;
+                v->key=0;
+                v->parent=std::shared_ptr<VertexType>();
+            }
+            int time=0;
+            std::vector<_DFSFrame<GraphType>> frames;
+            for(std::size_t v_id=0;v_id<graph->vertexes.size();v_id++)
+                if(graph->vertexes[v_id]&&graph->vertexes[v_id]->color==VertexType::COLOR::WHITE)
+                    _dfs_noop_loop_vertex(graph,v_id,time,frames);
+        }
+        //!_finite_matrix_sum:返回距离矩阵中所有有限元素之和，用作所有结点对最短路径算法的结果摘要
+        template<typename MatrixType> long long _finite_matrix_sum(const MatrixType& D,std::size_t num)
+        {
+            long long sum=0;
+            for(std::size_t i=0;i<num;i++)
+                for(std::size_t j=0;j<num;j++)
+                    if(D(i,j)<unlimit<int>()) sum+=D(i,j);
+            return sum;
+        }
+
+        //!run_graph_benchmark：在一个图上对各个图算法计时
+        /*!
+        * \param name:图的名字，原样写入结果
+        * \param graph:生成的图，其中边的权重必须为正数
+        * \param options:基准测试的选项
+        * \return: 每个算法一条记录
+        *
+        * 对每个算法，先构造该算法所需顶点类型的`CSRGraph`（不计入时间），然后计时。计时的算法及其结果摘要为：
+        *
+        * - `build_csr`：从边集合构造`CSRGraph`；结果为边的数量
+        * - `bfs`、`parallel_bfs`：以0为源点的广度优先搜索；结果为可达的顶点数量
+        * - `dfs`：深度优先搜索；结果为完成的顶点数量
+        * - `bfs_noop_function`、`bfs_noop_visitor`、`dfs_noop_function`、`dfs_noop_visitor`：分别以空的`std::function`回调与`NullVisitor`进行遍历，
+        *   用于比较两种回调方式的开销；结果为黑色顶点的数量
+        * - `bfs_noop_loop`、`dfs_noop_loop`：步骤相同但没有任何回调的手写循环，作为`*_noop_visitor`的基准：两者用时相同说明空的访问者没有开销；
+        *   结果为黑色顶点的数量
+        * - `bfs_properties`、`dfs_properties`、`dijkstra_properties`：状态保存在`SearchProperties`中的版本，作用于没有算法状态的`Vertex<int>`图；
+        *   结果分别与`bfs`、`dfs`、`dijkstra`相同
+        * - `reorder_rcm`、`reorder_degree`：计算逆 Cuthill-McKee 次序（度数递减次序）并重新标记`Vertex<int>`图；结果为新编号下的带宽
+        * - `bfs_properties_rcm`、`bfs_properties_degree`、`dijkstra_properties_rcm`、`dijkstra_properties_degree`：在重新标记的图上从源点0（的新编号）
+        *   执行`bfs_properties`、`dijkstra_properties`，重新标记不计入时间，用于衡量次序带来的局部性；结果分别与`bfs_properties`、`dijkstra_properties`相同
+        * - `bfs_256_sources`、`multi_source_bfs`：从256个随机源点出发的广度优先搜索，前者逐个源点执行`breadth_first_visit`，
+        *   后者为一次`multi_source_breadth_first_visit`；结果为有限的距离之和
+        * - `dijkstra`、`delta_stepping`、`bellman_ford`、`bellman_ford_spfa`：以0为源点的单源最短路径；结果为有限的最短路径长度之和
+        * - `p2p_dijkstra`、`p2p_bidirectional`、`p2p_alt`：`ShortestPathQuery`的64次随机点到点查询（单向、双向、8个地标的ALT），
+        *   建立查询对象与地标预处理不计入时间；结果为有限的最短路径长度之和
+        * - `contraction_hierarchy`：收缩层次的预处理；结果为捷径的数量
+        * - `p2p_ch`：以收缩层次索引执行同样的64次查询，预处理不计入时间；结果与`p2p_dijkstra`相同
+        * - `dag_shortest_path`、`dag_schedule`：只保留`u<v`的边得到有向无环图，从16个随机源点出发的单源最短路径。
+        *   前者逐个源点调用`dag_shortest_path`，后者以预先构造（不计入时间）的`DAGSchedule`逐层并行地查询；结果为有限的最短路径长度之和
+        * - `floyd_warshall`、`johnson`、`matrix_shortest_path`：所有结点对最短路径（并行版本），最后一个为重复平方的`matrix_shortest_path_fast`，
+        *   权重矩阵的构造不计入时间。它的`int`min-plus微内核在运行期按CPU选择AVX-512、AVX2或者标量版本（见`min_plus_kernel_name`）；结果为有限的最短路径长度之和
+        * - `kruskal`、`filter_kruskal`、`prim`、`boruvka`：最小生成树（森林）；结果为其权重。`prim`只计算包含顶点0的树
+        * - `scc`、`tarjan_scc`：强连通分量；结果为包含多于一个顶点的强连通分量的数量
+        * - `dinic`、`highest_label_push_relabel`：以0为源点、`V-1`为汇点的最大流；结果为最大流的值
+        *
+        * 深度优先搜索（`dfs`、`scc`等）以显式栈实现，不递归，因此大图不需要增大调用栈。每次计时之前重置峰值常驻内存（见`reset_peak_rss`），
+        * 因此`peak_rss_kb`是算法运行期间的峰值，其中包含了图本身占用的内存。
+        */
+        inline std::vector<BenchmarkRecord> run_graph_benchmark(const std::string& name,const GraphEdgeList& graph,const BenchmarkOptions& options)
+        {
+            using IntroductionToAlgorithm::ParallelAlgorithm::thread_num_or_default;
+            const std::size_t num=graph.vertex_num;
+            const std::size_t threads=thread_num_or_default(options.thread_num);
+            const auto& edges=graph.edges;
+            const bool dense_skip=num>options.dense_limit;
+            const int src=0;
+            const int dst=num>0?num-1:0;
+            _BenchmarkRunner runner(name,graph,options);
+
+            std::shared_ptr<CSRGraph<Vertex<int>>> plain;
+            DenseMatrix<int> weights;
+            std::shared_ptr<CSRGraph<BFS_Vertex<int>>> bfs_graph;
+            std::shared_ptr<CSRGraph<DFS_Vertex<int>>> dfs_graph;
+            std::shared_ptr<CSRGraph<VertexP<int>>> path_graph;
+            std::shared_ptr<CSRGraph<SetVertex<int>>> set_graph;
+            SearchProperties<int> properties;
+            std::unique_ptr<ShortestPathQuery<CSRGraph<Vertex<int>>>> query;
+            std::unique_ptr<LandmarkHeuristic<int>> alt;
+            std::vector<std::pair<int,int>> query_pairs;
+            std::vector<int> bfs_sources;
+            std::shared_ptr<const ContractionHierarchy<int>> hierarchy;
+            std::shared_ptr<CSRGraph<DFS_Vertex<int>>> dag_graph;
+            std::shared_ptr<CSRGraph<Vertex<int>>> reordered[2];   //逆 Cuthill-McKee 次序、度数递减次序
+            VertexOrdering<int> orderings[2];
+            std::unique_ptr<DAGSchedule<int,int>> dag_schedule;
+            std::vector<int> dag_sources;
+            std::size_t max_degree=0;
+            {
+                std::vector<std::size_t> degree(num,0);
+                for(const auto& edge:edges)
+                    max_degree=std::max(max_degree,++degree[std::get<0>(edge)]);
+            }
+            const bool contraction_skip=num==0||max_degree>options.contraction_degree_limit;
+            std::function<void(int,int)> no_edge_action=[](int,int){};
+            std::function<void(int)> no_vertex_action=[](int){};
+            auto no_prepare=[](){};
+            auto make_plain=[&](){if(!plain) plain=std::make_shared<CSRGraph<Vertex<int>>>(num,edges.begin(),edges.end(),unlimit<int>());};
+            auto make_bfs=[&](){if(!bfs_graph) bfs_graph=std::make_shared<CSRGraph<BFS_Vertex<int>>>(num,edges.begin(),edges.end(),unlimit<int>());};
+            auto make_dfs=[&](){if(!dfs_graph) dfs_graph=std::make_shared<CSRGraph<DFS_Vertex<int>>>(num,edges.begin(),edges.end(),unlimit<int>());};
+            auto make_path=[&](){if(!path_graph) path_graph=std::make_shared<CSRGraph<VertexP<int>>>(num,edges.begin(),edges.end(),unlimit<int>());};
+            auto make_query=[&](){
+                make_plain();
+                if(query) return;
+                query.reset(new ShortestPathQuery<CSRGraph<Vertex<int>>>(plain));
+                alt.reset(new LandmarkHeuristic<int>(*query,std::min<std::size_t>(8,num)));
+                std::mt19937_64 engine(num);
+                for(int i=0;i<64;i++)
+                    query_pairs.push_back(std::make_pair(_random_below(engine,num),_random_below(engine,num)));
+            };
+            auto run_queries=[&](int kind){
+                long long sum=0;
+                for(const auto& pair:query_pairs)
+                {
+                    int distance=kind==0?query->dijkstra(pair.first,pair.second):
+                                 kind==1?query->bidirectional_dijkstra(pair.first,pair.second):query->astar(pair.first,pair.second,*alt);
+                    if(distance<unlimit<int>()) sum+=distance;
+                }
+                return sum;
+            };
+            auto make_hierarchy=[&](){
+                make_query();
+                if(!hierarchy) hierarchy=std::make_shared<const ContractionHierarchy<int>>(build_contraction_hierarchy(plain));
+            };
+            auto make_sources=[&](){
+                make_plain();
+                if(!bfs_sources.empty()) return;
+                std::mt19937_64 engine(num+1);
+                for(int i=0;i<256;i++)
+                    bfs_sources.push_back(_random_below(engine,num));
+            };
+            auto make_dag=[&](){
+                if(dag_graph) return;
+                std::vector<GraphEdgeList::EdgeTupleType> dag_edges;
+                for(const auto& edge:edges)
+                    if(std::get<0>(edge)<std::get<1>(edge)) dag_edges.push_back(edge);
+                dag_graph=std::make_shared<CSRGraph<DFS_Vertex<int>>>(num,dag_edges.begin(),dag_edges.end(),unlimit<int>());
+                std::mt19937_64 engine(num+2);
+                for(int i=0;i<16;i++)
+                    dag_sources.push_back(_random_below(engine,num));
+            };
+            auto make_dag_schedule=[&](){
+                make_dag();
+                if(!dag_schedule) dag_schedule.reset(new DAGSchedule<int,int>(dag_graph));
+            };
+            auto compute_ordering=[&](int kind){
+                orderings[kind]=kind==0?reverse_cuthill_mckee_ordering(plain):degree_ordering(plain);
+                reordered[kind]=reorder_graph(plain,orderings[kind]);
+            };
+            auto make_reordered=[&](int kind){
+                make_plain();
+                if(!reordered[kind]) compute_ordering(kind);
+            };
+            auto run_reordered_search=[&](int kind,bool shortest){
+                NullVisitor visitor;
+                int source=orderings[kind].to_new(src);
+                if(!shortest)
+                {
+                    breadth_first_visit(reordered[kind],source,properties,visitor);
+                    return (long long)std::count(properties.color.begin(),properties.color.end(),VertexColor::BLACK);
+                }
+                dijkstra(reordered[kind],source,properties);
+                long long sum=0;
+                for(auto distance:properties.distance)
+                    if(distance<unlimit<int>()) sum+=distance;
+                return sum;
+            };
+            auto make_set=[&](){if(!set_graph) set_graph=std::make_shared<CSRGraph<SetVertex<int>>>(num,edges.begin(),edges.end(),unlimit<int>());};
+
+            runner.run("build_csr",1,false,no_prepare,[&](){
+                return (long long)std::make_shared<CSRGraph<Vertex<int>>>(num,edges.begin(),edges.end(),unlimit<int>())->edge_num();});
+            //*************  遍历  *************
+            runner.run("bfs",1,num==0,make_bfs,[&](){
+                long long count=0;
+                breadth_first_search(bfs_graph,src,[&count](int){count++;});
+                return count;});
+            runner.run("parallel_bfs",threads,num==0,make_bfs,[&](){
+                auto result=parallel_breadth_first_search(bfs_graph,src,threads);
+                return (long long)result.order.size();});
+            runner.run("dfs",1,false,make_dfs,[&](){
+                long long count=0;
+                depth_first_search<CSRGraph<DFS_Vertex<int>>>(dfs_graph,[](int,int){},[&count](int,int){count++;});
+                return count;});
+            runner.run("bfs_noop_function",1,num==0,make_bfs,[&](){
+                breadth_first_search(bfs_graph,src,no_vertex_action,no_vertex_action);
+                return _black_vertex_num(bfs_graph);});
+            runner.run("bfs_noop_visitor",1,num==0,make_bfs,[&](){
+                NullVisitor visitor;
+                breadth_first_visit(bfs_graph,src,visitor);
+                return _black_vertex_num(bfs_graph);});
+            runner.run("bfs_noop_loop",1,num==0,make_bfs,[&](){
+                _bfs_noop_loop(bfs_graph,src);
+                return _black_vertex_num(bfs_graph);});
+            runner.run("bfs_properties",1,num==0,make_plain,[&](){
+                NullVisitor visitor;
+                breadth_first_visit(plain,src,properties,visitor);
+                return (long long)std::count(properties.color.begin(),properties.color.end(),VertexColor::BLACK);});
+            runner.run("dfs_noop_function",1,false,make_dfs,[&](){
+                depth_first_search(dfs_graph,no_edge_action,no_edge_action,no_edge_action,no_edge_action);
+                return _black_vertex_num(dfs_graph);});
+            runner.run("dfs_noop_visitor",1,false,make_dfs,[&](){
+                NullVisitor visitor;
+                depth_first_visit(dfs_graph,visitor);
+                return _black_vertex_num(dfs_graph);});
+            runner.run("dfs_noop_loop",1,false,make_dfs,[&](){
+                _dfs_noop_loop(dfs_graph);
+                return _black_vertex_num(dfs_graph);});
+            runner.run("dfs_properties",1,false,make_plain,[&](){
+                NullVisitor visitor;
+                depth_first_visit(plain,properties,visitor);
+                return (long long)std::count(properties.color.begin(),properties.color.end(),VertexColor::BLACK);});
+            runner.run("reorder_rcm",1,false,make_plain,[&](){
+                compute_ordering(0);
+                return (long long)ordering_bandwidth(plain,orderings[0]).first;});
+            runner.run("reorder_degree",1,false,make_plain,[&](){
+                compute_ordering(1);
+                return (long long)ordering_bandwidth(plain,orderings[1]).first;});
+            runner.run("bfs_properties_rcm",1,num==0,[&](){make_reordered(0);},[&](){return run_reordered_search(0,false);});
+            runner.run("bfs_properties_degree",1,num==0,[&](){make_reordered(1);},[&](){return run_reordered_search(1,false);});
+            runner.run("bfs_256_sources",1,num==0,make_sources,[&](){
+                long long sum=0;
+                for(int source:bfs_sources)
+                {
+                    NullVisitor visitor;
+                    breadth_first_visit(plain,source,properties,visitor);
+                    for(auto distance:properties.distance)
+                        if(distance<unlimit<int>()) sum+=distance;
+                }
+                return sum;});
+            runner.run("multi_source_bfs",1,num==0,make_sources,[&](){
+                long long sum=0;
+                multi_source_breadth_first_visit(plain,bfs_sources,[&sum](std::size_t,int,int distance){sum+=distance;});
+                return sum;});
+            //*************  单源最短路径  *************
+            runner.run("dijkstra",1,num==0,make_path,[&](){
+                dijkstra(path_graph,src);
+                return _finite_key_sum(path_graph);});
+            runner.run("dijkstra_properties",1,num==0,make_plain,[&](){
+                dijkstra(plain,src,properties);
+                long long sum=0;
+                for(auto distance:properties.distance)
+                    if(distance<unlimit<int>()) sum+=distance;
+                return sum;});
+            runner.run("dijkstra_properties_rcm",1,num==0,[&](){make_reordered(0);},[&](){return run_reordered_search(0,true);});
+            runner.run("dijkstra_properties_degree",1,num==0,[&](){make_reordered(1);},[&](){return run_reordered_search(1,true);});
+            runner.run("p2p_dijkstra",1,num==0,make_query,[&](){return run_queries(0);});
+            runner.run("p2p_bidirectional",1,num==0,make_query,[&](){return run_queries(1);});
+            runner.run("p2p_alt",1,num==0,make_query,[&](){return run_queries(2);});
+            runner.run("contraction_hierarchy",1,contraction_skip,make_query,[&](){
+                hierarchy=std::make_shared<const ContractionHierarchy<int>>(build_contraction_hierarchy(plain));
+                return (long long)hierarchy->shortcut_num();});
+            runner.run("p2p_ch",1,contraction_skip,make_hierarchy,[&](){
+                ContractionHierarchyQuery<int> ch_query(hierarchy);
+                long long sum=0;
+                for(const auto& pair:query_pairs)
+                {
+                    int distance=ch_query.distance(pair.first,pair.second);
+                    if(distance<unlimit<int>()) sum+=distance;
+                }
+                return sum;});
+            runner.run("dag_shortest_path",1,num==0,make_dag,[&](){
+                long long sum=0;
+                for(int source:dag_sources)
+                {
+                    dag_shortest_path(dag_graph,source);
+                    sum+=_finite_key_sum(dag_graph);
+                }
+                return sum;});
+            runner.run("dag_schedule",threads,num==0,make_dag_schedule,[&](){
+                long long sum=0;
+                for(int source:dag_sources)
+                    for(auto distance:dag_schedule->shortest_paths(source,threads).distance)
+                        if(distance<unlimit<int>()) sum+=distance;
+                return sum;});
+            runner.run("delta_stepping",threads,num==0,make_path,[&](){
+                delta_stepping(path_graph,src,0,threads);
+                return _finite_key_sum(path_graph);});
+            runner.run("bellman_ford",1,num==0||num>options.bellman_ford_limit,make_path,[&](){
+                bellman_ford(path_graph,src);
+                return _finite_key_sum(path_graph);});
+            runner.run("bellman_ford_spfa",1,num==0,make_path,[&](){
+                bellman_ford_spfa(path_graph,src);
+                return _finite_key_sum(path_graph);});
+            //*************  所有结点对最短路径  *************
+            runner.run("floyd_warshall",threads,dense_skip,make_plain,[&](){
+                return _finite_matrix_sum(parallel_floyd_warshall(plain,threads).first,num);});
+            runner.run("johnson",threads,dense_skip,make_path,[&](){
+                return _finite_matrix_sum(parallel_johnson(path_graph,threads).first,num);});
+            runner.run("matrix_shortest_path",threads,dense_skip,[&](){make_plain();weights=weight_matrix(plain);},[&](){
+                return _finite_matrix_sum(matrix_shortest_path_fast(weights,threads),num);});
+            //*************  最小生成树  *************
+            runner.run("kruskal",1,false,make_set,[&](){
+                return (long long)kruskal(set_graph);});
+            runner.run("filter_kruskal",threads,false,make_set,[&](){
+                return (long long)filter_kruskal(set_graph,no_edge_action,no_edge_action,threads);});
+            runner.run("prim",1,num==0,make_path,[&](){
+                long long weight=0;
+                std::function<void(int)> add_weight=[&](int id){
+                    auto key=path_graph->vertexes[id]->key;
+                    if(key<unlimit<int>()) weight+=key;};
+                prim(path_graph,src,no_vertex_action,add_weight);
+                return weight;});
+            runner.run("boruvka",threads,false,make_plain,[&](){
+                return (long long)parallel_boruvka(plain,no_edge_action,no_edge_action,threads);});
+            //*************  强连通分量  *************
+            runner.run("scc",1,false,make_dfs,[&](){
+                return (long long)scc(dfs_graph).size();});
+            runner.run("tarjan_scc",1,false,make_plain,[&](){
+                return (long long)tarjan_scc(plain).size();});
+            //*************  最大流  *************
+            runner.run("dinic",1,num<2,make_plain,[&](){
+                return (long long)dinic(plain,src,dst);});
+            runner.run("highest_label_push_relabel",1,num<2,make_plain,[&](){
+                return (long long)highest_label_push_relabel(plain,src,dst);});
+            return runner.records;
+        }
+    }
+}
+#endif // GRAPHBENCHMARK
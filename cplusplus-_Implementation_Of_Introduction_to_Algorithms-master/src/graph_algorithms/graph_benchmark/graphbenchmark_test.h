@@ -0,0 +1,149 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef GRAPHBENCHMARK_TEST
+#define GRAPHBENCHMARK_TEST
+#include<sstream>
+#include<map>
+#include"../../google_test/gtest.h"
+#include"graphbenchmark.h"
+
+using IntroductionToAlgorithm::GraphAlgorithm::BenchmarkRecord;
+using IntroductionToAlgorithm::GraphAlgorithm::BenchmarkOptions;
+using IntroductionToAlgorithm::GraphAlgorithm::run_graph_benchmark;
+using IntroductionToAlgorithm::GraphAlgorithm::benchmark_csv;
+using IntroductionToAlgorithm::GraphAlgorithm::benchmark_json;
+using IntroductionToAlgorithm::GraphAlgorithm::grid_graph;
+using IntroductionToAlgorithm::GraphAlgorithm::geometric_graph;
+
+//!graph_benchmark_test:run_graph_benchmark
+/*!
+*
+* 在小规模的网格图、几何图上运行全部算法：解决同一问题的不同算法给出相同的结果摘要
+*/
+TEST(GraphBenchmarkTest,test_run_graph_benchmark)
+{
+    for(const auto& graph:{grid_graph(8,8,1),geometric_graph(300,5,2)})
+    {
+        BenchmarkOptions options;
+        options.thread_num=2;
+        auto records=run_graph_benchmark("test",graph,options);
+        EXPECT_EQ(records.size(),43);
+        std::map<std::string,long long> result;
+        for(const auto& record:records)
+        {
+            EXPECT_FALSE(record.skipped)<<record.algorithm;
+            EXPECT_EQ(record.vertex_num,graph.vertex_num);
+            EXPECT_EQ(record.edge_num,graph.edges.size());
+            EXPECT_GE(record.seconds,0);
+            EXPECT_GT(record.peak_rss_kb,0);
+            result[record.algorithm]=record.result;
+        }
+        EXPECT_EQ(result["build_csr"],graph.edges.size());
+        EXPECT_EQ(result["bfs"],result["parallel_bfs"]);
+        EXPECT_EQ(result["dfs"],graph.vertex_num);
+        EXPECT_EQ(result["bfs_noop_function"],result["bfs"]);
+        EXPECT_EQ(result["bfs_noop_visitor"],result["bfs"]);
+        EXPECT_EQ(result["dfs_noop_function"],graph.vertex_num);
+        EXPECT_EQ(result["dfs_noop_visitor"],graph.vertex_num);
+        EXPECT_EQ(result["bfs_noop_loop"],result["bfs"]);
+        EXPECT_EQ(result["dfs_noop_loop"],graph.vertex_num);
+        EXPECT_EQ(result["bfs_properties"],result["bfs"]);
+        EXPECT_EQ(result["dfs_properties"],graph.vertex_num);
+        EXPECT_EQ(result["multi_source_bfs"],result["bfs_256_sources"]);
+        EXPECT_EQ(result["dijkstra_properties"],result["dijkstra"]);
+        for(const char* name:{"bfs_properties_rcm","bfs_properties_degree"})
+            EXPECT_EQ(result[name],result["bfs"])<<name;
+        for(const char* name:{"dijkstra_properties_rcm","dijkstra_properties_degree"})
+            EXPECT_EQ(result[name],result["dijkstra"])<<name;
+        EXPECT_EQ(result["p2p_bidirectional"],result["p2p_dijkstra"]);
+        EXPECT_EQ(result["p2p_alt"],result["p2p_dijkstra"]);
+        EXPECT_EQ(result["p2p_ch"],result["p2p_dijkstra"]);
+        EXPECT_EQ(result["dag_schedule"],result["dag_shortest_path"]);
+        for(const char* name:{"delta_stepping","bellman_ford","bellman_ford_spfa"})
+            EXPECT_EQ(result[name],result["dijkstra"])<<name;
+        EXPECT_EQ(result["johnson"],result["floyd_warshall"]);
+        EXPECT_EQ(result["matrix_shortest_path"],result["floyd_warshall"]);
+        for(const char* name:{"filter_kruskal","boruvka"})
+            EXPECT_EQ(result[name],result["kruskal"])<<name;
+        EXPECT_EQ(result["tarjan_scc"],result["scc"]);
+        EXPECT_EQ(result["highest_label_push_relabel"],result["dinic"]);
+    }
+    //************ 网格图是连通的：prim 的树就是最小生成树 ************
+    std::map<std::string,long long> grid_result;
+    for(const auto& record:run_graph_benchmark("grid",grid_graph(8,8,1),BenchmarkOptions()))
+        grid_result[record.algorithm]=record.result;
+    EXPECT_EQ(grid_result["prim"],grid_result["kruskal"]);
+}
+
+//!graph_benchmark_test:run_graph_benchmark
+/*!
+*
+* `BenchmarkOptions`：只运行指定的算法；顶点数量或者最大出度超过限制的算法被标记为跳过
+*/
+TEST(GraphBenchmarkTest,test_options)
+{
+    BenchmarkOptions options;
+    options.algorithms={"bfs","floyd_warshall","bellman_ford","p2p_ch"};
+    options.dense_limit=10;
+    options.bellman_ford_limit=100;
+    options.contraction_degree_limit=3;
+    auto records=run_graph_benchmark("grid",grid_graph(4,4,1),options);
+    ASSERT_EQ(records.size(),4);
+    EXPECT_EQ(records[0].algorithm,"bfs");
+    EXPECT_EQ(records[0].result,16);
+    EXPECT_EQ(records[1].algorithm,"p2p_ch");
+    EXPECT_TRUE(records[1].skipped);                    //网格图内部顶点的出度为4
+    EXPECT_EQ(records[2].algorithm,"bellman_ford");
+    EXPECT_FALSE(records[2].skipped);
+    EXPECT_EQ(records[3].algorithm,"floyd_warshall");
+    EXPECT_TRUE(records[3].skipped);
+    EXPECT_EQ(records[3].seconds,0);
+}
+
+//!graph_benchmark_test:benchmark_csv、benchmark_json
+/*!
+*
+* CSV 第一行为表头，每条记录一行；JSON 为一个对象数组，字符串中的引号、反斜杠被转义
+*/
+TEST(GraphBenchmarkTest,test_output)
+{
+    std::vector<BenchmarkRecord> records={
+        {"grid-4",16,48,"bfs",1,false,0.5,96,1024,16},
+        {"rmat-4",16,48,"johnson",4,true,0,0,0,0}};
+    std::ostringstream csv;
+    benchmark_csv(records,csv);
+    EXPECT_EQ(csv.str(),"graph,vertices,edges,algorithm,threads,skipped,seconds,edges_per_second,peak_rss_kb,result\n"
+                        "grid-4,16,48,bfs,1,0,0.5,96,1024,16\n"
+                        "rmat-4,16,48,johnson,4,1,0,0,0,0\n");
+    std::ostringstream json;
+    benchmark_json(records,json);
+    EXPECT_EQ(json.str(),"[\n {\"graph\":\"grid-4\",\"vertices\":16,\"edges\":48,\"algorithm\":\"bfs\",\"threads\":1,\"skipped\":false,"
+                         "\"seconds\":0.5,\"edges_per_second\":96,\"peak_rss_kb\":1024,\"result\":16},\n"
+                         " {\"graph\":\"rmat-4\",\"vertices\":16,\"edges\":48,\"algorithm\":\"johnson\",\"threads\":4,\"skipped\":true,"
+                         "\"seconds\":0,\"edges_per_second\":0,\"peak_rss_kb\":0,\"result\":0}\n]\n");
+    std::ostringstream escaped;
+    records.resize(1);
+    records[0].graph="a\"b\\c";
+    benchmark_json(records,escaped);
+    EXPECT_NE(escaped.str().find("\"graph\":\"a\\\"b\\\\c\""),std::string::npos);
+    std::ostringstream empty;
+    benchmark_json(std::vector<BenchmarkRecord>(),empty);
+    EXPECT_EQ(empty.str(),"[\n]\n");
+}
+#endif // GRAPHBENCHMARK_TEST
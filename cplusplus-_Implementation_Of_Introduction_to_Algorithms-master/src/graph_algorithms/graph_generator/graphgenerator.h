@@ -0,0 +1,259 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef GRAPHGENERATOR
+#define GRAPHGENERATOR
+#include<vector>
+#include<tuple>
+#include<random>
+#include<cmath>
+#include<cstdint>
+#include<algorithm>
+#include<stdexcept>
+namespace IntroductionToAlgorithm
+{
+    namespace GraphAlgorithm
+    {
+        //!GraphEdgeList：生成器生成的图：顶点数量以及边的三元素元组集合
+        /*!
+        * 边按(起点，终点)递增排列，不含自环和重复边，因此可以直接用于构造`CSRGraph`或者`Graph::add_edges`。
+        * 无向图的每一条边以(u,v)、(v,u)两条权重相同的有向边给出。
+        */
+        struct GraphEdgeList
+        {
+            typedef std::tuple<int,int,int> EdgeTupleType; /*!< 边的三元素（顶点1编号，顶点2编号，权重)组成的元组*/
+            std::size_t vertex_num;             /*!< 顶点数量*/
+            std::vector<EdgeTupleType> edges;   /*!< 边的集合*/
+        };
+
+        //!_random_below：返回`[0,bound)`之间的随机整数
+        /*!
+        * \param engine:随机数引擎
+        * \param bound:上界，必须大于0
+        * \return: 随机整数
+        *
+        * `std::mt19937_64`的输出序列是标准规定的，而`std::uniform_int_distribution`等分布的实现由标准库决定。
+        * 这里直接对引擎的输出取模，从而保证相同的种子在不同的标准库上生成相同的图。
+        */
+        inline std::uint64_t _random_below(std::mt19937_64& engine,std::uint64_t bound)
+        {
+            return engine()%bound;
+        }
+        //!_random_unit：返回`[0,1)`之间的随机浮点数，与`_random_below`一样不依赖标准库的分布实现
+        inline double _random_unit(std::mt19937_64& engine)
+        {
+            return (engine()>>11)*(1.0/9007199254740992.0);
+        }
+        //!_normalize_edges：将边按(起点，终点)排序，并删除自环与重复的边（保留先出现的一条）
+        inline void _normalize_edges(std::vector<GraphEdgeList::EdgeTupleType>& edges)
+        {
+            typedef GraphEdgeList::EdgeTupleType EdgeTupleType;
+            edges.erase(std::remove_if(edges.begin(),edges.end(),[](const EdgeTupleType& edge)
+                        {return std::get<0>(edge)==std::get<1>(edge);}),edges.end());
+            std::stable_sort(edges.begin(),edges.end(),[](const EdgeTupleType& a,const EdgeTupleType& b)
+                        {return std::make_pair(std::get<0>(a),std::get<1>(a))<std::make_pair(std::get<0>(b),std::get<1>(b));});
+            edges.erase(std::unique(edges.begin(),edges.end(),[](const EdgeTupleType& a,const EdgeTupleType& b)
+                        {return std::get<0>(a)==std::get<0>(b)&&std::get<1>(a)==std::get<1>(b);}),edges.end());
+        }
+
+        //!rmat_graph：生成R-MAT（递归矩阵，Kronecker图的一种）有向图
+        /*!
+        * \param scale:顶点数量为`2^scale`
+        * \param edge_factor:生成`edge_factor*2^scale`条边（删除自环与重复边之前）
+        * \param seed:随机数种子
+        * \param max_weight:边的权重在`[1,max_weight]`之间均匀分布
+        * \param a,b,c:邻接矩阵左上、右上、左下象限的概率，右下象限的概率为`1-a-b-c`
+        * \return: 生成的图
+        *
+        * 每一条边从整个邻接矩阵开始，按概率选择四个象限之一，递归`scale`次后得到一个元素。默认参数与Graph500相同，
+        * 生成的图的度数呈幂律分布，类似于社交网络、网页链接图。最后对顶点编号做一次随机置换，使高度数顶点不集中在小编号处。
+        *
+        * 参数无效（`scale`超过30、`max_weight`小于1、概率越界）时抛出异常。
+        */
+        inline GraphEdgeList rmat_graph(std::size_t scale,std::size_t edge_factor,std::uint64_t seed,int max_weight=100,
+                                        double a=0.57,double b=0.19,double c=0.19)
+        {
+            if(scale>30||max_weight<1||a<0||b<0||c<0||a+b+c>1)
+                throw std::invalid_argument("rmat_graph error: scale must <=30, max_weight must >=1 and a,b,c must be probabilities!");
+            std::mt19937_64 engine(seed);
+            GraphEdgeList result;
+            result.vertex_num=std::size_t(1)<<scale;
+            const std::size_t edge_num=edge_factor*result.vertex_num;
+            result.edges.reserve(edge_num);
+            for(std::size_t i=0;i<edge_num;i++)
+            {
+                std::size_t u=0,v=0;
+                for(std::size_t level=0;level<scale;level++)
+                {
+                    double p=_random_unit(engine);
+                    u<<=1;
+                    v<<=1;
+                    if(p<a) ;                       //左上象限
+                    else if(p<a+b) v|=1;            //右上象限
+                    else if(p<a+b+c) u|=1;          //左下象限
+                    else {u|=1;v|=1;}               //右下象限
+                }
+                result.edges.push_back(std::make_tuple(int(u),int(v),int(1+_random_below(engine,max_weight))));
+            }
+            //************ 随机置换顶点编号 ************
+            std::vector<int> permutation(result.vertex_num);
+            for(std::size_t i=0;i<result.vertex_num;i++) permutation[i]=i;
+            for(std::size_t i=result.vertex_num;i>1;i--)
+                std::swap(permutation[i-1],permutation[_random_below(engine,i)]);
+            for(auto& edge:result.edges)
+            {
+                std::get<0>(edge)=permutation[std::get<0>(edge)];
+                std::get<1>(edge)=permutation[std::get<1>(edge)];
+            }
+            _normalize_edges(result.edges);
+            return result;
+        }
+        //!grid_graph：生成二维网格无向图
+        /*!
+        * \param rows:网格的行数
+        * \param cols:网格的列数
+        * \param seed:随机数种子
+        * \param max_weight:边的权重在`[1,max_weight]`之间均匀分布
+        * \return: 生成的图。顶点`(r,c)`的编号为`r*cols+c`，它与上下左右四个相邻顶点之间各有一条无向边
+        *
+        * 网格图的直径为 O(sqrt(V))，是最短路径、广度优先搜索等逐层推进的算法的较差情形。`max_weight`小于1时抛出异常。
+        */
+        inline GraphEdgeList grid_graph(std::size_t rows,std::size_t cols,std::uint64_t seed,int max_weight=100)
+        {
+            if(max_weight<1)
+                throw std::invalid_argument("grid_graph error: max_weight must >=1!");
+            std::mt19937_64 engine(seed);
+            GraphEdgeList result;
+            result.vertex_num=rows*cols;
+            result.edges.reserve(4*rows*cols);
+            for(std::size_t r=0;r<rows;r++)
+                for(std::size_t c=0;c<cols;c++)
+                {
+                    int u=r*cols+c;
+                    if(c+1<cols)
+                    {
+                        int w=1+_random_below(engine,max_weight);
+                        result.edges.push_back(std::make_tuple(u,u+1,w));
+                        result.edges.push_back(std::make_tuple(u+1,u,w));
+                    }
+                    if(r+1<rows)
+                    {
+                        int w=1+_random_below(engine,max_weight);
+                        result.edges.push_back(std::make_tuple(u,int(u+cols),w));
+                        result.edges.push_back(std::make_tuple(int(u+cols),u,w));
+                    }
+                }
+            _normalize_edges(result.edges);
+            return result;
+        }
+        //!erdos_renyi_graph：生成Erdős–Rényi G(n,m)随机有向图
+        /*!
+        * \param vertex_num:顶点数量
+        * \param edge_num:随机选取的(起点，终点)对的数量。删除自环与重复边之后，实际的边数可能略少
+        * \param seed:随机数种子
+        * \param max_weight:边的权重在`[1,max_weight]`之间均匀分布
+        * \return: 生成的图
+        *
+        * 每个顶点的度数近似服从泊松分布，没有明显的局部性。`vertex_num`为0且`edge_num`不为0、或者`max_weight`小于1时抛出异常。
+        */
+        inline GraphEdgeList erdos_renyi_graph(std::size_t vertex_num,std::size_t edge_num,std::uint64_t seed,int max_weight=100)
+        {
+            if((vertex_num==0&&edge_num!=0)||max_weight<1)
+                throw std::invalid_argument("erdos_renyi_graph error: vertex_num must >0 and max_weight must >=1!");
+            std::mt19937_64 engine(seed);
+            GraphEdgeList result;
+            result.vertex_num=vertex_num;
+            result.edges.reserve(edge_num);
+            for(std::size_t i=0;i<edge_num;i++)
+            {
+                int u=_random_below(engine,vertex_num);
+                int v=_random_below(engine,vertex_num);
+                result.edges.push_back(std::make_tuple(u,v,int(1+_random_below(engine,max_weight))));
+            }
+            _normalize_edges(result.edges);
+            return result;
+        }
+        //!geometric_graph：生成随机几何无向图，作为道路网的近似
+        /*!
+        * \param vertex_num:顶点数量
+        * \param average_degree:期望的平均度数
+        * \param seed:随机数种子
+        * \param max_weight:边的最大权重
+        * \return: 生成的图
+        *
+        * 顶点是单位正方形内均匀分布的点，距离不超过`r=sqrt(average_degree/(pi*vertex_num))`的两个点之间有一条无向边，
+        * 边的权重与距离成正比：`1+floor(d/r*(max_weight-1))`。与道路网一样，这种图是平面上局部连接的、度数很低、直径很大。
+        *
+        * 用边长为`r`的网格对点分桶，每个点只需要与相邻的9个桶中的点比较距离，因此时间复杂度为 O(V+E)。
+        * `average_degree`不为正数、或者`max_weight`小于1时抛出异常。
+        */
+        inline GraphEdgeList geometric_graph(std::size_t vertex_num,double average_degree,std::uint64_t seed,int max_weight=1000)
+        {
+            if(!(average_degree>0)||max_weight<1)
+                throw std::invalid_argument("geometric_graph error: average_degree must >0 and max_weight must >=1!");
+            std::mt19937_64 engine(seed);
+            GraphEdgeList result;
+            result.vertex_num=vertex_num;
+            if(vertex_num==0) return result;
+            std::vector<double> x(vertex_num),y(vertex_num);
+            for(std::size_t i=0;i<vertex_num;i++)
+            {
+                x[i]=_random_unit(engine);
+                y[i]=_random_unit(engine);
+            }
+            const double radius=std::sqrt(average_degree/(3.14159265358979323846*vertex_num));
+            const std::size_t cells=std::max<std::size_t>(1,std::min<std::size_t>(std::size_t(1/radius),1<<15));
+            //************ 按网格分桶（计数排序） ************
+            std::vector<std::size_t> cell_of(vertex_num);
+            std::vector<std::size_t> offsets(cells*cells+1,0);
+            for(std::size_t i=0;i<vertex_num;i++)
+            {
+                cell_of[i]=std::min(std::size_t(y[i]*cells),cells-1)*cells+std::min(std::size_t(x[i]*cells),cells-1);
+                offsets[cell_of[i]+1]++;
+            }
+            for(std::size_t i=0;i<cells*cells;i++)
+                offsets[i+1]+=offsets[i];
+            std::vector<int> bucket(vertex_num);
+            std::vector<std::size_t> pos(offsets.begin(),offsets.end()-1);
+            for(std::size_t i=0;i<vertex_num;i++)
+                bucket[pos[cell_of[i]]++]=i;
+            //************ 与相邻的9个桶中的点比较距离 ************
+            for(std::size_t u=0;u<vertex_num;u++)
+            {
+                long row=cell_of[u]/cells,col=cell_of[u]%cells;
+                for(long r=row-1;r<=row+1;r++)
+                    for(long c=col-1;c<=col+1;c++)
+                    {
+                        if(r<0||c<0||r>=long(cells)||c>=long(cells)) continue;
+                        std::size_t cell=r*cells+c;
+                        for(std::size_t k=offsets[cell];k<offsets[cell+1];k++)
+                        {
+                            std::size_t v=bucket[k];
+                            if(v==u) continue;
+                            double d=std::sqrt((x[u]-x[v])*(x[u]-x[v])+(y[u]-y[v])*(y[u]-y[v]));
+                            if(d<=radius)
+                                result.edges.push_back(std::make_tuple(int(u),int(v),1+int(d/radius*(max_weight-1))));
+                        }
+                    }
+            }
+            _normalize_edges(result.edges);
+            return result;
+        }
+    }
+}
+#endif // GRAPHGENERATOR
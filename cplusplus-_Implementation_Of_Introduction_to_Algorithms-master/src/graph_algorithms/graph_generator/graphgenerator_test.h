@@ -0,0 +1,139 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef GRAPHGENERATOR_TEST
+#define GRAPHGENERATOR_TEST
+#include<set>
+#include"../../google_test/gtest.h"
+#include"graphgenerator.h"
+
+using IntroductionToAlgorithm::GraphAlgorithm::GraphEdgeList;
+using IntroductionToAlgorithm::GraphAlgorithm::rmat_graph;
+using IntroductionToAlgorithm::GraphAlgorithm::grid_graph;
+using IntroductionToAlgorithm::GraphAlgorithm::erdos_renyi_graph;
+using IntroductionToAlgorithm::GraphAlgorithm::geometric_graph;
+
+namespace {
+    //!check_edge_list:检查生成的图：边按(起点，终点)严格递增（因此无重复边），无自环，顶点编号有效，权重位于[1,max_weight]
+    void check_edge_list(const GraphEdgeList& graph,int max_weight)
+    {
+        for(std::size_t i=0;i<graph.edges.size();i++)
+        {
+            const auto& edge=graph.edges[i];
+            EXPECT_NE(std::get<0>(edge),std::get<1>(edge))<<"i:"<<i;
+            EXPECT_TRUE(std::get<0>(edge)>=0&&std::get<0>(edge)<int(graph.vertex_num))<<"i:"<<i;
+            EXPECT_TRUE(std::get<1>(edge)>=0&&std::get<1>(edge)<int(graph.vertex_num))<<"i:"<<i;
+            EXPECT_TRUE(std::get<2>(edge)>=1&&std::get<2>(edge)<=max_weight)<<"i:"<<i;
+            if(i>0)
+            {
+                EXPECT_LT(std::make_pair(std::get<0>(graph.edges[i-1]),std::get<1>(graph.edges[i-1])),
+                          std::make_pair(std::get<0>(edge),std::get<1>(edge)))<<"i:"<<i;
+            }
+        }
+    }
+    //!check_symmetric:检查无向图：每一条边(u,v,w)都有对应的(v,u,w)
+    void check_symmetric(const GraphEdgeList& graph)
+    {
+        std::set<std::tuple<int,int,int>> edges(graph.edges.begin(),graph.edges.end());
+        for(const auto& edge:graph.edges)
+            EXPECT_TRUE(edges.count(std::make_tuple(std::get<1>(edge),std::get<0>(edge),std::get<2>(edge))))
+                    <<std::get<0>(edge)<<"->"<<std::get<1>(edge);
+    }
+}
+
+//!graph_generator_test:rmat_graph
+/*!
+*
+* `rmat_graph`：顶点数量为2^scale，边数不超过edge_factor*2^scale，相同的种子生成相同的图
+*/
+TEST(GraphGeneratorTest,test_rmat_graph)
+{
+    auto graph=rmat_graph(10,8,1,50);
+    EXPECT_EQ(graph.vertex_num,1024);
+    EXPECT_LE(graph.edges.size(),8*1024);
+    EXPECT_GT(graph.edges.size(),4*1024);
+    check_edge_list(graph,50);
+    EXPECT_EQ(rmat_graph(10,8,1,50).edges,graph.edges);
+    EXPECT_NE(rmat_graph(10,8,2,50).edges,graph.edges);
+    //************ 度数的幂律分布：最大出度远大于平均出度 ************
+    std::vector<int> degree(graph.vertex_num,0);
+    for(const auto& edge:graph.edges) degree[std::get<0>(edge)]++;
+    EXPECT_GT(*std::max_element(degree.begin(),degree.end()),10*int(graph.edges.size()/graph.vertex_num));
+    EXPECT_THROW(rmat_graph(31,1,1),std::invalid_argument);
+    EXPECT_THROW(rmat_graph(4,1,1,0),std::invalid_argument);
+    EXPECT_THROW(rmat_graph(4,1,1,10,0.5,0.3,0.3),std::invalid_argument);
+}
+
+//!graph_generator_test:grid_graph
+/*!
+*
+* `grid_graph`：rows*cols个顶点，2*(rows*(cols-1)+cols*(rows-1))条有向边，且是对称的
+*/
+TEST(GraphGeneratorTest,test_grid_graph)
+{
+    auto graph=grid_graph(7,9,3,20);
+    EXPECT_EQ(graph.vertex_num,63);
+    EXPECT_EQ(graph.edges.size(),2*(7*8+9*6));
+    check_edge_list(graph,20);
+    check_symmetric(graph);
+    for(const auto& edge:graph.edges)
+    {
+        int diff=std::abs(std::get<0>(edge)-std::get<1>(edge));
+        EXPECT_TRUE(diff==1||diff==9);
+    }
+    EXPECT_EQ(grid_graph(7,9,3,20).edges,graph.edges);
+    EXPECT_TRUE(grid_graph(0,5,1).edges.empty());
+    EXPECT_THROW(grid_graph(2,2,1,0),std::invalid_argument);
+}
+
+//!graph_generator_test:erdos_renyi_graph
+/*!
+*
+* `erdos_renyi_graph`：边数不超过m，且由于重复很少，接近m
+*/
+TEST(GraphGeneratorTest,test_erdos_renyi_graph)
+{
+    auto graph=erdos_renyi_graph(1000,5000,7);
+    EXPECT_EQ(graph.vertex_num,1000);
+    EXPECT_LE(graph.edges.size(),5000);
+    EXPECT_GT(graph.edges.size(),4900);
+    check_edge_list(graph,100);
+    EXPECT_EQ(erdos_renyi_graph(1000,5000,7).edges,graph.edges);
+    EXPECT_TRUE(erdos_renyi_graph(0,0,7).edges.empty());
+    EXPECT_THROW(erdos_renyi_graph(0,1,7),std::invalid_argument);
+}
+
+//!graph_generator_test:geometric_graph
+/*!
+*
+* `geometric_graph`：对称，平均度数接近指定值（边界处的点度数较小，因此略低）
+*/
+TEST(GraphGeneratorTest,test_geometric_graph)
+{
+    auto graph=geometric_graph(4000,6,11,500);
+    EXPECT_EQ(graph.vertex_num,4000);
+    check_edge_list(graph,500);
+    check_symmetric(graph);
+    double average_degree=double(graph.edges.size())/graph.vertex_num;
+    EXPECT_GT(average_degree,5);
+    EXPECT_LT(average_degree,7);
+    EXPECT_EQ(geometric_graph(4000,6,11,500).edges,graph.edges);
+    EXPECT_TRUE(geometric_graph(0,6,11).edges.empty());
+    EXPECT_THROW(geometric_graph(10,0,11),std::invalid_argument);
+}
+#endif // GRAPHGENERATOR_TEST
@@ -0,0 +1,174 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef DINIC
+#define DINIC
+#include<vector>
+#include<memory>
+#include<stdexcept>
+#include<algorithm>
+#include"../residual_graph/residualgraph.h"
+namespace IntroductionToAlgorithm
+{
+    namespace GraphAlgorithm
+    {
+        //!dinic：最大流的Dinic算法
+        /*!
+        *
+        * \param network:残余网络。算法在它的当前流的基础上增加流，结束后它保存的就是最大流
+        * \param src: 流的源点，必须在`[0,network.vertex_num())`之间，否则抛出异常
+        * \param dst: 流的汇点，必须在`[0,network.vertex_num())`之间且不等于`src`，否则抛出异常
+        * \return: 本次调用增加的流量。若`network`初始没有流，则就是最大流的值|f|
+        *
+        * ## Dinic 算法
+        *
+        * ### 算法原理
+        *
+        * Dinic 算法是`ford_fulkerson`方法的一种实现。它以阶段为单位寻找增广路径：
+        *
+        * - 层次图：在残余网络Gf中从s开始执行广度优先搜索，得到每个结点的层次level(v)（即s到v的最短路径的边数）。
+        *   若残余弧(u,v)满足level(v)=level(u)+1，则称它为层次图中的弧
+        * - 阻塞流：在层次图中反复寻找s到t的路径并沿它增广，直到层次图中不再存在s到t的路径
+        *
+        * 每个阶段结束之后，s到t的最短增广路径的长度严格增加，因此最多有V-1个阶段。
+        *
+        * 寻找阻塞流时，每个结点u维护一个当前弧指针current(u)（与`relabel_to_front`中的u.current类似）：
+        * 当前弧之前的弧都已经确认不能再到达t。增广之后饱和的弧以及回溯时经过的弧都被跳过，因此一个阶段中每条弧最多被跳过一次。
+        *
+        * ### 算法步骤
+        *
+        * - 循环，每次循环为一个阶段：
+        *   - 在残余网络中从s开始执行广度优先搜索计算层次，若t不可达则算法结束
+        *   - 将每个结点的current设为它的第一条弧
+        *   - 从s出发，用栈代替递归执行深度优先搜索：
+        *       - 若当前结点为t，则求出栈中路径的残余容量cf(p)并沿路径增广，然后回退到路径上第一条饱和弧的起点
+        *       - 否则从current(u)开始寻找层次图中残余容量为正的弧。若找到则沿它前进；若找不到则将u从层次图中删除（令level(u)=-1），
+        *         回退到路径上u的前一个结点，并跳过该结点的当前弧
+        *       - 若在s处也找不到弧，则本阶段结束
+        *
+        * ### 算法性能
+        *
+        * 时间复杂度 O(V^2 E)，对于单位容量的网络为 O(E min(V^(2/3),E^(1/2)))。空间复杂度 O(V+E)
+        */
+        template<typename EWeightType>
+        EWeightType dinic(ResidualGraph<EWeightType>& network,typename ResidualGraph<EWeightType>::VIDType src,typename ResidualGraph<EWeightType>::VIDType dst)
+        {
+            typedef typename ResidualGraph<EWeightType>::VIDType VIDType;
+            const std::size_t num=network.vertex_num();
+            if(src<0||dst<0||static_cast<std::size_t>(src)>=num||static_cast<std::size_t>(dst)>=num)
+                throw std::invalid_argument("dinic error:id must >=0 and <vertex_num.");
+            if(src==dst)
+                throw std::invalid_argument("dinic error: src must not equal dst.");
+
+            const auto& offsets=network.offsets;
+            const auto& heads=network.heads;
+            auto& residual=network.residual;
+            const auto& reverse=network.reverse;
+            std::vector<int> level(num);
+            std::vector<std::size_t> current(num);
+            std::vector<VIDType> queue(num);
+            std::vector<std::size_t> path;          //从s出发的路径上的弧
+            EWeightType total=0;
+            while(true)
+            {
+                //************  广度优先搜索计算层次  *************
+                std::fill(level.begin(),level.end(),-1);
+                std::size_t queue_begin=0,queue_end=0;
+                level[src]=0;
+                queue[queue_end++]=src;
+                while(queue_begin<queue_end&&level[dst]<0)
+                {
+                    VIDType u=queue[queue_begin++];
+                    for(std::size_t arc=offsets[u];arc<offsets[u+1];arc++)
+                    {
+                        VIDType v=heads[arc];
+                        if(residual[arc]>0&&level[v]<0)
+                        {
+                            level[v]=level[u]+1;
+                            queue[queue_end++]=v;
+                        }
+                    }
+                }
+                if(level[dst]<0) break;
+                std::copy(offsets.begin(),offsets.end()-1,current.begin());
+                //************  当前弧深度优先搜索，求阻塞流  *************
+                path.clear();
+                VIDType u=src;
+                while(true)
+                {
+                    if(u==dst)
+                    {
+                        EWeightType delta=residual[path[0]];
+                        for(std::size_t arc:path)
+                            delta=std::min(delta,residual[arc]);
+                        std::size_t saturated=path.size();
+                        for(std::size_t k=0;k<path.size();k++)
+                        {
+                            residual[path[k]]-=delta;
+                            residual[reverse[path[k]]]+=delta;
+                            if(residual[path[k]]==0&&saturated==path.size()) saturated=k;
+                        }
+                        total+=delta;
+                        path.resize(saturated);             //回退到第一条饱和弧的起点
+                        u=path.empty()?src:heads[path.back()];
+                        continue;
+                    }
+                    std::size_t& arc=current[u];
+                    for(;arc<offsets[u+1];arc++)
+                    {
+                        VIDType v=heads[arc];
+                        if(residual[arc]>0&&level[v]==level[u]+1&&(v==dst||level[v]<level[dst]))
+                            break;
+                    }
+                    if(arc<offsets[u+1])                    //前进
+                    {
+                        path.push_back(arc);
+                        u=heads[arc];
+                    }else                                   //回退
+                    {
+                        level[u]=-1;
+                        if(path.empty()) break;
+                        path.pop_back();
+                        u=path.empty()?src:heads[path.back()];
+                        current[u]++;
+                    }
+                }
+            }
+            return total;
+        }
+        //!dinic：最大流的Dinic算法
+        /*!
+        *
+        * \param graph:指定流网络。它必须非空，否则抛出异常。边的权重为容量
+        * \param src: 流的源点，必须有效否则抛出异常
+        * \param dst: 流的汇点，必须有效否则抛出异常
+        * \return: 最大流的值|f|
+        *
+        * 它通过`make_residual_graph`创建残余网络，然后调用`dinic(network,src,dst)`。
+        */
+        template<typename GraphType>
+        typename GraphType::EWeightType dinic(std::shared_ptr<GraphType> graph,typename GraphType::VIDType src,typename GraphType::VIDType dst)
+        {
+            if(!graph)
+                throw std::invalid_argument("dinic error: graph must not be nullptr!");
+            auto network=make_residual_graph(graph);
+            return dinic(network,src,dst);
+        }
+    }
+}
+#endif // DINIC
@@ -0,0 +1,169 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef DINIC_TEST
+#define DINIC_TEST
+#include <random>
+#include "../../../google_test/gtest.h"
+#include "dinic.h"
+#include "../highest_label_push_relabel/highestlabelpushrelabel.h"
+#include "../relabel_to_front/relabeltofront.h"
+#include "../../../graph_algorithms/basic_graph/graph_representation/graph/graph.h"
+#include "../../../graph_algorithms/basic_graph/graph_representation/graph_vertex/vertex.h"
+
+using IntroductionToAlgorithm::GraphAlgorithm::Graph;
+using IntroductionToAlgorithm::GraphAlgorithm::Vertex;
+using IntroductionToAlgorithm::GraphAlgorithm::FrontFlowVertex;
+using IntroductionToAlgorithm::GraphAlgorithm::ResidualGraph;
+using IntroductionToAlgorithm::GraphAlgorithm::make_residual_graph;
+using IntroductionToAlgorithm::GraphAlgorithm::relabel_to_front;
+using IntroductionToAlgorithm::GraphAlgorithm::dinic;
+using IntroductionToAlgorithm::GraphAlgorithm::highest_label_push_relabel;
+
+namespace {
+    const int DN_N= 6;  /*!< 测试的图顶点数量*/
+}
+
+//!DinicTest:测试类，用于为测试提供基础数据
+/*!
+*
+* `DinicTest`是 `::testing::Test` 的子类。它主要用于为每一个`TEST_F`准备测试环境
+*/
+class DinicTest:public ::testing::Test
+{
+public:
+typedef Graph<DN_N,Vertex<int>> GType; /*!< 模板实例化的图类型，该图的顶点类型为`Vertex<int>`*/
+
+protected:
+    void SetUp()
+    {
+        //****  算法导论图26-6   ****
+        _graph=std::make_shared<GType>(0); //边的无效权重为0
+        for(int i=0;i<DN_N;i++)
+            _graph->add_vertex(0);
+
+        _graph->add_edge(std::make_tuple(0,1,16));
+        _graph->add_edge(std::make_tuple(0,2,13));
+        _graph->add_edge(std::make_tuple(1,3,12));
+        _graph->add_edge(std::make_tuple(2,1,4));
+        _graph->add_edge(std::make_tuple(2,4,14));
+        _graph->add_edge(std::make_tuple(3,2,9));
+        _graph->add_edge(std::make_tuple(3,5,20));
+        _graph->add_edge(std::make_tuple(4,3,7));
+        _graph->add_edge(std::make_tuple(4,5,4));
+    }
+    void TearDown(){}
+    //!_check_flow：检查残余网络中保存的是一个值为`value`的流：满足容量限制和流量守恒
+    static void _check_flow(const ResidualGraph<int>& network,int src,int dst,int value)
+    {
+        for(std::size_t arc=0;arc<network.arc_num();arc++)
+        {
+            EXPECT_GE(network.residual[arc],0)<<"arc:"<<arc;
+            EXPECT_EQ(network.flow(arc),-network.flow(network.reverse[arc]))<<"arc:"<<arc;
+        }
+        for(std::size_t u=0;u<network.vertex_num();u++)
+        {
+            if(u==static_cast<std::size_t>(src))
+            {
+                EXPECT_EQ(network.excess(u),-value);
+            }else if(u==static_cast<std::size_t>(dst))
+            {
+                EXPECT_EQ(network.excess(u),value);
+            }else
+            {
+                EXPECT_EQ(network.excess(u),0)<<"u:"<<u;
+            }
+        }
+    }
+    std::shared_ptr<GType> _graph;    /*!< 指向一个图，算法导论图26-6*/
+};
+
+//!DinicTest:测试 dinic 算法
+/*!
+*
+* `test_dinic`：算法导论图26-6的最大流为23；在已经是最大流的网络上再次调用，增加的流量为0
+*/
+TEST_F(DinicTest,test_dinic)
+{
+    EXPECT_EQ(dinic(_graph,0,5),23);
+    auto network=make_residual_graph(_graph);
+    EXPECT_EQ(dinic(network,0,5),23);
+    _check_flow(network,0,5,23);
+    EXPECT_EQ(dinic(network,0,5),0);
+    _check_flow(network,0,5,23);
+    EXPECT_EQ(dinic(network,5,0),23);     //反向弧：从5到0可以将原来的流全部退回
+    _check_flow(network,5,0,0);
+    EXPECT_THROW(dinic(network,0,0),std::invalid_argument);
+    EXPECT_THROW(dinic(network,0,DN_N),std::invalid_argument);
+    EXPECT_THROW(dinic(std::shared_ptr<GType>(),0,5),std::invalid_argument);
+}
+//!DinicTest:测试 dinic 算法
+/*!
+*
+* `test_dinic_random`：在随机的流网络上，最大流的值与`relabel_to_front`相同，且得到的是一个合法的流
+*/
+TEST_F(DinicTest,test_dinic_random)
+{
+    const int num=16;
+    typedef Graph<num,FrontFlowVertex<int>> FrontGType;
+    std::mt19937 gen(26);
+    std::uniform_int_distribution<int> vertex_dist(0,num-1);
+    std::uniform_int_distribution<int> capacity_dist(1,20);
+    for(int round=0;round<20;round++)
+    {
+        auto graph=std::make_shared<FrontGType>(0); //边的无效权重为0
+        for(int i=0;i<num;i++)
+            graph->add_vertex(0);
+        for(int k=0;k<num*3;k++)
+        {
+            int from=vertex_dist(gen),to=vertex_dist(gen);
+            if(from==to||graph->has_edge(from,to)||graph->has_edge(to,from)) continue;  //relabel_to_front 不允许反平行边
+            graph->add_edge(std::make_tuple(from,to,capacity_dist(gen)));
+        }
+        auto network=make_residual_graph(graph);
+        int value=dinic(network,0,num-1);
+        _check_flow(network,0,num-1,value);
+        auto flow=relabel_to_front(graph,0,num-1);
+        int expect=0;
+        for(int i=0;i<num;i++)
+            expect+=flow[0][i]-flow[i][0];
+        EXPECT_EQ(value,expect)<<"round:"<<round;
+    }
+}
+//!DinicTest:测试 dinic 算法
+/*!
+*
+* `test_dinic_large`：在含有反平行边、重边的较大的随机流网络上，结果与`highest_label_push_relabel`相同，且得到的是一个合法的流
+*/
+TEST_F(DinicTest,test_dinic_large)
+{
+    const int num=2000;
+    std::mt19937 gen(2026);
+    std::uniform_int_distribution<int> vertex_dist(0,num-1);
+    std::uniform_int_distribution<int> capacity_dist(1,100);
+    std::vector<ResidualGraph<int>::EdgeTupleType> edges;
+    for(int k=0;k<num*10;k++)
+        edges.push_back(std::make_tuple(vertex_dist(gen),vertex_dist(gen),capacity_dist(gen)));
+    ResidualGraph<int> network(num,edges.begin(),edges.end());
+    ResidualGraph<int> expect_network=network;
+    int value=dinic(network,0,num-1);
+    _check_flow(network,0,num-1,value);
+    EXPECT_EQ(value,highest_label_push_relabel(expect_network,0,num-1));
+    EXPECT_GT(value,0);
+}
+#endif // DINIC_TEST
@@ -178,9 +178,7 @@ namespace IntroductionToAlgorithm
         ford_fulkerson(const std::shared_ptr<GraphType> graph,typename GraphType::VIDType src,typename GraphType::VIDType dst)
         {
             typedef typename GraphType::EWeightType EWeightType;
-            typedef typename GraphType::VIDType VIDType;
             typedef std::array<std::array<EWeightType,GraphType::NUM>,GraphType::NUM> MatrixType;
-            typedef std::function<void(VIDType v_id)> ActionType;
 
             if(!graph)
                 throw std::invalid_argument("ford_fulkerson error: graph must not be nullptr!");
@@ -190,7 +188,7 @@ namespace IntroductionToAlgorithm
                 throw std::invalid_argument("ford_fulkerson error: vertex of id does not exist.");
 
 
-            ActionType empty_action=[](VIDType v_id){};
+            NullVisitor visitor;   //只需要广度优先树，不需要回调
             //********** 初始化 flow 为全 0 **********
             MatrixType flow;
             for(int i=0;i<GraphType::NUM;i++)
@@ -202,7 +200,7 @@ namespace IntroductionToAlgorithm
             {
                 Gf=create_Gf(graph,flow); //创建残余网络
                 //************ 寻找增广路径  *************
-                breadth_first_search<GraphType>(Gf,src,empty_action,empty_action);
+                breadth_first_visit(Gf,src,visitor);
                 auto path=get_path(Gf->vertexes.at(src),Gf->vertexes.at(dst));
                 if(path.size()==0) break;  //不存在增广路径
 
@@ -248,11 +248,10 @@ namespace IntroductionToAlgorithm
 
                 graph->vertexes[src]->h=GraphType::NUM; // h(s)= |V|
                 //**************  对s出发的边调整  *************
-                auto edges=graph->vertex_edge_tuples(src);
-                for(const auto&edge:edges)
+                for(const auto&neighbor:graph->neighbors(src))
                 {
-                    auto v_id=std::get<1>(edge); //{v:(s,v)属于E}
-                    auto c_s_v=std::get<2>(edge);// c(s,v)
+                    auto v_id=neighbor.first; //{v:(s,v)属于E}
+                    auto c_s_v=neighbor.second;// c(s,v)
                     flow[src][v_id]=c_s_v; //f(s,v)
                     graph->vertexes[v_id]->key=c_s_v; // v.e=c(s,v)
                     graph->vertexes[src]->key -=c_s_v; // s.e-=c(s,v)
@@ -0,0 +1,349 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef HIGHESTLABELPUSHRELABEL
+#define HIGHESTLABELPUSHRELABEL
+#include<vector>
+#include<memory>
+#include<stdexcept>
+#include<algorithm>
+#include"../residual_graph/residualgraph.h"
+#include"../../basic_graph/graph_representation/vertex_property_map/vertexpropertymap.h"
+namespace IntroductionToAlgorithm
+{
+    namespace GraphAlgorithm
+    {
+        //!HighestLabelPushRelabel：最高标号推送-重贴标签算法的辅助类
+        /*!
+        * 它保存算法执行过程中每个结点的高度h、超额流量e（二者位于调用者提供的`FlowProperties`中）、当前弧current，以及按照高度组织的两组结点：
+        *
+        * - `_active`：高度为k的溢出结点组成的栈。每次取出高度最大的溢出结点执行释放操作
+        * - `_layer_next`、`_layer_prev`、`_layer_head`：高度为k（k<V）的所有结点组成的双向链表，用于间隙优化
+        *
+        * 它只在`highest_label_push_relabel`内部使用。
+        */
+        template<typename EWeightType> class HighestLabelPushRelabel
+        {
+        public:
+            typedef typename ResidualGraph<EWeightType>::VIDType VIDType; /*!< 顶点编号的类型*/
+            //!显式构造函数
+            /*!
+            * \param network:残余网络
+            * \param src:源点
+            * \param dst:汇点
+            * \param properties:保存高度与超额流量的顶点属性，其结点数量必须等于网络的结点数量
+            */
+            HighestLabelPushRelabel(ResidualGraph<EWeightType>& network,VIDType src,VIDType dst,FlowProperties<EWeightType>& properties):_network(network),_num(network.vertex_num()),
+                _src(src),_dst(dst),_height(properties.height),_excess(properties.excess),_current(_num),_active(2*_num+1),_layer_next(_num),_layer_prev(_num),_layer_head(_num+1),_queue(_num){}
+            //!run：执行算法
+            /*!
+            * \return: 本次调用增加的流量
+            */
+            EWeightType run()
+            {
+                auto& residual=_network.residual;
+                const auto& heads=_network.heads;
+                const auto& reverse=_network.reverse;
+                //************ 初始化：计算超额流量，饱和从源点出发的弧 ***********
+                for(std::size_t u=0;u<_num;u++)
+                    _excess[u]=_network.excess(u);
+                EWeightType old_excess=_excess[_dst];
+                for(std::size_t arc=_network.offsets[_src];arc<_network.offsets[_src+1];arc++)
+                {
+                    EWeightType delta=residual[arc];
+                    if(delta<=0) continue;
+                    residual[arc]-=delta;
+                    residual[reverse[arc]]+=delta;
+                    _excess[_src]-=delta;
+                    _excess[heads[arc]]+=delta;
+                }
+                //************ 第一阶段：求最大预流 ***********
+                _global_relabel(_dst,_src);
+                std::size_t relabel_num=0;
+                while(_max_active>=0)
+                {
+                    if(_active[_max_active].empty())
+                    {
+                        _max_active--;
+                        continue;
+                    }
+                    VIDType u=_active[_max_active].back();
+                    _active[_max_active].pop_back();
+                    if(_height[u]!=_max_active||_excess[u]<=0) continue;  //已被间隙优化提升的结点
+                    relabel_num+=_discharge(u,_dst,true);
+                    if(relabel_num>=_num)                               //周期性的全局重贴标签
+                    {
+                        _global_relabel(_dst,_src);
+                        relabel_num=0;
+                    }
+                }
+                EWeightType flow=_excess[_dst]-old_excess;
+                //************ 第二阶段：将剩余的超额流量送回源点 ***********
+                _global_relabel(_src,_dst);
+                while(_max_active>=0)
+                {
+                    if(_active[_max_active].empty())
+                    {
+                        _max_active--;
+                        continue;
+                    }
+                    VIDType u=_active[_max_active].back();
+                    _active[_max_active].pop_back();
+                    if(_height[u]!=_max_active||_excess[u]<=0) continue;
+                    _discharge(u,_src,false);
+                }
+                return flow;
+            }
+        private:
+            //!_global_relabel：全局重贴标签
+            /*!
+            * \param target:目标结点，超额流量被推送向它
+            * \param excluded:被排除的结点，它不参与推送
+            *
+            * 在残余网络中从`target`开始沿着反向的残余弧执行广度优先搜索，将每个结点的高度设为它到`target`的最短距离；
+            * 不可达的结点高度设为V（它们的超额流量在本阶段不再移动）。然后重建按高度组织的结点集合
+            */
+            void _global_relabel(VIDType target,VIDType excluded)
+            {
+                const auto& offsets=_network.offsets;
+                const auto& heads=_network.heads;
+                const auto& residual=_network.residual;
+                const auto& reverse=_network.reverse;
+                const int unreached=static_cast<int>(_num);
+                std::fill(_height.begin(),_height.end(),unreached);
+                std::size_t queue_begin=0,queue_end=0;
+                _height[target]=0;
+                _queue[queue_end++]=target;
+                while(queue_begin<queue_end)
+                {
+                    VIDType v=_queue[queue_begin++];
+                    for(std::size_t arc=offsets[v];arc<offsets[v+1];arc++)
+                    {
+                        VIDType u=heads[arc];                   //弧 reverse[arc] 为 u-->v
+                        if(u!=excluded&&_height[u]==unreached&&residual[reverse[arc]]>0)
+                        {
+                            _height[u]=_height[v]+1;
+                            _queue[queue_end++]=u;
+                        }
+                    }
+                }
+                _height[excluded]=unreached;
+                //**********  重建结点集合  ************
+                for(auto& active:_active) active.clear();
+                std::fill(_layer_head.begin(),_layer_head.end(),-1);
+                _max_active=-1;
+                _max_layer=-1;
+                for(std::size_t u=0;u<_num;u++)
+                {
+                    _current[u]=offsets[u];
+                    int height=_height[u];
+                    if(height>=unreached||static_cast<VIDType>(u)==target) continue;
+                    _layer_add(u);
+                    if(_excess[u]>0)
+                    {
+                        _active[height].push_back(u);
+                        _max_active=std::max(_max_active,height);
+                    }
+                }
+            }
+            //!_discharge：释放操作
+            /*!
+            * \param u:溢出结点
+            * \param target:目标结点
+            * \param gap:是否执行间隙优化
+            * \return: 重贴标签的次数
+            *
+            * 与`discharge`相同：从当前弧开始推送，当前弧到达末尾时重贴标签。若u的高度达到V，则它的超额流量在本阶段不再移动
+            */
+            std::size_t _discharge(VIDType u,VIDType target,bool gap)
+            {
+                const auto& offsets=_network.offsets;
+                const auto& heads=_network.heads;
+                auto& residual=_network.residual;
+                const auto& reverse=_network.reverse;
+                const int limit=static_cast<int>(_num);
+                std::size_t relabel_num=0;
+                while(_excess[u]>0)
+                {
+                    //*********** 推送 **********
+                    std::size_t& arc=_current[u];
+                    for(;arc<offsets[u+1];arc++)
+                    {
+                        VIDType v=heads[arc];
+                        if(residual[arc]<=0||_height[u]!=_height[v]+1) continue;
+                        EWeightType delta=std::min(_excess[u],residual[arc]);
+                        residual[arc]-=delta;
+                        residual[reverse[arc]]+=delta;
+                        if(_excess[v]<=0&&v!=target)                //v 成为溢出结点
+                        {
+                            _active[_height[v]].push_back(v);
+                            _max_active=std::max(_max_active,_height[v]);  //u 可能已经被重贴标签到高于 _max_active 的高度
+                        }
+                        _excess[u]-=delta;
+                        _excess[v]+=delta;
+                        if(_excess[u]<=0) break;                    //当前弧可能仍有残余容量，保留它
+                    }
+                    if(_excess[u]<=0) break;
+                    //*********** 重贴标签 **********
+                    int old_height=_height[u];
+                    _layer_remove(u);
+                    if(gap&&_layer_head[old_height]<0)              //间隙：高于old_height的结点都无法到达汇点
+                    {
+                        for(int height=old_height;height<=_max_layer;height++)
+                        {
+                            for(int v=_layer_head[height];v>=0;v=_layer_next[v])
+                                _height[v]=limit;
+                            _layer_head[height]=-1;
+                        }
+                        _max_layer=old_height-1;
+                        _height[u]=limit;
+                        break;
+                    }
+                    int new_height=2*limit;
+                    for(std::size_t a=offsets[u];a<offsets[u+1];a++)
+                        if(residual[a]>0&&_height[heads[a]]+1<new_height)
+                            new_height=_height[heads[a]]+1;
+                    relabel_num++;
+                    _current[u]=offsets[u];
+                    if(new_height>=limit)                       //本阶段中它的超额流量不再移动
+                    {
+                        _height[u]=limit;
+                        break;
+                    }
+                    _height[u]=new_height;
+                    _layer_add(u);
+                }
+                return relabel_num;
+            }
+            //!_layer_add：将结点加入它的高度对应的链表
+            void _layer_add(VIDType u)
+            {
+                int height=_height[u];
+                _layer_prev[u]=-1;
+                _layer_next[u]=_layer_head[height];
+                if(_layer_head[height]>=0) _layer_prev[_layer_head[height]]=u;
+                _layer_head[height]=u;
+                _max_layer=std::max(_max_layer,height);
+            }
+            //!_layer_remove：将结点从它的高度对应的链表中删除
+            void _layer_remove(VIDType u)
+            {
+                int height=_height[u];
+                if(_layer_prev[u]>=0) _layer_next[_layer_prev[u]]=_layer_next[u];
+                else _layer_head[height]=_layer_next[u];
+                if(_layer_next[u]>=0) _layer_prev[_layer_next[u]]=_layer_prev[u];
+            }
+
+            ResidualGraph<EWeightType>& _network;   /*!< 残余网络*/
+            std::size_t _num;                       /*!< 结点数量*/
+            VIDType _src;                           /*!< 源点*/
+            VIDType _dst;                           /*!< 汇点*/
+            VertexPropertyMap<int>& _height;        /*!< 各结点的高度*/
+            VertexPropertyMap<EWeightType>& _excess;/*!< 各结点的超额流量*/
+            std::vector<std::size_t> _current;      /*!< 各结点的当前弧*/
+            std::vector<std::vector<VIDType>> _active;  /*!< 按高度组织的溢出结点*/
+            std::vector<int> _layer_next;           /*!< 高度链表中的下一个结点*/
+            std::vector<int> _layer_prev;           /*!< 高度链表中的上一个结点*/
+            std::vector<int> _layer_head;           /*!< 各高度链表的头结点*/
+            std::vector<VIDType> _queue;            /*!< 全局重贴标签时广度优先搜索的队列*/
+            int _max_active;                        /*!< 溢出结点的最大高度*/
+            int _max_layer;                         /*!< 高度链表的最大高度*/
+        };
+
+        //!highest_label_push_relabel：最大流的最高标号推送-重贴标签算法。算法导论26章26.4节、26.5节
+        /*!
+        *
+        * \param network:残余网络。算法在它的当前流的基础上增加流，结束后它保存的就是最大流
+        * \param src: 流的源点，必须在`[0,network.vertex_num())`之间，否则抛出异常
+        * \param dst: 流的汇点，必须在`[0,network.vertex_num())`之间且不等于`src`，否则抛出异常
+        * \return: 本次调用增加的流量。若`network`初始没有流，则就是最大流的值|f|
+        *
+        * ## 最高标号推送-重贴标签算法
+        *
+        * >本节的一些概念参考 generic_push_relabel 算法、relabel_to_front 算法
+        *
+        * 它是通用推送-重贴标签方法的一种实现，选择溢出结点的规则为：每次选择高度最大的溢出结点执行释放操作（`discharge`）。
+        * 其时间复杂度为 O(V^2 E^(1/2))。此外它采用了两个启发式优化：
+        *
+        * - 间隙优化：若某个结点重贴标签之后，原来的高度k上不再有任何结点，则所有高度大于k（且小于V）的结点都不可能再到达汇点，
+        *   直接将它们的高度提升为V
+        * - 全局重贴标签：初始时以及每执行V次重贴标签之后，在残余网络中从汇点开始沿反向的残余弧执行广度优先搜索，将每个结点的高度设置为它到汇点的精确距离
+        *
+        * ### 算法步骤
+        *
+        * - 初始化预流：饱和从源点出发的所有弧
+        * - 第一阶段：执行全局重贴标签，然后反复取出高度最大的溢出结点执行释放操作，直到高度小于V的结点都不再溢出。此时汇点的超额流量就是最大流的值。
+        *   高度达到V的结点的超额流量在这一阶段不再移动，此时得到的是一个最大预流
+        * - 第二阶段：以源点为目标（不经过汇点）执行同样的过程，将剩余的超额流量送回源点，使得预流成为一个流
+        *
+        * ### 算法性能
+        *
+        * 时间复杂度 O(V^2 E^(1/2))。空间复杂度 O(V+E)
+        */
+        template<typename EWeightType>
+        EWeightType highest_label_push_relabel(ResidualGraph<EWeightType>& network,typename ResidualGraph<EWeightType>::VIDType src,
+                                               typename ResidualGraph<EWeightType>::VIDType dst)
+        {
+            FlowProperties<EWeightType> properties;
+            return highest_label_push_relabel(network,src,dst,properties);
+        }
+        //!highest_label_push_relabel：最高标号推送-重贴标签算法，高度与超额流量保存在调用者提供的顶点属性中
+        /*!
+        *
+        * \param network:残余网络。算法在它的当前流的基础上增加流，结束后它保存的就是最大流
+        * \param src: 流的源点，必须在`[0,network.vertex_num())`之间，否则抛出异常
+        * \param dst: 流的汇点，必须在`[0,network.vertex_num())`之间且不等于`src`，否则抛出异常
+        * \param properties:保存各结点高度与超额流量的顶点属性，它被调整为结点数量并置为0
+        * \return: 本次调用增加的流量
+        *
+        * 算法与`highest_label_push_relabel(network,src,dst)`相同。结束时除源点与汇点之外所有结点的超额流量都为0，
+        * `properties.excess[dst]`等于网络中的流值|f|。对同一个网络反复求解时，复用同一个`properties`可以避免重新分配内存。
+        */
+        template<typename EWeightType>
+        EWeightType highest_label_push_relabel(ResidualGraph<EWeightType>& network,typename ResidualGraph<EWeightType>::VIDType src,
+                                               typename ResidualGraph<EWeightType>::VIDType dst,FlowProperties<EWeightType>& properties)
+        {
+            const std::size_t num=network.vertex_num();
+            if(src<0||dst<0||static_cast<std::size_t>(src)>=num||static_cast<std::size_t>(dst)>=num)
+                throw std::invalid_argument("highest_label_push_relabel error:id must >=0 and <vertex_num.");
+            if(src==dst)
+                throw std::invalid_argument("highest_label_push_relabel error: src must not equal dst.");
+            properties.reset(num);
+            return HighestLabelPushRelabel<EWeightType>(network,src,dst,properties).run();
+        }
+        //!highest_label_push_relabel：最大流的最高标号推送-重贴标签算法
+        /*!
+        *
+        * \param graph:指定流网络。它必须非空，否则抛出异常。边的权重为容量
+        * \param src: 流的源点，必须有效否则抛出异常
+        * \param dst: 流的汇点，必须有效否则抛出异常
+        * \return: 最大流的值|f|
+        *
+        * 它通过`make_residual_graph`创建残余网络，然后调用`highest_label_push_relabel(network,src,dst)`。
+        */
+        template<typename GraphType>
+        typename GraphType::EWeightType highest_label_push_relabel(std::shared_ptr<GraphType> graph,typename GraphType::VIDType src,typename GraphType::VIDType dst)
+        {
+            if(!graph)
+                throw std::invalid_argument("highest_label_push_relabel error: graph must not be nullptr!");
+            auto network=make_residual_graph(graph);
+            return highest_label_push_relabel(network,src,dst);
+        }
+    }
+}
+#endif // HIGHESTLABELPUSHRELABEL
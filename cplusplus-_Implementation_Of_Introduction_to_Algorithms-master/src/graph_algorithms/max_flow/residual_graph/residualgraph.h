@@ -0,0 +1,155 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef RESIDUALGRAPH
+#define RESIDUALGRAPH
+#include<vector>
+#include<tuple>
+#include<memory>
+#include<stdexcept>
+#include<cstddef>
+namespace IntroductionToAlgorithm
+{
+    namespace GraphAlgorithm
+    {
+        //!ResidualGraph：流网络的残余网络，以成对的弧存储，算法导论26章26.2节
+        /*!
+        * `ford_fulkerson`、`generic_push_relabel`、`relabel_to_front`用`N*N`的流矩阵保存流，并通过`has_edge`/`weight`查询残余容量。
+        * `ResidualGraph`的空间为 O(V+E)：流网络的每一条边(u,v)对应两条弧，一条是正向弧u-->v，另一条是反向弧v-->u。
+        * 弧按照起点以压缩稀疏行(CSR)的形式存放：
+        *
+        * - `offsets`：行偏移数组，大小为`顶点数量+1`。顶点`u`出发的弧位于`[offsets[u],offsets[u+1])`区间
+        * - `heads`：弧的终点
+        * - `residual`：弧的残余容量c_f。正向弧初始为边的容量，反向弧初始为0
+        * - `capacity`：弧的容量。正向弧为边的容量，反向弧为0
+        * - `reverse`：与该弧成对的另一条弧的下标。沿一条弧推送d单位的流，就是将它的残余容量减少d，同时将`reverse`弧的残余容量增加d
+        *
+        * 由于每条边都有自己的一对弧，流网络可以包含反平行边(u,v)、(v,u)以及重边，不需要像算法导论那样假设(v,u)不属于E。自环被忽略。
+        *
+        * 弧(u,v)上的流为`capacity-residual`（对于反向弧，它是对应正向弧上流的相反数）。
+        */
+        template<typename EWType=int> struct ResidualGraph
+        {
+            typedef int VIDType;        /*!< 顶点编号的类型*/
+            typedef EWType EWeightType; /*!< 容量、流的类型*/
+            typedef std::tuple<VIDType, VIDType, EWeightType> EdgeTupleType; /*!< 边的三元素（起点编号，终点编号，容量)组成的元组*/
+
+            //!显式构造函数，从边的集合构建残余网络
+            /*!
+            * \param  vertex_num:顶点数量
+            * \param  begin:边容器的起始迭代器
+            * \param  end:边容器的终止迭代器
+            *
+            * 若边的顶点不在`[0,vertex_num)`之间，或者边的容量为负，则抛出异常。构建过程采用两趟计数排序，时间复杂度为 O(V+E)
+            */
+            template<typename Iterator>
+            ResidualGraph(std::size_t vertex_num,const Iterator&begin,const Iterator&end):offsets(vertex_num+1,0)
+            {
+                //*********  第一趟：检查边，统计每个顶点出发的弧数量  ********
+                for(Iterator iter=begin;iter!=end;++iter)
+                {
+                    VIDType from=std::get<0>(*iter),to=std::get<1>(*iter);
+                    if(from<0||to<0||static_cast<std::size_t>(from)>=vertex_num||static_cast<std::size_t>(to)>=vertex_num)
+                        throw std::invalid_argument("ResidualGraph error: id must >=0 and <vertex_num.");
+                    if(std::get<2>(*iter)<0)
+                        throw std::invalid_argument("ResidualGraph error: capacity must >=0.");
+                    if(from==to) continue;
+                    offsets[from+1]++;
+                    offsets[to+1]++;
+                }
+                for(std::size_t i=0;i<vertex_num;i++)
+                    offsets[i+1]+=offsets[i];
+                //*********  第二趟：放置成对的弧  ********
+                std::size_t arc_num=offsets[vertex_num];
+                heads.resize(arc_num);
+                residual.resize(arc_num);
+                capacity.resize(arc_num);
+                reverse.resize(arc_num);
+                std::vector<std::size_t> next(offsets.begin(),offsets.end()-1);
+                for(Iterator iter=begin;iter!=end;++iter)
+                {
+                    VIDType from=std::get<0>(*iter),to=std::get<1>(*iter);
+                    if(from==to) continue;
+                    std::size_t forward=next[from]++;
+                    std::size_t backward=next[to]++;
+                    heads[forward]=to;
+                    heads[backward]=from;
+                    residual[forward]=capacity[forward]=std::get<2>(*iter);
+                    residual[backward]=capacity[backward]=0;
+                    reverse[forward]=backward;
+                    reverse[backward]=forward;
+                }
+            }
+            //!vertex_num:返回顶点数量
+            std::size_t vertex_num() const {return offsets.size()-1;}
+            //!arc_num:返回弧的数量（边的数量的两倍）
+            std::size_t arc_num() const {return heads.size();}
+            //!flow:返回弧上的流
+            /*!
+            * \param arc:弧的下标
+            * \return: 弧上的流。反向弧上的流为负数或者0
+            */
+            EWeightType flow(std::size_t arc) const {return capacity[arc]-residual[arc];}
+            //!excess:返回顶点的超额流：流入该顶点的流减去流出该顶点的流
+            /*!
+            * \param u:顶点`id`
+            * \return: 超额流。对于流网络中的一个流，源点的超额流为 -|f|，汇点的超额流为 |f|，其他顶点的超额流为0
+            */
+            EWeightType excess(VIDType u) const
+            {
+                EWeightType result=0;
+                for(std::size_t arc=offsets[u];arc<offsets[u+1];arc++)
+                    result-=flow(arc);
+                return result;
+            }
+            //!reset:将所有弧上的流清零
+            void reset() {residual=capacity;}
+
+            std::vector<std::size_t> offsets;   /*!< 行偏移数组*/
+            std::vector<VIDType> heads;         /*!< 弧的终点*/
+            std::vector<EWeightType> residual;  /*!< 弧的残余容量*/
+            std::vector<EWeightType> capacity;  /*!< 弧的容量*/
+            std::vector<std::size_t> reverse;   /*!< 成对的弧的下标*/
+        };
+
+        //!make_residual_graph：从图创建残余网络
+        /*!
+        * \param graph:指向流网络的强指针，必须非空。若为空则抛出异常
+        * \return: 残余网络。图的每一条边(u,v)的权重就是它的容量
+        *
+        * 它通过`graph->neighbors(u)`获取边，因此适用于`Graph`、`CSRGraph`等图类型
+        */
+        template<typename GraphType>
+        ResidualGraph<typename GraphType::EWeightType> make_residual_graph(std::shared_ptr<GraphType> graph)
+        {
+            typedef typename GraphType::EWeightType EWeightType;
+            if(!graph)
+                throw std::invalid_argument("make_residual_graph error: graph must not be nullptr!");
+            std::vector<std::tuple<int,int,EWeightType>> edges;
+            std::size_t num=graph->vertexes.size();
+            for(std::size_t i=0;i<num;i++)
+            {
+                if(!graph->vertexes[i]) continue;
+                for(const auto& neighbor:graph->neighbors(i))
+                    edges.push_back(std::make_tuple(static_cast<int>(i),static_cast<int>(neighbor.first),neighbor.second));
+            }
+            return ResidualGraph<EWeightType>(num,edges.begin(),edges.end());
+        }
+    }
+}
+#endif // RESIDUALGRAPH
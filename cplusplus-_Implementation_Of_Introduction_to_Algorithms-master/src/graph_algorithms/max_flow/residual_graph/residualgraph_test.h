@@ -0,0 +1,92 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef RESIDUALGRAPH_TEST
+#define RESIDUALGRAPH_TEST
+#include "../../../google_test/gtest.h"
+#include "residualgraph.h"
+#include "../../basic_graph/graph_representation/graph/graph.h"
+#include "../../basic_graph/graph_representation/graph_vertex/vertex.h"
+
+using IntroductionToAlgorithm::GraphAlgorithm::ResidualGraph;
+using IntroductionToAlgorithm::GraphAlgorithm::make_residual_graph;
+using IntroductionToAlgorithm::GraphAlgorithm::Graph;
+using IntroductionToAlgorithm::GraphAlgorithm::Vertex;
+
+//!test_residual_graph：测试ResidualGraph
+/*!
+*
+* 每条边对应一对互为`reverse`的弧；自环被忽略；反平行边、重边各自拥有自己的弧
+*/
+TEST(ResidualGraphTest,test_residual_graph)
+{
+    typedef ResidualGraph<int>::EdgeTupleType EdgeTupleType;
+    std::vector<EdgeTupleType> edges({std::make_tuple(0,1,5),std::make_tuple(1,0,3),std::make_tuple(1,2,4),
+                                      std::make_tuple(1,2,6),std::make_tuple(2,2,9)});
+    ResidualGraph<int> network(3,edges.begin(),edges.end());
+    EXPECT_EQ(network.vertex_num(),3);
+    EXPECT_EQ(network.arc_num(),8);
+    for(int u=0;u<3;u++)
+        for(std::size_t arc=network.offsets[u];arc<network.offsets[u+1];arc++)
+        {
+            std::size_t reverse=network.reverse[arc];
+            EXPECT_EQ(network.reverse[reverse],arc);
+            EXPECT_EQ(network.heads[reverse],u);
+            EXPECT_EQ(network.capacity[arc]+network.capacity[reverse],network.residual[arc]+network.residual[reverse]);
+            EXPECT_EQ(network.flow(arc),0);
+        }
+    EXPECT_EQ(network.offsets,std::vector<std::size_t>({0,2,6,8}));
+    //************ 沿弧 0-->1 推送 2 单位流  ***********
+    std::size_t arc=network.offsets[0];
+    while(network.heads[arc]!=1||network.capacity[arc]!=5) arc++;
+    network.residual[arc]-=2;
+    network.residual[network.reverse[arc]]+=2;
+    EXPECT_EQ(network.flow(arc),2);
+    EXPECT_EQ(network.flow(network.reverse[arc]),-2);
+    EXPECT_EQ(network.excess(0),-2);
+    EXPECT_EQ(network.excess(1),2);
+    network.reset();
+    EXPECT_EQ(network.excess(1),0);
+
+    std::vector<EdgeTupleType> bad_id({std::make_tuple(0,3,1)});
+    EXPECT_THROW(ResidualGraph<int>(3,bad_id.begin(),bad_id.end()),std::invalid_argument);
+    std::vector<EdgeTupleType> bad_capacity({std::make_tuple(0,1,-1)});
+    EXPECT_THROW(ResidualGraph<int>(3,bad_capacity.begin(),bad_capacity.end()),std::invalid_argument);
+}
+//!test_make_residual_graph：测试make_residual_graph
+/*!
+*
+* 从`Graph`创建的残余网络中，正向弧的容量就是边的权重
+*/
+TEST(ResidualGraphTest,test_make_residual_graph)
+{
+    auto graph=std::make_shared<Graph<4,Vertex<int>>>(0); //边的无效权重为0
+    for(int i=0;i<4;i++)
+        graph->add_vertex(0);
+    graph->add_edge(std::make_tuple(0,1,7));
+    graph->add_edge(std::make_tuple(2,3,8));
+    auto network=make_residual_graph(graph);
+    EXPECT_EQ(network.vertex_num(),4);
+    EXPECT_EQ(network.arc_num(),4);
+    EXPECT_EQ(network.heads[network.offsets[0]],1);
+    EXPECT_EQ(network.capacity[network.offsets[0]],7);
+    EXPECT_EQ(network.heads[network.offsets[2]],3);
+    EXPECT_EQ(network.capacity[network.offsets[2]],8);
+    EXPECT_THROW(make_residual_graph(std::shared_ptr<Graph<4,Vertex<int>>>()),std::invalid_argument);
+}
+#endif // RESIDUALGRAPH_TEST
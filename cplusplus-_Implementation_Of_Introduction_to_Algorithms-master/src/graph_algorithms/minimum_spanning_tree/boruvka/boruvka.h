@@ -0,0 +1,150 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef BORUVKA
+#define BORUVKA
+#include <functional>
+#include <atomic>
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <stdexcept>
+#include "../../../set_algorithms/concurrent_disjoint_set/concurrentdisjointset.h"
+#include "../../../parallel_algorithms/parallel_for/parallelfor.h"
+#include "../../basic_graph/graph_visitor/graphvisitor.h"
+#include "../../../header.h"
+namespace IntroductionToAlgorithm
+{
+    namespace GraphAlgorithm
+    {
+        //!parallel_boruvka：最小生成树的并行Borůvka算法，算法导论23章思考题23-2
+        /*!
+        * \param graph:指向图的强指针，必须非空。若为空则抛出异常
+        * \param pre_action:一个可调用对象，对每一条加入最小生成树的边调用一次，调用参数为该边的两个顶点的`id`。默认为空操作
+        * \param post_action:一个可调用对象，在`pre_action`之后对同一条边调用，调用参数为该边的两个顶点的`id`。默认为空操作
+        * \param thread_num:线程数量。若为0则使用硬件支持的并发线程数量。默认为0
+        * \return: 最小生成树的权重。若图不连通，则为最小生成森林的权重
+        *
+        * 它与`kruskal`一样将图的每一条边(u,v)视为无向边，不要求图的顶点为`SetVertex`，也不修改图的顶点。
+        *
+        * ### 算法原理
+        *
+        * 对于每一个连通分量，与它关联的最小权重边是一条安全边。Borůvka算法以轮为单位执行：在每一轮中，为每一个分量找到与它关联的最小权重边，
+        * 将这些边全部加入最小生成树，然后将这些边连接的分量合并。每一轮至少使分量的数量减半，因此最多执行 lgV 轮。
+        *
+        * 为了保证同一轮选出的边不构成环，边按照（权重，边的编号）的字典序比较，即所有边的权重互不相同。
+        *
+        * ### 算法步骤
+        *
+        * 初始化：将图的边复制到数组中（忽略自环），每个顶点单独构成一个分量。然后每一轮执行：
+        *
+        * - 并行地计算每个顶点所在分量的代表元素
+        * - 并行地删除两个端点在同一个分量中的边。若没有剩下的边，则算法结束
+        * - 并行地扫描剩下的边：对边的两个端点所在的分量，用原子的 compare_exchange 循环将该分量的最小边更新为这条边
+        * - 并行地对每个分量的最小边执行`ConcurrentDisjointSet::union_set`。两个分量可能选中同一条边，此时只有一次合并成功，这条边只计入一次
+        * - 在调用线程中，将本轮加入的边按照（权重，边的编号）排序，累加权重并调用`pre_action`、`post_action`
+        *
+        * 因此回调总是在调用线程中执行，同一轮中的边按照权重递增的次序回调；不同轮之间的边不保证按照权重递增。
+        *
+        * ### 算法性能
+        *
+        * 时间复杂度 O(ElgV/p + VlgV)，其中p为线程数量
+        */
+        template<typename GraphType,typename ActionType=NoAction>
+        typename GraphType::EWeightType parallel_boruvka(std::shared_ptr<GraphType> graph,
+        ActionType pre_action=NoAction(),
+        ActionType post_action=NoAction(),
+        std::size_t thread_num=0)
+        {
+            typedef typename GraphType::VIDType VIDType;
+            typedef typename GraphType::EWeightType EWeightType;
+            using IntroductionToAlgorithm::SetAlgorithm::ConcurrentDisjointSet;
+            using IntroductionToAlgorithm::ParallelAlgorithm::thread_num_or_default;
+            using IntroductionToAlgorithm::ParallelAlgorithm::parallel_for;
+            using IntroductionToAlgorithm::ParallelAlgorithm::parallel_remove_if;
+
+            if(!graph)
+                throw std::invalid_argument("parallel_boruvka error: graph must not be nullptr!");
+            const std::size_t num=graph->vertexes.size();
+            const std::size_t threads=thread_num_or_default(thread_num);
+            const std::size_t NONE=std::numeric_limits<std::size_t>::max();
+            //*********** 初始化：复制边（忽略自环） ****************
+            std::vector<VIDType> froms,tos;
+            std::vector<EWeightType> weights;
+            for(std::size_t i=0;i<num;i++)
+            {
+                if(!vertex_exists(graph->vertexes,i)) continue;
+                for(const auto& neighbor:graph->neighbors(i))
+                    if(static_cast<std::size_t>(neighbor.first)!=i)
+                    {
+                        froms.push_back(i);
+                        tos.push_back(neighbor.first);
+                        weights.push_back(neighbor.second);
+                    }
+            }
+            auto less=[&weights](std::size_t edge1,std::size_t edge2){
+                return weights[edge1]<weights[edge2]||(!(weights[edge2]<weights[edge1])&&edge1<edge2);
+            };
+            std::vector<std::size_t> edges(weights.size());      //尚未被删除的边的编号
+            for(std::size_t e=0;e<edges.size();e++) edges[e]=e;
+
+            ConcurrentDisjointSet sets(num);
+            std::vector<std::size_t> component(num);
+            std::vector<std::atomic<std::size_t>> best(num);    //各分量的最小边
+            std::vector<char> accepted(num);                    //各分量的最小边是否被本轮加入最小生成树
+            std::vector<std::size_t> round_edges;
+            EWeightType weight=0;
+            while(true)
+            {
+                //*********** 计算分量，删除分量内部的边 ****************
+                parallel_for(0,num,threads,[&](std::size_t v){component[v]=sets.find_set(v);});
+                edges.erase(parallel_remove_if(edges.begin(),edges.end(),threads,[&](std::size_t e){
+                    return component[froms[e]]==component[tos[e]];
+                }),edges.end());
+                if(edges.empty()) break;
+                //*********** 每个分量的最小边 ****************
+                parallel_for(0,num,threads,[&](std::size_t v){best[v].store(NONE,std::memory_order_relaxed);});
+                parallel_for(0,edges.size(),threads,[&](std::size_t k){
+                    std::size_t e=edges[k];
+                    for(std::size_t c:{component[froms[e]],component[tos[e]]})
+                    {
+                        std::size_t old=best[c].load(std::memory_order_relaxed);
+                        while((old==NONE||less(e,old))&&!best[c].compare_exchange_weak(old,e,std::memory_order_relaxed));
+                    }
+                });
+                //*********** 合并分量 ****************
+                parallel_for(0,num,threads,[&](std::size_t v){
+                    std::size_t e=best[v].load(std::memory_order_relaxed);
+                    accepted[v]=component[v]==v&&e!=NONE&&sets.union_set(froms[e],tos[e]);
+                });
+                round_edges.clear();
+                for(std::size_t v=0;v<num;v++)
+                    if(accepted[v]) round_edges.push_back(best[v].load(std::memory_order_relaxed));
+                std::sort(round_edges.begin(),round_edges.end(),less);
+                for(std::size_t e:round_edges)
+                {
+                    pre_action(froms[e],tos[e]);
+                    weight+=weights[e];
+                    post_action(froms[e],tos[e]);
+                }
+            }
+            return weight;
+        }
+    }
+}
+#endif // BORUVKA
@@ -0,0 +1,159 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef BORUVKA_TEST
+#define BORUVKA_TEST
+#include <random>
+#include <set>
+#include "../../../google_test/gtest.h"
+#include "boruvka.h"
+#include "../kruskal/kruskal.h"
+#include "../../basic_graph/graph_representation/graph/graph.h"
+#include "../../basic_graph/graph_representation/csr_graph/csrgraph.h"
+#include "../../basic_graph/graph_representation/graph_vertex/set_vertex.h"
+using IntroductionToAlgorithm::GraphAlgorithm::Graph;
+using IntroductionToAlgorithm::GraphAlgorithm::CSRGraph;
+using IntroductionToAlgorithm::GraphAlgorithm::SetVertex;
+using IntroductionToAlgorithm::GraphAlgorithm::kruskal;
+using IntroductionToAlgorithm::GraphAlgorithm::parallel_boruvka;
+namespace{
+    const int BO_NUM=10;  /*!< 图顶点数量*/
+}
+
+//!BoruvkaTest:测试类，用于为测试提供基础数据
+/*!
+*
+* `BoruvkaTest`是 `::testing::Test` 的子类。它主要用于为每一个`TEST_F`准备测试环境
+*/
+class BoruvkaTest:public ::testing::Test
+{
+public:
+    typedef Graph<BO_NUM,SetVertex<int>> GType; /*!< 模板实例化的图类型，该图的顶点类型为`SetVertex<int>`*/
+    typedef std::function<void(SetVertex<int>::VIDType ,SetVertex<int>::VIDType)> ActionType;/*!< 模板实例化的Action类型*/
+    typedef std::pair<GType::VIDType,GType::VIDType> PairType; /*!< 边的两个顶点*/
+protected:
+    void SetUp()
+    {
+        _1v_graph=std::make_shared<GType>(-1);//边的无效权重为-1
+        _1v_graph->add_vertex(0);  //该图只有一个顶点
+        _1v_graph->add_edge(std::make_tuple(0,0,1));//该图只有一个顶点，有一条边指向自己
+
+        //****  含顶点图和边图：10个顶点，9条边   ****
+        _list_graph=std::make_shared<GType>(-1); //边的无效权重为-1
+        for(int i=0;i<BO_NUM;i++)
+            _list_graph->add_vertex(0);
+        for(int i=0;i<BO_NUM-1;i++)
+                _list_graph->add_edge(std::make_tuple(i+1,i,i+1)); //该图的边是从右到左组成一个链条
+
+        //****  含顶点图和边图：10个顶点，90条边   ****
+        _all_edges_graph=std::make_shared<GType>(-1); //边的无效权重为-1
+        for(int i=0;i<BO_NUM;i++)
+            _all_edges_graph->add_vertex(0);
+        for(int i=0;i<BO_NUM;i++)
+            for(int j=0;j<BO_NUM;j++)
+                if(i==j) continue;
+                else _all_edges_graph->add_edge(std::make_tuple(i,j,i+j)); //该图中任意一对顶点之间都有边
+    }
+    void TearDown(){}
+    //!_undirected：将边的两个顶点按照`id`从小到大排列
+    static PairType _undirected(GType::VIDType id1,GType::VIDType id2)
+    {
+        return id1<id2?std::make_pair(id1,id2):std::make_pair(id2,id1);
+    }
+    std::shared_ptr<GType> _1v_graph;     /*!< 指向一个图，该图只有一个顶点*/
+    std::shared_ptr<GType> _list_graph;   /*!< 指向一个图，该图的边组成一个链条*/
+    std::shared_ptr<GType> _all_edges_graph;    /*!< 指向一个图，该图中任意一对顶点之间都有边*/
+};
+
+//!BoruvkaTest:测试最小生成树的parallel_boruvka方法
+/*!
+* `test_boruvka`:最小生成树的权重与`kruskal`相同；每条边的`pre_action`、`post_action`各调用一次
+*/
+TEST_F(BoruvkaTest,test_boruvka)
+{
+    for(std::size_t thread_num:{1,4})
+    {
+        //************* 单点图 **************
+        {
+            std::vector<PairType> edges;
+            ActionType pre_action=[&edges](GType::VIDType id1,GType::VIDType id2){edges.push_back(std::make_pair(id1,id2));};
+            EXPECT_EQ(parallel_boruvka(_1v_graph,pre_action,pre_action,thread_num),0);
+            EXPECT_TRUE(edges.empty());
+        }
+        //************** 单链图：最小生成树就是全部的边 ******************
+        {
+            std::set<PairType> pre_edges,post_edges;
+            ActionType pre_action=[&pre_edges](GType::VIDType id1,GType::VIDType id2){pre_edges.insert(_undirected(id1,id2));};
+            ActionType post_action=[&post_edges](GType::VIDType id1,GType::VIDType id2){post_edges.insert(_undirected(id1,id2));};
+            EXPECT_EQ(parallel_boruvka(_list_graph,pre_action,post_action,thread_num),(BO_NUM-1)*BO_NUM/2);
+            std::set<PairType> result_edges;
+            for(int i=1;i<BO_NUM;i++)
+                result_edges.insert(std::make_pair(i-1,i));
+            EXPECT_EQ(pre_edges,result_edges);
+            EXPECT_EQ(post_edges,result_edges);
+        }
+        //***************** 任意一对顶点之间都有边的图：最小生成树为以0为中心的星形  **************
+        {
+            std::vector<PairType> edges;
+            ActionType pre_action=[&edges](GType::VIDType id1,GType::VIDType id2){edges.push_back(_undirected(id1,id2));};
+            ActionType post_action=[](GType::VIDType,GType::VIDType){};
+            EXPECT_EQ(parallel_boruvka(_all_edges_graph,pre_action,post_action,thread_num),kruskal(_all_edges_graph));
+            std::sort(edges.begin(),edges.end());
+            std::vector<PairType> result_edges;
+            for(int i=1;i<BO_NUM;i++)
+                result_edges.push_back(std::make_pair(0,i));
+            EXPECT_EQ(edges,result_edges);
+        }
+    }
+    EXPECT_THROW(parallel_boruvka(std::shared_ptr<GType>()),std::invalid_argument);
+}
+//!BoruvkaTest:测试最小生成树的parallel_boruvka方法
+/*!
+* `test_boruvka_random`:在随机的大图（含大量权重相同的边）上，结果与`kruskal`相同，与线程数量无关；非连通图返回最小生成森林的权重
+*/
+TEST_F(BoruvkaTest,test_boruvka_random)
+{
+    typedef CSRGraph<SetVertex<int>> CSRType;
+    const int vertex_num=2000;
+    const int edge_num=20000;
+    std::mt19937 gen(2017);
+    std::uniform_int_distribution<int> vertex_dist(0,vertex_num/2-1);   //两个互不连通的半图
+    std::uniform_int_distribution<int> weight_dist(-100,100);
+    std::set<std::pair<int,int>> edge_set;
+    std::vector<CSRType::EdgeTupleType> edges;
+    while(edges.size()<edge_num)
+    {
+        int offset=(edges.size()%2)*(vertex_num/2);
+        int from=vertex_dist(gen)+offset,to=vertex_dist(gen)+offset;
+        if(from==to||!edge_set.insert(std::make_pair(from,to)).second) continue;
+        edges.push_back(std::make_tuple(from,to,weight_dist(gen)));
+    }
+    auto graph=std::make_shared<CSRType>(vertex_num,edges.begin(),edges.end(),unlimit<int>());
+    int expect=kruskal(graph);
+    for(std::size_t thread_num:{1,2,4})
+    {
+        int num=0;
+        std::set<PairType> tree_edges;
+        std::function<void(int,int)> pre_action=[&](int from,int to){num++;tree_edges.insert(_undirected(from,to));};
+        std::function<void(int,int)> post_action=[](int,int){};
+        EXPECT_EQ(parallel_boruvka(graph,pre_action,post_action,thread_num),expect)<<"thread_num:"<<thread_num;
+        EXPECT_EQ(num,vertex_num-2)<<"thread_num:"<<thread_num;      //两棵树
+        EXPECT_EQ(tree_edges.size(),vertex_num-2)<<"thread_num:"<<thread_num;
+    }
+}
+#endif // BORUVKA_TEST
@@ -19,6 +19,14 @@
 #ifndef KRUSKAL
 #define KRUSKAL
 #include "../../../set_algorithms/disjoint_set/disjointset.h"
+#include "../../../set_algorithms/flat_disjoint_set/flatdisjointset.h"
+#include "../../../parallel_algorithms/parallel_for/parallelfor.h"
+#include "../../../parallel_algorithms/parallel_sort/parallelsort.h"
+#include <vector>
+#include <random>
+#include <algorithm>
+#include "../../basic_graph/graph_visitor/graphvisitor.h"
+#include "../../../header.h"
 
 using IntroductionToAlgorithm::SetAlgorithm::DisjointSetNode;
 
@@ -30,9 +38,8 @@ namespace IntroductionToAlgorithm
         //!kruskal：最小生成树的Kruskal算法，算法导论23章23.2节
         /*!
         * \param graph:指向图的强指针，必须非空。若为空则抛出异常
-        * \param source_id：最小生成树的根结点`id`，必须有效。若无效则抛出异常
-        * \param pre_action:一个可调用对象，在每次从最小优先级队列中弹出最小顶点时立即调用，调用参数为该顶点的`id`。默认为空操作，即不进行任何操作
-        * \param post_action:一个可调用对象，在每次从最小优先级队列中弹出最小顶点并处理完它的边时立即调用，调用参数为该顶点的`id`。默认为空操作，即不进行任何操作
+        * \param pre_action:一个可调用对象，在每次将一条边(u,v)加入最小生成树之前调用，调用参数为该边的两个顶点的`id`，即`(u,v)`。默认为空操作`NoAction`，即不进行任何操作
+        * \param post_action:一个可调用对象，在每次将一条边(u,v)加入最小生成树之后调用，调用参数为该边的两个顶点的`id`，即`(u,v)`。默认为空操作`NoAction`，即不进行任何操作
         * \return: 最小生成树的权重
         *
         * ## 最小生成树
@@ -64,21 +71,23 @@ namespace IntroductionToAlgorithm
         *
         * Kruskal算法运行时间依赖于不相交集合数据结构的实现方式。如果采用算法导论21.3节讨论的不相交集合森林实现（也是我在src/set_algorithms/disjoint_set中实现的），
         * 则Kruskal算法的时间为 O(ElgV)
+        *
+        * 排序后的边来自图的`sorted_edges()`，它只对边的下标排序，不复制边。若调用过`graph->sorted_edge_cache.enable()`，
+        * 下标数组缓存在图中，在边没有被修改的同一个图上再次运行时不需要再排序
         */
-        template<typename GraphType,typename ActionType=std::function< void(typename GraphType::VIDType,typename GraphType::VIDType)>>
+        template<typename GraphType,typename ActionType=NoAction>
         typename GraphType::EWeightType kruskal(std::shared_ptr<GraphType> graph,
-        ActionType pre_action=[](typename GraphType::VIDType,typename GraphType::VIDType){},
-        ActionType post_action=[](typename GraphType::VIDType,typename GraphType::VIDType){})
+        ActionType pre_action=NoAction(),
+        ActionType post_action=NoAction())
         {
             typedef typename GraphType::VertexType VertexType;
-            typedef typename GraphType::EdgeTupleType EdgeTupleType;
             typedef DisjointSetNode<VertexType> NodeType;
             if(!graph)
                 throw std::invalid_argument("kruskal error: graph must not be nullptr!");
             //*********** 初始化 ****************
             std::vector<std::shared_ptr<NodeType>> sets;
 
-            for(int i=0;i<GraphType::NUM;i++)
+            for(std::size_t i=0;i<graph->vertexes.size();i++)
             {
                 auto vertex=graph->vertexes.at(i);
                 if(vertex)                                              //添加顶点到`disjoint_set`中
@@ -91,10 +100,7 @@ namespace IntroductionToAlgorithm
             }
             //****************** 循环  ************************
             typename GraphType::EWeightType weight=0;
-            auto edges=graph->edge_tuples();
-            std::sort(edges.begin(),edges.end(),
-               [](const EdgeTupleType&edge1,const EdgeTupleType&edge2)->bool{ return std::get<2>(edge1)<std::get<2>(edge2);});
-            for(const auto&edge:edges)
+            for(const auto&edge:graph->sorted_edges())                  //按权重递增的次序遍历边
             {
                 auto from_id=std::get<0>(edge);
                 auto to_id=std::get<1>(edge);
@@ -112,6 +118,146 @@ namespace IntroductionToAlgorithm
             }
             return weight;
         }
+
+        //!KruskalEdge：filter_kruskal 使用的边
+        template<typename VIDType,typename EWeightType> struct KruskalEdge
+        {
+            VIDType from;       /*!< 边的起点*/
+            VIDType to;         /*!< 边的终点*/
+            EWeightType weight; /*!< 边的权重*/
+        };
+
+        //!filter_kruskal：最小生成树的Filter-Kruskal算法
+        /*!
+        * \param graph:指向图的强指针，必须非空。若为空则抛出异常
+        * \param pre_action:一个可调用对象，在每次将一条边加入最小生成树之前调用，调用参数为该边的两个顶点的`id`。默认为空操作
+        * \param post_action:一个可调用对象，在每次将一条边加入最小生成树之后调用，调用参数为该边的两个顶点的`id`。默认为空操作
+        * \param thread_num:排序与过滤所用的线程数量。若为0则使用硬件支持的并发线程数量。默认为1
+        * \return: 最小生成树的权重
+        *
+        * 最小生成树的权重与`kruskal`相同，`pre_action`、`post_action`的调用时机也相同：按照权重单调递增的顺序，对每一条加入最小生成树的边调用一次。
+        * 与`kruskal`的区别在于：
+        *
+        * - 不相交集合采用整数下标的`FlatDisjointSet`（按大小合并、路径减半），不需要图的顶点为`SetVertex`，也不修改图的顶点
+        * - 边被复制到一个`KruskalEdge`数组中，而不是`edge_tuples()`返回的元组数组
+        * - 不对全部的边排序，而是采用 Filter-Kruskal 的划分策略
+        *
+        * ### 算法步骤
+        *
+        * 对一组边E：
+        *
+        * - 若E的边数不超过阈值，则将E排序，然后按照`kruskal`的方式依次处理
+        * - 否则选取一个主元权重p（随机取三条边权重的中位数），将E划分为 E< 、E= 、E> 三部分：
+        *   - 递归处理 E<
+        *   - 依次处理 E= 中的边（它们的权重相同，不需要排序）
+        *   - 过滤 E>：删除两个端点已经在同一棵树中的边，因为它们不可能再成为安全边。然后递归处理剩下的边
+        *
+        * 当最小生成树已经包含 |V|-1 条边时提前结束。对于稠密图，大部分较重的边在排序之前就被过滤掉了。
+        *
+        * `thread_num`大于1时，排序采用`parallel_sort`，过滤时各线程并行地检查一段边（此时不相交集合森林不被修改，查找采用只读的`find_root`）。
+        *
+        * ### 算法性能
+        *
+        * 期望时间复杂度 O(E + VlgVlg(E/V))
+        */
+        template<typename GraphType,typename ActionType=NoAction>
+        typename GraphType::EWeightType filter_kruskal(std::shared_ptr<GraphType> graph,
+        ActionType pre_action=NoAction(),
+        ActionType post_action=NoAction(),
+        std::size_t thread_num=1)
+        {
+            typedef typename GraphType::VIDType VIDType;
+            typedef typename GraphType::EWeightType EWeightType;
+            typedef KruskalEdge<VIDType,EWeightType> EdgeType;
+            using IntroductionToAlgorithm::SetAlgorithm::FlatDisjointSet;
+            using IntroductionToAlgorithm::ParallelAlgorithm::thread_num_or_default;
+            using IntroductionToAlgorithm::ParallelAlgorithm::parallel_remove_if;
+            using IntroductionToAlgorithm::ParallelAlgorithm::parallel_sort;
+
+            if(!graph)
+                throw std::invalid_argument("filter_kruskal error: graph must not be nullptr!");
+            const std::size_t num=graph->vertexes.size();
+            const std::size_t threads=thread_num_or_default(thread_num);
+            //*********** 初始化：复制边（忽略自环），统计顶点数量 ****************
+            std::vector<EdgeType> edges;
+            std::size_t vertex_num=0;
+            for(std::size_t i=0;i<num;i++)
+            {
+                if(!vertex_exists(graph->vertexes,i)) continue;
+                vertex_num++;
+                for(const auto& neighbor:graph->neighbors(i))
+                    if(static_cast<std::size_t>(neighbor.first)!=i)
+                        edges.push_back(EdgeType{static_cast<VIDType>(i),neighbor.first,neighbor.second});
+            }
+            FlatDisjointSet sets(num);
+            EWeightType weight=0;
+            std::size_t tree_edge_num=0;
+            auto done=[&](){return tree_edge_num+1>=vertex_num;};
+            auto less=[](const EdgeType& edge1,const EdgeType& edge2){return edge1.weight<edge2.weight;};
+            //************ 按顺序处理已排序（或权重相同）的边 ****************
+            auto process=[&](std::size_t begin,std::size_t end){
+                for(std::size_t k=begin;k<end&&!done();k++)
+                {
+                    const EdgeType& edge=edges[k];
+                    if(sets.find_set(edge.from)!=sets.find_set(edge.to))
+                    {
+                        pre_action(edge.from,edge.to);
+                        sets.union_set(edge.from,edge.to);
+                        weight+=edge.weight;
+                        tree_edge_num++;
+                        post_action(edge.from,edge.to);
+                    }
+                }
+            };
+            //************ 过滤：删除区间中两个端点已经在同一棵树中的边，返回保留的边的终止位置 ****************
+            auto filter=[&](std::size_t begin,std::size_t end)->std::size_t{
+                return parallel_remove_if(edges.begin()+begin,edges.begin()+end,threads,[&sets](const EdgeType& edge){
+                    return sets.find_root(edge.from)==sets.find_root(edge.to);
+                })-edges.begin();
+            };
+
+            //****************** 循环：用栈代替递归  ************************
+            struct Range
+            {
+                std::size_t begin;  /*!< 区间起始*/
+                std::size_t end;    /*!< 区间终止*/
+                bool need_filter;   /*!< 处理之前是否需要过滤*/
+                bool same_weight;   /*!< 区间中的边权重是否相同*/
+            };
+            const std::size_t threshold=std::max<std::size_t>(vertex_num,1024);
+            std::mt19937 gen(0);
+            std::vector<Range> ranges{Range{0,edges.size(),false,false}};
+            while(!ranges.empty()&&!done())
+            {
+                Range range=ranges.back();
+                ranges.pop_back();
+                if(range.need_filter) range.end=filter(range.begin,range.end);
+                if(range.begin>=range.end) continue;
+                if(range.same_weight)
+                {
+                    process(range.begin,range.end);
+                }else if(range.end-range.begin<=threshold)
+                {
+                    parallel_sort(edges.begin()+range.begin,edges.begin()+range.end,threads,less);
+                    process(range.begin,range.end);
+                }else
+                {
+                    //*********** 三路划分 **********
+                    std::uniform_int_distribution<std::size_t> dist(range.begin,range.end-1);
+                    EWeightType samples[3]={edges[dist(gen)].weight,edges[dist(gen)].weight,edges[dist(gen)].weight};
+                    std::sort(samples,samples+3);
+                    EWeightType pivot=samples[1];
+                    auto middle_begin=std::partition(edges.begin()+range.begin,edges.begin()+range.end,[pivot](const EdgeType& edge){return edge.weight<pivot;});
+                    auto middle_end=std::partition(middle_begin,edges.begin()+range.end,[pivot](const EdgeType& edge){return !(pivot<edge.weight);});
+                    std::size_t middle_begin_index=middle_begin-edges.begin();
+                    std::size_t middle_end_index=middle_end-edges.begin();
+                    ranges.push_back(Range{middle_end_index,range.end,true,false});                // E>，稍后过滤
+                    ranges.push_back(Range{middle_begin_index,middle_end_index,false,true});       // E=
+                    ranges.push_back(Range{range.begin,middle_begin_index,false,false});           // E<，先处理
+                }
+            }
+            return weight;
+        }
     }
 }
 
@@ -22,8 +22,15 @@
 #include "kruskal.h"
 #include "../../basic_graph/graph_representation/graph/graph.h"
 #include "../../../graph_algorithms/basic_graph/graph_representation/graph_vertex/set_vertex.h"
+#include "../../basic_graph/graph_representation/csr_graph/csrgraph.h"
+#include "../../basic_graph/graph_representation/graph_vertex/vertex.h"
+#include <random>
+#include <set>
 using IntroductionToAlgorithm::GraphAlgorithm::Graph;
+using IntroductionToAlgorithm::GraphAlgorithm::CSRGraph;
+using IntroductionToAlgorithm::GraphAlgorithm::Vertex;
 using IntroductionToAlgorithm::GraphAlgorithm::kruskal;
+using IntroductionToAlgorithm::GraphAlgorithm::filter_kruskal;
 using IntroductionToAlgorithm::SetAlgorithm::DisjointSetNode;
 using IntroductionToAlgorithm::GraphAlgorithm::SetVertex;
 namespace{
@@ -142,5 +149,72 @@ TEST_F(KruskalTest,test_kruskal)
                         (edges[i].first==result_edges[i].second && edges[i].second==result_edges[i].first));
     }
 }
+//!KruskalTest:测试最小生成树的filter_kruskal方法
+/*!
+* `test_filter_kruskal`:测试最小生成树的filter_kruskal方法：权重、加入的边与`kruskal`相同，且不修改图的顶点
+*/
+TEST_F(KruskalTest,test_filter_kruskal)
+{
+    typedef  std::pair<GType::VIDType,GType::VIDType> PairType;
+    std::vector<std::shared_ptr<GType>> graphs({_1v_graph,_1e_graph,_list_graph,_all_edges_graph});
+    for(const auto& graph:graphs)
+    {
+        std::vector<PairType> edges,result_edges;
+        ActionType pre_action=[&edges](GType::VIDType id1,GType::VIDType id2){edges.push_back(std::make_pair(id1,id2));};
+        ActionType result_action=[&result_edges](GType::VIDType id1,GType::VIDType id2){result_edges.push_back(std::make_pair(id1,id2));};
+        EXPECT_EQ(filter_kruskal(graph,pre_action),kruskal(graph,result_action));
+        EXPECT_EQ(edges.size(),result_edges.size());
+        for(std::size_t i=0;i<edges.size();i++)
+            EXPECT_TRUE((edges[i].first==result_edges[i].first && edges[i].second==result_edges[i].second)||\
+                        (edges[i].first==result_edges[i].second && edges[i].second==result_edges[i].first));
+    }
+    //************** 不需要 SetVertex ***************
+    auto graph=std::make_shared<Graph<K_NUM,Vertex<int>>>(-1);
+    for(int i=0;i<K_NUM;i++)
+        graph->add_vertex(0);
+    graph->add_edge(std::make_tuple(0,1,5));
+    graph->add_edge(std::make_tuple(2,3,7));  //非连通图：返回最小生成森林的权重
+    EXPECT_EQ(filter_kruskal(graph),12);
+    EXPECT_THROW(filter_kruskal(std::shared_ptr<GType>()),std::invalid_argument);
+}
+//!KruskalTest:测试最小生成树的filter_kruskal方法
+/*!
+* `test_filter_kruskal_random`:在随机的大图上测试filter_kruskal方法：过滤、划分、并行排序都被执行，结果与`kruskal`相同，且边按照权重单调递增的顺序加入
+*/
+TEST_F(KruskalTest,test_filter_kruskal_random)
+{
+    typedef CSRGraph<SetVertex<int>> CSRType;
+    const int vertex_num=2000;
+    const int edge_num=40000;
+    std::mt19937 gen(2016);
+    std::uniform_int_distribution<int> vertex_dist(0,vertex_num-1);
+    std::uniform_int_distribution<int> weight_dist(1,500);   //大量权重相同的边
+    std::set<std::pair<int,int>> edge_set;
+    std::vector<CSRType::EdgeTupleType> edges;
+    while(edges.size()<edge_num)
+    {
+        int from=vertex_dist(gen),to=vertex_dist(gen);
+        if(from==to||!edge_set.insert(std::make_pair(from,to)).second) continue;
+        edges.push_back(std::make_tuple(from,to,weight_dist(gen)));
+    }
+    auto graph=std::make_shared<CSRType>(vertex_num,edges.begin(),edges.end(),-1);
+    int expect=kruskal(graph);
+    for(std::size_t thread_num:{1,4})
+    {
+        int last_weight=0;
+        int num=0;
+        bool ordered=true;
+        std::function<void(int,int)> pre_action=[&](int from,int to){
+            int weight=graph->weight(from,to);
+            ordered=ordered&&weight>=last_weight;
+            last_weight=weight;
+            num++;
+        };
+        std::function<void(int,int)> post_action=[](int,int){};
+        EXPECT_EQ(filter_kruskal(graph,pre_action,post_action,thread_num),expect)<<"thread_num:"<<thread_num;
+        EXPECT_TRUE(ordered)<<"thread_num:"<<thread_num;
+        EXPECT_EQ(num,vertex_num-1)<<"thread_num:"<<thread_num;
+    }
+}
 #endif // KRUSKAL_TEST
 
@@ -19,9 +19,10 @@
 #ifndef PRIM
 #define PRIM
 #include <functional>
-#include "../../../queue_algorithms/min_queue/minqueue.h"
+#include "../../../queue_algorithms/indexed_min_queue/indexedminqueue.h"
 #include "../../../header.h"
-using IntroductionToAlgorithm::QueueAlgorithm::MinQueue;
+#include "../../basic_graph/graph_visitor/graphvisitor.h"
+using IntroductionToAlgorithm::QueueAlgorithm::IndexedMinQueue;
 using IntroductionToAlgorithm::GraphAlgorithm::unlimit;
 namespace IntroductionToAlgorithm
 {
@@ -31,8 +32,8 @@ namespace IntroductionToAlgorithm
         /*!
         * \param graph:指向图的强指针，必须非空。若为空则抛出异常
         * \param source_id：最小生成树的根结点`id`，必须有效。若无效则抛出异常
-        * \param pre_action:一个可调用对象，在每次从最小优先级队列中弹出最小顶点时立即调用，调用参数为该顶点的`id`。默认为空操作，即不进行任何操作
-        * \param post_action:一个可调用对象，在每次从最小优先级队列中弹出最小顶点并处理完它的边时立即调用，调用参数为该顶点的`id`。默认为空操作，即不进行任何操作
+        * \param pre_action:一个可调用对象，在每次从最小优先级队列中弹出最小顶点时立即调用，调用参数为该顶点的`id`。默认为空操作`NoAction`，即不进行任何操作
+        * \param post_action:一个可调用对象，在每次从最小优先级队列中弹出最小顶点并处理完它的边时立即调用，调用参数为该顶点的`id`。默认为空操作`NoAction`，即不进行任何操作
         * \return: 最小生成树的权重
         *
         * `source_id`在以下情况下无效：
@@ -73,23 +74,24 @@ namespace IntroductionToAlgorithm
         *
         * Prim总时间代价为O(VlgV+ElgV)=O(ElgV)(使用最小堆实现的最小优先级队列），或者O(E+VlgV)（使用斐波那契堆实现最小优先级队列）
         */
-        template<typename GraphType,typename ActionType=std::function< void(typename GraphType::VIDType)>>
+        template<typename GraphType,typename ActionType=NoAction>
         typename GraphType::EWeightType prim(std::shared_ptr<GraphType> graph,typename GraphType::VIDType source_id,
-             ActionType pre_action=[](typename GraphType::VIDType){},ActionType post_action=[](typename GraphType::VIDType){})
+             ActionType pre_action=NoAction(),ActionType post_action=NoAction())
         {
             typedef typename GraphType::VertexType VertexType;
             typedef typename VertexType::KeyType KeyType;
             if(!graph)
                 throw std::invalid_argument("prim error: graph must not be nullptr!");
-            if(source_id<0||source_id>=GraphType::NUM||!graph->vertexes.at(source_id))
+            if(source_id<0||static_cast<std::size_t>(source_id)>=graph->vertexes.size()||!graph->vertexes.at(source_id))
                 throw std::invalid_argument("prim error: source_id muse belongs [0,N) and graph->vertexes[source_id] must not be nullptr!");
 
             auto vertex_compare=[](std::shared_ptr<VertexType> first,std::shared_ptr<VertexType> second){return first->key<second->key;};
             auto vertex_key_get=[](std::shared_ptr<VertexType> v)->KeyType& {return v->key;};
-            MinQueue<VertexType,KeyType> min_queue(vertex_compare,vertex_key_get);
+            auto vertex_id_get=[](std::shared_ptr<VertexType> v)->std::size_t {return v->id;};
+            IndexedMinQueue<VertexType,KeyType> min_queue(graph->vertexes.size(),vertex_compare,vertex_key_get,vertex_id_get);
 
             //********** 初始化顶点  ****************
-            for(int i=0;i<GraphType::NUM;i++)
+            for(std::size_t i=0;i<graph->vertexes.size();i++)
             {
                 auto vertex=graph->vertexes.at(i);
                 if(vertex)
@@ -107,12 +109,11 @@ namespace IntroductionToAlgorithm
                 auto minNode=min_queue.extract_min();
                 pre_action(minNode->id);
 
-                auto edges =graph->vertex_edge_tuples(minNode->id);
-                for(const auto& edge_tuple:edges)
+                for(const auto& neighbor:graph->neighbors(minNode->id))
                 {
-                    auto another_id=std::get<1>(edge_tuple);
+                    auto another_id=neighbor.first;
                     auto another_vertex=graph->vertexes.at(another_id);
-                    auto edge_weight=std::get<2>(edge_tuple);
+                    auto edge_weight=neighbor.second;
 
                     auto index=min_queue.index_inqueue(another_vertex);
                     if(index>=0&& edge_weight<another_vertex->key)
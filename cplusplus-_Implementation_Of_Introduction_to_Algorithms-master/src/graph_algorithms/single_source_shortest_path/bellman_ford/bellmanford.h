@@ -19,7 +19,13 @@
 #ifndef BELLMAN_FORD
 #define BELLMAN_FORD
 #include <memory>
+#include <deque>
+#include <vector>
+#include <atomic>
+#include <cstdint>
 #include "../../../header.h"
+#include "../../../parallel_algorithms/parallel_for/parallelfor.h"
+#include "../../../parallel_algorithms/atomic_min/atomicmin.h"
 namespace IntroductionToAlgorithm
 {
     namespace GraphAlgorithm
@@ -44,11 +50,11 @@ namespace IntroductionToAlgorithm
         {
             if(!graph)
                 throw std::invalid_argument("initialize_single_source error: graph must not be nullptr!");
-            if(source_id<0||source_id>=GraphType::NUM||!graph->vertexes.at(source_id))
+            if(source_id<0||static_cast<std::size_t>(source_id)>=graph->vertexes.size()||!graph->vertexes.at(source_id))
                 throw std::invalid_argument("initialize_single_source error: source_id muse belongs [0,N) and graph->vertexes[source_id] must not be nullptr!");
 
             //**************** 设置所有结点 *****************
-            for(int i=0;i<GraphType::NUM;i++)
+            for(std::size_t i=0;i<graph->vertexes.size();i++)
             {
                 auto vertex=graph->vertexes.at(i);
                 if(vertex)
@@ -67,7 +73,7 @@ namespace IntroductionToAlgorithm
         * \param from:松弛有向边的起始结点，必须非空。若为空则抛出异常
         * \param to：松弛有向边的终止结点，必须非空且不等于from。若为空或者等于from则抛出异常
         * \param weight:有向边的权重
-        * \return: void
+        * \return: 是否更新了`to`的`key`和`parent`
         *
         *
         * 对每一个结点v来说，我们维持一个属性v.key，它记录了从源结点s到结点v的最短路径权重的上界。我们称v.key为s到v的最短路径估计。
@@ -79,20 +85,23 @@ namespace IntroductionToAlgorithm
         *
         *
         */
-        template<typename VertexType> void relax(std::shared_ptr<VertexType> from,std::shared_ptr<VertexType> to,typename VertexType::KeyType weight)
+        template<typename VertexType> bool relax(std::shared_ptr<VertexType> from,std::shared_ptr<VertexType> to,typename VertexType::KeyType weight)
         {
             if(!from || !to)
                 throw std::invalid_argument("relax error: from_vertex and to_vertex must not be nullptr!");
             if(from==to)
                 throw std::invalid_argument("relax error: from_vertex must not be to_vertex!");
+            if(from->key>=unlimit<typename VertexType::KeyType>()) //u.key为正无穷（u不可达），则不可能松弛。负权重的边不能使其变为有限值
+                return false;
             if((from->key+weight)>=unlimit<typename VertexType::KeyType>()) //u.key+weight为正无穷，则不可能松弛
-                return;
+                return false;
             if(to->key>from->key+weight)
             {
                 to->key=from->key+weight;
                 to->parent=from;
+                return true;
             }
-
+            return false;
         }
 
         //!bellman_ford：单源最短路径的bellman_ford算法，算法导论24章24.1节
@@ -131,13 +140,14 @@ namespace IntroductionToAlgorithm
         * ### 算法步骤
         *
         * - 执行单源最短路径的初始化过程
-        * - 进行|V|-1次处理，每次处理过程为：对图的每一条边进行一次松弛操作
+        * - 进行|V|-1次处理，每次处理过程为：对图的每一条边进行一次松弛操作。若某一次处理没有更新任何结点，则最短路径估计已经收敛，
+        *   此时不可能存在可以继续松弛的边（因此也不存在权重为负值的环路），直接返回`true`
         * - 检查图中是否存在权重为负的环路并返回与之相适应的布尔值
         *
         *
         * ### 算法性能
         *
-        * 时间复杂度为O(VE)
+        * 时间复杂度为O(VE)。若最短路径树的深度为 k，则只需要 k+1 次处理，时间复杂度为O(kE)
         *
         */
         template<typename GraphType> bool bellman_ford(std::shared_ptr<GraphType> graph, typename GraphType::VIDType source_id)
@@ -145,26 +155,232 @@ namespace IntroductionToAlgorithm
 
             if(!graph)
                 throw std::invalid_argument("bellman_ford error: graph must not be nullptr!");
-            if(source_id<0||source_id>=GraphType::NUM||!graph->vertexes.at(source_id))
+            if(source_id<0||static_cast<std::size_t>(source_id)>=graph->vertexes.size()||!graph->vertexes.at(source_id))
                 throw std::invalid_argument("bellman_ford error: source_id muse belongs [0,N) and graph->vertexes[source_id] must not be nullptr!");
 
             initialize_single_source(graph,source_id);
             //************* 循环处理  ***************
-            for(int i=0;i<GraphType::NUM-1;i++)
+            for(std::size_t i=1;i<graph->vertexes.size();i++)
             {
-                for(const auto&edge:graph->edge_tuples())
+                bool changed=false;
+                for(std::size_t from=0;from<graph->vertexes.size();from++)      //按起点依次遍历所有的边
                 {
-                    relax(graph->vertexes[std::get<0>(edge)],graph->vertexes[std::get<1>(edge)],std::get<2>(edge));
+                    auto from_vertex=graph->vertexes[from];
+                    if(!from_vertex) continue;
+                    for(const auto&neighbor:graph->neighbors(from))
+                        changed|=relax(from_vertex,graph->vertexes[neighbor.first],neighbor.second);
                 }
+                if(!changed) return true;                                       //已经收敛
             }
             //**********  检验是否存在从源点可达的权重为负的环路 *************
-            for(const auto&edge:graph->edge_tuples())
+            for(std::size_t from=0;from<graph->vertexes.size();from++)
+            {
+                auto from_vertex=graph->vertexes[from];
+                if(!from_vertex) continue;
+                for(const auto&neighbor:graph->neighbors(from))
+                {
+                    if(graph->vertexes[neighbor.first]->key>from_vertex->key+neighbor.second)
+                        return false;
+                }
+            }
+            return true;
+        }
+
+        //!bellman_ford_spfa：单源最短路径的基于队列的bellman_ford算法（SPFA）
+        /*!
+        * \param graph:指向图的强指针，必须非空。若为空则抛出异常
+        * \param source_id：源结点`id`，必须有效。若无效则抛出异常
+        * \return: 是否不包含可以从源结点可达的权重为负值的环路。若返回值为true，则说明不包含可以从源结点可达的权重为负值的环路
+        *
+        * `bellman_ford`的每一次处理都松弛所有的边。但是只有最短路径估计在上一次处理中发生了变化的结点，它出发的边才可能松弛成功。
+        * 因此本算法用一个先进先出队列保存最短路径估计发生变化、且尚未处理的结点：
+        *
+        * - 执行单源最短路径的初始化过程，将源结点放入队列
+        * - 循环直到队列为空：弹出队首结点u，松弛从u出发的所有边(u,v)。若v.key减小且v不在队列中，则将v放入队列
+        *
+        * 负权重环路的检测：对每个结点v记录当前最短路径估计所对应路径的边数 length(v)=length(u)+1。不存在负权重环路时最短路径至多有|V|-1条边，
+        * 因此一旦某个结点的 length 达到|V|，则说明从源结点可达一个权重为负值的环路，立即返回`false`。
+        *
+        * 算法结束时结点的`key`与`bellman_ford`相同。最短路径不唯一时，`parent`可能与`bellman_ford`不同，但同样构成一棵最短路径树。
+        *
+        * ### 算法性能
+        *
+        * 最坏时间复杂度为O(VE)，与`bellman_ford`相同；在实际的稀疏图上通常只需要检查很少的边
+        *
+        */
+        template<typename GraphType> bool bellman_ford_spfa(std::shared_ptr<GraphType> graph, typename GraphType::VIDType source_id)
+        {
+            typedef typename GraphType::VIDType VIDType;
+            if(!graph)
+                throw std::invalid_argument("bellman_ford_spfa error: graph must not be nullptr!");
+            if(source_id<0||static_cast<std::size_t>(source_id)>=graph->vertexes.size()||!graph->vertexes.at(source_id))
+                throw std::invalid_argument("bellman_ford_spfa error: source_id muse belongs [0,N) and graph->vertexes[source_id] must not be nullptr!");
+
+            initialize_single_source(graph,source_id);
+            const std::size_t num=graph->vertexes.size();
+            std::vector<char> in_queue(num,0);
+            std::vector<std::size_t> length(num,0);             //当前最短路径估计所对应路径的边数
+            std::deque<VIDType> queue;
+            queue.push_back(source_id);
+            in_queue[source_id]=1;
+            while(!queue.empty())
             {
-                if(graph->vertexes[std::get<1>(edge)]->key>graph->vertexes[std::get<0>(edge)]->key+std::get<2>(edge))
-                    return false;
+                VIDType from=queue.front();
+                queue.pop_front();
+                in_queue[from]=0;
+                auto from_vertex=graph->vertexes[from];
+                for(const auto&neighbor:graph->neighbors(from))
+                {
+                    VIDType to=neighbor.first;
+                    if(to==from)                                //自环：权重为负则构成负权重环路
+                    {
+                        if(neighbor.second<0) return false;
+                        continue;
+                    }
+                    if(relax(from_vertex,graph->vertexes[to],neighbor.second))
+                    {
+                        length[to]=length[from]+1;
+                        if(length[to]>=num) return false;       //路径边数达到|V|，存在负权重环路
+                        if(!in_queue[to])
+                        {
+                            queue.push_back(to);
+                            in_queue[to]=1;
+                        }
+                    }
+                }
             }
             return true;
         }
+
+        //!parallel_bellman_ford：单源最短路径的并行bellman_ford算法
+        /*!
+        * \param graph:指向图的强指针，必须非空。若为空则抛出异常
+        * \param source_id：源结点`id`，必须有效。若无效则抛出异常
+        * \param thread_num：线程数量。若为0则使用硬件支持的并发线程数量
+        * \return: 是否不包含可以从源结点可达的权重为负值的环路。若返回值为true，则说明不包含可以从源结点可达的权重为负值的环路
+        *
+        * 与`bellman_ford`相同，进行至多|V|-1次处理，某一次处理没有更新任何结点时提前结束，最后检查是否仍有可以松弛的边。区别在于：
+        *
+        * - 所有的边被展开为数组，并划分为连续的若干段，每一次处理中各线程并行地松弛各自的一段
+        * - 每个结点的（最短路径估计，父结点`id`）被打包为一个64位整数存放于原子数组中（估计值的符号位取反以保持有符号整数的大小次序），
+        *   松弛是一次`atomic_fetch_min`。因此读到的总是某个合法的估计值，且第 k 次处理之后，边数不超过 k 的最短路径一定已经求得
+        *
+        * 算法结束时结点的`key`与`bellman_ford`相同。距离相同时父结点为`id`最小的一个满足 u.key+w(u,v)=v.key 的结点，与线程数量无关。
+        *
+        * ### 算法性能
+        *
+        * 总工作量与`bellman_ford`相同，每一次处理在各线程之间并行
+        *
+        */
+        template<typename GraphType> bool parallel_bellman_ford(std::shared_ptr<GraphType> graph, typename GraphType::VIDType source_id,std::size_t thread_num=0)
+        {
+            typedef typename GraphType::VIDType VIDType;
+            typedef typename GraphType::EWeightType EWeightType;
+            using IntroductionToAlgorithm::ParallelAlgorithm::parallel_for;
+            using IntroductionToAlgorithm::ParallelAlgorithm::parallel_blocks;
+            using IntroductionToAlgorithm::ParallelAlgorithm::atomic_fetch_min;
+            using IntroductionToAlgorithm::ParallelAlgorithm::pack_pair;
+            using IntroductionToAlgorithm::ParallelAlgorithm::pack_high;
+            using IntroductionToAlgorithm::ParallelAlgorithm::pack_low;
+            if(!graph)
+                throw std::invalid_argument("parallel_bellman_ford error: graph must not be nullptr!");
+            if(source_id<0||static_cast<std::size_t>(source_id)>=graph->vertexes.size()||!graph->vertexes.at(source_id))
+                throw std::invalid_argument("parallel_bellman_ford error: source_id muse belongs [0,N) and graph->vertexes[source_id] must not be nullptr!");
+
+            const std::size_t num=graph->vertexes.size();
+            const std::size_t threads=ParallelAlgorithm::thread_num_or_default(thread_num);
+            const long long INFINITE=unlimit<EWeightType>();
+            const std::uint32_t NO_PARENT=0xFFFFFFFF;
+            auto encode=[](long long key)->std::uint32_t{return std::uint32_t(std::int32_t(key))^0x80000000u;};
+            auto decode=[](std::uint32_t code)->long long{return std::int32_t(code^0x80000000u);};
+
+            //************* 将所有的边展开为数组 ****************
+            std::vector<std::size_t> offsets(num+1,0);
+            parallel_for(0,num,threads,[&](std::size_t i){
+                std::size_t degree=0;
+                if(vertex_exists(graph->vertexes,i))
+                    for(const auto& neighbor:graph->neighbors(i)) {(void)neighbor;degree++;}
+                offsets[i+1]=degree;
+            });
+            for(std::size_t i=0;i<num;i++) offsets[i+1]+=offsets[i];
+            const std::size_t edge_num=offsets[num];
+            std::vector<VIDType> froms(edge_num),tos(edge_num);
+            std::vector<EWeightType> weights(edge_num);
+            parallel_for(0,num,threads,[&](std::size_t i){
+                if(!vertex_exists(graph->vertexes,i)) return;
+                std::size_t k=offsets[i];
+                for(const auto& neighbor:graph->neighbors(i))
+                {
+                    froms[k]=i;
+                    tos[k]=neighbor.first;
+                    weights[k]=neighbor.second;
+                    k++;
+                }
+            });
+
+            //************* 初始化 ****************
+            std::unique_ptr<std::atomic<std::uint64_t>[]> state(new std::atomic<std::uint64_t>[num]);  //（最短路径估计，父结点）
+            parallel_for(0,num,threads,[&](std::size_t i){state[i].store(pack_pair(encode(INFINITE),NO_PARENT),std::memory_order_relaxed);});
+            state[source_id].store(pack_pair(encode(0),NO_PARENT),std::memory_order_relaxed);
+            auto key_of=[&](std::size_t v)->long long{return decode(pack_high(state[v].load(std::memory_order_relaxed)));};
+
+            //************* 循环处理  ***************
+            std::vector<char> changes(threads);
+            bool converged=false;
+            for(std::size_t i=1;i<num&&!converged;i++)
+            {
+                std::fill(changes.begin(),changes.end(),0);
+                parallel_blocks(0,edge_num,threads,[&](std::size_t begin,std::size_t end,std::size_t index){
+                    bool changed=false;
+                    for(std::size_t k=begin;k<end;k++)
+                    {
+                        long long from_key=key_of(froms[k]);
+                        if(from_key>=INFINITE) continue;                                        //u不可达，则不可能松弛
+                        long long key=from_key+weights[k];
+                        if(key>=INFINITE) continue;                                             //u.key+weight为正无穷，则不可能松弛
+                        if(froms[k]==tos[k])                                                    //自环：权重为负则永远不会收敛，留给最后的检验
+                        {
+                            if(weights[k]<0) changed=true;
+                            continue;
+                        }
+                        std::uint64_t old=atomic_fetch_min(state[tos[k]],pack_pair(encode(key),froms[k]));
+                        if(decode(pack_high(old))>key) changed=true;
+                    }
+                    changes[index]=changed;
+                });
+                converged=std::find(changes.begin(),changes.end(),1)==changes.end();
+            }
+            //**********  检验是否存在从源点可达的权重为负的环路 *************
+            bool no_negative_cycle=converged;
+            if(!converged)
+            {
+                std::fill(changes.begin(),changes.end(),0);
+                parallel_blocks(0,edge_num,threads,[&](std::size_t begin,std::size_t end,std::size_t index){
+                    for(std::size_t k=begin;k<end;k++)
+                    {
+                        long long from_key=key_of(froms[k]);
+                        long long key=from_key+weights[k];
+                        if(from_key<INFINITE&&key<INFINITE&&key_of(tos[k])>key)
+                        {
+                            changes[index]=1;
+                            break;
+                        }
+                    }
+                });
+                no_negative_cycle=std::find(changes.begin(),changes.end(),1)==changes.end();
+            }
+            //************* 写回结点 ****************
+            initialize_single_source(graph,source_id);
+            parallel_for(0,num,threads,[&](std::size_t i){
+                auto vertex=graph->vertexes[i];
+                if(!vertex) return;
+                std::uint64_t packed=state[i].load(std::memory_order_relaxed);
+                vertex->key=decode(pack_high(packed));
+                if(pack_low(packed)!=NO_PARENT)
+                    vertex->parent=graph->vertexes[pack_low(packed)];
+            });
+            return no_negative_cycle;
+        }
     }
 }
 #endif // BELLMAN_FORD
@@ -18,8 +18,11 @@
  */
 #ifndef BELLMAN_FORD_TEST
 #define BELLMAN_FORD_TEST
+#include <random>
+#include <set>
 #include "../../../google_test/gtest.h"
 #include "bellmanford.h"
+#include "../../basic_graph/graph_representation/csr_graph/csrgraph.h"
 #include "../../basic_graph/graph_representation/graph/graph.h"
 #include "../../basic_graph/graph_representation/graph_vertex/vertexp.h"
 using IntroductionToAlgorithm::GraphAlgorithm::Graph;
@@ -27,6 +30,9 @@ using IntroductionToAlgorithm::GraphAlgorithm::VertexP;
 using IntroductionToAlgorithm::GraphAlgorithm::initialize_single_source;
 using IntroductionToAlgorithm::GraphAlgorithm::relax;
 using IntroductionToAlgorithm::GraphAlgorithm::bellman_ford;
+using IntroductionToAlgorithm::GraphAlgorithm::bellman_ford_spfa;
+using IntroductionToAlgorithm::GraphAlgorithm::parallel_bellman_ford;
+using IntroductionToAlgorithm::GraphAlgorithm::CSRGraph;
 using IntroductionToAlgorithm::GraphAlgorithm::unlimit;
 namespace{
     const int B_NUM=10;  /*!< 图顶点数量*/
@@ -135,5 +141,99 @@ TEST_F(BellmanFordTest,test_bellman_ford)
     //*********** 含有负权值回路的图  ***********
     EXPECT_FALSE(bellman_ford(_minus_graph,0));
 }
+/*!
+* `test_bellman_ford_spfa`:测试单源最短路径的的bellman_ford_spfa算法
+*/
+TEST_F(BellmanFordTest,test_bellman_ford_spfa)
+{
+    EXPECT_THROW(bellman_ford_spfa(_1v_graph,1),std::invalid_argument);
+    EXPECT_TRUE(bellman_ford_spfa(_1v_graph,0));
+    EXPECT_EQ(_1v_graph->vertexes[0]->key,0);
+    EXPECT_TRUE(bellman_ford_spfa(_1e_graph,0));
+    EXPECT_EQ(_1e_graph->vertexes[1]->key,1);
+    EXPECT_EQ(_1e_graph->vertexes[1]->parent,_1e_graph->vertexes[0]);
+    EXPECT_TRUE(bellman_ford_spfa(_normal_graph,0));
+    for(int i=1;i<B_NUM;i++)
+    {
+        EXPECT_EQ(_normal_graph->vertexes[i]->key,i);
+        EXPECT_EQ(_normal_graph->vertexes[i]->parent,_normal_graph->vertexes[i-1]);
+    }
+    EXPECT_FALSE(bellman_ford_spfa(_minus_graph,0));
+}
+/*!
+* `test_parallel_bellman_ford`:测试单源最短路径的的parallel_bellman_ford算法
+*/
+TEST_F(BellmanFordTest,test_parallel_bellman_ford)
+{
+    EXPECT_THROW(parallel_bellman_ford(_1v_graph,1),std::invalid_argument);
+    EXPECT_TRUE(parallel_bellman_ford(_1v_graph,0,2));
+    EXPECT_EQ(_1v_graph->vertexes[0]->key,0);
+    EXPECT_TRUE(parallel_bellman_ford(_1e_graph,0,2));
+    EXPECT_EQ(_1e_graph->vertexes[1]->key,1);
+    EXPECT_EQ(_1e_graph->vertexes[1]->parent,_1e_graph->vertexes[0]);
+    EXPECT_TRUE(parallel_bellman_ford(_normal_graph,0,2));
+    for(int i=1;i<B_NUM;i++)
+    {
+        EXPECT_EQ(_normal_graph->vertexes[i]->key,i);
+        EXPECT_EQ(_normal_graph->vertexes[i]->parent,_normal_graph->vertexes[i-1]);
+    }
+    EXPECT_FALSE(parallel_bellman_ford(_minus_graph,0,2));
+}
+/*!
+* `test_random_graph`:含负权重边（但无负权重环路）的随机图上，三种bellman_ford算法的结果相同
+*/
+TEST_F(BellmanFordTest,test_random_graph)
+{
+    typedef CSRGraph<VertexP<int>> CSRType;
+    //****  随机有向图：500个顶点，2500条边。权重为 w+p(u)-p(v)，其中w>=0，因此存在负权重的边，但任何环路的权重都非负  ****
+    const int num=500;
+    std::mt19937 gen(6);
+    std::uniform_int_distribution<int> vertex_dist(0,num-1);
+    std::uniform_int_distribution<int> weight_dist(0,20);
+    std::vector<int> potential(num);
+    for(auto& p:potential) p=weight_dist(gen)*5;
+    std::set<std::pair<int,int>> edge_set;
+    while(edge_set.size()<2500)
+    {
+        int from=vertex_dist(gen);
+        int to=vertex_dist(gen);
+        if(from!=to) edge_set.insert(std::make_pair(from,to));
+    }
+    std::vector<CSRType::EdgeTupleType> edges;
+    for(const auto& edge:edge_set)
+        edges.push_back(std::make_tuple(edge.first,edge.second,weight_dist(gen)+potential[edge.first]-potential[edge.second]));
+
+    auto graph=std::make_shared<CSRType>(num,edges.begin(),edges.end(),-1000);
+    auto spfa_graph=std::make_shared<CSRType>(num,edges.begin(),edges.end(),-1000);
+    auto parallel_graph=std::make_shared<CSRType>(num,edges.begin(),edges.end(),-1000);
+    EXPECT_TRUE(bellman_ford(graph,0));
+    EXPECT_TRUE(bellman_ford_spfa(spfa_graph,0));
+    EXPECT_TRUE(parallel_bellman_ford(parallel_graph,0,4));
+    for(int i=0;i<num;i++)
+    {
+        EXPECT_EQ(spfa_graph->vertexes[i]->key,graph->vertexes[i]->key)<<"i:"<<i;
+        EXPECT_EQ(parallel_graph->vertexes[i]->key,graph->vertexes[i]->key)<<"i:"<<i;
+        auto parent=parallel_graph->vertexes[i]->parent;
+        if(parent)
+        {
+            EXPECT_EQ(parallel_graph->vertexes[i]->key,parent->key+parallel_graph->weight(parent->id,i))<<"i:"<<i;
+        }
+    }
+    //****  增加一条边构成从0可达的负权重环路  ****
+    auto reachable=std::find_if(graph->vertexes.begin()+1,graph->vertexes.end(),[](const std::shared_ptr<VertexP<int>>& v){
+        return v->key<IntroductionToAlgorithm::GraphAlgorithm::unlimit<int>();});
+    ASSERT_TRUE(reachable!=graph->vertexes.end());
+    int id=(*reachable)->id;
+    if(!edge_set.count(std::make_pair(id,0)))
+    {
+        edges.push_back(std::make_tuple(id,0,-(*reachable)->key-1));
+        graph=std::make_shared<CSRType>(num,edges.begin(),edges.end(),-1000);
+        spfa_graph=std::make_shared<CSRType>(num,edges.begin(),edges.end(),-1000);
+        parallel_graph=std::make_shared<CSRType>(num,edges.begin(),edges.end(),-1000);
+        EXPECT_FALSE(bellman_ford(graph,0));
+        EXPECT_FALSE(bellman_ford_spfa(spfa_graph,0));
+        EXPECT_FALSE(parallel_bellman_ford(parallel_graph,0,4));
+    }
+}
 #endif // BELLMAN_FORD_TEST
 
@@ -0,0 +1,713 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef CONTRACTIONHIERARCHY
+#define CONTRACTIONHIERARCHY
+#include<vector>
+#include<memory>
+#include<string>
+#include<fstream>
+#include<queue>
+#include<functional>
+#include<algorithm>
+#include<stdexcept>
+#include<cstdint>
+#include<cstring>
+#include"../../../header.h"
+#include"../../../queue_algorithms/id_min_queue/idminqueue.h"
+#include"../../basic_graph/graph_representation/graph_snapshot/graphsnapshot.h"
+namespace IntroductionToAlgorithm
+{
+    namespace GraphAlgorithm
+    {
+        const char CONTRACTION_HIERARCHY_MAGIC[8]={'I','T','A','C','H','I','D','X'}; /*!< 收缩层次索引文件的魔数*/
+        const std::uint32_t CONTRACTION_HIERARCHY_VERSION=1;                        /*!< 索引格式的版本号*/
+
+        //!ContractionHierarchyHeader：收缩层次索引文件的头部
+        /*!
+        * 索引文件的布局为（均为写出索引的机器的本机字节序）：
+        *
+        * - 头部：56字节，即本结构体
+        * - `rank`：`vertex_num`个`int32`，顶点的收缩次序
+        * - 向上图：`offsets`（`vertex_num+1`个`std::uint64_t`）、`targets`（`int32`）、`weights`、`middles`（`int32`），各`up_edge_num`个。行与顶点编号都是`rank`
+        * - 向下图：布局与向上图相同，各`down_edge_num`个
+        *
+        * `checksum`为头部之后所有字节的 64位 FNV-1a 散列值（见`_snapshot_checksum`）。头部长度为8的倍数，各数组之间不需要填充。
+        */
+        struct ContractionHierarchyHeader
+        {
+            char magic[8];              /*!< 魔数，必须为`CONTRACTION_HIERARCHY_MAGIC`*/
+            std::uint32_t version;      /*!< 格式版本号*/
+            std::uint32_t endian_tag;   /*!< 字节序标记，必须为`GRAPH_SNAPSHOT_ENDIAN_TAG`*/
+            std::uint32_t weight_bytes; /*!< 权重的字节数*/
+            std::uint32_t reserved;     /*!< 保留，为0*/
+            std::uint64_t vertex_num;   /*!< 顶点数量*/
+            std::uint64_t up_edge_num;  /*!< 向上图的边的数量*/
+            std::uint64_t down_edge_num;/*!< 向下图的边的数量*/
+            std::uint64_t checksum;     /*!< 数据部分的校验和*/
+        };
+        static_assert(sizeof(ContractionHierarchyHeader)==56,"ContractionHierarchyHeader must be 56 bytes");
+
+        //!ContractionHierarchy：收缩层次（Contraction Hierarchies）索引
+        /*!
+        * 预处理按照“重要性”从低到高逐个收缩顶点：收缩顶点v时，对每一对仍未收缩的入邻居u、出邻居w，若 u->v->w 是u到w的唯一最短路径
+        * （见证搜索没有找到不经过v、不长于它的路径），则加入一条捷径 u->w，其权重为 w(u,v)+w(v,w)。收缩次序记为`rank`。
+        *
+        * 预处理结束后，原图的边与所有捷径按照两端顶点的`rank`分为两个CSR形式的图：
+        *
+        * - 向上图：边 u->w，其中 rank(w)>rank(u)，存放在u的行中
+        * - 向下图：边 u->w，其中 rank(u)>rank(w)，反向存放在w的行中（行中的顶点为u）。这样反向搜索也只沿`rank`增大的方向进行
+        *
+        * 两个图的行按照`rank`排列，边的端点与捷径的中间顶点也以`rank`表示，`order`将`rank`映射回原图的顶点编号。
+        * 几乎每次查询都会访问`rank`最大的那些顶点，这样它们的数据在内存中连续存放，查询的缓存命中率高得多。
+        *
+        * 任意两点间的最短路径都可以改写为一条“先沿向上图上升、再沿向下图下降”的路径，因此查询只需在两个很小的向上搜索空间中进行，
+        * 见`ContractionHierarchyQuery`。每条边记录`middle`：原图的边为-1，捷径为被收缩的中间顶点，用于将捷径展开为原图的路径。
+        *
+        * 索引可以通过`save`写入文件，并通过接受文件路径的构造函数载入。文件的格式见`ContractionHierarchyHeader`。
+        */
+        template<typename EWeightType> class ContractionHierarchy
+        {
+        public:
+            //!默认构造函数：空索引
+            ContractionHierarchy():up_offsets(1,0),down_offsets(1,0){}
+            //!显式构造函数，从索引文件载入
+            /*!
+            * \param path:索引文件路径
+            *
+            * 文件无法打开、头部无效、文件大小与头部不符、校验和不符或者数据不一致时，抛出异常
+            *
+            * - 时间复杂度 O(V+E)
+            */
+            explicit ContractionHierarchy(const std::string& path)
+            {
+                std::ifstream in(path,std::ios::binary);
+                if(!in)
+                    throw std::invalid_argument("ContractionHierarchy error: can not open "+path);
+                ContractionHierarchyHeader header;
+                if(!in.read(reinterpret_cast<char*>(&header),sizeof(header)))
+                    throw std::invalid_argument("ContractionHierarchy error: "+path+" is too small to be an index!");
+                if(std::memcmp(header.magic,CONTRACTION_HIERARCHY_MAGIC,sizeof(header.magic))!=0)
+                    throw std::invalid_argument("ContractionHierarchy error: bad magic, not a contraction hierarchy index!");
+                if(header.version!=CONTRACTION_HIERARCHY_VERSION)
+                    throw std::invalid_argument("ContractionHierarchy error: unsupported index version!");
+                if(header.endian_tag!=GRAPH_SNAPSHOT_ENDIAN_TAG)
+                    throw std::invalid_argument("ContractionHierarchy error: index is written by a machine of different byte order!");
+                if(header.weight_bytes!=sizeof(EWeightType))
+                    throw std::invalid_argument("ContractionHierarchy error: index weight width mismatch!");
+                //******** 先由头部计算文件大小，避免按照损坏的头部分配内存 *********
+                in.seekg(0,std::ios::end);
+                const std::uint64_t body=static_cast<std::uint64_t>(in.tellg())-sizeof(header);
+                in.seekg(sizeof(header));
+                const std::uint64_t edge_bytes=2*sizeof(std::int32_t)+sizeof(EWeightType);
+                if(body<2*sizeof(std::uint64_t)
+                   ||header.vertex_num>(body-2*sizeof(std::uint64_t))/(sizeof(std::int32_t)+2*sizeof(std::uint64_t))
+                   ||header.up_edge_num>body/edge_bytes||header.down_edge_num>body/edge_bytes
+                   ||body!=header.vertex_num*(sizeof(std::int32_t)+2*sizeof(std::uint64_t))+2*sizeof(std::uint64_t)
+                           +(header.up_edge_num+header.down_edge_num)*edge_bytes)
+                    throw std::invalid_argument("ContractionHierarchy error: file size does not match the header!");
+                std::uint64_t actual=14695981039346656037ULL;
+                auto read_array=[&](auto& array,std::size_t size){
+                    array.resize(size);
+                    in.read(reinterpret_cast<char*>(array.data()),size*sizeof(array[0]));
+                    actual=_snapshot_checksum(actual,array.data(),size*sizeof(array[0]));
+                };
+                std::vector<std::uint64_t> offsets;
+                read_array(rank,header.vertex_num);
+                read_array(offsets,header.vertex_num+1);
+                up_offsets.assign(offsets.begin(),offsets.end());
+                read_array(up_targets,header.up_edge_num);
+                read_array(up_weights,header.up_edge_num);
+                read_array(up_middles,header.up_edge_num);
+                read_array(offsets,header.vertex_num+1);
+                down_offsets.assign(offsets.begin(),offsets.end());
+                read_array(down_targets,header.down_edge_num);
+                read_array(down_weights,header.down_edge_num);
+                read_array(down_middles,header.down_edge_num);
+                if(!in||actual!=header.checksum)
+                    throw std::invalid_argument("ContractionHierarchy error: "+path+" is corrupted!");
+                if(!_is_consistent())
+                    throw std::invalid_argument("ContractionHierarchy error: "+path+" is inconsistent!");
+                _make_order();
+            }
+            //!save:将索引写入文件
+            /*!
+            * \param path:索引文件路径。若文件已存在则覆盖
+            * \return: void
+            *
+            * 先写入校验和为0的头部，边写数据边计算校验和，最后回写校验和。文件无法写入时抛出异常。
+            *
+            * - 时间复杂度 O(V+E)
+            */
+            void save(const std::string& path) const
+            {
+                std::ofstream out(path,std::ios::binary|std::ios::trunc);
+                if(!out)
+                    throw std::invalid_argument("ContractionHierarchy save error: can not open "+path);
+                ContractionHierarchyHeader header;
+                std::memcpy(header.magic,CONTRACTION_HIERARCHY_MAGIC,sizeof(header.magic));
+                header.version=CONTRACTION_HIERARCHY_VERSION;
+                header.endian_tag=GRAPH_SNAPSHOT_ENDIAN_TAG;
+                header.weight_bytes=sizeof(EWeightType);
+                header.reserved=0;
+                header.vertex_num=vertex_num();
+                header.up_edge_num=up_targets.size();
+                header.down_edge_num=down_targets.size();
+                header.checksum=0;
+                out.write(reinterpret_cast<const char*>(&header),sizeof(header));
+                std::uint64_t checksum=14695981039346656037ULL;
+                auto write_array=[&](const auto& array){
+                    checksum=_snapshot_checksum(checksum,array.data(),array.size()*sizeof(array[0]));
+                    out.write(reinterpret_cast<const char*>(array.data()),array.size()*sizeof(array[0]));
+                };
+                write_array(rank);
+                write_array(std::vector<std::uint64_t>(up_offsets.begin(),up_offsets.end()));   //std::size_t 不一定是 64位
+                write_array(up_targets);
+                write_array(up_weights);
+                write_array(up_middles);
+                write_array(std::vector<std::uint64_t>(down_offsets.begin(),down_offsets.end()));
+                write_array(down_targets);
+                write_array(down_weights);
+                write_array(down_middles);
+                header.checksum=checksum;
+                out.seekp(0);
+                out.write(reinterpret_cast<const char*>(&header),sizeof(header));
+                out.flush();
+                if(!out)
+                    throw std::invalid_argument("ContractionHierarchy save error: write "+path+" failed!");
+            }
+            //!vertex_num:返回顶点数量
+            std::size_t vertex_num() const {return rank.size();}
+            //!edge_num:返回向上图与向下图的边的总数（包括捷径）
+            std::size_t edge_num() const {return up_targets.size()+down_targets.size();}
+            //!shortcut_num:返回捷径的数量
+            std::size_t shortcut_num() const
+            {
+                return std::count_if(up_middles.begin(),up_middles.end(),[](int middle){return middle>=0;})
+                        +std::count_if(down_middles.begin(),down_middles.end(),[](int middle){return middle>=0;});
+            }
+
+            std::vector<int> rank;                  /*!< 顶点的收缩次序，越晚收缩的顶点越“重要”*/
+            std::vector<int> order;                 /*!< `rank`的逆映射：order[rank[v]]==v*/
+            std::vector<std::size_t> up_offsets;    /*!< 向上图：rank为u的顶点的边位于[up_offsets[u],up_offsets[u+1])*/
+            std::vector<int> up_targets;            /*!< 向上图：边的终点的rank，大于行的rank*/
+            std::vector<EWeightType> up_weights;    /*!< 向上图：边的权重*/
+            std::vector<int> up_middles;            /*!< 向上图：捷径的中间顶点的rank，原图的边为-1*/
+            std::vector<std::size_t> down_offsets;  /*!< 向下图：rank为w的顶点的入边位于[down_offsets[w],down_offsets[w+1])*/
+            std::vector<int> down_targets;          /*!< 向下图：入边的起点的rank，大于行的rank*/
+            std::vector<EWeightType> down_weights;  /*!< 向下图：入边的权重*/
+            std::vector<int> down_middles;          /*!< 向下图：捷径的中间顶点的rank，原图的边为-1*/
+        private:
+            //!_make_order:由rank计算order
+            void _make_order()
+            {
+                order.assign(rank.size(),-1);
+                for(std::size_t v=0;v<rank.size();v++)
+                    order[rank[v]]=v;
+            }
+            //!_is_consistent:检查rank是一个排列、offsets单调、边的方向与rank一致
+            bool _is_consistent() const
+            {
+                const std::size_t num=vertex_num();
+                auto check=[&](const std::vector<std::size_t>& offsets,const std::vector<int>& targets,const std::vector<int>& middles){
+                    if(offsets.size()!=num+1||offsets[0]!=0||offsets[num]!=targets.size()) return false;
+                    for(std::size_t u=0;u<num;u++)
+                    {
+                        if(offsets[u+1]<offsets[u]) return false;
+                        for(std::size_t k=offsets[u];k<offsets[u+1];k++)
+                            if(targets[k]<=static_cast<int>(u)||static_cast<std::size_t>(targets[k])>=num||middles[k]>=static_cast<int>(u))
+                                return false;
+                    }
+                    return true;
+                };
+                std::vector<bool> seen(num,false);
+                for(auto r:rank)
+                {
+                    if(r<0||static_cast<std::size_t>(r)>=num||seen[r]) return false;
+                    seen[r]=true;
+                }
+                return check(up_offsets,up_targets,up_middles)&&check(down_offsets,down_targets,down_middles);
+            }
+        };
+
+        //!_ContractionBuilder：收缩层次的预处理过程
+        /*!
+        * 维护尚未收缩的顶点之间的边（包括已加入的捷径）。每一对顶点之间至多保存一条边（权重最小的一条），
+        * 收缩一个顶点后立即从其邻居的边表中删除它，因此见证搜索只会访问尚未收缩的顶点。
+        */
+        template<typename EWeightType> class _ContractionBuilder
+        {
+        public:
+            struct Arc
+            {
+                int to;             /*!< 另一个顶点*/
+                EWeightType weight; /*!< 权重*/
+                int middle;         /*!< 捷径的中间顶点，原图的边为-1*/
+            };
+            //!显式构造函数
+            /*!
+            * \param num:顶点数量
+            * \param witness_limit:一次见证搜索最多弹出的顶点数量
+            */
+            _ContractionBuilder(std::size_t num,std::size_t witness_limit):out(num),in(num),
+                _witness_limit(witness_limit),_distance(num,unlimit<EWeightType>()),_stamp(num,0),_is_target(num,false),_search_id(0){}
+            //!add_arc:加入边 u->w；若已有更短或相等的边则忽略，若已有更长的边则替换它
+            void add_arc(int u,int w,EWeightType weight,int middle)
+            {
+                for(auto& arc:out[u])
+                    if(arc.to==w)
+                    {
+                        if(!(weight<arc.weight)) return;
+                        arc.weight=weight;
+                        arc.middle=middle;
+                        for(auto& back:in[w])
+                            if(back.to==u) {back.weight=weight;back.middle=middle;break;}
+                        return;
+                    }
+                out[u].push_back(Arc{w,weight,middle});
+                in[w].push_back(Arc{u,weight,middle});
+            }
+            //!contract:收缩（或者模拟收缩）顶点v
+            /*!
+            * \param v:被收缩的顶点
+            * \param simulate:为`true`时只计算需要的捷径数量，不修改图
+            * \return: 需要的捷径数量
+            *
+            * 对每个入邻居u执行一次从u出发、不经过v的有限dijkstra（见证搜索），搜索半径为 w(u,v)+max w(v,w)，最多弹出`witness_limit`个顶点，
+            * 所有出邻居都被弹出时提前结束。
+            * 见证搜索没有找到不长于 w(u,v)+w(v,w) 的路径时需要捷径 u->w。见证搜索可能因为规模限制而漏掉见证路径，这只会多加捷径，不影响正确性。
+            */
+            std::size_t contract(int v,bool simulate)
+            {
+                std::size_t count=0;
+                EWeightType max_out=0;
+                for(const auto& arc:out[v])
+                {
+                    if(arc.weight>max_out) max_out=arc.weight;
+                    _is_target[arc.to]=true;
+                }
+                for(const auto& in_arc:in[v])                  //捷径的两端都不是v，因此加入捷径不会修改in[v]、out[v]
+                {
+                    const int u=in_arc.to;
+                    _witness_search(u,v,in_arc.weight+max_out,out[v].size()-(_is_target[u]?1:0));
+                    for(const auto& out_arc:out[v])
+                    {
+                        const int w=out_arc.to;
+                        if(w==u) continue;
+                        const EWeightType via=in_arc.weight+out_arc.weight;
+                        if(_get_distance(w)<=via) continue;         //存在见证路径
+                        count++;
+                        if(!simulate) add_arc(u,w,via,v);
+                    }
+                }
+                for(const auto& arc:out[v]) _is_target[arc.to]=false;
+                return count;
+            }
+            //!remove:从邻居的边表中删除顶点v
+            void remove(int v)
+            {
+                for(const auto& arc:out[v]) _erase(in[arc.to],v);
+                for(const auto& arc:in[v]) _erase(out[arc.to],v);
+            }
+
+            std::vector<std::vector<Arc>> out;  /*!< 尚未收缩的顶点之间的出边*/
+            std::vector<std::vector<Arc>> in;   /*!< 尚未收缩的顶点之间的入边*/
+        private:
+            //!_erase:从边表中删除指向v的边
+            static void _erase(std::vector<Arc>& arcs,int v)
+            {
+                for(std::size_t k=0;k<arcs.size();k++)
+                    if(arcs[k].to==v)
+                    {
+                        arcs[k]=arcs.back();
+                        arcs.pop_back();
+                        return;
+                    }
+            }
+            //!_get_distance:返回本次见证搜索中顶点的距离，未触及的顶点为正无穷
+            EWeightType _get_distance(int v) const {return _stamp[v]==_search_id?_distance[v]:unlimit<EWeightType>();}
+            //!_witness_search:从source出发、不经过excluded的有限dijkstra，弹出target_num个被标记的目标之后提前结束
+            void _witness_search(int source,int excluded,EWeightType limit,std::size_t target_num)
+            {
+                _search_id++;
+                if(_search_id==0)
+                {
+                    std::fill(_stamp.begin(),_stamp.end(),0);
+                    _search_id=1;
+                }
+                typedef std::pair<EWeightType,int> Item;
+                std::priority_queue<Item,std::vector<Item>,std::greater<Item>> queue;
+                _stamp[source]=_search_id;
+                _distance[source]=0;
+                queue.push(Item(0,source));
+                std::size_t settled=0;
+                while(!queue.empty()&&settled<_witness_limit&&target_num>0)
+                {
+                    Item item=queue.top();
+                    queue.pop();
+                    if(item.first>_get_distance(item.second)) continue;  //过期的元素
+                    if(item.first>limit) break;
+                    settled++;
+                    if(_is_target[item.second]&&item.second!=source) target_num--;
+                    for(const auto& arc:out[item.second])
+                    {
+                        if(arc.to==excluded) continue;
+                        EWeightType new_distance=item.first+arc.weight;
+                        if(new_distance<_get_distance(arc.to))
+                        {
+                            _stamp[arc.to]=_search_id;
+                            _distance[arc.to]=new_distance;
+                            queue.push(Item(new_distance,arc.to));
+                        }
+                    }
+                }
+            }
+            std::size_t _witness_limit;         /*!< 一次见证搜索最多弹出的顶点数量*/
+            std::vector<EWeightType> _distance; /*!< 见证搜索的距离*/
+            std::vector<unsigned> _stamp;       /*!< 距离的时间戳*/
+            std::vector<bool> _is_target;       /*!< 是否为本次收缩的出邻居*/
+            unsigned _search_id;                /*!< 当前见证搜索的编号*/
+        };
+
+        //!build_contraction_hierarchy：建立收缩层次索引
+        /*!
+        * \param graph:指向图的强指针，必须非空，所有边的权重必须非负，否则抛出异常
+        * \param witness_limit:一次见证搜索最多弹出的顶点数量，默认为500。越大捷径越少，预处理越慢
+        * \return: 收缩层次索引
+        *
+        * ### 算法原理
+        *
+        * 顶点的重要性为 `边差+已收缩的邻居数量`，其中边差为收缩它需要加入的捷径数量减去它的入度与出度。
+        * 边差小的顶点先收缩，使得捷径尽量少；已收缩的邻居数量使得收缩均匀地分布在图中，层次更浅。
+        *
+        * 所有顶点按照重要性放入最小优先级队列。每次弹出重要性最小的顶点后重新计算它的重要性（懒惰更新），若它不再是最小的则重新入队；
+        * 否则收缩它，并将其所有邻居的已收缩邻居数量加一、重新计算它们的重要性。入度与出度之积超过256的邻居只将重要性加一：
+        * 对度数很大的顶点，每收缩一个邻居就模拟收缩它一次代价太高，过期的边差会在它被弹出时由懒惰更新修正。
+        *
+        * 它适用于路网等度数小、有层次结构的图。对于存在度数很大的顶点的图（如R-MAT），捷径的数量可能很多，预处理很慢。
+        *
+        * - 时间复杂度：取决于图的结构，对于路网大约为 O(V log V) 次有限的见证搜索
+        */
+        template<typename GraphType>
+        ContractionHierarchy<typename GraphType::EWeightType> build_contraction_hierarchy(std::shared_ptr<GraphType> graph,std::size_t witness_limit=500)
+        {
+            typedef typename GraphType::EWeightType EWeightType;
+            if(!graph)
+                throw std::invalid_argument("build_contraction_hierarchy error: graph must not be nullptr!");
+            const std::size_t num=graph->vertexes.size();
+            _ContractionBuilder<EWeightType> builder(num,witness_limit);
+            for(std::size_t u=0;u<num;u++)
+            {
+                if(!vertex_exists(graph->vertexes,u)) continue;
+                for(const auto& neighbor:graph->neighbors(u))
+                {
+                    if(neighbor.second<0)
+                        throw std::invalid_argument("build_contraction_hierarchy error: edge weight must not be negative!");
+                    if(neighbor.first!=static_cast<int>(u))                 //自环不会出现在最短路径上
+                        builder.add_arc(u,neighbor.first,neighbor.second,-1);
+                }
+            }
+            //********** 按照重要性收缩 ***********
+            std::vector<long long> priority(num);
+            std::vector<long long> contracted_neighbors(num,0);
+            std::vector<bool> contracted(num,false);
+            auto importance=[&](int v){
+                return static_cast<long long>(builder.contract(v,true))
+                        -static_cast<long long>(builder.out[v].size()+builder.in[v].size())+contracted_neighbors[v];
+            };
+            typedef std::pair<long long,int> Item;
+            std::priority_queue<Item,std::vector<Item>,std::greater<Item>> queue;
+            for(std::size_t v=0;v<num;v++)
+            {
+                priority[v]=importance(v);
+                queue.push(Item(priority[v],v));
+            }
+            ContractionHierarchy<EWeightType> hierarchy;
+            hierarchy.rank.assign(num,-1);
+            hierarchy.order.assign(num,-1);
+            std::vector<std::vector<typename _ContractionBuilder<EWeightType>::Arc>> up(num),down(num);
+            int next_rank=0;
+            while(!queue.empty())
+            {
+                Item item=queue.top();
+                queue.pop();
+                const int v=item.second;
+                if(contracted[v]||item.first!=priority[v]) continue;       //已收缩或者过期的元素
+                long long current=importance(v);                           //懒惰更新
+                if(current>priority[v]&&!queue.empty()&&current>queue.top().first)
+                {
+                    priority[v]=current;
+                    queue.push(Item(current,v));
+                    continue;
+                }
+                hierarchy.order[next_rank]=v;
+                hierarchy.rank[v]=next_rank++;
+                contracted[v]=true;
+                up[v]=builder.out[v];                                       //此时v的邻居都尚未收缩，rank都大于v
+                down[v]=builder.in[v];
+                builder.contract(v,false);
+                builder.remove(v);
+                std::vector<int> neighbors;
+                for(const auto& arc:up[v]) neighbors.push_back(arc.to);
+                for(const auto& arc:down[v]) neighbors.push_back(arc.to);
+                std::sort(neighbors.begin(),neighbors.end());
+                neighbors.erase(std::unique(neighbors.begin(),neighbors.end()),neighbors.end());
+                for(int w:neighbors)
+                {
+                    contracted_neighbors[w]++;
+                    if(builder.in[w].size()*builder.out[w].size()<=256) priority[w]=importance(w);
+                    else priority[w]++;                                     //度数很大的顶点：边差留到弹出时再重新计算
+                    queue.push(Item(priority[w],w));
+                }
+            }
+            //********** 转换为CSR形式 ***********
+            auto flatten=[&](const std::vector<std::vector<typename _ContractionBuilder<EWeightType>::Arc>>& arcs,std::vector<std::size_t>& offsets,
+                    std::vector<int>& targets,std::vector<EWeightType>& weights,std::vector<int>& middles){
+                offsets.assign(num+1,0);
+                for(std::size_t r=0;r<num;r++)
+                {
+                    for(const auto& arc:arcs[hierarchy.order[r]])
+                    {
+                        targets.push_back(hierarchy.rank[arc.to]);
+                        weights.push_back(arc.weight);
+                        middles.push_back(arc.middle>=0?hierarchy.rank[arc.middle]:-1);
+                    }
+                    offsets[r+1]=targets.size();
+                }
+            };
+            flatten(up,hierarchy.up_offsets,hierarchy.up_targets,hierarchy.up_weights,hierarchy.up_middles);
+            flatten(down,hierarchy.down_offsets,hierarchy.down_targets,hierarchy.down_weights,hierarchy.down_middles);
+            return hierarchy;
+        }
+
+        //!ContractionHierarchyQuery：基于收缩层次索引的点到点最短路径查询
+        /*!
+        * 查询s->t时，正向搜索从s出发只沿向上图的边，反向搜索从t出发只沿向下图的边（即原图中rank增大的入边）。两个搜索空间都只包含比起点更“重要”的顶点，
+        * 在路网上通常只有几百个顶点。两个方向交替弹出顶点；弹出顶点u时若另一个方向已经触及u，则用 d_f(u)+d_b(u) 更新最短路径权重mu。
+        * 一个方向队首的关键字不小于mu时，该方向停止；两个方向都停止时mu就是最短路径权重。
+        *
+        * 此外使用“按需停滞”（stall-on-demand）：弹出u时，若存在rank更大的顶点x使得 d(x)+w(x,u)<d(u)，则u的距离不是最短的，不从u继续扩展。
+        *
+        * 与`ShortestPathQuery`相同，每个顶点的距离附带时间戳，开始新查询的代价与上一次查询触及的顶点数量成正比。
+        * 一个查询对象不能被多个线程同时使用；多个线程可以各自构造一个查询对象，共享同一个索引。
+        */
+        template<typename EWeightType> class ContractionHierarchyQuery
+        {
+        public:
+            //!显式构造函数
+            /*!
+            * \param hierarchy:指向索引的强指针，必须非空，否则抛出异常
+            */
+            explicit ContractionHierarchyQuery(std::shared_ptr<const ContractionHierarchy<EWeightType>> hierarchy)
+                :_hierarchy(hierarchy),_query_id(0),_settled_num(0),_meet(-1)
+            {
+                if(!hierarchy)
+                    throw std::invalid_argument("ContractionHierarchyQuery error: hierarchy must not be nullptr!");
+                const std::size_t num=hierarchy->vertex_num();
+                for(int side=0;side<2;side++)
+                {
+                    _distance[side].assign(num,unlimit<EWeightType>());
+                    _parent_edge[side].assign(num,0);
+                    _stamp[side].assign(num,0);
+                    _queue[side].reset(new QueueAlgorithm::IDMinQueue<EWeightType>(num));
+                }
+            }
+            //!distance：查询s到t的最短路径权重
+            /*!
+            * \param source:起点，必须属于[0,vertex_num)，否则抛出异常
+            * \param target:终点，必须属于[0,vertex_num)，否则抛出异常
+            * \return: s到t的最短路径权重。若t不可达则返回正无穷
+            */
+            EWeightType distance(int source,int target)
+            {
+                const auto& h=*_hierarchy;
+                if(source<0||target<0||static_cast<std::size_t>(source)>=h.vertex_num()||static_cast<std::size_t>(target)>=h.vertex_num())
+                    throw std::invalid_argument("ContractionHierarchyQuery error: source and target must belong [0,N)!");
+                _begin_query();
+                source=h.rank[source];                                      //以下均在rank编号下进行
+                target=h.rank[target];
+                const EWeightType INFINITE=unlimit<EWeightType>();
+                EWeightType mu=INFINITE;
+                _touch(FORWARD,source,0,NO_EDGE);
+                _touch(BACKWARD,target,0,NO_EDGE);
+                _queue[FORWARD]->insert(source,0);
+                _queue[BACKWARD]->insert(target,0);
+                const std::vector<std::size_t>* offsets[2]={&h.up_offsets,&h.down_offsets};
+                const std::vector<int>* targets[2]={&h.up_targets,&h.down_targets};
+                const std::vector<EWeightType>* weights[2]={&h.up_weights,&h.down_weights};
+                bool active[2]={true,true};
+                int side=BACKWARD;
+                while(active[FORWARD]||active[BACKWARD])
+                {
+                    if(active[1-side]) side=1-side;                         //交替弹出
+                    auto& queue=*_queue[side];
+                    if(queue.is_empty()||!(queue.key(queue.min())<mu))
+                    {
+                        active[side]=false;
+                        continue;
+                    }
+                    int u=queue.extract_min();
+                    _settled_num++;
+                    EWeightType distance_u=_distance[side][u];
+                    EWeightType other=_get_distance(1-side,u);
+                    if(other<INFINITE&&distance_u+other<mu)
+                    {
+                        mu=distance_u+other;
+                        _meet=u;
+                    }
+                    //********* 按需停滞：另一张图中u的行即指向u的、rank更大的顶点 *********
+                    bool stalled=false;
+                    const auto& stall_offsets=*offsets[1-side];
+                    for(std::size_t k=stall_offsets[u];k<stall_offsets[u+1]&&!stalled;k++)
+                    {
+                        EWeightType distance_x=_get_distance(side,(*targets[1-side])[k]);
+                        stalled=distance_x<INFINITE&&distance_x+(*weights[1-side])[k]<distance_u;
+                    }
+                    if(stalled) continue;
+                    for(std::size_t k=(*offsets[side])[u];k<(*offsets[side])[u+1];k++)
+                    {
+                        int v=(*targets[side])[k];
+                        EWeightType new_distance=distance_u+(*weights[side])[k];
+                        if(new_distance<_get_distance(side,v))
+                        {
+                            _touch(side,v,new_distance,k);
+                            queue.insert_or_decreate_key(v,new_distance);
+                        }
+                    }
+                }
+                if(mu==INFINITE) _meet=-1;
+                return mu;
+            }
+            //!path：返回上一次查询得到的最短路径
+            /*!
+            * \return: 从起点到终点的原图中的顶点序列，捷径已被展开。若终点不可达则返回空序列
+            */
+            std::vector<int> path() const
+            {
+                std::vector<int> result;
+                if(_meet<0) return result;
+                const auto& h=*_hierarchy;
+                //********* 向上的一段：从meet沿父边回溯到起点 *********
+                std::vector<std::size_t> edges;
+                int v=_meet;
+                while(_parent_edge[FORWARD][v]!=NO_EDGE)
+                {
+                    std::size_t k=_parent_edge[FORWARD][v];
+                    edges.push_back(k);
+                    v=_up_source(k);
+                }
+                result.push_back(v);
+                for(auto it=edges.rbegin();it!=edges.rend();++it)
+                    _unpack(_up_source(*it),h.up_targets[*it],h.up_middles[*it],result);
+                //********* 向下的一段：从meet沿父边前进到终点 *********
+                v=_meet;
+                while(_parent_edge[BACKWARD][v]!=NO_EDGE)
+                {
+                    std::size_t k=_parent_edge[BACKWARD][v];
+                    int next=_down_source(k);
+                    _unpack(v,next,h.down_middles[k],result);
+                    v=next;
+                }
+                for(auto& vertex:result) vertex=h.order[vertex];          //rank编号映射回原图的顶点编号
+                return result;
+            }
+            //!settled_num：返回上一次查询弹出的顶点数量
+            std::size_t settled_num() const {return _settled_num;}
+        private:
+            enum {FORWARD=0,BACKWARD=1};
+            static const std::size_t NO_EDGE=static_cast<std::size_t>(-1);
+            //!_begin_query：开始一次新的查询
+            void _begin_query()
+            {
+                _query_id++;
+                if(_query_id==0)
+                {
+                    for(int side=0;side<2;side++)
+                        std::fill(_stamp[side].begin(),_stamp[side].end(),0);
+                    _query_id=1;
+                }
+                _queue[FORWARD]->clear();
+                _queue[BACKWARD]->clear();
+                _settled_num=0;
+                _meet=-1;
+            }
+            //!_get_distance：返回本次查询中顶点v的距离，未触及的顶点为正无穷
+            EWeightType _get_distance(int side,int v) const
+            {
+                return _stamp[side][v]==_query_id?_distance[side][v]:unlimit<EWeightType>();
+            }
+            //!_touch：更新顶点v的距离以及到达它的边
+            void _touch(int side,int v,EWeightType distance,std::size_t edge)
+            {
+                _stamp[side][v]=_query_id;
+                _distance[side][v]=distance;
+                _parent_edge[side][v]=edge;
+            }
+            //!_up_source：返回向上图中第k条边的起点
+            int _up_source(std::size_t k) const
+            {
+                const auto& offsets=_hierarchy->up_offsets;
+                return std::upper_bound(offsets.begin(),offsets.end(),k)-offsets.begin()-1;
+            }
+            //!_down_source：返回向下图中第k条边所在的行，即原图中该边的终点
+            int _down_source(std::size_t k) const
+            {
+                const auto& offsets=_hierarchy->down_offsets;
+                return std::upper_bound(offsets.begin(),offsets.end(),k)-offsets.begin()-1;
+            }
+            //!_unpack：将边 from->to 展开为原图的路径，依次追加 from 之后的顶点
+            /*!
+            * 捷径 u->w 的中间顶点m比u、w都先收缩，因此 u->m 存放在向下图m的行中，m->w 存放在向上图m的行中。用栈代替递归，避免捷径嵌套很深时栈溢出
+            */
+            void _unpack(int from,int to,int middle,std::vector<int>& result) const
+            {
+                const auto& h=*_hierarchy;
+                std::vector<std::pair<std::pair<int,int>,int>> stack;     //((from,to),middle)，栈顶是路径上最靠前的一段
+                stack.push_back(std::make_pair(std::make_pair(from,to),middle));
+                while(!stack.empty())
+                {
+                    auto item=stack.back();
+                    stack.pop_back();
+                    int u=item.first.first,w=item.first.second,m=item.second;
+                    if(m<0)
+                    {
+                        result.push_back(w);
+                        continue;
+                    }
+                    int first_middle=-1,second_middle=-1;
+                    for(std::size_t k=h.down_offsets[m];k<h.down_offsets[m+1];k++)
+                        if(h.down_targets[k]==u) {first_middle=h.down_middles[k];break;}
+                    for(std::size_t k=h.up_offsets[m];k<h.up_offsets[m+1];k++)
+                        if(h.up_targets[k]==w) {second_middle=h.up_middles[k];break;}
+                    stack.push_back(std::make_pair(std::make_pair(m,w),second_middle));
+                    stack.push_back(std::make_pair(std::make_pair(u,m),first_middle));
+                }
+            }
+
+            std::shared_ptr<const ContractionHierarchy<EWeightType>> _hierarchy;  /*!< 索引*/
+            std::vector<EWeightType> _distance[2];          /*!< 正向、反向搜索的距离*/
+            std::vector<std::size_t> _parent_edge[2];       /*!< 到达顶点的边在向上图（正向）或向下图（反向）中的下标*/
+            std::vector<unsigned> _stamp[2];                /*!< 距离与父边的时间戳*/
+            std::unique_ptr<QueueAlgorithm::IDMinQueue<EWeightType>> _queue[2];/*!< 正向、反向搜索的最小优先级队列*/
+            unsigned _query_id;                             /*!< 当前查询的编号*/
+            std::size_t _settled_num;                       /*!< 本次查询弹出的顶点数量*/
+            int _meet;                                      /*!< 最短路径上正向与反向搜索的交汇点（rank编号），-1表示无路径*/
+        };
+    }
+}
+#endif // CONTRACTIONHIERARCHY
@@ -0,0 +1,197 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef CONTRACTIONHIERARCHY_TEST
+#define CONTRACTIONHIERARCHY_TEST
+#include <random>
+#include <fstream>
+#include <cstdio>
+#include "../../../google_test/gtest.h"
+#include "contractionhierarchy.h"
+#include "../shortest_path_query/shortestpathquery.h"
+#include "../../basic_graph/graph_representation/csr_graph/csrgraph.h"
+#include "../../basic_graph/graph_representation/graph_vertex/vertex.h"
+#include "../../graph_generator/graphgenerator.h"
+
+using IntroductionToAlgorithm::GraphAlgorithm::ContractionHierarchy;
+using IntroductionToAlgorithm::GraphAlgorithm::ContractionHierarchyQuery;
+using IntroductionToAlgorithm::GraphAlgorithm::build_contraction_hierarchy;
+using IntroductionToAlgorithm::GraphAlgorithm::ShortestPathQuery;
+using IntroductionToAlgorithm::GraphAlgorithm::CSRGraph;
+using IntroductionToAlgorithm::GraphAlgorithm::Vertex;
+using IntroductionToAlgorithm::GraphAlgorithm::erdos_renyi_graph;
+using IntroductionToAlgorithm::GraphAlgorithm::grid_graph;
+using IntroductionToAlgorithm::GraphAlgorithm::geometric_graph;
+
+//!ContractionHierarchyTest:测试类，用于为测试提供基础数据
+/*!
+*
+* `ContractionHierarchyTest`是 `::testing::Test` 的子类。它主要用于为每一个`TEST_F`准备测试环境
+*/
+class ContractionHierarchyTest:public ::testing::Test
+{
+public:
+    typedef CSRGraph<Vertex<int>> GType; /*!< 模板实例化的图类型*/
+    typedef ContractionHierarchy<int> HType; /*!< 模板实例化的索引类型*/
+protected:
+    void SetUp()
+    {
+        auto sparse=erdos_renyi_graph(300,900,23);    //稀疏的随机有向图，有不可达的顶点对
+        _sparse_graph=std::make_shared<GType>(sparse.vertex_num,sparse.edges.begin(),sparse.edges.end(),unlimit<int>());
+        auto grid=grid_graph(30,30,23);
+        _grid_graph=std::make_shared<GType>(grid.vertex_num,grid.edges.begin(),grid.edges.end(),unlimit<int>());
+        _path="/tmp/contraction_hierarchy_test.bin";
+    }
+    void TearDown()
+    {
+        std::remove(_path.c_str());
+    }
+    //!_check_queries：对随机的顶点对，比较收缩层次查询与双向dijkstra的结果，并检查展开后的路径
+    static void _check_queries(std::shared_ptr<GType> graph,std::shared_ptr<const HType> hierarchy)
+    {
+        ShortestPathQuery<GType> expect_query(graph);
+        ContractionHierarchyQuery<int> query(hierarchy);
+        std::mt19937 gen(23);
+        std::uniform_int_distribution<int> vertex_dist(0,graph->vertexes.size()-1);
+        for(int round=0;round<200;round++)
+        {
+            int source=vertex_dist(gen);
+            int target=round%20==0?source:vertex_dist(gen);
+            int expect=expect_query.bidirectional_dijkstra(source,target);
+            EXPECT_EQ(query.distance(source,target),expect)<<source<<"->"<<target;
+            auto path=query.path();
+            if(!(expect<unlimit<int>()))
+            {
+                EXPECT_TRUE(path.empty());
+                continue;
+            }
+            ASSERT_FALSE(path.empty());
+            EXPECT_EQ(path.front(),source);
+            EXPECT_EQ(path.back(),target);
+            int sum=0;
+            for(std::size_t i=1;i<path.size();i++)
+            {
+                ASSERT_TRUE(graph->has_edge(path[i-1],path[i]));
+                sum+=graph->weight(path[i-1],path[i]);
+            }
+            EXPECT_EQ(sum,expect);
+        }
+    }
+    std::shared_ptr<GType> _sparse_graph;   /*!< 稀疏的随机有向图*/
+    std::shared_ptr<GType> _grid_graph;     /*!< 网格图*/
+    std::string _path;                      /*!< 索引文件的路径*/
+};
+//!test_ch_query:测试收缩层次查询
+/*!
+*
+* 在随机有向图、网格图与随机几何图上，查询结果与双向dijkstra相同，`path()`展开捷径后是原图中的一条最短路径
+*/
+TEST_F(ContractionHierarchyTest,test_ch_query)
+{
+    auto sparse=std::make_shared<const HType>(build_contraction_hierarchy(_sparse_graph));
+    EXPECT_EQ(sparse->vertex_num(),300);
+    _check_queries(_sparse_graph,sparse);
+    auto grid=std::make_shared<const HType>(build_contraction_hierarchy(_grid_graph));
+    EXPECT_GT(grid->shortcut_num(),0);
+    _check_queries(_grid_graph,grid);
+    auto geometric_edges=geometric_graph(1000,6,23);
+    auto geometric=std::make_shared<GType>(geometric_edges.vertex_num,geometric_edges.edges.begin(),geometric_edges.edges.end(),unlimit<int>());
+    _check_queries(geometric,std::make_shared<const HType>(build_contraction_hierarchy(geometric,50)));
+}
+//!test_ch_settled:测试收缩层次查询弹出的顶点数量
+/*!
+*
+* 在网格图上，收缩层次查询弹出的顶点远少于双向dijkstra
+*/
+TEST_F(ContractionHierarchyTest,test_ch_settled)
+{
+    ShortestPathQuery<GType> plain_query(_grid_graph);
+    ContractionHierarchyQuery<int> query(std::make_shared<const HType>(build_contraction_hierarchy(_grid_graph)));
+    std::size_t plain_settled=0,ch_settled=0;
+    for(int i=0;i<30;i++)
+    {
+        int source=i*30+i%5;
+        int target=(29-i)*30+29-i%7;
+        EXPECT_EQ(query.distance(source,target),plain_query.bidirectional_dijkstra(source,target));
+        plain_settled+=plain_query.settled_num();
+        ch_settled+=query.settled_num();
+    }
+    EXPECT_LT(ch_settled*2,plain_settled);
+}
+//!test_ch_save_load:测试索引的写入与载入
+/*!
+*
+* 载入的索引与写入的索引相同；不存在、被截断、被修改的文件抛出异常
+*/
+TEST_F(ContractionHierarchyTest,test_ch_save_load)
+{
+    HType hierarchy=build_contraction_hierarchy(_grid_graph);
+    hierarchy.save(_path);
+    auto loaded=std::make_shared<const HType>(_path);
+    EXPECT_EQ(loaded->rank,hierarchy.rank);
+    EXPECT_EQ(loaded->up_offsets,hierarchy.up_offsets);
+    EXPECT_EQ(loaded->up_targets,hierarchy.up_targets);
+    EXPECT_EQ(loaded->up_weights,hierarchy.up_weights);
+    EXPECT_EQ(loaded->down_middles,hierarchy.down_middles);
+    EXPECT_EQ(loaded->edge_num(),hierarchy.edge_num());
+    EXPECT_EQ(loaded->shortcut_num(),hierarchy.shortcut_num());
+    _check_queries(_grid_graph,loaded);
+    //******** 空索引 *********
+    HType().save(_path);
+    EXPECT_EQ(HType(_path).vertex_num(),0);
+    //******** 无效的文件 *********
+    EXPECT_THROW(HType("/tmp/contraction_hierarchy_test_not_exist.bin"),std::invalid_argument);
+    hierarchy.save(_path);
+    std::string content;
+    {
+        std::ifstream in(_path,std::ios::binary);
+        content.assign(std::istreambuf_iterator<char>(in),std::istreambuf_iterator<char>());
+    }
+    auto write_content=[this](const std::string& data){
+        std::ofstream out(_path,std::ios::binary|std::ios::trunc);
+        out.write(data.data(),data.size());
+    };
+    write_content(content.substr(0,content.size()-4));     //截断
+    EXPECT_THROW(HType index(_path),std::invalid_argument);
+    std::string modified=content;
+    modified[modified.size()/2]^=1;                        //修改一个字节
+    write_content(modified);
+    EXPECT_THROW(HType index(_path),std::invalid_argument);
+    modified=content;
+    modified[0]='X';                                       //魔数错误
+    write_content(modified);
+    EXPECT_THROW(HType index(_path),std::invalid_argument);
+}
+//!test_ch_invalid:测试无效的参数
+/*!
+*
+* 空的图、负权重的边、无效的顶点抛出异常
+*/
+TEST_F(ContractionHierarchyTest,test_ch_invalid)
+{
+    EXPECT_THROW(build_contraction_hierarchy(std::shared_ptr<GType>()),std::invalid_argument);
+    EXPECT_THROW(ContractionHierarchyQuery<int>(std::shared_ptr<const HType>()),std::invalid_argument);
+    std::vector<GType::EdgeTupleType> edges;
+    edges.push_back(std::make_tuple(0,1,-1));
+    auto negative=std::make_shared<GType>(2,edges.begin(),edges.end(),unlimit<int>());
+    EXPECT_THROW(build_contraction_hierarchy(negative),std::invalid_argument);
+    ContractionHierarchyQuery<int> query(std::make_shared<const HType>(build_contraction_hierarchy(_sparse_graph)));
+    EXPECT_THROW(query.distance(-1,0),std::invalid_argument);
+    EXPECT_THROW(query.distance(0,300),std::invalid_argument);
+}
+#endif // CONTRACTIONHIERARCHY_TEST
@@ -0,0 +1,286 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef DAGSCHEDULE
+#define DAGSCHEDULE
+#include <memory>
+#include <vector>
+#include <utility>
+#include <stdexcept>
+#include "../../../header.h"
+#include "../../../parallel_algorithms/parallel_for/parallelfor.h"
+
+namespace IntroductionToAlgorithm
+{
+    namespace GraphAlgorithm
+    {
+        //!DAGPathResult：`DAGSchedule`的一次单源路径计算的结果
+        /*!
+        * 两个数组都以顶点`id`为下标：
+        *
+        * - `distance`：源点到各顶点的最短（或最长）路径权重。不可达的顶点为`unlimit<EWeightType>()`
+        * - `parent`：各顶点在最短（或最长）路径树中的父结点`id`。源点、不可达的顶点为-1
+        */
+        template<typename VIDType,typename EWeightType> struct DAGPathResult
+        {
+            std::vector<EWeightType> distance;  /*!< 源点到各顶点的路径权重*/
+            std::vector<VIDType> parent;        /*!< 各顶点的父结点`id`*/
+        };
+
+        //!DAGSchedule：有向无环图的分层调度，用于反复计算单源最短路径、最长路径，算法导论24章24.2节
+        /*!
+        * `dag_shortest_path`每次调用都要重新做一次基于深度优先搜索的拓扑排序，然后顺序地松弛所有的边。
+        * 对于同一个有向无环图、许多个源点和许多组权重的场景（如流水线的关键路径分析），`DAGSchedule`在构造时一次性地：
+        *
+        * - 用Kahn算法计算每个顶点的层号：入度为0的顶点为第0层，其余顶点的层号为其所有前驱的层号的最大值加一。
+        *   同一层的顶点之间没有边，所有的边都从较低的层指向较高的层
+        * - 将顶点按层排列为`order`，第L层的顶点为`order[level_offsets[L]..level_offsets[L+1])`，是一段连续的区间
+        * - 按照`order`的次序建立入边的压缩稀疏行数组：入边的起点以它在`order`中的位置表示，入边的权重下标为边号
+        *
+        * 边号为构造时按照起点`id`递增、同一起点按照`neighbors`的次序对边的编号（见`edges()`），
+        * 调用者提供的权重数组按照边号排列。构造时图中的权重保存为默认的权重数组。
+        *
+        * 之后每次查询都逐层进行：处理第L层时，第L层的每个顶点从它的入边中“拉取”最小（最长路径时为最大）的`d(u)+w(u,v)`。
+        * 同一层的顶点互不依赖，并且每个顶点只由一个线程写入，因此一层之内可以不加锁地并行；层与层之间是同步点。
+        * 低于源点所在层的顶点不可能从源点到达，查询从源点所在的层开始。
+        *
+        * 多组权重可以在一次扫描中一起计算：距离数组按照（顶点，权重组）交错存放，拉取一条入边时同时更新所有的权重组。
+        *
+        * - 构造的时间复杂度 O(V+E)，之后每次查询 O(V+E)（K组权重时为 O(K(V+E))）
+        */
+        template<typename VIDType,typename EWeightType> class DAGSchedule
+        {
+        public:
+            //!显式构造函数
+            /*!
+            * \param graph:指向图的强指针，必须非空，否则抛出异常。图中有环时抛出异常
+            */
+            template<typename GraphType> explicit DAGSchedule(std::shared_ptr<GraphType> graph)
+            {
+                if(!graph)
+                    throw std::invalid_argument("DAGSchedule error: graph must not be nullptr!");
+                const std::size_t num=graph->vertexes.size();
+                //************ 编号所有的边，并计算入度 ************
+                std::vector<std::size_t> in_degree(num,0);
+                std::vector<std::size_t> out_offsets(num+1,0);
+                for(std::size_t u=0;u<num;u++)
+                {
+                    if(vertex_exists(graph->vertexes,u))
+                        for(const auto& neighbor:graph->neighbors(u))
+                        {
+                            _edges.push_back(std::make_pair(VIDType(u),neighbor.first));
+                            _weights.push_back(neighbor.second);
+                            in_degree[neighbor.first]++;
+                        }
+                    out_offsets[u+1]=_edges.size();
+                }
+                //************ Kahn算法：逐层剥离入度为0的顶点 ************
+                _level.assign(num,-1);
+                _level_offsets.push_back(0);
+                for(std::size_t v=0;v<num;v++)
+                    if(vertex_exists(graph->vertexes,v)&&in_degree[v]==0)
+                        _order.push_back(v);
+                std::size_t level_begin=0;
+                while(level_begin<_order.size())
+                {
+                    const std::size_t level_end=_order.size();
+                    const int level=_level_offsets.size()-1;
+                    for(std::size_t i=level_begin;i<level_end;i++)
+                    {
+                        VIDType u=_order[i];
+                        _level[u]=level;
+                        for(std::size_t k=out_offsets[u];k<out_offsets[u+1];k++)
+                            if(--in_degree[_edges[k].second]==0)
+                                _order.push_back(_edges[k].second);
+                    }
+                    _level_offsets.push_back(level_end);
+                    level_begin=level_end;
+                }
+                std::size_t vertex_num=0;
+                for(std::size_t v=0;v<num;v++)
+                    if(vertex_exists(graph->vertexes,v)) vertex_num++;
+                if(_order.size()!=vertex_num)
+                    throw std::invalid_argument("DAGSchedule error: graph must be acyclic!");
+                //************ 按照order的次序建立入边数组 ************
+                _position.assign(num,-1);
+                for(std::size_t i=0;i<_order.size();i++)
+                    _position[_order[i]]=i;
+                _in_offsets.assign(_order.size()+1,0);
+                for(const auto& edge:_edges)
+                    _in_offsets[_position[edge.second]+1]++;
+                for(std::size_t i=0;i<_order.size();i++)
+                    _in_offsets[i+1]+=_in_offsets[i];
+                _in_sources.resize(_edges.size());
+                _in_edges.resize(_edges.size());
+                std::vector<std::size_t> cursor(_in_offsets.begin(),_in_offsets.end()-1);
+                for(std::size_t k=0;k<_edges.size();k++)
+                {
+                    std::size_t slot=cursor[_position[_edges[k].second]]++;
+                    _in_sources[slot]=_position[_edges[k].first];
+                    _in_edges[slot]=k;
+                }
+            }
+            //!shortest_paths：以构造时的权重计算单源最短路径
+            /*!
+            * \param source_id:源点，必须有效，否则抛出异常
+            * \param thread_num:线程数量。若为0则使用硬件支持的并发线程数量。默认为1
+            * \return: 最短路径的结果，与`dag_shortest_path`得到的`key`相同
+            */
+            DAGPathResult<VIDType,EWeightType> shortest_paths(VIDType source_id,std::size_t thread_num=1) const
+            {
+                return _sweep(source_id,std::vector<const std::vector<EWeightType>*>(1,&_weights),false,thread_num).front();
+            }
+            //!longest_paths：以构造时的权重计算单源最长路径（如关键路径）
+            /*!
+            * \param source_id:源点，必须有效，否则抛出异常
+            * \param thread_num:线程数量。若为0则使用硬件支持的并发线程数量。默认为1
+            * \return: 最长路径的结果。有向无环图中最长路径总是存在的，可以是负权重
+            */
+            DAGPathResult<VIDType,EWeightType> longest_paths(VIDType source_id,std::size_t thread_num=1) const
+            {
+                return _sweep(source_id,std::vector<const std::vector<EWeightType>*>(1,&_weights),true,thread_num).front();
+            }
+            //!shortest_paths：在一次扫描中以多组权重计算单源最短路径
+            /*!
+            * \param source_id:源点，必须有效，否则抛出异常
+            * \param weights:多组权重，每一组的大小必须为`edge_num()`并按照边号排列，否则抛出异常
+            * \param thread_num:线程数量。若为0则使用硬件支持的并发线程数量。默认为1
+            * \return: 与`weights`一一对应的结果
+            */
+            std::vector<DAGPathResult<VIDType,EWeightType>> shortest_paths(VIDType source_id,
+                            const std::vector<std::vector<EWeightType>>& weights,std::size_t thread_num=1) const
+            {
+                return _sweep(source_id,_weight_pointers(weights),false,thread_num);
+            }
+            //!longest_paths：在一次扫描中以多组权重计算单源最长路径
+            /*!
+            * \param source_id:源点，必须有效，否则抛出异常
+            * \param weights:多组权重，每一组的大小必须为`edge_num()`并按照边号排列，否则抛出异常
+            * \param thread_num:线程数量。若为0则使用硬件支持的并发线程数量。默认为1
+            * \return: 与`weights`一一对应的结果
+            */
+            std::vector<DAGPathResult<VIDType,EWeightType>> longest_paths(VIDType source_id,
+                            const std::vector<std::vector<EWeightType>>& weights,std::size_t thread_num=1) const
+            {
+                return _sweep(source_id,_weight_pointers(weights),true,thread_num);
+            }
+            //!level_num：返回层数
+            std::size_t level_num() const {return _level_offsets.size()-1;}
+            //!level：返回顶点的层号，不存在的顶点为-1
+            int level(VIDType id) const {return _level.at(id);}
+            //!level_vertexes：返回第L层的顶点，它们是`order()`中连续的一段
+            std::vector<VIDType> level_vertexes(std::size_t L) const
+            {
+                return std::vector<VIDType>(_order.begin()+_level_offsets.at(L),_order.begin()+_level_offsets.at(L+1));
+            }
+            //!order：返回按层排列的所有顶点，它是一个拓扑排序
+            const std::vector<VIDType>& order() const {return _order;}
+            //!edges：返回按照边号排列的所有边（起点，终点）
+            const std::vector<std::pair<VIDType,VIDType>>& edges() const {return _edges;}
+            //!edge_num：返回边的数量
+            std::size_t edge_num() const {return _edges.size();}
+        private:
+            //!_weight_pointers：检查各组权重的大小，并返回指向它们的指针
+            std::vector<const std::vector<EWeightType>*> _weight_pointers(const std::vector<std::vector<EWeightType>>& weights) const
+            {
+                std::vector<const std::vector<EWeightType>*> pointers;
+                for(const auto& group:weights)
+                {
+                    if(group.size()!=_edges.size())
+                        throw std::invalid_argument("DAGSchedule error: every weight vector must have edge_num() elements!");
+                    pointers.push_back(&group);
+                }
+                return pointers;
+            }
+            //!_sweep：逐层计算单源最短（最长）路径
+            /*!
+            * 距离数组以`order`中的位置为下标，K组权重交错存放：位置i的第j组距离为`distance[i*K+j]`
+            */
+            std::vector<DAGPathResult<VIDType,EWeightType>> _sweep(VIDType source_id,const std::vector<const std::vector<EWeightType>*>& weights,
+                                                                    bool longest,std::size_t thread_num) const
+            {
+                if(source_id<0||static_cast<std::size_t>(source_id)>=_position.size()||_position[source_id]<0)
+                    throw std::invalid_argument("DAGSchedule error: source_id muse belongs [0,N) and the vertex must exist!");
+                const std::size_t K=weights.size();
+                const std::size_t num=_order.size();
+                const EWeightType INFINITE=unlimit<EWeightType>();
+                std::vector<EWeightType> distance(num*K,INFINITE);
+                std::vector<std::ptrdiff_t> parent(num*K,-1);       //父结点在order中的位置
+                const std::size_t source=_position[source_id];
+                for(std::size_t j=0;j<K;j++) distance[source*K+j]=0;
+                for(std::size_t L=_level[source_id]+1;L<level_num();L++)
+                {
+                    ParallelAlgorithm::parallel_for(_level_offsets[L],_level_offsets[L+1],thread_num,[&](std::size_t v){
+                        for(std::size_t k=_in_offsets[v];k<_in_offsets[v+1];k++)
+                        {
+                            const std::size_t u=_in_sources[k];
+                            const std::size_t edge=_in_edges[k];
+                            for(std::size_t j=0;j<K;j++)
+                            {
+                                const EWeightType distance_u=distance[u*K+j];
+                                if(!(distance_u<INFINITE)) continue;
+                                const EWeightType candidate=distance_u+(*weights[j])[edge];
+                                EWeightType& distance_v=distance[v*K+j];
+                                if(!(distance_v<INFINITE)||(longest?candidate>distance_v:candidate<distance_v))
+                                {
+                                    distance_v=candidate;
+                                    parent[v*K+j]=u;
+                                }
+                            }
+                        }
+                    });
+                }
+                //************ 将结果转换为以顶点id为下标 ************
+                std::vector<DAGPathResult<VIDType,EWeightType>> results(K);
+                for(std::size_t j=0;j<K;j++)
+                {
+                    results[j].distance.assign(_position.size(),INFINITE);
+                    results[j].parent.assign(_position.size(),-1);
+                    for(std::size_t i=0;i<num;i++)
+                    {
+                        results[j].distance[_order[i]]=distance[i*K+j];
+                        if(parent[i*K+j]>=0) results[j].parent[_order[i]]=_order[parent[i*K+j]];
+                    }
+                }
+                return results;
+            }
+
+            std::vector<std::pair<VIDType,VIDType>> _edges;     /*!< 按照边号排列的边*/
+            std::vector<EWeightType> _weights;                  /*!< 构造时图中的权重，按照边号排列*/
+            std::vector<VIDType> _order;                        /*!< 按层排列的顶点*/
+            std::vector<std::size_t> _level_offsets;            /*!< 第L层的顶点位于order[level_offsets[L],level_offsets[L+1])*/
+            std::vector<int> _level;                            /*!< 各顶点的层号，不存在的顶点为-1*/
+            std::vector<std::ptrdiff_t> _position;              /*!< 各顶点在order中的位置，不存在的顶点为-1*/
+            std::vector<std::size_t> _in_offsets;               /*!< 位置i的顶点的入边位于[in_offsets[i],in_offsets[i+1])*/
+            std::vector<std::size_t> _in_sources;               /*!< 入边的起点在order中的位置*/
+            std::vector<std::size_t> _in_edges;                 /*!< 入边的边号*/
+        };
+
+        //!make_dag_schedule：为有向无环图构造分层调度
+        /*!
+        * \param graph:指向图的强指针，必须非空，否则抛出异常。图中有环时抛出异常
+        * \return: 以图的顶点编号类型、权重类型实例化的`DAGSchedule`
+        */
+        template<typename GraphType>
+        DAGSchedule<typename GraphType::VIDType,typename GraphType::EWeightType> make_dag_schedule(std::shared_ptr<GraphType> graph)
+        {
+            return DAGSchedule<typename GraphType::VIDType,typename GraphType::EWeightType>(graph);
+        }
+    }
+}
+#endif // DAGSCHEDULE
@@ -0,0 +1,195 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef DAGSCHEDULE_TEST
+#define DAGSCHEDULE_TEST
+#include <random>
+#include <algorithm>
+#include "../../../google_test/gtest.h"
+#include "dagschedule.h"
+#include "dagshortpath.h"
+#include "../../basic_graph/graph_representation/csr_graph/csrgraph.h"
+#include "../../basic_graph/graph_representation/graph_vertex/dfs_vertex.h"
+#include "../../graph_generator/graphgenerator.h"
+
+using IntroductionToAlgorithm::GraphAlgorithm::DAGSchedule;
+using IntroductionToAlgorithm::GraphAlgorithm::make_dag_schedule;
+using IntroductionToAlgorithm::GraphAlgorithm::dag_shortest_path;
+using IntroductionToAlgorithm::GraphAlgorithm::CSRGraph;
+using IntroductionToAlgorithm::GraphAlgorithm::DFS_Vertex;
+using IntroductionToAlgorithm::GraphAlgorithm::erdos_renyi_graph;
+
+//!DAGScheduleTest:测试类，用于为测试提供基础数据
+/*!
+*
+* `DAGScheduleTest`是 `::testing::Test` 的子类。它主要用于为每一个`TEST_F`准备测试环境
+*/
+class DAGScheduleTest:public ::testing::Test
+{
+public:
+    typedef CSRGraph<DFS_Vertex<int>> GType; /*!< 模板实例化的图类型*/
+protected:
+    void SetUp()
+    {
+        //********* 随机有向图中只保留从小编号指向大编号的边，得到有向无环图，边的权重可以为负 **********
+        auto random=erdos_renyi_graph(400,2400,11);
+        std::mt19937 gen(11);
+        std::uniform_int_distribution<int> weight_dist(-5,20);
+        for(const auto& edge:random.edges)
+            if(std::get<0>(edge)<std::get<1>(edge))
+                _edges.push_back(std::make_tuple(std::get<0>(edge),std::get<1>(edge),weight_dist(gen)));
+        _graph=std::make_shared<GType>(400,_edges.begin(),_edges.end(),unlimit<int>());
+    }
+    void TearDown(){}
+    //!_expect_paths：按照顶点编号的次序（一个拓扑排序）用动态规划计算单源最短（最长）路径，作为期望结果
+    std::vector<int> _expect_paths(int source,const std::vector<int>& weights,bool longest) const
+    {
+        auto schedule=make_dag_schedule(_graph);
+        std::vector<int> distance(400,unlimit<int>());
+        distance[source]=0;
+        for(int u=0;u<400;u++)
+        {
+            if(!(distance[u]<unlimit<int>())) continue;
+            for(std::size_t k=0;k<schedule.edge_num();k++)
+            {
+                if(schedule.edges()[k].first!=u) continue;
+                int v=schedule.edges()[k].second;
+                int candidate=distance[u]+weights[k];
+                if(!(distance[v]<unlimit<int>())||(longest?candidate>distance[v]:candidate<distance[v]))
+                    distance[v]=candidate;
+            }
+        }
+        return distance;
+    }
+    std::vector<GType::EdgeTupleType> _edges;   /*!< 有向无环图的边*/
+    std::shared_ptr<GType> _graph;              /*!< 有向无环图*/
+};
+//!test_dag_schedule_levels:测试分层
+/*!
+*
+* 每条边都从较低的层指向较高的层；每一层的顶点在`order()`中连续；非第0层的顶点都有一条来自上一层的入边
+*/
+TEST_F(DAGScheduleTest,test_dag_schedule_levels)
+{
+    auto schedule=make_dag_schedule(_graph);
+    ASSERT_EQ(schedule.order().size(),400);
+    EXPECT_EQ(schedule.edge_num(),_edges.size());
+    for(const auto& edge:schedule.edges())
+        EXPECT_LT(schedule.level(edge.first),schedule.level(edge.second));
+    std::vector<int> order;
+    for(std::size_t L=0;L<schedule.level_num();L++)
+        for(int v:schedule.level_vertexes(L))
+        {
+            EXPECT_EQ(schedule.level(v),L);
+            order.push_back(v);
+            if(L==0) continue;
+            bool has_parent_level=false;
+            for(const auto& edge:schedule.edges())
+                if(edge.second==v&&schedule.level(edge.first)==int(L)-1) has_parent_level=true;
+            EXPECT_TRUE(has_parent_level);
+        }
+    EXPECT_EQ(order,schedule.order());
+}
+//!test_dag_schedule_shortest:测试单源最短路径
+/*!
+*
+* 不同的源点、线程数量下，`shortest_paths`与`dag_shortest_path`的结果相同，父结点构成最短路径树
+*/
+TEST_F(DAGScheduleTest,test_dag_schedule_shortest)
+{
+    auto schedule=make_dag_schedule(_graph);
+    for(int source:{0,3,57,200,399})
+    {
+        dag_shortest_path(_graph,source);
+        for(std::size_t thread_num:{1,4,0})
+        {
+            auto result=schedule.shortest_paths(source,thread_num);
+            for(int v=0;v<400;v++)
+            {
+                ASSERT_EQ(result.distance[v],_graph->vertexes[v]->key)<<"source "<<source<<" vertex "<<v;
+                if(v==source||!(result.distance[v]<unlimit<int>()))
+                {
+                    EXPECT_EQ(result.parent[v],-1);
+                    continue;
+                }
+                int parent=result.parent[v];
+                ASSERT_TRUE(_graph->has_edge(parent,v));
+                EXPECT_EQ(result.distance[parent]+_graph->weight(parent,v),result.distance[v]);
+            }
+        }
+    }
+}
+//!test_dag_schedule_longest:测试单源最长路径
+/*!
+*
+* `longest_paths`与按拓扑排序的动态规划结果相同
+*/
+TEST_F(DAGScheduleTest,test_dag_schedule_longest)
+{
+    auto schedule=make_dag_schedule(_graph);
+    std::vector<int> weights;
+    for(const auto& edge:schedule.edges())
+        weights.push_back(_graph->weight(edge.first,edge.second));
+    for(int source:{0,3,57,200})
+    {
+        auto expect=_expect_paths(source,weights,true);
+        EXPECT_EQ(schedule.longest_paths(source,1).distance,expect);
+        EXPECT_EQ(schedule.longest_paths(source,3).distance,expect);
+    }
+}
+//!test_dag_schedule_batch:测试多组权重的批量计算
+/*!
+*
+* 一次扫描得到的各组结果与逐组计算的结果相同
+*/
+TEST_F(DAGScheduleTest,test_dag_schedule_batch)
+{
+    auto schedule=make_dag_schedule(_graph);
+    std::mt19937 gen(5);
+    std::uniform_int_distribution<int> weight_dist(0,30);
+    std::vector<std::vector<int>> weights(5,std::vector<int>(schedule.edge_num()));
+    for(auto& group:weights)
+        std::generate(group.begin(),group.end(),[&](){return weight_dist(gen);});
+    auto shortest=schedule.shortest_paths(3,weights,2);
+    auto longest=schedule.longest_paths(3,weights,0);
+    ASSERT_EQ(shortest.size(),5);
+    ASSERT_EQ(longest.size(),5);
+    for(std::size_t j=0;j<weights.size();j++)
+    {
+        EXPECT_EQ(shortest[j].distance,_expect_paths(3,weights[j],false));
+        EXPECT_EQ(longest[j].distance,_expect_paths(3,weights[j],true));
+    }
+    EXPECT_TRUE(schedule.shortest_paths(3,std::vector<std::vector<int>>()).empty());
+}
+//!test_dag_schedule_invalid:测试无效的参数
+/*!
+*
+* 空的图、有环的图、无效的源点、大小不对的权重抛出异常
+*/
+TEST_F(DAGScheduleTest,test_dag_schedule_invalid)
+{
+    EXPECT_THROW(make_dag_schedule(std::shared_ptr<GType>()),std::invalid_argument);
+    std::vector<GType::EdgeTupleType> cycle={std::make_tuple(0,1,1),std::make_tuple(1,2,1),std::make_tuple(2,0,1),std::make_tuple(3,0,1)};
+    EXPECT_THROW(make_dag_schedule(std::make_shared<GType>(4,cycle.begin(),cycle.end(),unlimit<int>())),std::invalid_argument);
+    auto schedule=make_dag_schedule(_graph);
+    EXPECT_THROW(schedule.shortest_paths(-1),std::invalid_argument);
+    EXPECT_THROW(schedule.longest_paths(400),std::invalid_argument);
+    std::vector<std::vector<int>> weights(1,std::vector<int>(schedule.edge_num()+1));
+    EXPECT_THROW(schedule.shortest_paths(0,weights),std::invalid_argument);
+}
+#endif // DAGSCHEDULE_TEST
@@ -73,7 +73,7 @@ namespace IntroductionToAlgorithm
             typedef typename GraphType::VIDType VIDType;
             if(!graph)
                 throw std::invalid_argument("dag_shortest_path error: graph must not be nullptr!");
-            if(source_id<0||source_id>=GraphType::NUM||!graph->vertexes.at(source_id))
+            if(source_id<0||static_cast<std::size_t>(source_id)>=graph->vertexes.size()||!graph->vertexes.at(source_id))
                 throw std::invalid_argument("dag_shortest_path error: source_id muse belongs [0,N) and graph->vertexes[source_id] must not be nullptr!");
 
             auto sorted_vertexs = topology_sort(graph);                                         //先进行拓扑排序，确定结点之间的一个线性次序
@@ -81,8 +81,8 @@ namespace IntroductionToAlgorithm
 
             for(const VIDType& v_id:sorted_vertexs)
             {
-                for(const auto&edge:graph->vertex_edge_tuples(v_id))
-                   relax(graph->vertexes.at(v_id),graph->vertexes.at(std::get<1>(edge)),std::get<2>(edge));  //再对每个结点进行松弛操作
+                for(const auto&neighbor:graph->neighbors(v_id))
+                   relax(graph->vertexes.at(v_id),graph->vertexes.at(neighbor.first),neighbor.second);  //再对每个结点进行松弛操作
             }
         }
     }
@@ -0,0 +1,209 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef DELTASTEPPING
+#define DELTASTEPPING
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <cstdint>
+#include <algorithm>
+#include <map>
+#include "../bellman_ford/bellmanford.h"
+#include "../../../parallel_algorithms/parallel_for/parallelfor.h"
+#include "../../../parallel_algorithms/atomic_min/atomicmin.h"
+
+namespace IntroductionToAlgorithm
+{
+    namespace GraphAlgorithm
+    {
+
+        //!delta_stepping：单源最短路径的并行 Delta-Stepping 算法
+        /*!
+        * \param graph:指向图的强指针，必须非空。若为空则抛出异常
+        * \param source_id：源结点`id`，必须有效。若无效则抛出异常
+        * \param delta：桶的宽度 Δ，必须非负。为0时自动选取为 max(1,最大权重/平均出度)。默认为0
+        * \param thread_num：线程数量。若为0则使用硬件支持的并发线程数量
+        * \return: void
+        *
+        * 与`dijkstra`一样，要求所有边的权重都为非负值，若存在负权重的边则抛出异常。算法结束时结点的`key`、`parent`与`dijkstra`具有相同的含义。
+        *
+        * ## Delta-Stepping 算法
+        *
+        * Dijkstra 算法每次只从最小优先级队列中弹出一个结点，无法并行。Delta-Stepping 把最短路径估计按照宽度 Δ 划分为若干个桶，第 i 个桶存放估计值位于`[i*Δ,(i+1)*Δ)`的结点。
+        * 权重不超过 Δ 的边称为轻边，其余的称为重边。算法按照桶的编号从小到大处理：
+        *
+        * - 取出当前桶中的所有结点，并行地松弛它们的轻边。轻边的松弛可能把结点放回当前桶，因此重复这一步直到当前桶为空
+        * - 对本桶中处理过的所有结点，并行地松弛它们的重边一次（重边的另一端一定落在后面的桶中）
+        *
+        * Δ=1 且权重为正整数时退化为 Dijkstra 算法（每桶一个距离值）；Δ=正无穷时退化为 Bellman-Ford 算法。
+        *
+        * ## 并行松弛
+        *
+        * 每个结点的（最短路径估计，父结点`id`）被打包为一个64位整数，存放于原子数组中。松弛操作是一次`atomic_fetch_min`，只有严格更小时才写入，
+        * 这与`relax`的语义一致；距离减小的结点被放入对应的桶。由于按字典序取最小，距离相同时父结点为`id`最小的一个满足 u.key+w(u,v)=v.key 的结点，
+        * 因此结果与线程数量、调度次序无关。最短路径估计与`dijkstra`完全相同；当最短路径唯一时父结点也相同。
+        *
+        * 内部使用轻边在前、重边在后的压缩稀疏行邻接表，不通过`std::shared_ptr`访问结点；只在最后一次性写回结点。
+        *
+        * ### 算法性能
+        *
+        * 总工作量为 O((V+E+重复松弛次数)*lg(非空桶数))，每个桶内部的松弛在各线程之间并行。
+        * 桶保存在以编号为键的`std::map`中，只有非空的桶占用空间，处理完一个桶后直接跳到下一个非空的桶，因此与最短路径的长度/Δ无关
+        */
+        template<typename GraphType>
+        void delta_stepping(std::shared_ptr<GraphType> graph, typename GraphType::VIDType source_id,
+                            typename GraphType::EWeightType delta=0,std::size_t thread_num=0)
+        {
+            typedef typename GraphType::VIDType VIDType;
+            typedef typename GraphType::EWeightType EWeightType;
+            using IntroductionToAlgorithm::ParallelAlgorithm::parallel_for;
+            using IntroductionToAlgorithm::ParallelAlgorithm::parallel_blocks;
+            using IntroductionToAlgorithm::ParallelAlgorithm::atomic_fetch_min;
+            using IntroductionToAlgorithm::ParallelAlgorithm::pack_pair;
+            using IntroductionToAlgorithm::ParallelAlgorithm::pack_high;
+            using IntroductionToAlgorithm::ParallelAlgorithm::pack_low;
+
+            if(!graph)
+                throw std::invalid_argument("delta_stepping error: graph must not be nullptr!");
+            if(source_id<0||static_cast<std::size_t>(source_id)>=graph->vertexes.size()||!graph->vertexes.at(source_id))
+                throw std::invalid_argument("delta_stepping error: source_id muse belongs [0,N) and graph->vertexes[source_id] must not be nullptr!");
+            if(delta<0)
+                throw std::invalid_argument("delta_stepping error: delta must not be negative!");
+
+            const std::size_t num=graph->vertexes.size();
+            const std::size_t threads=ParallelAlgorithm::thread_num_or_default(thread_num);
+            const std::uint32_t INFINITE=unlimit<EWeightType>();
+            const std::uint32_t NO_PARENT=0xFFFFFFFF;
+
+            //************* 构建压缩稀疏行邻接表：每一行轻边在前，重边在后 ****************
+            std::vector<std::size_t> offsets(num+1,0);
+            std::vector<EWeightType> max_weights(num,0);
+            parallel_for(0,num,threads,[&](std::size_t i){
+                std::size_t degree=0;
+                if(vertex_exists(graph->vertexes,i))
+                    for(const auto& neighbor:graph->neighbors(i))
+                    {
+                        degree++;
+                        max_weights[i]=std::max(max_weights[i],neighbor.second);
+                        if(neighbor.second<0) throw std::invalid_argument("delta_stepping error: edge weight must not be negative!");
+                    }
+                offsets[i+1]=degree;
+            });
+            for(std::size_t i=0;i<num;i++) offsets[i+1]+=offsets[i];
+            if(delta==0)
+            {
+                EWeightType max_weight=*std::max_element(max_weights.begin(),max_weights.end());
+                std::size_t edge_num=std::max<std::size_t>(offsets[num],1);
+                delta=std::max<EWeightType>(1,EWeightType(max_weight*double(num)/edge_num));
+            }
+            std::vector<VIDType> targets(offsets[num]);
+            std::vector<EWeightType> weights(offsets[num]);
+            std::vector<std::size_t> heavy_begin(num,0);                                        //每一行重边的起始位置
+            parallel_for(0,num,threads,[&](std::size_t i){
+                std::size_t light=offsets[i];
+                heavy_begin[i]=offsets[i];
+                if(!vertex_exists(graph->vertexes,i)) return;
+                for(const auto& neighbor:graph->neighbors(i))
+                    if(neighbor.second<=delta) heavy_begin[i]++;
+                std::size_t heavy=heavy_begin[i];
+                for(const auto& neighbor:graph->neighbors(i))
+                {
+                    std::size_t& k=neighbor.second<=delta?light:heavy;
+                    targets[k]=neighbor.first;
+                    weights[k]=neighbor.second;
+                    k++;
+                }
+            });
+
+            //************* 初始化 ****************
+            std::unique_ptr<std::atomic<std::uint64_t>[]> state(new std::atomic<std::uint64_t>[num]);  //（最短路径估计，父结点）
+            parallel_for(0,num,threads,[&](std::size_t i){state[i].store(pack_pair(INFINITE,NO_PARENT),std::memory_order_relaxed);});
+            state[source_id].store(pack_pair(0,NO_PARENT),std::memory_order_relaxed);
+            auto distance_of=[&](std::size_t v)->std::uint32_t{return pack_high(state[v].load(std::memory_order_relaxed));};
+
+            std::map<std::size_t,std::vector<VIDType>> buckets;                                //只保存非空的桶，按编号排列
+            buckets[0].push_back(source_id);
+            std::vector<std::vector<VIDType>> requests(threads);                                //每个块中距离减小的结点
+            std::vector<std::size_t> phase_stamp(num,0);                                        //去除桶中重复的结点
+            std::size_t phase=0;
+            //!relax_edges:并行松弛`vertexes`中每个结点在[begin_of(u),end_of(u))中的边，并把距离减小的结点放入对应的桶
+            auto relax_edges=[&](const std::vector<VIDType>& vertexes,const std::vector<std::size_t>& begin_of,const std::vector<std::size_t>& end_of){
+                for(auto& request:requests) request.clear();
+                parallel_blocks(0,vertexes.size(),threads,[&](std::size_t begin,std::size_t end,std::size_t index){
+                    auto& request=requests[index];
+                    for(std::size_t i=begin;i<end;i++)
+                    {
+                        VIDType u=vertexes[i];
+                        std::uint32_t distance_u=distance_of(u);
+                        for(std::size_t k=begin_of[u];k<end_of[u];k++)
+                        {
+                            std::uint64_t distance_v=std::uint64_t(distance_u)+weights[k];
+                            if(distance_v>=INFINITE) continue;                                  //u.key+weight为正无穷，则不可能松弛
+                            VIDType v=targets[k];
+                            if(VIDType(u)==v) continue;
+                            std::uint64_t old=atomic_fetch_min(state[v],pack_pair(std::uint32_t(distance_v),u));
+                            if(pack_high(old)>distance_v) request.push_back(v);
+                        }
+                    }
+                },64);
+                for(const auto& request:requests)
+                    for(VIDType v:request)
+                        buckets[distance_of(v)/delta].push_back(v);
+            };
+
+            const std::vector<std::size_t> row_end(offsets.begin()+1,offsets.end());          //每一行的终止位置
+            //************* 按桶处理 ****************
+            while(!buckets.empty())
+            {
+                const std::size_t current=buckets.begin()->first;                               //直接跳到编号最小的非空桶
+                std::vector<VIDType> settled;                                                   //本桶中处理过的结点
+                for(auto iter=buckets.begin();iter!=buckets.end()&&iter->first==current;iter=buckets.begin())
+                {
+                    std::vector<VIDType> bucket;
+                    bucket.swap(iter->second);
+                    buckets.erase(iter);                                                        //松弛轻边可能重新创建当前桶
+                    phase++;
+                    std::vector<VIDType> frontier;
+                    for(VIDType v:bucket)
+                        if(phase_stamp[v]!=phase&&distance_of(v)/delta==current)                //跳过重复的、已经移到更前面的桶中的结点
+                        {
+                            phase_stamp[v]=phase;
+                            frontier.push_back(v);
+                        }
+                    relax_edges(frontier,offsets,heavy_begin);                                  //松弛轻边
+                    settled.insert(settled.end(),frontier.begin(),frontier.end());
+                }
+                std::sort(settled.begin(),settled.end());
+                settled.erase(std::unique(settled.begin(),settled.end()),settled.end());
+                relax_edges(settled,heavy_begin,row_end);                                       //松弛重边
+            }
+
+            //************* 写回结点 ****************
+            initialize_single_source(graph,source_id);
+            parallel_for(0,num,threads,[&](std::size_t i){
+                std::uint64_t packed=state[i].load(std::memory_order_relaxed);
+                if(pack_high(packed)==INFINITE||!graph->vertexes[i]) return;
+                graph->vertexes[i]->key=pack_high(packed);
+                if(pack_low(packed)!=NO_PARENT)
+                    graph->vertexes[i]->parent=graph->vertexes[pack_low(packed)];
+            });
+        }
+    }
+}
+#endif // DELTASTEPPING
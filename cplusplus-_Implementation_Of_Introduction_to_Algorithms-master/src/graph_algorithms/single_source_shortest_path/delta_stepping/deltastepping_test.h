@@ -0,0 +1,154 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef DELTASTEPPING_TEST
+#define DELTASTEPPING_TEST
+#include <random>
+#include <set>
+#include "../../../google_test/gtest.h"
+#include "deltastepping.h"
+#include "../dijkstra/dijkstra.h"
+#include "../../basic_graph/graph_representation/graph/graph.h"
+#include "../../basic_graph/graph_representation/csr_graph/csrgraph.h"
+#include "../../basic_graph/graph_representation/graph_vertex/vertexp.h"
+
+using IntroductionToAlgorithm::GraphAlgorithm::Graph;
+using IntroductionToAlgorithm::GraphAlgorithm::CSRGraph;
+using IntroductionToAlgorithm::GraphAlgorithm::VertexP;
+using IntroductionToAlgorithm::GraphAlgorithm::dijkstra;
+using IntroductionToAlgorithm::GraphAlgorithm::delta_stepping;
+
+//!DeltaSteppingTest:测试类，用于为测试提供基础数据
+/*!
+*
+* `DeltaSteppingTest`是 `::testing::Test` 的子类。它主要用于为每一个`TEST_F`准备测试环境
+*/
+class DeltaSteppingTest : public ::testing::Test
+{
+public:
+    typedef CSRGraph<VertexP<int>> GraphType; /*!< 模板实例化的图类型，该图的顶点类型为`VertexP<int>`*/
+    typedef GraphType::EdgeTupleType EdgeTupleType; /*!< 边的三元素元组类型*/
+protected:
+    void SetUp()
+    {
+        //****  随机有向图：3000个顶点，20000条边，权重在[0,100]之间（含0权重）；顶点2999不可达   ****
+        const int num=3000;
+        std::mt19937 gen(24);
+        std::uniform_int_distribution<int> vertex_dist(0,num-2);
+        std::uniform_int_distribution<int> weight_dist(0,100);
+        std::set<std::pair<int,int>> edge_set;
+        while(edge_set.size()<20000)
+        {
+            int from=vertex_dist(gen);
+            int to=vertex_dist(gen);
+            if(from!=to) edge_set.insert(std::make_pair(from,to));   //relax不允许自环
+        }
+        for(const auto& edge:edge_set)
+            _edges.push_back(std::make_tuple(edge.first,edge.second,weight_dist(gen)));
+        _dijkstra_graph=std::make_shared<GraphType>(num,_edges.begin(),_edges.end(),-1);
+        dijkstra(_dijkstra_graph,0);
+    }
+    void TearDown(){}
+
+    std::vector<EdgeTupleType> _edges;          /*!< 图的边*/
+    std::shared_ptr<GraphType> _dijkstra_graph; /*!< 执行了dijkstra算法的图*/
+};
+
+//!DeltaSteppingTest:测试单源最短路径的Delta-Stepping算法
+/*!
+* `test_invalid`:参数无效、存在负权重的边时抛出异常
+*/
+TEST_F(DeltaSteppingTest,test_invalid)
+{
+    auto graph=std::make_shared<GraphType>(3,_edges.begin(),_edges.begin(),-1);
+    EXPECT_THROW(delta_stepping(std::shared_ptr<GraphType>(),0),std::invalid_argument);
+    EXPECT_THROW(delta_stepping(graph,3),std::invalid_argument);
+    EXPECT_THROW(delta_stepping(graph,0,-1),std::invalid_argument);
+    std::vector<EdgeTupleType> negative({std::make_tuple(0,1,2),std::make_tuple(1,2,-1)});
+    graph=std::make_shared<GraphType>(3,negative.begin(),negative.end(),-100);
+    EXPECT_THROW(delta_stepping(graph,0),std::invalid_argument);
+}
+//!DeltaSteppingTest:测试单源最短路径的Delta-Stepping算法
+/*!
+* `test_same_as_dijkstra`:不同的 Δ、不同的线程数量下，最短路径估计都与`dijkstra`相同，父结点构成一棵最短路径树，且与线程数量无关
+*/
+TEST_F(DeltaSteppingTest,test_same_as_dijkstra)
+{
+    std::vector<int> parents;
+    for(int delta:{0,1,10,50,1000})
+        for(std::size_t thread_num:{1,2,4})
+        {
+            auto graph=std::make_shared<GraphType>(_dijkstra_graph->vertex_num(),_edges.begin(),_edges.end(),-1);
+            delta_stepping(graph,0,delta,thread_num);
+            std::vector<int> current_parents;
+            for(std::size_t i=0;i<graph->vertexes.size();i++)
+            {
+                auto vertex=graph->vertexes[i];
+                EXPECT_EQ(vertex->key,_dijkstra_graph->vertexes[i]->key)<<"delta:"<<delta<<"\ti:"<<i;
+                if(vertex->parent)
+                {
+                    EXPECT_EQ(vertex->key,vertex->parent->key+graph->weight(vertex->parent->id,i))<<"i:"<<i;
+                    current_parents.push_back(vertex->parent->id);
+                }else
+                {
+                    EXPECT_TRUE(i==0||vertex->key==IntroductionToAlgorithm::GraphAlgorithm::unlimit<int>())<<"i:"<<i;
+                    current_parents.push_back(-1);
+                }
+            }
+            if(parents.empty()) parents=current_parents;
+            EXPECT_EQ(current_parents,parents)<<"delta:"<<delta<<"\tthread_num:"<<thread_num;
+        }
+}
+//!DeltaSteppingTest:测试单源最短路径的Delta-Stepping算法
+/*!
+* `test_graph`:作用于`Graph`：链边的图
+*/
+TEST_F(DeltaSteppingTest,test_graph)
+{
+    typedef Graph<10,VertexP<int>> SmallGraphType;
+    auto graph=std::make_shared<SmallGraphType>(-1);
+    for(int i=0;i<10;i++)
+        graph->add_vertex(0);
+    for(int i=0;i<9;i++)
+        graph->add_edge(std::make_tuple(i,i+1,1)); //该图的边是从左到右组成一个链条
+    delta_stepping(graph,0,2,2);
+    EXPECT_EQ(graph->vertexes[0]->key,0);
+    EXPECT_FALSE(graph->vertexes[0]->parent);
+    for(int i=1;i<10;i++)
+    {
+        EXPECT_EQ(graph->vertexes[i]->key,i);
+        EXPECT_EQ(graph->vertexes[i]->parent,graph->vertexes[i-1]);
+    }
+}
+//!DeltaSteppingTest:测试单源最短路径的Delta-Stepping算法
+/*!
+* `test_long_path`:最短路径长度远大于 Δ 时只为非空的桶占用空间：Δ=1、最长路径约为10^9的链
+*/
+TEST_F(DeltaSteppingTest,test_long_path)
+{
+    const int num=200;
+    const int weight=5000000;
+    std::vector<EdgeTupleType> chain;
+    for(int i=0;i<num-1;i++)
+        chain.push_back(std::make_tuple(i,i+1,weight));
+    auto graph=std::make_shared<GraphType>(num,chain.begin(),chain.end(),-1);
+    delta_stepping(graph,0,1,2);
+    for(int i=0;i<num;i++)
+        EXPECT_EQ(graph->vertexes[i]->key,i*weight)<<"i:"<<i;
+}
+#endif // DELTASTEPPING_TEST
@@ -20,9 +20,11 @@
 #define DIJKSTRA
 #include <vector>
 #include "../bellman_ford/bellmanford.h"
-#include "../../../queue_algorithms/min_queue/minqueue.h"
+#include "../../../queue_algorithms/indexed_min_queue/indexedminqueue.h"
+#include "../../../queue_algorithms/id_min_queue/idminqueue.h"
+#include "../../basic_graph/graph_representation/vertex_property_map/vertexpropertymap.h"
 
-using IntroductionToAlgorithm::QueueAlgorithm::MinQueue;
+using IntroductionToAlgorithm::QueueAlgorithm::IndexedMinQueue;
 namespace IntroductionToAlgorithm
 {
     namespace GraphAlgorithm
@@ -71,7 +73,7 @@ namespace IntroductionToAlgorithm
         *
         * ### 算法性能
         *
-        * 时间复杂度为O(V^2+E)
+        * 最小优先级队列采用带索引的`IndexedMinQueue`，查找结点在队列中的位置为O(1)，`decreate_key`为O(lgV)，因此时间复杂度为O((V+E)lgV)
         *
         */
         template<typename GraphType> 
@@ -83,7 +85,7 @@ namespace IntroductionToAlgorithm
 
             if(!graph)
                 throw std::invalid_argument("dijkstra error: graph must not be nullptr!");
-            if(source_id<0||source_id>=GraphType::NUM||!graph->vertexes.at(source_id))
+            if(source_id<0||static_cast<std::size_t>(source_id)>=graph->vertexes.size()||!graph->vertexes.at(source_id))
                 throw std::invalid_argument("dijkstra error: source_id muse belongs [0,N) and graph->vertexes[source_id] must not be nullptr!");
 
             initialize_single_source(graph,source_id);
@@ -91,10 +93,11 @@ namespace IntroductionToAlgorithm
 
             auto vertex_compare=[](std::shared_ptr<VertexType> first,std::shared_ptr<VertexType> second){return first->key<second->key;};
             auto vertex_key_get=[](std::shared_ptr<VertexType> v)->KeyType& {return v->key;};
-            MinQueue<VertexType,KeyType> min_queue(vertex_compare,vertex_key_get);
+            auto vertex_id_get=[](std::shared_ptr<VertexType> v)->std::size_t {return v->id;};
+            IndexedMinQueue<VertexType,KeyType> min_queue(graph->vertexes.size(),vertex_compare,vertex_key_get,vertex_id_get);
 
             //********** 添加顶点到最小优先级队列中  ****************
-            for(int i=0;i<GraphType::NUM;i++)
+            for(std::size_t i=0;i<graph->vertexes.size();i++)
             {
                 auto vertex=graph->vertexes.at(i);
                 if(vertex) min_queue.insert(vertex);
@@ -103,16 +106,65 @@ namespace IntroductionToAlgorithm
             {
                 auto node=min_queue.extract_min();
                 current_S.push_back(vertex_key_get(node));
-                for(const auto& edge:graph->vertex_edge_tuples(node->id))
+                for(const auto& neighbor:graph->neighbors(node->id))
                 {
-                    auto another_vertex=graph->vertexes.at(std::get<1>(edge));
-                    relax(node,another_vertex,std::get<2>(edge));
+                    auto another_vertex=graph->vertexes.at(neighbor.first);
+                    relax(node,another_vertex,neighbor.second);
                     auto index=min_queue.index_inqueue(another_vertex);
                     if(index>=0)                                        //边的另一端在最小优先级队列Q中
                         min_queue.decreate_key(index,vertex_key_get(another_vertex));
                 }
             }
         }
+        //!dijkstra：以顶点属性数组保存状态的dijkstra算法
+        /*!
+        * \param graph:指向图的强指针，必须非空。若为空则抛出异常。只用到`graph->vertexes.size()`与`graph->neighbors(id)`
+        * \param source_id：源点`id`，必须有效。若无效则抛出异常
+        * \param properties:保存结果的顶点属性。它被调整为图的顶点数量并初始化，结束后`distance`为最短路径权重（不可达为正无穷），`parent`为最短路径树中的父结点
+        * \return: void
+        *
+        * 算法与`dijkstra(graph,source_id)`相同，区别在于：
+        *
+        * - 最短路径估计与父结点保存在`properties`的数组中，不读写顶点对象
+        * - 最小优先级队列为`IDMinQueue`，元素是顶点`id`。顶点在第一次被松弛时才入队，而不是一开始把所有顶点放入队列
+        * - 出队的顶点被标记为黑色，即集合S
+        */
+        template<typename GraphType,typename KeyType>
+        void dijkstra(std::shared_ptr<GraphType> graph,typename GraphType::VIDType source_id,SearchProperties<KeyType>& properties)
+        {
+            using IntroductionToAlgorithm::QueueAlgorithm::IDMinQueue;
+            if(!graph)
+                throw std::invalid_argument("dijkstra error: graph must not be nullptr!");
+            if(source_id<0||static_cast<std::size_t>(source_id)>=graph->vertexes.size()||!vertex_exists(graph->vertexes,source_id))
+                throw std::invalid_argument("dijkstra error: source_id muse belongs [0,N) and graph->vertexes[source_id] must not be nullptr!");
+
+            const std::size_t num=graph->vertexes.size();
+            properties.reset(num);
+            auto& distance=properties.distance;
+            auto& parent=properties.parent;
+            auto& color=properties.color;
+            IDMinQueue<KeyType> min_queue(num);
+            distance[source_id]=0;
+            min_queue.insert(source_id,0);
+            while(!min_queue.is_empty())
+            {
+                auto from=min_queue.extract_min();
+                color[from]=VertexColor::BLACK;                     //加入集合S
+                for(const auto& neighbor:graph->neighbors(from))
+                {
+                    auto to=neighbor.first;
+                    if(color[to]==VertexColor::BLACK) continue;
+                    KeyType new_distance=distance[from]+neighbor.second;
+                    if(new_distance<distance[to])                   //松弛
+                    {
+                        distance[to]=new_distance;
+                        parent[to]=from;
+                        color[to]=VertexColor::GRAY;
+                        min_queue.insert_or_decreate_key(to,new_distance);
+                    }
+                }
+            }
+        }
     }
 }
 #endif // DIJKSTRA
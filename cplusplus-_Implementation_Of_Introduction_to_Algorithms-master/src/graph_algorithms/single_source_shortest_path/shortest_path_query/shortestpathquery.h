@@ -0,0 +1,474 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef SHORTESTPATHQUERY
+#define SHORTESTPATHQUERY
+#include<vector>
+#include<memory>
+#include<algorithm>
+#include<stdexcept>
+#include<cstddef>
+#include<limits>
+#include"../../../header.h"
+#include"../../../queue_algorithms/id_min_queue/idminqueue.h"
+namespace IntroductionToAlgorithm
+{
+    namespace GraphAlgorithm
+    {
+        //!ZeroHeuristic：恒为0的启发函数。以它执行A*算法等价于提前终止的dijkstra算法
+        struct ZeroHeuristic
+        {
+            template<typename VIDType> int operator()(VIDType,VIDType) const {return 0;}
+        };
+
+        //!ShortestPathQuery：点到点最短路径查询
+        /*!
+        * `dijkstra`总是计算以源点为根的整棵最短路径树，并且在开始时把所有顶点放入最小优先级队列。对于大量的 s->t 查询，这样做的代价是每次 O(V)。
+        * `ShortestPathQuery`在构造时保存图并建立反向图的邻接数组，之后每次查询只访问被搜索到的顶点：
+        *
+        * - 懒惰入队：最小优先级队列（`IDMinQueue`）初始只有起点，顶点在第一次被松弛时才入队
+        * - 提前终止：终点被弹出（或双向搜索满足终止条件）时立即结束
+        * - 时间戳：每个顶点的距离、父结点附带一个时间戳，时间戳不等于本次查询的编号就视为“正无穷、无父结点”。
+        *   因此开始一次新查询只需要将查询编号加一并清空队列中的剩余元素，代价与上一次查询触及的顶点数量成正比，而不是 O(V)
+        *
+        * 提供三种查询：
+        *
+        * - `dijkstra(s,t)`：单向dijkstra
+        * - `bidirectional_dijkstra(s,t)`：从s出发沿正向边、从t出发沿反向边交替搜索
+        * - `astar(s,t,heuristic)`：A*算法，`heuristic(v,t)`是v到t的最短路径权重的下界（可接受的启发函数），如`LandmarkHeuristic`
+        *
+        * 要求所有边的权重非负。查询结束后，`path()`返回最短路径，`settled_num()`返回本次查询弹出（确定了最短路径）的顶点数量。
+        * 一个`ShortestPathQuery`对象不能被多个线程同时使用；多个线程可以各自构造一个对象，共享同一个图。
+        */
+        template<typename GraphType> class ShortestPathQuery
+        {
+        public:
+            typedef typename GraphType::VIDType VIDType;            /*!< 顶点编号的类型*/
+            typedef typename GraphType::EWeightType EWeightType;    /*!< 权重的类型*/
+
+            //!显式构造函数
+            /*!
+            * \param graph:指向图的强指针，必须非空，否则抛出异常。构造之后不能再修改图的边
+            *
+            * 构造时扫描一遍所有的边以建立反向图的邻接数组，时间复杂度 O(V+E)
+            */
+            explicit ShortestPathQuery(std::shared_ptr<GraphType> graph):_graph(graph),_query_id(0),_settled_num(0),_meet(-1)
+            {
+                if(!graph)
+                    throw std::invalid_argument("ShortestPathQuery error: graph must not be nullptr!");
+                _num=graph->vertexes.size();
+                //********* 建立反向图：先计数，再填充 **********
+                _reverse_offsets.assign(_num+1,0);
+                for(std::size_t from=0;from<_num;from++)
+                {
+                    if(!vertex_exists(graph->vertexes,from)) continue;
+                    for(const auto& neighbor:graph->neighbors(from))
+                        _reverse_offsets[neighbor.first+1]++;
+                }
+                for(std::size_t v=0;v<_num;v++)
+                    _reverse_offsets[v+1]+=_reverse_offsets[v];
+                _reverse_targets.resize(_reverse_offsets[_num]);
+                _reverse_weights.resize(_reverse_offsets[_num]);
+                std::vector<std::size_t> position(_reverse_offsets.begin(),_reverse_offsets.end()-1);
+                for(std::size_t from=0;from<_num;from++)
+                {
+                    if(!vertex_exists(graph->vertexes,from)) continue;
+                    for(const auto& neighbor:graph->neighbors(from))
+                    {
+                        auto k=position[neighbor.first]++;
+                        _reverse_targets[k]=from;
+                        _reverse_weights[k]=neighbor.second;
+                    }
+                }
+                for(int side=0;side<2;side++)
+                {
+                    _distance[side].assign(_num,unlimit<EWeightType>());
+                    _parent[side].assign(_num,-1);
+                    _stamp[side].assign(_num,0);
+                    _queue[side].reset(new QueueAlgorithm::IDMinQueue<EWeightType>(_num));
+                }
+            }
+            //!dijkstra：单向dijkstra查询
+            /*!
+            * \param source:起点，必须有效，否则抛出异常
+            * \param target:终点，必须有效，否则抛出异常
+            * \return: s到t的最短路径权重。若t不可达则返回正无穷
+            *
+            * 与`dijkstra`的区别在于懒惰入队，以及终点被弹出时立即结束
+            */
+            EWeightType dijkstra(VIDType source,VIDType target)
+            {
+                return astar(source,target,ZeroHeuristic());
+            }
+            //!astar：A*查询
+            /*!
+            * \param source:起点，必须有效，否则抛出异常
+            * \param target:终点，必须有效，否则抛出异常
+            * \param heuristic:启发函数，`heuristic(v,target)`返回v到target的最短路径权重的一个非负下界。返回正无穷表示v不能到达target，v将不会入队
+            * \return: s到t的最短路径权重。若t不可达则返回正无穷
+            *
+            * ### 算法原理
+            *
+            * A*算法就是关键字为`d(v)+heuristic(v,t)`的dijkstra算法，其中d(v)为s到v的最短路径估计。启发函数越接近真实距离，被弹出的顶点越少；
+            * 启发函数恒为0时它就是dijkstra算法。
+            *
+            * - 若启发函数是可接受的（不超过真实距离），则t被弹出时d(t)就是最短路径权重
+            * - 若启发函数还是一致的（对每条边(u,v)有 h(u)<=w(u,v)+h(v)，如`LandmarkHeuristic`），则每个顶点至多被弹出一次；
+            *   否则一个已经弹出的顶点的距离被缩减时，它会被重新放入队列
+            */
+            template<typename Heuristic>
+            EWeightType astar(VIDType source,VIDType target,const Heuristic& heuristic)
+            {
+                _check_query(source,target,"astar");
+                _begin_query();
+                const EWeightType INFINITE=unlimit<EWeightType>();
+                auto& queue=*_queue[FORWARD];
+                _relax(FORWARD,source,-1,0);
+                queue.insert(source,heuristic(source,target));
+                while(!queue.is_empty())
+                {
+                    VIDType u=queue.extract_min();
+                    _settled_num++;
+                    if(u==target) break;
+                    EWeightType distance_u=_distance[FORWARD][u];
+                    for(const auto& neighbor:_graph->neighbors(u))
+                    {
+                        VIDType v=neighbor.first;
+                        EWeightType new_distance=distance_u+neighbor.second;
+                        if(new_distance<_get_distance(FORWARD,v))
+                        {
+                            EWeightType estimate=heuristic(v,target);
+                            if(!(estimate<INFINITE)) continue;              //启发函数断定v不能到达t：剪枝
+                            _relax(FORWARD,v,u,new_distance);
+                            queue.insert_or_decreate_key(v,new_distance+estimate);
+                        }
+                    }
+                }
+                _meet=_get_distance(FORWARD,target)<unlimit<EWeightType>()?target:-1;
+                return _get_distance(FORWARD,target);
+            }
+            //!bidirectional_dijkstra：双向dijkstra查询
+            /*!
+            * \param source:起点，必须有效，否则抛出异常
+            * \param target:终点，必须有效，否则抛出异常
+            * \return: s到t的最短路径权重。若t不可达则返回正无穷
+            *
+            * ### 算法原理
+            *
+            * 同时执行两个dijkstra搜索：正向搜索从s出发沿正向边，反向搜索从t出发沿反向边（即求各顶点到t的距离）。每次从两个队列中关键字较小的一个弹出顶点。
+            * 松弛边(u,v)时，若v已经被另一个方向的搜索触及，则用 d_f(u)+w(u,v)+d_b(v) 更新当前找到的最短s-t路径权重mu。
+            *
+            * 终止条件：两个队列队首的关键字之和 top_f+top_b>=mu。此时任何尚未发现的s-t路径都必须经过两个队列之外的某个顶点，
+            * 其权重不小于top_f+top_b，因此mu就是最短路径权重。注意：仅仅“某个顶点被两个方向都弹出”并不能保证mu是最短的。
+            *
+            * 两个方向的搜索半径大约都是单向搜索的一半，在路网等图上弹出的顶点数量大约减少一半
+            */
+            EWeightType bidirectional_dijkstra(VIDType source,VIDType target)
+            {
+                _check_query(source,target,"bidirectional_dijkstra");
+                _begin_query();
+                const EWeightType INFINITE=unlimit<EWeightType>();
+                EWeightType mu=INFINITE;
+                _meet=-1;
+                _relax(FORWARD,source,-1,0);
+                _relax(BACKWARD,target,-1,0);
+                _queue[FORWARD]->insert(source,0);
+                _queue[BACKWARD]->insert(target,0);
+                if(source==target) {mu=0;_meet=source;}
+                while(!_queue[FORWARD]->is_empty()&&!_queue[BACKWARD]->is_empty())
+                {
+                    EWeightType top_forward=_queue[FORWARD]->key(_queue[FORWARD]->min());
+                    EWeightType top_backward=_queue[BACKWARD]->key(_queue[BACKWARD]->min());
+                    if(mu<INFINITE&&top_forward+top_backward>=mu) break;    //终止条件
+                    int side=top_forward<=top_backward?FORWARD:BACKWARD;
+                    VIDType u=_queue[side]->extract_min();
+                    _settled_num++;
+                    EWeightType distance_u=_distance[side][u];
+                    auto scan=[&](VIDType v,EWeightType weight){
+                        EWeightType new_distance=distance_u+weight;
+                        if(new_distance<_get_distance(side,v))
+                        {
+                            _relax(side,v,u,new_distance);
+                            _queue[side]->insert_or_decreate_key(v,new_distance);
+                        }
+                        EWeightType other=_get_distance(1-side,v);
+                        if(other<INFINITE&&_get_distance(side,v)+other<mu)
+                        {
+                            mu=_get_distance(side,v)+other;
+                            _meet=v;
+                        }
+                    };
+                    if(side==FORWARD)
+                        for(const auto& neighbor:_graph->neighbors(u))
+                            scan(neighbor.first,neighbor.second);
+                    else
+                        for(std::size_t k=_reverse_offsets[u];k<_reverse_offsets[u+1];k++)
+                            scan(_reverse_targets[k],_reverse_weights[k]);
+                }
+                return mu;
+            }
+            //!distances_from：计算从起点出发到所有顶点的最短路径权重
+            /*!
+            * \param source:起点，必须有效，否则抛出异常
+            * \return: 长度为V的数组，不可达的顶点为正无穷
+            *
+            * 它是不提前终止的单向dijkstra，用于`LandmarkHeuristic`的预处理
+            */
+            std::vector<EWeightType> distances_from(VIDType source){return _full_search(FORWARD,source);}
+            //!distances_to：计算所有顶点到终点的最短路径权重
+            /*!
+            * \param target:终点，必须有效，否则抛出异常
+            * \return: 长度为V的数组，不能到达终点的顶点为正无穷
+            *
+            * 它是在反向图上从终点出发的dijkstra，用于`LandmarkHeuristic`的预处理
+            */
+            std::vector<EWeightType> distances_to(VIDType target){return _full_search(BACKWARD,target);}
+            //!path：返回上一次点到点查询得到的最短路径
+            /*!
+            * \return: 从起点到终点的顶点序列。若终点不可达则返回空序列。`distances_from`、`distances_to`之后调用则返回空序列
+            */
+            std::vector<VIDType> path() const
+            {
+                std::vector<VIDType> result;
+                if(_meet<0) return result;
+                for(VIDType v=_meet;v>=0;v=_get_parent(FORWARD,v))
+                    result.push_back(v);
+                std::reverse(result.begin(),result.end());
+                for(VIDType v=_get_parent(BACKWARD,_meet);v>=0;v=_get_parent(BACKWARD,v))
+                    result.push_back(v);
+                return result;
+            }
+            //!settled_num：返回上一次查询弹出的顶点数量（重复弹出的顶点计算多次）
+            std::size_t settled_num() const {return _settled_num;}
+            //!vertex_num：返回图的顶点数量
+            std::size_t vertex_num() const {return _num;}
+            //!has_vertex：返回顶点v是否存在。`Graph<N,VType>`的顶点集合中可以有空位
+            bool has_vertex(VIDType v) const {return vertex_exists(_graph->vertexes,v);}
+            //!in_degree：返回顶点v的入度
+            std::size_t in_degree(VIDType v) const {return _reverse_offsets.at(v+1)-_reverse_offsets[v];}
+        private:
+            enum {FORWARD=0,BACKWARD=1};
+            //!_check_query：检查起点与终点的有效性
+            void _check_query(VIDType source,VIDType target,const char* name) const
+            {
+                if(source<0||target<0||static_cast<std::size_t>(source)>=_num||static_cast<std::size_t>(target)>=_num
+                        ||!_graph->vertexes[source]||!_graph->vertexes[target])
+                    throw std::invalid_argument(std::string(name)+" error: source and target must belong [0,N) and must not be nullptr!");
+            }
+            //!_begin_query：开始一次新的查询。时间复杂度与上一次查询遗留在队列中的顶点数量成正比
+            void _begin_query()
+            {
+                _query_id++;
+                if(_query_id==0)                                        //时间戳回绕：重置所有时间戳
+                {
+                    for(int side=0;side<2;side++)
+                        std::fill(_stamp[side].begin(),_stamp[side].end(),0);
+                    _query_id=1;
+                }
+                _queue[FORWARD]->clear();
+                _queue[BACKWARD]->clear();
+                _settled_num=0;
+                _meet=-1;
+            }
+            //!_get_distance：返回本次查询中顶点v的距离，未触及的顶点为正无穷
+            EWeightType _get_distance(int side,VIDType v) const
+            {
+                return _stamp[side][v]==_query_id?_distance[side][v]:unlimit<EWeightType>();
+            }
+            //!_get_parent：返回本次查询中顶点v的父结点，未触及的顶点为-1
+            VIDType _get_parent(int side,VIDType v) const
+            {
+                return _stamp[side][v]==_query_id?_parent[side][v]:-1;
+            }
+            //!_relax：更新顶点v的距离与父结点
+            void _relax(int side,VIDType v,VIDType parent,EWeightType distance)
+            {
+                _stamp[side][v]=_query_id;
+                _distance[side][v]=distance;
+                _parent[side][v]=parent;
+            }
+            //!_full_search：不提前终止的dijkstra，返回所有顶点的距离
+            std::vector<EWeightType> _full_search(int side,VIDType root)
+            {
+                _check_query(root,root,side==FORWARD?"distances_from":"distances_to");
+                _begin_query();
+                auto& queue=*_queue[side];
+                _relax(side,root,-1,0);
+                queue.insert(root,0);
+                while(!queue.is_empty())
+                {
+                    VIDType u=queue.extract_min();
+                    _settled_num++;
+                    EWeightType distance_u=_distance[side][u];
+                    auto scan=[&](VIDType v,EWeightType weight){
+                        EWeightType new_distance=distance_u+weight;
+                        if(new_distance<_get_distance(side,v))
+                        {
+                            _relax(side,v,u,new_distance);
+                            queue.insert_or_decreate_key(v,new_distance);
+                        }
+                    };
+                    if(side==FORWARD)
+                        for(const auto& neighbor:_graph->neighbors(u))
+                            scan(neighbor.first,neighbor.second);
+                    else
+                        for(std::size_t k=_reverse_offsets[u];k<_reverse_offsets[u+1];k++)
+                            scan(_reverse_targets[k],_reverse_weights[k]);
+                }
+                std::vector<EWeightType> result(_num);
+                for(std::size_t v=0;v<_num;v++)
+                    result[v]=_get_distance(side,v);
+                return result;
+            }
+
+            std::shared_ptr<GraphType> _graph;                  /*!< 图*/
+            std::size_t _num;                                   /*!< 顶点数量*/
+            std::vector<std::size_t> _reverse_offsets;          /*!< 反向图：顶点u的入边在`_reverse_targets`中的区间为[offsets[u],offsets[u+1])*/
+            std::vector<VIDType> _reverse_targets;              /*!< 反向图：入边的起点*/
+            std::vector<EWeightType> _reverse_weights;          /*!< 反向图：入边的权重*/
+            std::vector<EWeightType> _distance[2];              /*!< 正向、反向搜索的距离*/
+            std::vector<VIDType> _parent[2];                    /*!< 正向、反向搜索的父结点（反向搜索中为通往终点的下一个顶点）*/
+            std::vector<unsigned> _stamp[2];                    /*!< 距离与父结点的时间戳*/
+            std::unique_ptr<QueueAlgorithm::IDMinQueue<EWeightType>> _queue[2];/*!< 正向、反向搜索的最小优先级队列*/
+            unsigned _query_id;                                 /*!< 当前查询的编号*/
+            std::size_t _settled_num;                           /*!< 本次查询弹出的顶点数量*/
+            VIDType _meet;                                      /*!< 最短路径上正向与反向搜索的交汇点；单向查询中为终点；-1表示无路径*/
+        };
+
+        //!LandmarkHeuristic：基于地标与三角不等式的A*启发函数（ALT）
+        /*!
+        * 预处理时选择k个地标L，计算每个地标到所有顶点、所有顶点到每个地标的最短路径权重d(L,v)、d(v,L)。由三角不等式：
+        *
+        * - d(L,t)<=d(L,v)+d(v,t)，因此 d(v,t)>=d(L,t)-d(L,v)
+        * - d(v,L)<=d(v,t)+d(t,L)，因此 d(v,t)>=d(v,L)-d(t,L)
+        *
+        * 启发函数取所有地标给出的下界的最大值（至少为0）。它是可接受且一致的。此外地标的可达性还可以证明某些顶点不能到达t，A*算法不会将它们入队。
+        *
+        * 地标按照“最远点”策略选择：第一个地标是距离顶点`first`最远的可达顶点，之后每次在与已选地标连通（可以到达或者从它可以到达）的顶点中，
+        * 选择到已选地标的最小距离最大的顶点，使得地标分布在图的边缘。若没有这样的顶点（例如已选地标都是孤立的顶点），则选择入度最大的顶点。预处理需要 2k 次完整的dijkstra，空间为 2kV。
+        * 距离表按顶点交错存放，计算一次启发函数只访问两段连续的内存。
+        */
+        template<typename EWeightType> class LandmarkHeuristic
+        {
+        public:
+            //!显式构造函数
+            /*!
+            * \param query:用于预处理的查询对象
+            * \param landmark_num:地标数量，至少为1，且不超过存在的顶点的数量，否则抛出异常
+            * \param first:地标选择的起始顶点，默认为0。它必须存在，否则抛出异常
+            *
+            * 顶点集合中的空位不会被选为地标
+            */
+            template<typename GraphType>
+            LandmarkHeuristic(ShortestPathQuery<GraphType>& query,std::size_t landmark_num,typename GraphType::VIDType first=0)
+            {
+                const std::size_t num=query.vertex_num();
+                std::size_t exist_num=0;
+                for(std::size_t v=0;v<num;v++)
+                    if(query.has_vertex(v)) exist_num++;
+                if(landmark_num==0||landmark_num>exist_num)
+                    throw std::invalid_argument("LandmarkHeuristic error: landmark_num must belong [1,number of existing vertexes]!");
+                const EWeightType INFINITE=unlimit<EWeightType>();
+                std::vector<EWeightType> min_distance(num,INFINITE);    //各顶点到已选地标的最小距离
+                std::vector<std::vector<EWeightType>> from_all,to_all;  //from_all[i][v]=d(L_i,v)，to_all[i][v]=d(v,L_i)
+                auto start=query.distances_from(first);
+                int landmark=first;
+                for(std::size_t v=0;v<num;v++)
+                    if(start[v]<INFINITE&&start[v]>start[landmark]) landmark=v;
+                if(landmark==first)                                     //first不能到达其它顶点：从入度最大的顶点开始
+                    landmark=_max_in_degree(query);
+                while(_landmarks.size()<landmark_num)
+                {
+                    _landmarks.push_back(landmark);
+                    from_all.push_back(query.distances_from(landmark));
+                    to_all.push_back(query.distances_to(landmark));
+                    const auto& from=from_all.back();
+                    const auto& to=to_all.back();
+                    //******** 选择下一个地标：优先选择与已选地标连通的顶点中最远的一个 *********
+                    int finite_best=-1,any=-1;          //any：是否还有未被选为地标的顶点
+                    for(std::size_t v=0;v<num;v++)
+                    {
+                        EWeightType distance=std::min(from[v],to[v]);
+                        if(distance<min_distance[v]) min_distance[v]=distance;
+                        if(!query.has_vertex(v)) continue;
+                        if(std::find(_landmarks.begin(),_landmarks.end(),static_cast<int>(v))!=_landmarks.end()) continue;
+                        if(any<0) any=v;
+                        if(min_distance[v]<INFINITE&&(finite_best<0||min_distance[v]>min_distance[finite_best]))
+                            finite_best=v;
+                    }
+                    if(any<0) break;
+                    landmark=finite_best>=0?finite_best:_max_in_degree(query);
+                }
+                //******** 按顶点交错存放：一次查询启发函数只访问v、t各自连续的2k个元素 *********
+                _stride=2*_landmarks.size();
+                _table.resize(num*_stride);
+                for(std::size_t v=0;v<num;v++)
+                    for(std::size_t i=0;i<_landmarks.size();i++)
+                    {
+                        _table[v*_stride+2*i]=from_all[i][v];
+                        _table[v*_stride+2*i+1]=to_all[i][v];
+                    }
+            }
+            //!operator()：返回顶点v到顶点t的最短路径权重的下界
+            /*!
+            * 若某个地标L可以到达v而不能到达t，或者t可以到达L而v不能到达L，则v一定不能到达t，此时返回正无穷
+            */
+            template<typename VIDType> EWeightType operator()(VIDType v,VIDType t) const
+            {
+                const EWeightType INFINITE=unlimit<EWeightType>();
+                EWeightType result=0;
+                const EWeightType* dv=&_table[v*_stride];
+                const EWeightType* dt=&_table[t*_stride];
+                for(std::size_t i=0;i<_stride;i+=2)
+                {
+                    //******** dv[i]=d(L,v)，dv[i+1]=d(v,L) ***********
+                    if(dv[i]<INFINITE)
+                    {
+                        if(!(dt[i]<INFINITE)) return INFINITE;
+                        if(dt[i]-dv[i]>result) result=dt[i]-dv[i];
+                    }
+                    if(dt[i+1]<INFINITE)
+                    {
+                        if(!(dv[i+1]<INFINITE)) return INFINITE;
+                        if(dv[i+1]-dt[i+1]>result) result=dv[i+1]-dt[i+1];
+                    }
+                }
+                return result;
+            }
+            //!landmarks：返回选出的地标
+            const std::vector<int>& landmarks() const {return _landmarks;}
+        private:
+            //!_max_in_degree：返回存在且尚未被选为地标的顶点中入度最大的一个
+            template<typename GraphType> int _max_in_degree(const ShortestPathQuery<GraphType>& query) const
+            {
+                int result=-1;
+                for(std::size_t v=0;v<query.vertex_num();v++)
+                {
+                    if(!query.has_vertex(v)) continue;
+                    if(std::find(_landmarks.begin(),_landmarks.end(),static_cast<int>(v))!=_landmarks.end()) continue;
+                    if(result<0||query.in_degree(v)>query.in_degree(result)) result=v;
+                }
+                return result;
+            }
+            std::vector<int> _landmarks;                        /*!< 地标*/
+            std::size_t _stride;                                /*!< 每个顶点占用的元素数量，即2k*/
+            std::vector<EWeightType> _table;                    /*!< _table[v*2k+2i]=d(L_i,v)，_table[v*2k+2i+1]=d(v,L_i)*/
+        };
+    }
+}
+#endif // SHORTESTPATHQUERY
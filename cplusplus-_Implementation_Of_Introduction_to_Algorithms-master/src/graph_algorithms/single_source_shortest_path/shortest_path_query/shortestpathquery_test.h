@@ -0,0 +1,189 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef SHORTESTPATHQUERY_TEST
+#define SHORTESTPATHQUERY_TEST
+#include <random>
+#include "../../../google_test/gtest.h"
+#include "shortestpathquery.h"
+#include "../dijkstra/dijkstra.h"
+#include "../../basic_graph/graph_representation/csr_graph/csrgraph.h"
+#include "../../basic_graph/graph_representation/graph/graph.h"
+#include "../../basic_graph/graph_representation/graph_vertex/vertex.h"
+#include "../../graph_generator/graphgenerator.h"
+
+using IntroductionToAlgorithm::GraphAlgorithm::ShortestPathQuery;
+using IntroductionToAlgorithm::GraphAlgorithm::LandmarkHeuristic;
+using IntroductionToAlgorithm::GraphAlgorithm::ZeroHeuristic;
+using IntroductionToAlgorithm::GraphAlgorithm::SearchProperties;
+using IntroductionToAlgorithm::GraphAlgorithm::CSRGraph;
+using IntroductionToAlgorithm::GraphAlgorithm::Graph;
+using IntroductionToAlgorithm::GraphAlgorithm::Vertex;
+using IntroductionToAlgorithm::GraphAlgorithm::dijkstra;
+using IntroductionToAlgorithm::GraphAlgorithm::erdos_renyi_graph;
+using IntroductionToAlgorithm::GraphAlgorithm::grid_graph;
+
+//!ShortestPathQueryTest:测试类，用于为测试提供基础数据
+/*!
+*
+* `ShortestPathQueryTest`是 `::testing::Test` 的子类。它主要用于为每一个`TEST_F`准备测试环境
+*/
+class ShortestPathQueryTest:public ::testing::Test
+{
+public:
+    typedef CSRGraph<Vertex<int>> GType; /*!< 模板实例化的图类型*/
+protected:
+    void SetUp()
+    {
+        auto sparse=erdos_renyi_graph(300,900,19);    //稀疏的随机有向图，有不可达的顶点对
+        _sparse_graph=std::make_shared<GType>(sparse.vertex_num,sparse.edges.begin(),sparse.edges.end(),unlimit<int>());
+        auto grid=grid_graph(20,20,19);
+        _grid_graph=std::make_shared<GType>(grid.vertex_num,grid.edges.begin(),grid.edges.end(),unlimit<int>());
+    }
+    void TearDown(){}
+    //!_check_path：检查路径从source开始、到target结束，且路径上的边存在、权重之和为distance
+    static void _check_path(std::shared_ptr<GType> graph,const std::vector<int>& path,int source,int target,int distance)
+    {
+        ASSERT_FALSE(path.empty());
+        EXPECT_EQ(path.front(),source);
+        EXPECT_EQ(path.back(),target);
+        int sum=0;
+        for(std::size_t i=1;i<path.size();i++)
+        {
+            ASSERT_TRUE(graph->has_edge(path[i-1],path[i]));
+            sum+=graph->weight(path[i-1],path[i]);
+        }
+        EXPECT_EQ(sum,distance);
+    }
+    //!_check_queries：对随机的顶点对，比较各种查询与完整的dijkstra的结果
+    static void _check_queries(std::shared_ptr<GType> graph,int landmark_num)
+    {
+        ShortestPathQuery<GType> query(graph);
+        LandmarkHeuristic<int> alt(query,landmark_num);
+        EXPECT_EQ(alt.landmarks().size(),static_cast<std::size_t>(landmark_num));
+        SearchProperties<int> properties;
+        std::mt19937 gen(19);
+        std::uniform_int_distribution<int> vertex_dist(0,graph->vertexes.size()-1);
+        for(int round=0;round<60;round++)
+        {
+            int source=vertex_dist(gen);
+            int target=round%10==0?source:vertex_dist(gen);
+            dijkstra(graph,source,properties);
+            int expect=properties.distance[target];
+            EXPECT_EQ(query.dijkstra(source,target),expect)<<source<<"->"<<target;
+            if(expect<unlimit<int>()) _check_path(graph,query.path(),source,target,expect);
+            else EXPECT_TRUE(query.path().empty());
+            EXPECT_EQ(query.bidirectional_dijkstra(source,target),expect)<<source<<"->"<<target;
+            if(expect<unlimit<int>()) _check_path(graph,query.path(),source,target,expect);
+            else EXPECT_TRUE(query.path().empty());
+            EXPECT_EQ(query.astar(source,target,alt),expect)<<source<<"->"<<target;
+            if(expect<unlimit<int>()) _check_path(graph,query.path(),source,target,expect);
+            //******* 启发函数是可接受的 *******
+            for(std::size_t v=0;v<graph->vertexes.size();v++)
+            {
+                if(properties.distance[v]<unlimit<int>()&&v!=static_cast<std::size_t>(source))
+                {
+                    EXPECT_LE(alt(source,int(v)),properties.distance[v]);
+                }
+            }
+        }
+    }
+    std::shared_ptr<GType> _sparse_graph;   /*!< 稀疏的随机有向图*/
+    std::shared_ptr<GType> _grid_graph;     /*!< 网格图*/
+};
+//!test_query_random:测试各种点到点查询
+/*!
+*
+* 在随机有向图与网格图上，`dijkstra`、`bidirectional_dijkstra`、`astar`的结果与完整的dijkstra相同，`path()`是一条最短路径
+*/
+TEST_F(ShortestPathQueryTest,test_query_random)
+{
+    _check_queries(_sparse_graph,4);
+    _check_queries(_grid_graph,8);
+}
+//!test_query_settled:测试点到点查询弹出的顶点数量
+/*!
+*
+* 在网格图上，单向查询弹出的顶点少于完整的dijkstra，双向查询与ALT弹出的顶点更少
+*/
+TEST_F(ShortestPathQueryTest,test_query_settled)
+{
+    ShortestPathQuery<GType> query(_grid_graph);
+    LandmarkHeuristic<int> alt(query,8);
+    std::size_t unidirectional=0,bidirectional=0,landmark=0;
+    for(int i=0;i<20;i++)
+    {
+        int source=i*20+i%5;        //第i行
+        int target=(19-i)*20+19-i%7;
+        int distance=query.dijkstra(source,target);
+        unidirectional+=query.settled_num();
+        EXPECT_EQ(query.bidirectional_dijkstra(source,target),distance);
+        bidirectional+=query.settled_num();
+        EXPECT_EQ(query.astar(source,target,alt),distance);
+        landmark+=query.settled_num();
+        EXPECT_EQ(query.astar(source,target,ZeroHeuristic()),distance);
+    }
+    EXPECT_LT(bidirectional,unidirectional);
+    EXPECT_LT(landmark,unidirectional);
+    EXPECT_EQ(query.distances_from(0).size(),400);
+    EXPECT_TRUE(query.path().empty());
+}
+//!test_query_invalid:测试无效的参数
+/*!
+*
+* 无效的图、顶点、地标数量抛出异常
+*/
+TEST_F(ShortestPathQueryTest,test_query_invalid)
+{
+    EXPECT_THROW(ShortestPathQuery<GType>(std::shared_ptr<GType>()),std::invalid_argument);
+    ShortestPathQuery<GType> query(_sparse_graph);
+    EXPECT_THROW(query.dijkstra(-1,0),std::invalid_argument);
+    EXPECT_THROW(query.bidirectional_dijkstra(0,300),std::invalid_argument);
+    EXPECT_THROW(query.astar(300,0,ZeroHeuristic()),std::invalid_argument);
+    EXPECT_THROW(query.distances_to(300),std::invalid_argument);
+    EXPECT_THROW(LandmarkHeuristic<int>(query,0),std::invalid_argument);
+    EXPECT_THROW(LandmarkHeuristic<int>(query,301),std::invalid_argument);
+}
+//!test_query_holes:测试顶点集合中有空位的图
+/*!
+*
+* `Graph<N,VType>`的空位不会被选为地标；地标数量最多为存在的顶点的数量
+*/
+TEST_F(ShortestPathQueryTest,test_query_holes)
+{
+    typedef Graph<6,Vertex<int>> HType;
+    auto graph=std::make_shared<HType>(unlimit<int>());
+    for(int id:{0,2,3,5})                       //顶点1、4为空位，顶点3是孤立的顶点
+        graph->add_vertex(0,id);
+    std::vector<HType::EdgeTupleType> edges={std::make_tuple(0,2,2),std::make_tuple(2,5,3),std::make_tuple(0,5,7)};
+    graph->add_edges(edges.begin(),edges.end());
+    ShortestPathQuery<HType> query(graph);
+    EXPECT_FALSE(query.has_vertex(1));
+    EXPECT_TRUE(query.has_vertex(3));
+    LandmarkHeuristic<int> alt(query,4);
+    auto landmarks=alt.landmarks();
+    std::sort(landmarks.begin(),landmarks.end());
+    EXPECT_EQ(landmarks,std::vector<int>({0,2,3,5}));
+    EXPECT_EQ(query.astar(0,5,alt),5);
+    EXPECT_EQ(query.path(),std::vector<int>({0,2,5}));
+    EXPECT_EQ(query.astar(0,3,alt),unlimit<int>());
+    EXPECT_EQ(query.astar(0,5,LandmarkHeuristic<int>(query,2,3)),5);  //从孤立的顶点开始选择地标
+    EXPECT_THROW(LandmarkHeuristic<int>(query,5),std::invalid_argument);
+    EXPECT_THROW(LandmarkHeuristic<int>(query,1,1),std::invalid_argument);
+}
+#endif // SHORTESTPATHQUERY_TEST
@@ -27,6 +27,8 @@
 #include<memory>
 #include<vector>
 #include<ostream>
+#include<limits>
+#include<cstdint>
 namespace IntroductionToAlgorithm
 {
     //! Namespace of  SortAlgorithm
@@ -88,6 +90,15 @@ namespace IntroductionToAlgorithm
     namespace SetAlgorithm {
 
 
+    }
+    //! Namespace of  ParallelAlgorithm
+    /*!
+    *
+    * 该命名空间内包含多线程并行执行的基础设施（如`parallel_for`），供各个并行算法使用
+    */
+    namespace ParallelAlgorithm {
+
+
     }
     //! Namespace of  GraphAlgorithm
     /*!
@@ -127,6 +138,37 @@ namespace IntroductionToAlgorithm
         {
             return t>=std::numeric_limits<T>::max()/3;  //大于最大值的3分之一都会认为是正无穷
         }
+        //!vertex_exists：判断顶点集合中指定`id`的顶点是否存在
+        /*!
+        * \param vertexes: 图的顶点集合，即`graph->vertexes`
+        * \param id: 顶点`id`，要求在`[0,vertexes.size())`之间
+        * \return : 如果该顶点存在，则返回`true`，否则返回`false`
+        *
+        * 通用版本将`vertexes[id]`转换为`bool`。`CSRGraph`的顶点集合按需创建顶点对象，它有一个不创建顶点对象的特殊版本，
+        * 因此只需要判断顶点是否存在的算法应当调用本函数而不是直接访问`vertexes[id]`
+        */
+        template<typename VertexesType> bool vertex_exists(const VertexesType& vertexes,std::size_t id)
+        {
+            return static_cast<bool>(vertexes[id]);
+        }
+
+        //!lowest_bit：返回非零整数最低的1位的下标
+        /*!
+        * \param bits: 非零的64位整数
+        * \return : 最低的1位的下标，在`[0,64)`之间
+        *
+        * 位集表示的算法（`BitsetGraph`、多源广度优先搜索）用它从一个字中逐个取出被置位的顶点。GCC与Clang下为一条指令
+        */
+        inline unsigned lowest_bit(std::uint64_t bits)
+        {
+#if defined(__GNUC__)
+            return __builtin_ctzll(bits);
+#else
+            unsigned index=0;
+            while(!(bits&1)) {bits>>=1;index++;}
+            return index;
+#endif
+        }
 
         //!get_path：获取两个顶点之间的路径
         /*!
@@ -0,0 +1,68 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef ATOMICMIN
+#define ATOMICMIN
+#include<atomic>
+#include<cstdint>
+namespace IntroductionToAlgorithm
+{
+    namespace ParallelAlgorithm
+    {
+        //!atomic_fetch_min：原子地将`target`更新为`min(target,value)`
+        /*!
+        * \param target:待更新的原子变量
+        * \param value:候选值
+        * \param order:内存序。默认为`std::memory_order_relaxed`
+        * \return: `target`更新之前的值。若返回值大于`value`，则说明本次调用成功地更新了`target`
+        *
+        * 采用`compare_exchange_weak`循环：只有当`value`严格小于当前值时才写入，因此多个线程并发调用时，最终结果与调用次序无关
+        */
+        template<typename T>
+        T atomic_fetch_min(std::atomic<T>& target,T value,std::memory_order order=std::memory_order_relaxed)
+        {
+            T old=target.load(order);
+            while(value<old&&!target.compare_exchange_weak(old,value,order,std::memory_order_relaxed));
+            return old;
+        }
+
+        //!pack_pair：将两个32位无符号整数打包为一个64位整数，`high`位于高32位
+        /*!
+        * \param high:高32位
+        * \param low:低32位
+        * \return: 打包后的64位整数
+        *
+        * 打包后的整数按照（`high`，`low`）的字典序比较大小，因此可以用一次`atomic_fetch_min`同时更新一对值，例如（距离，父结点）
+        */
+        inline std::uint64_t pack_pair(std::uint32_t high,std::uint32_t low)
+        {
+            return (std::uint64_t(high)<<32)|low;
+        }
+        //!pack_high：返回`pack_pair`打包结果的高32位
+        inline std::uint32_t pack_high(std::uint64_t packed)
+        {
+            return std::uint32_t(packed>>32);
+        }
+        //!pack_low：返回`pack_pair`打包结果的低32位
+        inline std::uint32_t pack_low(std::uint64_t packed)
+        {
+            return std::uint32_t(packed);
+        }
+    }
+}
+#endif // ATOMICMIN
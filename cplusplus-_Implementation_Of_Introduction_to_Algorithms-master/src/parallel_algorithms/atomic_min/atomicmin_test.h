@@ -0,0 +1,62 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef ATOMICMIN_TEST
+#define ATOMICMIN_TEST
+#include"../../google_test/gtest.h"
+#include"atomicmin.h"
+#include"../parallel_for/parallelfor.h"
+
+using IntroductionToAlgorithm::ParallelAlgorithm::atomic_fetch_min;
+using IntroductionToAlgorithm::ParallelAlgorithm::pack_pair;
+using IntroductionToAlgorithm::ParallelAlgorithm::pack_high;
+using IntroductionToAlgorithm::ParallelAlgorithm::pack_low;
+
+//!test_atomic_fetch_min：测试atomic_fetch_min
+/*!
+*
+* 多个线程并发更新时，结果为所有候选值的最小值
+*/
+TEST(AtomicMinTest,test_atomic_fetch_min)
+{
+    std::atomic<int> value(10);
+    EXPECT_EQ(atomic_fetch_min(value,20),10);
+    EXPECT_EQ(value.load(),10);
+    EXPECT_EQ(atomic_fetch_min(value,3),10);
+    EXPECT_EQ(value.load(),3);
+
+    std::atomic<long long> shared(1<<30);
+    IntroductionToAlgorithm::ParallelAlgorithm::parallel_for(0,100000,4,[&shared](std::size_t i){
+        atomic_fetch_min(shared,(long long)((i*7919)%100000)+5);
+    },1);
+    EXPECT_EQ(shared.load(),5);
+}
+//!test_pack_pair：测试pack_pair
+/*!
+*
+* 打包结果按照（高32位，低32位）的字典序比较
+*/
+TEST(AtomicMinTest,test_pack_pair)
+{
+    auto packed=pack_pair(7,0xFFFFFFFF);
+    EXPECT_EQ(pack_high(packed),7);
+    EXPECT_EQ(pack_low(packed),0xFFFFFFFF);
+    EXPECT_LT(pack_pair(1,9),pack_pair(2,0));
+    EXPECT_LT(pack_pair(2,0),pack_pair(2,1));
+}
+#endif // ATOMICMIN_TEST
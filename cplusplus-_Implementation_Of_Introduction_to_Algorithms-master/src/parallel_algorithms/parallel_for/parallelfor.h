@@ -0,0 +1,148 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef PARALLELFOR
+#define PARALLELFOR
+#include<thread>
+#include<vector>
+#include<exception>
+#include<algorithm>
+#include<cstddef>
+#include"../../header.h"
+namespace IntroductionToAlgorithm
+{
+    namespace ParallelAlgorithm
+    {
+        //!thread_num_or_default：返回实际使用的线程数量
+        /*!
+        * \param thread_num:指定的线程数量。若为0则表示使用硬件支持的并发线程数量
+        * \return: 实际使用的线程数量，至少为1
+        */
+        inline std::size_t thread_num_or_default(std::size_t thread_num)
+        {
+            if(thread_num) return thread_num;
+            std::size_t hardware=std::thread::hardware_concurrency();
+            return hardware?hardware:1;
+        }
+
+        //!parallel_blocks：将区间`[begin,end)`均匀划分为若干连续的块，每个块由一个线程处理
+        /*!
+        * \param begin:区间起始
+        * \param end:区间终止
+        * \param thread_num:线程数量。若为0则使用硬件支持的并发线程数量
+        * \param func:一个可调用对象，调用参数为`(block_begin,block_end,block_index)`，它处理区间`[block_begin,block_end)`
+        * \param min_block_size:每个块的最小长度。区间较短时会减少线程数量，以免创建线程的开销超过计算本身。默认为1024
+        * \return: void
+        *
+        * 块的数量为`min(thread_num,ceil((end-begin)/min_block_size))`，第`i`个块的`block_index`为`i`，块按照`block_index`递增的次序覆盖整个区间。
+        * 最后一个块在调用线程中执行，其余的块各自在一个新线程中执行；所有的块完成之后本函数才返回。
+        *
+        * 若某个块抛出了异常，则等待所有的块完成之后，将第一个（按`block_index`）异常重新抛出
+        */
+        template<typename Func>
+        void parallel_blocks(std::size_t begin,std::size_t end,std::size_t thread_num,Func func,std::size_t min_block_size=1024)
+        {
+            if(end<=begin) return;
+            std::size_t length=end-begin;
+            if(min_block_size==0) min_block_size=1;
+            std::size_t block_num=std::min(thread_num_or_default(thread_num),(length+min_block_size-1)/min_block_size);
+            if(block_num<=1)
+            {
+                func(begin,end,std::size_t(0));
+                return;
+            }
+
+            std::vector<std::exception_ptr> errors(block_num);
+            std::vector<std::thread> threads;
+            threads.reserve(block_num-1);
+            auto run_block=[&](std::size_t index){
+                std::size_t block_begin=begin+length*index/block_num;
+                std::size_t block_end=begin+length*(index+1)/block_num;
+                try{
+                    func(block_begin,block_end,index);
+                }catch(...){
+                    errors[index]=std::current_exception();
+                }
+            };
+            for(std::size_t index=0;index+1<block_num;index++)
+                threads.emplace_back(run_block,index);
+            run_block(block_num-1);                             //最后一个块在调用线程中执行
+            for(auto& thread:threads)
+                thread.join();
+            for(const auto& error:errors)
+                if(error) std::rethrow_exception(error);
+        }
+
+        //!parallel_for：并行地对区间`[begin,end)`中的每个下标调用`func`
+        /*!
+        * \param begin:区间起始
+        * \param end:区间终止
+        * \param thread_num:线程数量。若为0则使用硬件支持的并发线程数量
+        * \param func:一个可调用对象，调用参数为下标`i`
+        * \param min_block_size:每个线程处理的最少下标数量。默认为1024
+        * \return: void
+        *
+        * 它是`parallel_blocks`的包装：每个线程按照下标递增的次序处理一个连续的块。不同下标上的`func`调用之间可能并发执行，同步由调用者负责
+        */
+        template<typename Func>
+        void parallel_for(std::size_t begin,std::size_t end,std::size_t thread_num,Func func,std::size_t min_block_size=1024)
+        {
+            parallel_blocks(begin,end,thread_num,[&func](std::size_t block_begin,std::size_t block_end,std::size_t){
+                for(std::size_t i=block_begin;i<block_end;i++)
+                    func(i);
+            },min_block_size);
+        }
+
+        //!parallel_remove_if：并行地删除区间`[begin,end)`中满足`pred`的元素
+        /*!
+        * \param begin:区间起始迭代器，必须为随机访问迭代器
+        * \param end:区间终止迭代器
+        * \param thread_num:线程数量。若为0则使用硬件支持的并发线程数量
+        * \param pred:一个可调用对象，调用参数为元素的常量引用，返回`true`表示删除该元素。它可能被多个线程并发调用
+        * \param min_block_size:每个线程处理的最少元素数量。默认为8192
+        * \return: 保留的元素的终止迭代器
+        *
+        * 与`std::remove_if`相同，保留的元素维持原来的相对次序。算法分两步：
+        *
+        * - 将区间按照`parallel_blocks`划分为若干块，各块并行地将本块中保留的元素移动到本块的开头
+        * - 按照块的次序，将各块保留的元素依次移动到一起
+        */
+        template<typename Iterator,typename Predicate>
+        Iterator parallel_remove_if(Iterator begin,Iterator end,std::size_t thread_num,Predicate pred,std::size_t min_block_size=8192)
+        {
+            if(end<=begin) return begin;
+            std::size_t length=end-begin;
+            std::size_t threads=thread_num_or_default(thread_num);
+            std::vector<std::size_t> block_begin(threads,length),block_kept(threads,0);
+            parallel_blocks(0,length,threads,[&](std::size_t b,std::size_t e,std::size_t index){
+                block_begin[index]=b;
+                block_kept[index]=std::remove_if(begin+b,begin+e,pred)-(begin+b);
+            },min_block_size);
+            Iterator kept=begin;
+            for(std::size_t index=0;index<threads;index++)
+            {
+                if(block_begin[index]==length) continue;        //该块不存在
+                if(kept!=begin+block_begin[index])
+                    std::move(begin+block_begin[index],begin+block_begin[index]+block_kept[index],kept);
+                kept+=block_kept[index];
+            }
+            return kept;
+        }
+    }
+}
+#endif // PARALLELFOR
@@ -0,0 +1,97 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef PARALLELFOR_TEST
+#define PARALLELFOR_TEST
+#include<atomic>
+#include<stdexcept>
+#include"../../google_test/gtest.h"
+#include"parallelfor.h"
+
+using IntroductionToAlgorithm::ParallelAlgorithm::parallel_for;
+using IntroductionToAlgorithm::ParallelAlgorithm::parallel_blocks;
+using IntroductionToAlgorithm::ParallelAlgorithm::thread_num_or_default;
+using IntroductionToAlgorithm::ParallelAlgorithm::parallel_remove_if;
+
+//!test_parallel_for：测试parallel_for
+/*!
+*
+* 每个下标恰好被处理一次，与线程数量、块的最小长度无关
+*/
+TEST(ParallelForTest,test_parallel_for)
+{
+    const std::size_t num=10000;
+    for(std::size_t thread_num:{1,2,3,8})
+        for(std::size_t min_block_size:{1,7,1024,100000})
+        {
+            std::vector<std::atomic<int>> counts(num);
+            for(auto& count:counts) count=0;
+            parallel_for(0,num,thread_num,[&counts](std::size_t i){counts[i]++;},min_block_size);
+            for(std::size_t i=0;i<num;i++)
+                EXPECT_EQ(counts[i],1)<<"thread_num:"<<thread_num<<"\tmin_block_size:"<<min_block_size<<"\ti:"<<i;
+        }
+    int called=0;
+    parallel_for(5,5,4,[&called](std::size_t){called++;});  //空区间
+    EXPECT_EQ(called,0);
+    EXPECT_GE(thread_num_or_default(0),1);
+    EXPECT_EQ(thread_num_or_default(3),3);
+}
+//!test_parallel_blocks：测试parallel_blocks
+/*!
+*
+* 块按照`block_index`递增的次序连续覆盖整个区间；块中抛出的异常传递给调用者
+*/
+TEST(ParallelForTest,test_parallel_blocks)
+{
+    std::vector<std::pair<std::size_t,std::size_t>> blocks(4);
+    parallel_blocks(10,110,4,[&blocks](std::size_t begin,std::size_t end,std::size_t index){
+        blocks[index]=std::make_pair(begin,end);
+    },1);
+    EXPECT_EQ(blocks.front().first,10);
+    EXPECT_EQ(blocks.back().second,110);
+    for(std::size_t i=1;i<blocks.size();i++)
+        EXPECT_EQ(blocks[i].first,blocks[i-1].second);
+
+    EXPECT_THROW(parallel_blocks(0,100,4,[](std::size_t,std::size_t,std::size_t index){
+        if(index==1) throw std::runtime_error("block error");
+    },1),std::runtime_error);
+}
+//!test_parallel_remove_if：测试parallel_remove_if
+/*!
+*
+* 结果与`std::remove_if`相同，与线程数量、块的最小长度无关
+*/
+TEST(ParallelForTest,test_parallel_remove_if)
+{
+    std::vector<int> data;
+    for(int i=0;i<10000;i++)
+        data.push_back((i*7919)%10007);
+    auto pred=[](int value){return value%3==0;};
+    std::vector<int> expect=data;
+    expect.erase(std::remove_if(expect.begin(),expect.end(),pred),expect.end());
+    for(std::size_t thread_num:{1,2,3,8})
+        for(std::size_t min_block_size:{1,7,8192})
+        {
+            std::vector<int> result=data;
+            result.erase(parallel_remove_if(result.begin(),result.end(),thread_num,pred,min_block_size),result.end());
+            EXPECT_EQ(result,expect)<<"thread_num:"<<thread_num<<"\tmin_block_size:"<<min_block_size;
+        }
+    std::vector<int> empty;
+    EXPECT_EQ(parallel_remove_if(empty.begin(),empty.end(),4,pred),empty.end());
+}
+#endif // PARALLELFOR_TEST
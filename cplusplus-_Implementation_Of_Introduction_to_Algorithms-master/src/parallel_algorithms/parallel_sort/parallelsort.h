@@ -0,0 +1,83 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef PARALLELSORT
+#define PARALLELSORT
+#include<vector>
+#include<algorithm>
+#include<iterator>
+#include<cstddef>
+#include"../../header.h"
+#include"../parallel_for/parallelfor.h"
+namespace IntroductionToAlgorithm
+{
+    namespace ParallelAlgorithm
+    {
+        //!parallel_sort：并行排序
+        /*!
+        * \param begin:待排序区间的起始迭代器，必须是随机访问迭代器
+        * \param end:待排序区间的终止迭代器
+        * \param thread_num:线程数量。若为0则使用硬件支持的并发线程数量
+        * \param compare:小于比较的可调用对象
+        * \param min_block_size:每个线程排序的最少元素数量。默认为8192
+        * \return: void
+        *
+        * 算法步骤：
+        *
+        * - 将区间均匀划分为若干块（块的划分与`parallel_blocks`相同），各块并行地用`std::sort`排序
+        * - 执行若干轮归并：每一轮将相邻的两个有序段用`std::inplace_merge`合并，同一轮中的各次合并并行执行
+        *
+        * 它与`std::sort`一样不是稳定排序。时间复杂度 O((n/p)lg(n/p) + n lgp)
+        */
+        template<typename Iterator,typename Compare>
+        void parallel_sort(Iterator begin,Iterator end,std::size_t thread_num,Compare compare,std::size_t min_block_size=8192)
+        {
+            std::size_t length=std::distance(begin,end);
+            if(length<2) return;
+            if(min_block_size==0) min_block_size=1;
+            std::size_t block_num=std::min(thread_num_or_default(thread_num),(length+min_block_size-1)/min_block_size);
+            if(block_num<=1)
+            {
+                std::sort(begin,end,compare);
+                return;
+            }
+            //************  各块并行排序，记录各块的边界 ************
+            std::vector<std::size_t> bounds(block_num+1);
+            parallel_blocks(0,length,block_num,[&](std::size_t block_begin,std::size_t block_end,std::size_t index){
+                bounds[index]=block_begin;
+                if(index+1==block_num) bounds[block_num]=block_end;
+                std::sort(begin+block_begin,begin+block_end,compare);
+            },1);
+            //************  逐轮归并相邻的有序段 ************
+            while(bounds.size()>2)
+            {
+                std::size_t segment_num=bounds.size()-1;
+                parallel_for(0,segment_num/2,thread_num,[&](std::size_t pair){
+                    std::inplace_merge(begin+bounds[2*pair],begin+bounds[2*pair+1],begin+bounds[2*pair+2],compare);
+                },1);
+                std::vector<std::size_t> new_bounds;
+                for(std::size_t i=0;i<bounds.size();i+=2)
+                    new_bounds.push_back(bounds[i]);
+                if(new_bounds.back()!=bounds.back())
+                    new_bounds.push_back(bounds.back());
+                bounds.swap(new_bounds);
+            }
+        }
+    }
+}
+#endif // PARALLELSORT
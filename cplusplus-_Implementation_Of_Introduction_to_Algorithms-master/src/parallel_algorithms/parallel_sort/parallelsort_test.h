@@ -0,0 +1,49 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef PARALLELSORT_TEST
+#define PARALLELSORT_TEST
+#include<random>
+#include<functional>
+#include"../../google_test/gtest.h"
+#include"parallelsort.h"
+
+using IntroductionToAlgorithm::ParallelAlgorithm::parallel_sort;
+
+//!test_parallel_sort：测试parallel_sort
+/*!
+*
+* 对各种长度、线程数量以及块的最小长度，结果与`std::sort`相同
+*/
+TEST(ParallelSortTest,test_parallel_sort)
+{
+    std::mt19937 gen(12);
+    std::uniform_int_distribution<int> dist(-1000,1000);
+    for(std::size_t length:{0,1,2,17,1000,10007})
+        for(std::size_t thread_num:{1,2,3,5,8})
+            for(std::size_t min_block_size:{1,100,8192})
+            {
+                std::vector<int> data(length);
+                for(auto& value:data) value=dist(gen);
+                std::vector<int> expected=data;
+                std::sort(expected.begin(),expected.end(),std::greater<int>());
+                parallel_sort(data.begin(),data.end(),thread_num,std::greater<int>(),min_block_size);
+                EXPECT_EQ(data,expected)<<"length:"<<length<<"\tthread_num:"<<thread_num<<"\tmin_block_size:"<<min_block_size;
+            }
+}
+#endif // PARALLELSORT_TEST
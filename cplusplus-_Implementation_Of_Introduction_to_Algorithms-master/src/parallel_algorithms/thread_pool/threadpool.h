@@ -0,0 +1,152 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef THREADPOOL
+#define THREADPOOL
+#include<thread>
+#include<mutex>
+#include<condition_variable>
+#include<functional>
+#include<deque>
+#include<vector>
+#include<exception>
+#include<stdexcept>
+#include<cstddef>
+#include"../../header.h"
+#include"../parallel_for/parallelfor.h"
+namespace IntroductionToAlgorithm
+{
+    namespace ParallelAlgorithm
+    {
+        //!ThreadPool：固定数量工作线程的线程池
+        /*!
+        *
+        * `parallel_for`每次调用都会创建、销毁线程，且把区间静态地均匀划分给各个线程。当各个任务的耗时差别很大时（例如对不同的源点执行dijkstra），
+        * 更适合先创建一组工作线程，再把任务逐个交给它们：
+        *
+        * - `submit(task)`将一个任务放入任务队列，空闲的工作线程按照提交的次序取出任务执行
+        * - `wait()`阻塞直到所有已提交的任务都执行完毕。若有任务抛出了异常，则将第一个异常重新抛出
+        * - 析构时等待所有已提交的任务执行完毕，然后结束工作线程
+        *
+        * 任务抛出的异常不会终止工作线程。
+        */
+        class ThreadPool
+        {
+        public:
+            typedef std::function<void()> TaskType; /*!< 任务类型*/
+            //!显式构造函数
+            /*!
+            * \param thread_num:工作线程的数量。若为0则使用硬件支持的并发线程数量
+            */
+            explicit ThreadPool(std::size_t thread_num=0):_stop(false),_running(0)
+            {
+                std::size_t num=thread_num_or_default(thread_num);
+                _workers.reserve(num);
+                for(std::size_t i=0;i<num;i++)
+                    _workers.emplace_back([this](){_work();});
+            }
+            //!析构函数：等待所有已提交的任务执行完毕，然后结束工作线程
+            ~ThreadPool()
+            {
+                {
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    _done.wait(lock,[this](){return _tasks.empty()&&_running==0;});
+                    _stop=true;
+                }
+                _ready.notify_all();
+                for(auto& worker:_workers)
+                    worker.join();
+            }
+            ThreadPool(const ThreadPool&)=delete;
+            ThreadPool& operator=(const ThreadPool&)=delete;
+
+            //!thread_num:返回工作线程的数量
+            std::size_t thread_num() const {return _workers.size();}
+            //!submit:提交一个任务
+            /*!
+            * \param task:任务，必须非空，否则抛出异常
+            * \return: void
+            */
+            void submit(TaskType task)
+            {
+                if(!task)
+                    throw std::invalid_argument("submit error: task must not be empty!");
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _tasks.push_back(std::move(task));
+                }
+                _ready.notify_one();
+            }
+            //!wait:等待所有已提交的任务执行完毕
+            /*!
+            * \return: void
+            *
+            * 若自上一次`wait()`以来有任务抛出了异常，则将第一个异常重新抛出，并清除它
+            */
+            void wait()
+            {
+                std::exception_ptr error;
+                {
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    _done.wait(lock,[this](){return _tasks.empty()&&_running==0;});
+                    std::swap(error,_error);
+                }
+                if(error) std::rethrow_exception(error);
+            }
+        private:
+            //!_work:工作线程的主循环
+            void _work()
+            {
+                while(true)
+                {
+                    TaskType task;
+                    {
+                        std::unique_lock<std::mutex> lock(_mutex);
+                        _ready.wait(lock,[this](){return _stop||!_tasks.empty();});
+                        if(_tasks.empty()) return;          //_stop且没有剩余任务
+                        task=std::move(_tasks.front());
+                        _tasks.pop_front();
+                        _running++;
+                    }
+                    std::exception_ptr error;
+                    try{
+                        task();
+                    }catch(...){
+                        error=std::current_exception();
+                    }
+                    {
+                        std::lock_guard<std::mutex> lock(_mutex);
+                        if(error&&!_error) _error=error;
+                        _running--;
+                        if(_tasks.empty()&&_running==0) _done.notify_all();
+                    }
+                }
+            }
+
+            std::vector<std::thread> _workers;  /*!< 工作线程*/
+            std::deque<TaskType> _tasks;        /*!< 任务队列*/
+            std::mutex _mutex;                  /*!< 保护任务队列与各个状态的互斥量*/
+            std::condition_variable _ready;     /*!< 有新任务或者线程池停止时通知工作线程*/
+            std::condition_variable _done;      /*!< 所有任务执行完毕时通知等待者*/
+            bool _stop;                         /*!< 线程池是否停止*/
+            std::size_t _running;               /*!< 正在执行的任务数量*/
+            std::exception_ptr _error;          /*!< 第一个抛出的异常*/
+        };
+    }
+}
+#endif // THREADPOOL
@@ -0,0 +1,80 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef THREADPOOL_TEST
+#define THREADPOOL_TEST
+#include<atomic>
+#include<stdexcept>
+#include"../../google_test/gtest.h"
+#include"threadpool.h"
+
+using IntroductionToAlgorithm::ParallelAlgorithm::ThreadPool;
+
+//!test_thread_pool：测试ThreadPool
+/*!
+*
+* 每个任务恰好执行一次；`wait()`之后所有任务都已经完成；线程池可以反复使用
+*/
+TEST(ThreadPoolTest,test_thread_pool)
+{
+    for(std::size_t thread_num:{1,2,4})
+    {
+        ThreadPool pool(thread_num);
+        EXPECT_EQ(pool.thread_num(),thread_num);
+        for(int round=0;round<3;round++)
+        {
+            std::vector<std::atomic<int>> counts(1000);
+            for(auto& count:counts) count=0;
+            for(std::size_t i=0;i<counts.size();i++)
+                pool.submit([&counts,i](){counts[i]++;});
+            pool.wait();
+            for(std::size_t i=0;i<counts.size();i++)
+                EXPECT_EQ(counts[i],1)<<"thread_num:"<<thread_num<<"\tround:"<<round<<"\ti:"<<i;
+        }
+    }
+    //*********  析构时等待已提交的任务  **********
+    std::atomic<int> count(0);
+    {
+        ThreadPool pool(2);
+        for(int i=0;i<100;i++)
+            pool.submit([&count](){count++;});
+    }
+    EXPECT_EQ(count,100);
+}
+//!test_thread_pool_exception：测试ThreadPool
+/*!
+*
+* 任务抛出的异常由`wait()`重新抛出，且不影响其他任务以及之后的任务
+*/
+TEST(ThreadPoolTest,test_thread_pool_exception)
+{
+    ThreadPool pool(2);
+    EXPECT_THROW(pool.submit(ThreadPool::TaskType()),std::invalid_argument);
+    std::atomic<int> count(0);
+    for(int i=0;i<10;i++)
+        pool.submit([&count,i](){
+            if(i==3) throw std::runtime_error("task error");
+            count++;
+        });
+    EXPECT_THROW(pool.wait(),std::runtime_error);
+    EXPECT_EQ(count,9);
+    pool.submit([&count](){count++;});
+    EXPECT_NO_THROW(pool.wait());
+    EXPECT_EQ(count,10);
+}
+#endif // THREADPOOL_TEST
@@ -0,0 +1,210 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef IDMINQUEUE
+#define IDMINQUEUE
+#include<vector>
+#include<stdexcept>
+#include<cstddef>
+#include"../../header.h"
+
+namespace IntroductionToAlgorithm
+{
+    namespace QueueAlgorithm
+    {
+
+        //!IDMinQueue：以整数`id`为元素的最小优先级队列，算法导论第6章6.5节
+        /*!
+        *
+        * `IndexedMinQueue`存放的是`std::shared_ptr<T>`，关键字保存在元素自身之中，通过可调用对象读写。因此多个线程不能同时用它处理同一组顶点对象。
+        *
+        * `IDMinQueue`中的元素就是`[0,capacity)`之间的整数`id`，关键字由队列自己保存在数组`_keys`中：
+        *
+        * - 堆`_heap`中存放的是`id`，映射表`_index`记录每个`id`在堆中的位置，-1表示不在队列中
+        * - 不使用`std::function`与`std::shared_ptr`，每个线程可以各自拥有一个队列，互不干扰
+        * - `clear()`只重置队列中剩余元素的映射表项，时间复杂度为 O(size)，因此同一个队列可以被反复使用（例如对每个源点执行一次dijkstra）
+        *
+        * 各操作的时间复杂度与`IndexedMinQueue`相同：`insert`、`extract_min`、`decreate_key`为 O(lgn)，`is_inqueue`、`key`为 O(1)
+        *
+        */
+        template<typename TKeyType>
+        class IDMinQueue
+        {
+        public:
+            //!显式构造函数
+            /*!
+            * \param capacity:`id`的上界，队列中元素的`id`必须在`[0,capacity)`之间
+            */
+            explicit IDMinQueue(std::size_t capacity):_keys(capacity),_index(capacity,-1)
+            {
+                _heap.reserve(capacity);
+            }
+            //!min:返回关键字最小的元素
+            /*!
+            * \return 关键字最小的元素的`id`。若队列为空则抛出异常
+            *
+            * - 时间复杂度 O(1)
+            */
+            std::size_t min() const
+            {
+                if(_heap.empty())
+                    throw std::invalid_argument("min error: queue is empty!");
+                return _heap[0];
+            }
+            //!extract_min:删除队列中关键字最小的元素，并返回它
+            /*!
+            * \return 关键字最小的元素的`id`。若队列为空则抛出异常
+            *
+            * - 时间复杂度 O(lgn)
+            */
+            std::size_t extract_min()
+            {
+                if(_heap.empty())
+                    throw std::invalid_argument("extract_min error: queue is empty!");
+                std::size_t result=_heap[0];
+                _index[result]=-1;
+                std::size_t last=_heap.back();
+                _heap.pop_back();
+                if(!_heap.empty())
+                    _sift_down(0,last);                         //队尾元素移动到队首，维护最小堆的性质
+                return result;
+            }
+            //!insert:向队列中插入一个元素
+            /*!
+            * \param id: 待插入元素，必须在`[0,capacity)`之间且不在队列中，否则抛出异常
+            * \param key: 待插入元素的关键字
+            * \return: void
+            *
+            * - 时间复杂度 O(lgn)
+            */
+            void insert(std::size_t id,TKeyType key)
+            {
+                if(id>=_index.size())
+                    throw std::invalid_argument("insert error: id must < capacity!");
+                if(_index[id]>=0)
+                    throw std::invalid_argument("insert error: id already in queue!");
+                _keys[id]=key;
+                _heap.push_back(id);
+                _sift_up(_heap.size()-1,id);
+            }
+            //!decreate_key:缩减队列中某个元素的关键字
+            /*!
+            * \param id: 待缩减的元素，必须在队列中，否则抛出异常
+            * \param key：新的关键字，不能大于原关键字，否则抛出异常
+            * \return: void
+            *
+            * - 时间复杂度 O(lgn)
+            */
+            void decreate_key(std::size_t id,TKeyType key)
+            {
+                if(!is_inqueue(id))
+                    throw std::invalid_argument("decreate_key error: id not in queue!");
+                if(key>_keys[id])
+                    throw std::invalid_argument("decreate_key error: new key greater than old key!");
+                _keys[id]=key;
+                _sift_up(_index[id],id);
+            }
+            //!insert_or_decreate_key:若元素不在队列中则插入它，否则将它的关键字缩减为`key`
+            /*!
+            * \param id: 元素，必须在`[0,capacity)`之间，否则抛出异常
+            * \param key：关键字。若元素已经在队列中，则它不能大于原关键字，否则抛出异常
+            * \return: void
+            *
+            * 这是dijkstra算法的松弛操作所需要的操作。时间复杂度 O(lgn)
+            */
+            void insert_or_decreate_key(std::size_t id,TKeyType key)
+            {
+                if(is_inqueue(id)) decreate_key(id,key);
+                else insert(id,key);
+            }
+            //!key:返回队列中某个元素的关键字
+            /*!
+            * \param id: 元素，必须在队列中，否则抛出异常
+            * \return: 元素的关键字
+            */
+            TKeyType key(std::size_t id) const
+            {
+                if(!is_inqueue(id))
+                    throw std::invalid_argument("key error: id not in queue!");
+                return _keys[id];
+            }
+            //!is_inqueue:返回指定元素是否在队列中
+            /*!
+            * \param id: 元素。若它不在`[0,capacity)`之间则返回false
+            * \return: 指定元素是否在队列中
+            */
+            bool is_inqueue(std::size_t id) const
+            {
+                return id<_index.size()&&_index[id]>=0;
+            }
+            //!is_empty:返回队列是否为空
+            bool is_empty() const {return _heap.empty();}
+            //!size:返回队列长度
+            std::size_t size() const {return _heap.size();}
+            //!clear:清空队列
+            /*!
+            * 只重置队列中剩余元素的映射表项，时间复杂度 O(size)
+            */
+            void clear()
+            {
+                for(auto id:_heap) _index[id]=-1;
+                _heap.clear();
+            }
+        private:
+            //!_sift_up:将元素`id`从堆中位置`index`处上移到合适的位置
+            void _sift_up(std::size_t index,std::size_t id)
+            {
+                while(index!=0)
+                {
+                    std::size_t parent=(index-1)>>1;
+                    if(!(_keys[id]<_keys[_heap[parent]])) break;
+                    _place(index,_heap[parent]);                     //父节点下移
+                    index=parent;
+                }
+                _place(index,id);
+            }
+            //!_sift_down:将元素`id`从堆中位置`index`处下移到合适的位置
+            void _sift_down(std::size_t index,std::size_t id)
+            {
+                std::size_t size=_heap.size();
+                while(true)
+                {
+                    std::size_t child=(index<<1)+1;
+                    if(child>=size) break;
+                    if(child+1<size&&_keys[_heap[child+1]]<_keys[_heap[child]])
+                        child++;                                     //右孩子较小
+                    if(!(_keys[_heap[child]]<_keys[id])) break;
+                    _place(index,_heap[child]);                      //较小的子节点上移
+                    index=child;
+                }
+                _place(index,id);
+            }
+            //!_place:将元素放置在堆中指定位置，并更新映射表
+            void _place(std::size_t index,std::size_t id)
+            {
+                _heap[index]=id;
+                _index[id]=static_cast<int>(index);
+            }
+
+            std::vector<TKeyType> _keys;    /*!< 各个`id`的关键字*/
+            std::vector<int> _index;        /*!< `id`到它在`_heap`中位置的映射，-1表示不在队列中*/
+            std::vector<std::size_t> _heap; /*!< 最小堆，存放的是`id`*/
+        };
+    }
+}
+#endif // IDMINQUEUE
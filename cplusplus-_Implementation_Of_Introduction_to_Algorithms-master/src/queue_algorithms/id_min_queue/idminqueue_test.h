@@ -0,0 +1,116 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef IDMINQUEUE_TEST
+#define IDMINQUEUE_TEST
+#include<random>
+#include<algorithm>
+#include"../../google_test/gtest.h"
+#include"idminqueue.h"
+
+using IntroductionToAlgorithm::QueueAlgorithm::IDMinQueue;
+namespace  {
+    const int IDQ_NUM=100;
+}
+
+//!IDMinQueueTest:测试类，用于为测试提供基础数据
+/*!
+*
+* `IDMinQueueTest`是 `::testing::Test` 的子类。它主要用于为每一个`TEST_F`准备测试环境
+*/
+class IDMinQueueTest:public ::testing::Test
+{
+protected:
+    void SetUp()
+    {
+        _queue=std::make_shared<IDMinQueue<int>>(IDQ_NUM);
+    }
+    void TearDown(){}
+    std::shared_ptr<IDMinQueue<int>> _queue; /*!< 指向一个最小优先级队列*/
+};
+
+//!IDMinQueueTest:测试以整数id为元素的最小优先级队列
+/*!
+*
+* `test_insert_extract`：测试`insert(...)`、`min()`、`extract_min()`、`clear()`成员方法
+*/
+TEST_F(IDMinQueueTest,test_insert_extract)
+{
+    EXPECT_THROW(_queue->min(),std::invalid_argument);
+    EXPECT_THROW(_queue->extract_min(),std::invalid_argument);
+    EXPECT_THROW(_queue->insert(IDQ_NUM,0),std::invalid_argument);
+    for(int i=0;i<IDQ_NUM;i++)
+        _queue->insert(i,(i*37)%IDQ_NUM); //关键字为0~IDQ_NUM-1的一个排列
+    EXPECT_EQ(_queue->size(),IDQ_NUM);
+    EXPECT_THROW(_queue->insert(0,0),std::invalid_argument); //id重复
+    for(int i=0;i<IDQ_NUM;i++)
+    {
+        std::size_t id=_queue->min();
+        EXPECT_EQ(_queue->key(id),i);
+        EXPECT_EQ(_queue->extract_min(),id);
+        EXPECT_EQ((id*37)%IDQ_NUM,i);
+        EXPECT_FALSE(_queue->is_inqueue(id));
+        EXPECT_THROW(_queue->key(id),std::invalid_argument);
+    }
+    EXPECT_TRUE(_queue->is_empty());
+    //*********  clear之后可以重新插入  **********
+    for(int i=0;i<10;i++)
+        _queue->insert(i,-i);
+    _queue->clear();
+    EXPECT_TRUE(_queue->is_empty());
+    for(int i=0;i<10;i++)
+        EXPECT_FALSE(_queue->is_inqueue(i));
+    _queue->insert(3,5);
+    EXPECT_EQ(_queue->extract_min(),3);
+}
+
+//!IDMinQueueTest:测试以整数id为元素的最小优先级队列
+/*!
+*
+* `test_decreate_key`：测试`decreate_key(...)`、`insert_or_decreate_key(...)`成员方法：随机操作序列的结果与排序相同
+*/
+TEST_F(IDMinQueueTest,test_decreate_key)
+{
+    EXPECT_THROW(_queue->decreate_key(0,0),std::invalid_argument); //不在队列中
+    _queue->insert(0,10);
+    EXPECT_THROW(_queue->decreate_key(0,11),std::invalid_argument); //关键字变大
+    _queue->clear();
+
+    std::mt19937 gen(9);
+    std::uniform_int_distribution<int> id_dist(0,IDQ_NUM-1);
+    std::vector<int> keys(IDQ_NUM,1000000);
+    for(int step=0;step<1000;step++)
+    {
+        int id=id_dist(gen);
+        int key=keys[id]-id_dist(gen)-1;
+        _queue->insert_or_decreate_key(id,key);
+        keys[id]=key;
+    }
+    std::vector<std::pair<int,int>> expected;
+    for(int id=0;id<IDQ_NUM;id++)
+        if(_queue->is_inqueue(id))
+            expected.push_back(std::make_pair(keys[id],id));
+    std::sort(expected.begin(),expected.end());
+    for(const auto& item:expected)
+    {
+        int id=_queue->extract_min();
+        EXPECT_EQ(keys[id],item.first);
+    }
+    EXPECT_TRUE(_queue->is_empty());
+}
+#endif // IDMINQUEUE_TEST
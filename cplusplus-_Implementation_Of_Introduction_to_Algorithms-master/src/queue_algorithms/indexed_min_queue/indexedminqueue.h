@@ -0,0 +1,297 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef INDEXEDMINQUEUE
+#define INDEXEDMINQUEUE
+#include<vector>
+#include<memory>
+#include<functional>
+#include<stdexcept>
+#include"../../header.h"
+using IntroductionToAlgorithm::GraphAlgorithm::unlimit;
+
+namespace IntroductionToAlgorithm
+{
+    namespace QueueAlgorithm
+    {
+
+        //!IndexedMinQueue：带索引的最小优先级队列，算法导论第6章6.5节
+        /*!
+        *
+        * 它的接口与`MinQueue`相同。区别在于：队列额外维护了一个从元素`id`到它在堆中位置的映射表`_index`，
+        * 每次堆中元素交换位置时同步更新该映射表。因此：
+        *
+        * - index_inqueue(S,x)、is_inqueue(S,x)的时间复杂度为 O(1)（`MinQueue`为 O(n) 的线性扫描）
+        * - decreate_key(S,x,k)的时间复杂度为 O(lgn)
+        *
+        * 本算法的实现时，有以下几种变化：
+        *
+        * - 增加了一个特殊的可调用对象`_getID`:它是一个std::function<std::size_t(std::shared_ptr<T>)>类型的对象，返回元素的`id`。
+        *   要求队列中同时存在的元素的`id`互不相同。`_index`的大小随着插入元素的最大`id`自动增长。
+        * - 队列容量只增不减。`extract_min`不再缩减`_data`，从而避免在队列长度反复跨越容量1/4附近时反复`resize`
+        * - `heapify`采用迭代而不是递归实现
+        *
+        */
+        template<typename T,typename TKeyType>
+        class IndexedMinQueue
+        {
+        public:
+            typedef std::function<bool (std::shared_ptr<T>,std::shared_ptr<T>)> CompareType ;   /*!< 一个可调用对象类型，该类型的对象可用于比较两个std::shared_ptr<T>的小于比较*/
+            typedef std::function<TKeyType&(std::shared_ptr<T>)> GetKeyType;                    /*!< 一个可调用对象，该类型的对象可用于获取std::shared_ptr<T>的关键字，并修改该关键字（返回的是关键字的引用）*/
+            typedef std::function<std::size_t(std::shared_ptr<T>)> GetIDType;                   /*!< 一个可调用对象，该类型的对象可用于获取std::shared_ptr<T>的`id`*/
+            //!显式构造函数
+            /*!
+            *  \param compare:一个可调用对象，可用于比较两个std::shared_ptr<T>对象的小于比较
+            *  \param getKey：一个可调用对象，它的参数为std::shared_ptr<T>，返回TKey&。通过它的返回值可以获取T的key，也可以修改T的key
+            *  \param getID：一个可调用对象，它的参数为std::shared_ptr<T>，返回T的`id`
+            *
+            */
+            IndexedMinQueue(CompareType compare,GetKeyType getKey,GetIDType getID):_size(0),_compare(compare),_getKey(getKey),_getID(getID){}
+            //!显式构造函数
+            /*!
+            * \param reseve_size:指定队列的初始容量，同时也是`id`映射表的初始大小
+            * \param compare:一个可调用对象，可用于比较两个std::shared_ptr<T>对象的小于比较
+            * \param getKey：一个可调用对象，它的参数为std::shared_ptr<T>，返回TKey&。通过它的返回值可以获取T的key，也可以修改T的key
+            * \param getID：一个可调用对象，它的参数为std::shared_ptr<T>，返回T的`id`
+            *
+            */
+            IndexedMinQueue(std::size_t reseve_size,CompareType compare,GetKeyType getKey,GetIDType getID):_size(0),_compare(compare),_getKey(getKey),_getID(getID)
+            {
+                _data.reserve(reseve_size);
+                _index.resize(reseve_size,-1);
+            }
+            //!min:返回最小值
+            /*!
+            * \return 最小值的强引用。如果队列为空，则返回一个空引用
+            *
+            * - 时间复杂度 O(1)
+            *
+            */
+            std::shared_ptr<T> min()
+            {
+                if(!_size)
+                    return std::shared_ptr<T>();
+                return _data[0];
+            }
+            //!extract_min:删除队列中最小值，并返回最小值
+            /*!
+            *  \return 最小值的强引用。如果队列为空，则返回一个空引用
+            *
+            * 将队尾元素移动到队首，然后执行`heapify(0)`维持最小堆性质。被弹出的元素在`_index`中的位置被置为-1。
+            *
+            * 与`MinQueue`不同，这里不会缩减队列容量。
+            *
+            * - 时间复杂度 O(h),h为堆的高度
+            * - 原地操作
+            */
+            std::shared_ptr<T> extract_min()
+            {
+                if(!_size)
+                    return std::shared_ptr<T>();
+                auto result=_data[0];
+                _index[_getID(result)]=-1;
+                _size--;
+                if(_size)
+                {
+                    _place(0,_data[_size]);                         //队尾元素移动到队首
+                    heapify(0);                                     //维护最小堆的性质
+                }
+                _data[_size].reset();                               //释放队尾的强引用
+                return result;
+            }
+            //!insert:向队列中插入一个元素
+            /*!
+            * \param element: 待插入元素，如果元素为空引用则直接返回
+            * \return: 插入的元素在队列中的位置。若元素为空指针则返回-1
+            *
+            * 若元素的`id`已经在队列中，则抛出异常。插入过程与`MinQueue::insert`相同：
+            *
+            * - 保留待插入元素的`key`，同时将待插入语元素的`key`设置为无穷大，并将待插入元素插入到队尾
+            * - 执行`decreate_key(..)`操作
+            *
+            * - 时间复杂度 O(h)
+            * - 原地操作
+            */
+            int insert(std::shared_ptr<T> element)
+            {
+                if(! element)  return -1;
+                std::size_t id=_getID(element);
+                if(id>=_index.size()) _index.resize(id*2+2,-1);     //映射表太小就扩展
+                if(_index[id]>=0)
+                    throw std::invalid_argument("insert error: element id already in queue!");
+                if(_size==_data.size()) _data.resize(_size*2+2);    //队列容量太小就扩展为原来的两倍
+                int index=_size;
+                _size++;
+                _place(index,element);
+                TKeyType& k=_getKey(element);
+                TKeyType old_k=k;                                   //保留插入元素的键值
+                k=unlimit<TKeyType>();                              //将带插入的键值设置为无穷大，并将带插入元素插入到队尾
+                decreate_key(index,old_k);                          //缩减键值
+                return index;
+            }
+            //!is_empty:返回队列是否为空
+            /*!
+            * \return 队列是否为空
+            *
+            * - 时间复杂度 O(1)
+            *
+            */
+            bool is_empty()
+            {
+                return _size==0;
+            }
+            //!size:返回队列长度
+            /*!
+            * \return 队列中元素的数量
+            *
+            * - 时间复杂度 O(1)
+            *
+            */
+            std::size_t size()
+            {
+                return _size;
+            }
+            //!is_inqueue:返回指定元素是否在队列中
+            /*!
+            * \param element:待判定的元素，要求非空。若它为空引用则抛出异常
+            * \return 指定元素是否在队列中
+            *
+            * - 时间复杂度 O(1)
+            */
+            bool is_inqueue(std::shared_ptr<T> element)
+            {
+                return index_inqueue(element)>=0;
+            }
+            //!index_inqueue:返回指定元素在队列中的位置
+            /*!
+            * \param element:待判定的元素，要求非空。若它为空引用则抛出异常
+            * \return 指定元素在队列的std::vector中的位置；若不在队列中则返回-1
+            *
+            * 通过元素的`id`查询映射表`_index`，并确认该位置存放的确实是`element`
+            *
+            * - 时间复杂度 O(1)
+            */
+            int index_inqueue(std::shared_ptr<T> element)
+            {
+                if(!element) throw std::invalid_argument("index_inqueue error: element must not be nullptr!");
+                std::size_t id=_getID(element);
+                if(id>=_index.size()) return -1;
+                int index=_index[id];
+                if(index<0||_data[index]!=element) return -1;
+                return index;
+            }
+            //!decreate_key:缩减队列中某个元素的`key`
+            /*!
+            * \param element_index: 待缩减元素的下标
+            * \param new_key：待缩减元素的新`key`，类型为TKey
+            *
+            * 缩减之前先判断缩减是否有效，若无效则抛出异常。
+            *
+            * - 若`element_index`超过了队列大小，则抛出异常
+            * - 若`new_key`大于待缩减元素的`key`，则抛出异常
+            *
+            * 缩减过程与`MinQueue::decreate_key`相同。区别在于元素上移时不逐次交换，而是将父节点下移，最后一次性放置该元素，并同步更新`_index`
+            *
+            * - 时间复杂度 O(h)
+            * - 原地操作
+            */
+            void decreate_key(std::size_t element_index,TKeyType new_key)
+            {
+                if(element_index>=_size)
+                    throw std::invalid_argument("decreate_key error: element_index must less than _size!");
+                if(new_key>_getKey(_data[element_index]))
+                    throw std::invalid_argument("decreate_key error: new_key less _data.at(element_index)->key!");
+
+                auto element=_data[element_index];
+                _getKey(element)=new_key;
+                while(element_index!=0)                                                     //不在队列首
+                {
+                    std::size_t pIndex=(element_index-1)>>1;
+                    if(!_compare(element,_data[pIndex])) break;                             //父节点不大于当前节点则终止迭代
+                    _place(element_index,_data[pIndex]);                                    //父节点下移
+                    element_index=pIndex;
+                }
+                _place(element_index,element);
+            }
+            //!setupHeap:建堆
+            /*!
+            * \return void
+            *
+            * 从后一半的元素开始依次向前调用heapify操作
+            *
+            * - 时间复杂度 O(n)
+            * - 原地操作
+            */
+            void setupHeap()
+            {
+                if(_size<=1)
+                    return;
+                for(std::size_t index=(_size-1)/2+1;index>0;index--)
+                    heapify(index-1);
+            }
+            //!heapify：维持堆性质
+            /*!
+            * \param elementIndex : 要维持以该节点为根节点的子堆的堆性质
+            * \return void
+            *
+            * 与`MinQueue::heapify`相同，但采用迭代实现：将较小的子节点上移，直到找到该元素的位置后一次性放置，并同步更新`_index`
+            *
+            * - 时间复杂度 O(h)
+            * - 原地操作
+            */
+            void heapify(std::size_t elementIndex)
+            {
+                if(elementIndex>=_size)                                         //越界直接返回
+                    return;
+                auto element=_data[elementIndex];
+                while(true)
+                {
+                    std::size_t minIndex=(elementIndex<<1)+1;                   //左孩子
+                    if(minIndex>=_size) break;
+                    if(minIndex+1<_size&&_compare(_data[minIndex+1],_data[minIndex]))
+                        minIndex++;                                             //右孩子较小
+                    if(!_compare(_data[minIndex],element)) break;               //子节点不小于该节点，维持了性质
+                    _place(elementIndex,_data[minIndex]);                       //较小的子节点上移
+                    elementIndex=minIndex;
+                }
+                _place(elementIndex,element);
+            }
+        private:
+            //!_place:将元素放置在堆中指定位置，并更新映射表
+            /*!
+            * \param index : 堆中的位置
+            * \param element: 待放置的元素
+            * \return void
+            *
+            */
+            void _place(std::size_t index,std::shared_ptr<T> element)
+            {
+                _data[index]=element;
+                _index[_getID(element)]=index;
+            }
+
+            std::vector<std::shared_ptr<T>> _data;  /*!< 最小优先级队列的数据*/
+            std::vector<int> _index; /*!< 元素`id`到它在`_data`中位置的映射，-1表示不在队列中*/
+            std::size_t _size;  /*!<  堆大小*/
+            CompareType _compare;  /*!< 一个可调用对象，可用于比较两个std::shared_ptr<T>的小于比较*/
+            GetKeyType _getKey; /*!<  一个可调用对象，可用于获取std::shared_ptr<T>的关键字，并修改该关键字（返回的是关键字的引用）*/
+            GetIDType _getID; /*!<  一个可调用对象，可用于获取std::shared_ptr<T>的`id`*/
+        };
+    }
+}
+#endif // INDEXEDMINQUEUE
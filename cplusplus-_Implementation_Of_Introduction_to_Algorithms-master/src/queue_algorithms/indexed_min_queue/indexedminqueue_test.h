@@ -0,0 +1,154 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef INDEXEDMINQUEUE_TEST
+#define INDEXEDMINQUEUE_TEST
+#include"../../google_test/gtest.h"
+#include"indexedminqueue.h"
+
+using IntroductionToAlgorithm::QueueAlgorithm::IndexedMinQueue;
+namespace  {
+    const int IQ_NUM=100;
+}
+
+
+//!IDNode:用于测试的类型
+struct IDNode
+{
+    IDNode(int k,std::size_t i):key(k),id(i){}
+    double key; /*!< key存放数据 */
+    std::size_t id; /*!< 结点的id */
+};
+
+//!IndexedMinQueueTest:测试类，用于为测试提供基础数据
+/*!
+*
+* `IndexedMinQueueTest`是 `::testing::Test` 的子类。它主要用于为每一个`TEST_F`准备测试环境
+*/
+class IndexedMinQueueTest:public ::testing::Test
+{
+public:
+    typedef IndexedMinQueue<IDNode,double> QueueType;                                               /*!< 存放的是IDNode*数据的最小优先级队列，IDNode的关键字是double类型 */
+protected:
+    void SetUp()
+    {
+        QueueType::CompareType compare=[](std::shared_ptr<IDNode> first,std::shared_ptr<IDNode> second){return first->key<second->key;};
+        QueueType::GetKeyType get_key=[](std::shared_ptr<IDNode> node)->double& {return node->key;};
+        QueueType::GetIDType get_id=[](std::shared_ptr<IDNode> node){return node->id;};
+        _queue=std::make_shared<QueueType>(compare,get_key,get_id);
+        for(int i=0;i<IQ_NUM;i++)
+            _nodes.push_back(std::make_shared<IDNode>((i*37)%IQ_NUM,i)); //关键字为0~IQ_NUM-1的一个排列
+    }
+    void TearDown(){}
+    std::shared_ptr<QueueType> _queue;                                                              /*!< 指向一个最小优先级队列*/
+    std::vector<std::shared_ptr<IDNode>> _nodes;                                                    /*!< 待插入的结点*/
+};
+//!IndexedMinQueueTest:测试带索引的最小优先级队列
+/*!
+*
+* `test_insert_extract`：测试`insert(...)`、`min()`、`extract_min()`成员方法
+*/
+TEST_F(IndexedMinQueueTest,test_insert_extract)
+{
+    EXPECT_FALSE(_queue->min());
+    EXPECT_FALSE(_queue->extract_min());
+    EXPECT_EQ(_queue->insert(std::shared_ptr<IDNode>()),-1);
+    for(const auto& node:_nodes)
+        _queue->insert(node);
+    EXPECT_EQ(_queue->size(),IQ_NUM);
+    EXPECT_THROW(_queue->insert(std::make_shared<IDNode>(0,0)),std::invalid_argument); //id重复
+    for(int i=0;i<IQ_NUM;i++)
+    {
+        EXPECT_NEAR(_queue->min()->key,i,0.001)<<"i:"<<i;
+        auto node=_queue->extract_min();
+        EXPECT_NEAR(node->key,i,0.001)<<"i:"<<i;
+        EXPECT_FALSE(_queue->is_inqueue(node));
+    }
+    EXPECT_TRUE(_queue->is_empty());
+    //************ 弹出后可以重新插入  ***********
+    EXPECT_EQ(_queue->insert(_nodes[0]),0);
+    EXPECT_TRUE(_queue->is_inqueue(_nodes[0]));
+}
+//!IndexedMinQueueTest:测试带索引的最小优先级队列
+/*!
+*
+* `test_index_inqueue`：测试`index_inqueue(...)`、`is_inqueue(...)`成员方法：在插入、弹出、缩减关键字后映射表始终与堆一致
+*/
+TEST_F(IndexedMinQueueTest,test_index_inqueue)
+{
+    EXPECT_THROW(_queue->index_inqueue(std::shared_ptr<IDNode>()),std::invalid_argument);
+    EXPECT_EQ(_queue->index_inqueue(_nodes[0]),-1);
+    for(const auto& node:_nodes)
+        _queue->insert(node);
+    EXPECT_EQ(_queue->index_inqueue(std::make_shared<IDNode>(0,0)),-1);   //id相同但不是同一个元素
+    EXPECT_EQ(_queue->index_inqueue(std::make_shared<IDNode>(0,IQ_NUM*10)),-1);
+    for(int round=0;round<IQ_NUM/2;round++)
+    {
+        _queue->extract_min();
+        for(const auto& node:_nodes)
+        {
+            int index=_queue->index_inqueue(node);
+            if(index>=0)
+            {
+                EXPECT_LE(_queue->min()->key,node->key);
+            }
+        }
+    }
+    int count=0;
+    for(const auto& node:_nodes)
+        if(_queue->is_inqueue(node)) count++;
+    EXPECT_EQ(count,IQ_NUM/2);
+}
+//!IndexedMinQueueTest:测试带索引的最小优先级队列
+/*!
+*
+* `test_decreate_key`：测试`decreate_key(...)`成员方法
+*/
+TEST_F(IndexedMinQueueTest,test_decreate_key)
+{
+    for(const auto& node:_nodes)
+        _queue->insert(node);
+    EXPECT_THROW(_queue->decreate_key(IQ_NUM,0),std::invalid_argument);
+    auto node=_nodes[IQ_NUM-1];
+    EXPECT_THROW(_queue->decreate_key(_queue->index_inqueue(node),IQ_NUM),std::invalid_argument);
+    for(int i=IQ_NUM-1;i>=0;i--)                                        //依次将各结点的关键字缩减为 -i，则弹出顺序为id递减
+        _queue->decreate_key(_queue->index_inqueue(_nodes[i]),-i);
+    for(int i=IQ_NUM-1;i>=0;i--)
+    {
+        EXPECT_EQ(_queue->extract_min(),_nodes[i])<<"i:"<<i;
+    }
+}
+//!IndexedMinQueueTest:测试带索引的最小优先级队列
+/*!
+*
+* `test_setupHeap`：测试`setupHeap()`、`heapify(...)`成员方法：直接修改关键字后重新建堆
+*/
+TEST_F(IndexedMinQueueTest,test_setupHeap)
+{
+    for(const auto& node:_nodes)
+        _queue->insert(node);
+    for(const auto& node:_nodes)
+        node->key=IQ_NUM-node->id;
+    _queue->setupHeap();
+    for(int i=IQ_NUM-1;i>=0;i--)
+    {
+        EXPECT_EQ(_queue->extract_min(),_nodes[i])<<"i:"<<i;
+    }
+}
+
+#endif // INDEXEDMINQUEUE_TEST
@@ -0,0 +1,133 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef CONCURRENTDISJOINTSET
+#define CONCURRENTDISJOINTSET
+#include <atomic>
+#include <vector>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <cstddef>
+namespace IntroductionToAlgorithm
+{
+    namespace SetAlgorithm
+    {
+
+    //!ConcurrentDisjointSet：可以被多个线程同时修改的不相交集合森林
+    /*!
+    *
+    * 它管理元素`0,1,...n-1`，接口与`FlatDisjointSet`类似。区别在于父结点数组的每一项都是`std::atomic<std::size_t>`，
+    * `find_set`、`union_set`、`is_same_set`可以被多个线程同时调用而不需要加锁：
+    *
+    * - 按下标合并：合并时总是让下标较小的根指向下标较大的根，链接通过`compare_exchange`完成。若另一个线程抢先修改了该根，
+    *   则重新查找两个代表元素并重试。由于沿着父结点走下标严格递增，森林中不会出现环
+    * - 路径减半：`find_set`用`compare_exchange`令被访问的结点指向它的祖父结点。失败说明其他线程已经修改了它，直接忽略即可
+    *
+    * 它不维护集合的大小，也不维护集合数量：这些信息在并发修改时没有意义。
+    *
+    */
+    class ConcurrentDisjointSet
+    {
+    public:
+        //!显式构造函数：创建n个集合，每个集合只有一个元素
+        /*!
+        * \param n:元素数量
+        */
+        explicit ConcurrentDisjointSet(std::size_t n):_parent(n)
+        {
+            for(std::size_t i=0;i<n;i++) _parent[i].store(i,std::memory_order_relaxed);
+        }
+        //!find_set：返回元素所在集合的代表元素
+        /*!
+        * \param x:元素，必须小于元素数量，否则抛出异常
+        * \return: 代表元素
+        *
+        * 采用路径减半。若有其他线程同时调用`union_set`，则返回的代表元素可能在返回之后立即失效
+        */
+        std::size_t find_set(std::size_t x)
+        {
+            _check(x,"find_set");
+            while(true)
+            {
+                std::size_t parent=_parent[x].load(std::memory_order_acquire);
+                if(parent==x) return x;
+                std::size_t grand=_parent[parent].load(std::memory_order_acquire);
+                if(parent!=grand)
+                    _parent[x].compare_exchange_weak(parent,grand,std::memory_order_acq_rel,std::memory_order_relaxed);  //指向祖父结点
+                x=grand;
+            }
+        }
+        //!union_set：合并集合
+        /*!
+        * \param x:待合并的第一个集合中的某个元素，必须小于元素数量，否则抛出异常
+        * \param y:待合并的第二个集合中的某个元素，必须小于元素数量，否则抛出异常
+        * \return: 若x与y原来不在同一个集合中，则合并它们并返回true；否则返回false
+        *
+        * 多个线程同时合并相同的两个集合时，恰好有一个线程返回true
+        */
+        bool union_set(std::size_t x,std::size_t y)
+        {
+            while(true)
+            {
+                std::size_t root_x=find_set(x);
+                std::size_t root_y=find_set(y);
+                if(root_x==root_y) return false;
+                if(root_x>root_y) std::swap(root_x,root_y);
+                std::size_t expected=root_x;
+                if(_parent[root_x].compare_exchange_strong(expected,root_y,std::memory_order_acq_rel,std::memory_order_relaxed))
+                    return true;                     //root_x 仍然是根，链接成功
+            }
+        }
+        //!is_same_set：判断两个元素是否在同一个集合中
+        /*!
+        * \param x:第一个元素，必须小于元素数量，否则抛出异常
+        * \param y:第二个元素，必须小于元素数量，否则抛出异常
+        * \return: 两个元素是否在同一个集合中
+        *
+        * 若两次查找的代表元素不同，则确认x的代表元素在查找之后仍然是根，否则重试
+        */
+        bool is_same_set(std::size_t x,std::size_t y)
+        {
+            while(true)
+            {
+                std::size_t root_x=find_set(x);
+                std::size_t root_y=find_set(y);
+                if(root_x==root_y) return true;
+                if(_parent[root_x].load(std::memory_order_acquire)==root_x) return false;
+            }
+        }
+        //!element_num：返回元素数量
+        std::size_t element_num() const {return _parent.size();}
+
+    private:
+        //!_check：检查元素是否有效，无效则抛出异常
+        void _check(std::size_t x,const char* name) const
+        {
+            if(x>=_parent.size())
+                throw std::invalid_argument(std::string(name)+" error: element must < element_num!");
+        }
+
+        std::vector<std::atomic<std::size_t>> _parent;   /*!< 各元素的父结点*/
+    };
+
+  }
+}
+
+
+#endif // CONCURRENTDISJOINTSET
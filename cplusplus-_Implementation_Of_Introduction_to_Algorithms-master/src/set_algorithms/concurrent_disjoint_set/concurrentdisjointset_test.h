@@ -0,0 +1,98 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef CONCURRENTDISJOINTSET_TEST
+#define CONCURRENTDISJOINTSET_TEST
+#include <random>
+#include <thread>
+#include <atomic>
+#include "../../google_test/gtest.h"
+#include "concurrentdisjointset.h"
+#include "../flat_disjoint_set/flatdisjointset.h"
+using IntroductionToAlgorithm::SetAlgorithm::ConcurrentDisjointSet;
+using IntroductionToAlgorithm::SetAlgorithm::FlatDisjointSet;
+namespace {
+    const int CS_NUM=20;
+}
+
+//!ConcurrentDisjointSetTest:测试ConcurrentDisjointSet
+/*!
+*
+* `test_union_find`:单线程测试 find_set、union_set、is_same_set方法
+*/
+TEST(ConcurrentDisjointSetTest,test_union_find)
+{
+    ConcurrentDisjointSet sets(CS_NUM);
+    EXPECT_EQ(sets.element_num(),CS_NUM);
+    for(int i=0;i<CS_NUM;i++)
+        EXPECT_EQ(sets.find_set(i),i);
+    EXPECT_THROW(sets.find_set(CS_NUM),std::invalid_argument);
+    EXPECT_THROW(sets.union_set(0,CS_NUM),std::invalid_argument);
+
+    EXPECT_TRUE(sets.union_set(3,1));        //下标较小的根指向下标较大的根
+    EXPECT_EQ(sets.find_set(1),3);
+    EXPECT_FALSE(sets.union_set(1,3));
+    EXPECT_TRUE(sets.union_set(1,2));
+    EXPECT_EQ(sets.find_set(2),3);
+    EXPECT_TRUE(sets.is_same_set(1,2));
+    EXPECT_FALSE(sets.is_same_set(0,2));
+    //****  将所有元素合并成一个集合  ***
+    for(int i=1;i<CS_NUM;i++)
+        sets.union_set(i,i-1);
+    for(int i=0;i<CS_NUM;i++)
+        EXPECT_EQ(sets.find_set(i),CS_NUM-1);
+}
+
+//!ConcurrentDisjointSetTest:测试ConcurrentDisjointSet
+/*!
+*
+* `test_concurrent_union`:多个线程同时执行随机的合并，集合划分与顺序执行的 FlatDisjointSet 相同，且返回true的次数等于集合数量的减少量
+*/
+TEST(ConcurrentDisjointSetTest,test_concurrent_union)
+{
+    const int num=5000;
+    const int thread_num=4;
+    const int step_num=3000;
+    std::vector<std::pair<int,int>> pairs;
+    std::mt19937 gen(21);
+    std::uniform_int_distribution<int> dist(0,num-1);
+    for(int i=0;i<thread_num*step_num;i++)
+        pairs.push_back(std::make_pair(dist(gen),dist(gen)));
+
+    FlatDisjointSet expect(num);
+    for(const auto& pair:pairs)
+        expect.union_set(pair.first,pair.second);
+
+    ConcurrentDisjointSet sets(num);
+    std::atomic<int> union_num(0);
+    std::vector<std::thread> threads;
+    for(int t=0;t<thread_num;t++)
+        threads.emplace_back([&,t](){
+            for(int i=t*step_num;i<(t+1)*step_num;i++)
+                if(sets.union_set(pairs[i].first,pairs[i].second)) union_num++;
+        });
+    for(auto& thread:threads)
+        thread.join();
+    EXPECT_EQ(union_num,num-expect.set_num());
+    for(int step=0;step<2000;step++)
+    {
+        int x=dist(gen),y=dist(gen);
+        EXPECT_EQ(sets.is_same_set(x,y),expect.is_same_set(x,y));
+    }
+}
+#endif // CONCURRENTDISJOINTSET_TEST
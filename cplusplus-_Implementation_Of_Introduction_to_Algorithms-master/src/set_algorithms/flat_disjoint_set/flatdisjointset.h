@@ -0,0 +1,137 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef FLATDISJOINTSET
+#define FLATDISJOINTSET
+#include <vector>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <cstddef>
+namespace IntroductionToAlgorithm
+{
+    namespace SetAlgorithm
+    {
+
+    //!FlatDisjointSet：以整数为元素、用数组存储的不相交集合森林，算法导论第21章21.3节
+    /*!
+    *
+    * `DisjointSetNode`中每个结点都是一个堆上的对象，父节点为`std::shared_ptr`，`find_set`递归实现。当元素数量很大时，
+    * 指针追踪、引用计数以及递归的开销都很大。
+    *
+    * `FlatDisjointSet`管理元素`0,1,...n-1`，森林就是一个数组`_parent`：
+    *
+    * - 按大小合并：每个根结点记录它所在集合的元素数量，合并时让较小集合的根指向较大集合的根。它与按秩合并有相同的渐近性能
+    * - 路径减半：`find_set`沿着查找路径向上时，令每个被访问的结点指向它的祖父结点。它只需要一趟、不需要递归，
+    *   与路径压缩有相同的渐近性能
+    *
+    * `find_root`是不修改森林的查找。当森林不被修改时，多个线程可以同时调用它。
+    *
+    */
+    class FlatDisjointSet
+    {
+    public:
+        //!显式构造函数：创建n个集合，每个集合只有一个元素
+        /*!
+        * \param n:元素数量
+        */
+        explicit FlatDisjointSet(std::size_t n):_parent(n),_size(n,1),_set_num(n)
+        {
+            for(std::size_t i=0;i<n;i++) _parent[i]=i;
+        }
+        //!find_set：返回元素所在集合的代表元素
+        /*!
+        * \param x:元素，必须小于元素数量，否则抛出异常
+        * \return: 代表元素
+        *
+        * 采用路径减半
+        */
+        std::size_t find_set(std::size_t x)
+        {
+            _check(x,"find_set");
+            while(_parent[x]!=x)
+            {
+                _parent[x]=_parent[_parent[x]];     //指向祖父结点
+                x=_parent[x];
+            }
+            return x;
+        }
+        //!find_root：返回元素所在集合的代表元素，不修改森林
+        /*!
+        * \param x:元素，必须小于元素数量，否则抛出异常
+        * \return: 代表元素
+        */
+        std::size_t find_root(std::size_t x) const
+        {
+            _check(x,"find_root");
+            while(_parent[x]!=x) x=_parent[x];
+            return x;
+        }
+        //!union_set：合并集合
+        /*!
+        * \param x:待合并的第一个集合中的某个元素，必须小于元素数量，否则抛出异常
+        * \param y:待合并的第二个集合中的某个元素，必须小于元素数量，否则抛出异常
+        * \return: 若x与y原来不在同一个集合中，则合并它们并返回true；否则返回false
+        *
+        * 较小集合的根指向较大集合的根；若两者大小相同，则x的根指向y的根（与`DisjointSetNode::link_set`秩相等时的规则相同）
+        */
+        bool union_set(std::size_t x,std::size_t y)
+        {
+            std::size_t root_x=find_set(x);
+            std::size_t root_y=find_set(y);
+            if(root_x==root_y) return false;
+            if(_size[root_x]>_size[root_y])
+                std::swap(root_x,root_y);
+            _parent[root_x]=root_y;
+            _size[root_y]+=_size[root_x];
+            _set_num--;
+            return true;
+        }
+        //!is_same_set：判断两个元素是否在同一个集合中
+        bool is_same_set(std::size_t x,std::size_t y)
+        {
+            return find_set(x)==find_set(y);
+        }
+        //!set_size：返回元素所在集合的元素数量
+        std::size_t set_size(std::size_t x)
+        {
+            return _size[find_set(x)];
+        }
+        //!element_num：返回元素数量
+        std::size_t element_num() const {return _parent.size();}
+        //!set_num：返回集合数量
+        std::size_t set_num() const {return _set_num;}
+
+    private:
+        //!_check：检查元素是否有效，无效则抛出异常
+        void _check(std::size_t x,const char* name) const
+        {
+            if(x>=_parent.size())
+                throw std::invalid_argument(std::string(name)+" error: element must < element_num!");
+        }
+
+        std::vector<std::size_t> _parent;   /*!< 各元素的父结点*/
+        std::vector<std::size_t> _size;     /*!< 各根结点所在集合的元素数量（非根结点的值无意义）*/
+        std::size_t _set_num;               /*!< 集合数量*/
+    };
+
+  }
+}
+
+
+#endif // FLATDISJOINTSET
@@ -0,0 +1,96 @@
+/*
+ * Copyright 2016- huaxz <huaxz1986@163.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: huaxz1986@163.com (huaxz)
+ */
+#ifndef FLATDISJOINTSET_TEST
+#define FLATDISJOINTSET_TEST
+#include <random>
+#include "../../google_test/gtest.h"
+#include "flatdisjointset.h"
+#include "../disjoint_set/disjointset.h"
+using IntroductionToAlgorithm::SetAlgorithm::FlatDisjointSet;
+using IntroductionToAlgorithm::SetAlgorithm::DisjointSetNode;
+namespace {
+    const int FS_NUM=20;
+}
+
+//!FlatDisjointSetTest:测试FlatDisjointSet
+/*!
+*
+* `test_union_find`:测试 find_set、union_set、set_size、set_num方法
+*/
+TEST(FlatDisjointSetTest,test_union_find)
+{
+    FlatDisjointSet sets(FS_NUM);
+    EXPECT_EQ(sets.element_num(),FS_NUM);
+    EXPECT_EQ(sets.set_num(),FS_NUM);
+    for(int i=0;i<FS_NUM;i++)
+    {
+        EXPECT_EQ(sets.find_set(i),i);
+        EXPECT_EQ(sets.set_size(i),1);
+    }
+    EXPECT_THROW(sets.find_set(FS_NUM),std::invalid_argument);
+    EXPECT_THROW(sets.union_set(0,FS_NUM),std::invalid_argument);
+
+    EXPECT_TRUE(sets.union_set(0,1));        //大小相同：0的根指向1的根
+    EXPECT_EQ(sets.find_set(0),1);
+    EXPECT_FALSE(sets.union_set(1,0));
+    EXPECT_TRUE(sets.union_set(0,2));        //较小的集合{2}指向较大的集合{0,1}
+    EXPECT_EQ(sets.find_set(2),1);
+    EXPECT_EQ(sets.set_size(2),3);
+    EXPECT_EQ(sets.set_num(),FS_NUM-2);
+    //****  将所有元素按照偶数、奇数合并成两个集合  ***
+    for(int i=2;i<FS_NUM;i++)
+        sets.union_set(i,i-2);
+    EXPECT_EQ(sets.set_num(),1);             // 0,1已经在同一集合中
+    EXPECT_EQ(sets.set_size(FS_NUM-1),FS_NUM);
+    for(int i=0;i<FS_NUM;i++)
+        EXPECT_EQ(sets.find_root(i),sets.find_set(0));
+}
+
+//!FlatDisjointSetTest:测试FlatDisjointSet
+/*!
+*
+* `test_compare_with_node`:随机的合并序列中，FlatDisjointSet 与 DisjointSetNode 给出相同的集合划分
+*/
+TEST(FlatDisjointSetTest,test_compare_with_node)
+{
+    typedef DisjointSetNode<int> NodeType;
+    const int num=500;
+    FlatDisjointSet sets(num);
+    std::vector<std::shared_ptr<NodeType>> nodes;
+    for(int i=0;i<num;i++)
+    {
+        nodes.push_back(std::make_shared<NodeType>(std::make_shared<int>(i)));
+        NodeType::make_set(nodes.back());
+    }
+    std::mt19937 gen(11);
+    std::uniform_int_distribution<int> dist(0,num-1);
+    for(int step=0;step<400;step++)
+    {
+        int x=dist(gen),y=dist(gen);
+        bool different=NodeType::find_set(nodes[x])!=NodeType::find_set(nodes[y]);
+        EXPECT_EQ(sets.union_set(x,y),different);
+        NodeType::union_set(nodes[x],nodes[y]);
+    }
+    for(int step=0;step<1000;step++)
+    {
+        int x=dist(gen),y=dist(gen);
+        EXPECT_EQ(sets.is_same_set(x,y),NodeType::find_set(nodes[x])==NodeType::find_set(nodes[y]));
+    }
+}
+#endif // FLATDISJOINTSET_TEST